@@ -159,6 +159,13 @@ struct _ple_locator_t {
   ple_lnum_t    n_exterior;         /* Number of local points not located */
   ple_lnum_t   *exterior_list;      /* List of points not located */
 
+  ple_lnum_t    location_shift;     /* Cumulative shift applied to
+                                       distant point locations */
+
+  double       *extents_cache;      /* Enlarged element and point extents
+                                       of all ranks from the last relocation
+                                       (size: 4*dim*comm_size), or NULL */
+
   /* Timing information (2 fields/time; 0: total; 1: communication) */
 
   double  location_wtime[2];       /* Location Wall-clock time */
@@ -269,6 +276,11 @@ typedef int
 
 static int _ple_locator_async_threshold = 128;
 
+/* relative margin added to extents exchanged for relocation, so that they
+   may be reused as long as mesh and point displacements remain small */
+
+static double _ple_locator_extents_margin = 0.1;
+
 /* global logging function */
 
 static ple_locator_log_t   *_ple_locator_log_func = NULL;
@@ -562,6 +574,77 @@ _within_extents(int                dim,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Test if extents are contained within other extents
+ *
+ * Empty extents (with min > max) are contained in any extents.
+ *
+ * parameters:
+ *   dim             <-- spatial (coordinates) dimension
+ *   extents_o       <-- outer extents: x_min, y_min, ..., x_max, y_max, ...
+ *                       size: dim*2
+ *   extents_i       <-- inner extents: x_min, y_min, ..., x_max, y_max, ...
+ *                       size: dim*2
+ *
+ * returns:
+ *   true if extents_i lies within extents_o, false otherwise
+ *----------------------------------------------------------------------------*/
+
+inline static _Bool
+_contains_extents(int           dim,
+                  const double  extents_o[],
+                  const double  extents_i[])
+{
+  int i;
+
+  for (i = 0; i < dim; i++) {
+    if (extents_i[i] > extents_i[i + dim])
+      return true;
+  }
+
+  for (i = 0; i < dim; i++) {
+    if (   (extents_i[i] < extents_o[i])
+        || (extents_i[i + dim] > extents_o[i + dim]))
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Enlarge non-empty extents by a fraction of their largest dimension.
+ *
+ * parameters:
+ *   dim             <-- spatial (coordinates) dimension
+ *   margin          <-- relative margin
+ *   extents         <-> extents: x_min, y_min, ..., x_max, y_max, ...
+ *                       size: dim*2
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_enlarge_extents(int      dim,
+                 double   margin,
+                 double   extents[])
+{
+  int i;
+  double l_max = 0.;
+
+  for (i = 0; i < dim; i++) {
+    if (extents[i] > extents[i + dim])
+      return;
+    if (extents[i + dim] - extents[i] > l_max)
+      l_max = extents[i + dim] - extents[i];
+  }
+
+  if (l_max >= HUGE_VAL)
+    return;
+
+  for (i = 0; i < dim; i++) {
+    extents[i]       -= l_max*margin;
+    extents[i + dim] += l_max*margin;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute extents of a point set
  *
@@ -688,6 +771,52 @@ _clear_location_info(ple_locator_t  *this_locator)
 
 #if defined(PLE_HAVE_MPI)
 
+/*----------------------------------------------------------------------------
+ * Determine ids of previously located points in a point set.
+ *
+ * Interior and exterior lists are both ordered by increasing point id,
+ * and use the point_list numbering if present, so ids are determined
+ * by merging them.
+ *
+ * parameters:
+ *   this_locator <-- pointer to locator structure
+ *   n_points     <-- number of points to locate
+ *   point_list   <-- optional indirection array to point_coords
+ *   interior_id  --> id of each interior point (size: n_interior)
+ *
+ * returns:
+ *   1 if the point set matches that of the previous location, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_interior_point_ids(const ple_locator_t  *this_locator,
+                    ple_lnum_t            n_points,
+                    const ple_lnum_t      point_list[],
+                    ple_lnum_t            interior_id[])
+{
+  ple_lnum_t j;
+  ple_lnum_t n_interior = 0, n_exterior = 0;
+
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  if (this_locator->n_interior + this_locator->n_exterior != n_points)
+    return 0;
+
+  for (j = 0; j < n_points; j++) {
+    ple_lnum_t p_num = (point_list != NULL) ? point_list[j] : j + idb;
+    if (   n_interior < this_locator->n_interior
+        && this_locator->interior_list[n_interior] == p_num)
+      interior_id[n_interior++] = j;
+    else if (   n_exterior < this_locator->n_exterior
+             && this_locator->exterior_list[n_exterior] == p_num)
+      n_exterior++;
+    else
+      return 0;
+  }
+
+  return 1;
+}
+
 /*----------------------------------------------------------------------------
  * Update intersection rank information once location is done.
  *
@@ -827,6 +956,10 @@ _location_ranks(ple_locator_t  *this_locator,
  *                          to each point, or -1 (size: n_points)
  *   mesh_extents_f     <-- pointer to function computing mesh or mesh
  *                          subset or element extents
+ *   use_cache          <-- if true, reuse enlarged extents of all ranks
+ *                          from a previous call as long as local extents
+ *                          are contained in them, and return no intersects
+ *                          if no rank has points to locate
  *
  * returns:
  *   local rank intersection info
@@ -841,7 +974,8 @@ _intersects_distant(ple_locator_t       *this_locator,
                     const ple_lnum_t     point_list[],
                     const ple_coord_t    point_coords[],
                     const ple_lnum_t     location[],
-                    ple_mesh_extents_t  *mesh_extents_f)
+                    ple_mesh_extents_t  *mesh_extents_f,
+                    _Bool                use_cache)
 {
   int stride2;
   double extents[12];
@@ -912,14 +1046,76 @@ _intersects_distant(ple_locator_t       *this_locator,
   stride4 = dim * 4; /* Stride for element and vertex
                         extents, end-to-end */
 
-  PLE_MALLOC(recvbuf, stride4*comm_size, double);
+  const double *l_extents = extents;
 
-  _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+  if (use_cache) {
 
-  MPI_Allgather(extents, stride4, MPI_DOUBLE, recvbuf, stride4, MPI_DOUBLE,
-                this_locator->comm);
+    /* Check if some points need to be located, and if cached extents
+       are still valid */
 
-  _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+    int loc_vals[2] = {0, 0}, max_vals[2];
+
+    if (n_points > 0)
+      loc_vals[0] = 1;
+
+    if (this_locator->extents_cache == NULL)
+      loc_vals[1] = 1;
+    else {
+      const double *c_extents = this_locator->extents_cache + comm_rank*stride4;
+      if (   _contains_extents(dim, c_extents, extents) == false
+          || _contains_extents(dim, c_extents + 2*dim, extents + 2*dim)
+             == false)
+        loc_vals[1] = 1;
+    }
+
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+    MPI_Allreduce(loc_vals, max_vals, 2, MPI_INT, MPI_MAX,
+                  this_locator->comm);
+
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+    if (max_vals[0] == 0) {
+      intersects.rank = NULL;
+      intersects.extents = NULL;
+      this_locator->location_wtime[1] += comm_timing[0];
+      this_locator->location_cpu_time[1] += comm_timing[1];
+      return intersects;
+    }
+
+    if (max_vals[1] > 0) {
+      _enlarge_extents(dim, _ple_locator_extents_margin, extents);
+      _enlarge_extents(dim, _ple_locator_extents_margin, extents + 2*dim);
+      PLE_REALLOC(this_locator->extents_cache, stride4*comm_size, double);
+
+      _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+      MPI_Allgather(extents, stride4, MPI_DOUBLE,
+                    this_locator->extents_cache, stride4, MPI_DOUBLE,
+                    this_locator->comm);
+
+      _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+    }
+
+    /* Use the same (cached) extents for local and distant ranks,
+       so that intersections remain symmetric */
+
+    recvbuf = this_locator->extents_cache;
+    l_extents = recvbuf + comm_rank*stride4;
+
+  }
+  else {
+
+    PLE_MALLOC(recvbuf, stride4*comm_size, double);
+
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+    MPI_Allgather(extents, stride4, MPI_DOUBLE, recvbuf, stride4, MPI_DOUBLE,
+                  this_locator->comm);
+
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+  }
 
   /* Count and mark possible overlaps */
 
@@ -929,10 +1125,10 @@ _intersects_distant(ple_locator_t       *this_locator,
   for (int i = 0; i < this_locator->n_ranks; i++) {
     j = this_locator->start_rank + i;
     if (  (_intersect_extents(dim,
-                              extents + (2*dim),
+                              l_extents + (2*dim),
                               recvbuf + (j*stride4)) == true)
         || (_intersect_extents(dim,
-                               extents,
+                               l_extents,
                                recvbuf + (j*stride4) + (2*dim)) == true)) {
       intersect_rank[n_intersects] = j;
       n_intersects += 1;
@@ -958,7 +1154,8 @@ _intersects_distant(ple_locator_t       *this_locator,
   /* Free temporary memory */
 
   PLE_FREE(intersect_rank);
-  PLE_FREE(recvbuf);
+  if (recvbuf != this_locator->extents_cache)
+    PLE_FREE(recvbuf);
 
   /* Finalize timing */
 
@@ -1087,6 +1284,11 @@ _transfer_location_distant(ple_locator_t  *this_locator,
  *                          > 1 if outside (size: n_points)
  *   mesh_extents_f     <-- function computing mesh or mesh subset extents
  *   mesh_locate_f      <-- function locating the points on local elements
+ *   relocate           <-- if true, use cached extents (see
+ *                          _intersects_distant), and also search for
+ *                          points already located (on the rank given by
+ *                          location_rank_id[]) on other ranks, so that
+ *                          the closest location is always used
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1102,7 +1304,8 @@ _locate_distant(ple_locator_t               *this_locator,
                 ple_lnum_t                   location_rank_id[],
                 float                        distance[],
                 ple_mesh_extents_t          *mesh_extents_f,
-                ple_mesh_elements_locate_t  *mesh_locate_f)
+                ple_mesh_elements_locate_t  *mesh_locate_f,
+                _Bool                        relocate)
 {
   int k;
   int dist_rank, dist_index;
@@ -1129,13 +1332,14 @@ _locate_distant(ple_locator_t               *this_locator,
   const int have_tags = this_locator->have_tags;
   const ple_lnum_t idb = this_locator->point_id_base;
 
-  /* Filter non-located points */
+  /* Filter non-located points (in relocation mode, located points
+     are also checked on other ranks) */
 
   _n_points = 0;
   _point_list_p = point_list;
 
   for (j = 0; j < n_points; j++) {
-    if (location[j] < 0)
+    if (location[j] < 0 || relocate)
       _n_points++;
   }
 
@@ -1174,8 +1378,9 @@ _locate_distant(ple_locator_t               *this_locator,
                                    _n_points,
                                    _point_list_p,
                                    point_coords,
-                                   location,
-                                   mesh_extents_f);
+                                   (relocate) ? NULL : location,
+                                   mesh_extents_f,
+                                   relocate);
 
   /* Allocate buffers */
 
@@ -1230,6 +1435,12 @@ _locate_distant(ple_locator_t               *this_locator,
       else
         coord_idx = j;
 
+      /* Points relocated on this rank were already checked there */
+
+      if (   relocate
+          && location[j] > -1 && location_rank_id[j] == dist_rank)
+        continue;
+
       if (_within_extents(dim,
                           &(point_coords[dim*coord_idx]),
                           extents) == true) {
@@ -1397,6 +1608,7 @@ _locate_distant(ple_locator_t               *this_locator,
  *   mesh_extents_f    <-- pointer to function computing mesh or mesh
  *                         subset or element extents
  *   mesh_locate_f     <-- function locating points in or on elements
+ *   relocate          <-- if true, relocation mode (see _locate_distant)
  *----------------------------------------------------------------------------*/
 
 static void
@@ -1412,7 +1624,8 @@ _locate_all_distant(ple_locator_t               *this_locator,
                     ple_lnum_t                   location_rank_id[],
                     float                        distance[],
                     ple_mesh_extents_t          *mesh_extents_f,
-                    ple_mesh_elements_locate_t  *mesh_locate_f)
+                    ple_mesh_elements_locate_t  *mesh_locate_f,
+                    _Bool                        relocate)
 {
   int k;
   int dist_rank;
@@ -1449,7 +1662,8 @@ _locate_all_distant(ple_locator_t               *this_locator,
                   location_rank_id,
                   _distance,
                   mesh_extents_f,
-                  mesh_locate_f);
+                  mesh_locate_f,
+                  relocate);
 
   /* Update info on communicating ranks and matching ids */
   /*----------------------------------------------------*/
@@ -2610,6 +2824,208 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[1] += comm_timing[1];
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize location information by relocating previously located points
+ * on the ranks on which they were located, in parallel mode.
+ *
+ * Updated point coordinates are sent to the ranks containing the elements
+ * in which points were previously located, and points are relocated on
+ * those ranks' local meshes. Points which are still inside an element
+ * (i.e. with a normalized distance < 1) keep that location as a candidate;
+ * all others are marked as unlocated. All points then go through a
+ * distributed search, in which candidates are only replaced by closer
+ * elements of other ranks.
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   n_points           <-- number of points to locate
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   interior_id        <-- id of each previously located point
+ *                          (size: this_locator->n_interior)
+ *   location           --> number of distant element containing
+ *                          each point, or -1 (size: n_points)
+ *   location_rank_id   --> rank id for distant element containing
+ *                          each point, or -1 (size: n_points)
+ *   distance           --> distance from point to element indicated by
+ *                          location[], or -1 (size: n_points)
+ *   mesh_locate_f      <-- function locating points in or on elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_relocate_distant(ple_locator_t               *this_locator,
+                  const void                  *mesh,
+                  float                        tolerance_base,
+                  float                        tolerance_fraction,
+                  ple_lnum_t                   n_points,
+                  const int                    point_tag[],
+                  const ple_coord_t            point_coords[],
+                  const ple_lnum_t             interior_id[],
+                  ple_lnum_t                   location[],
+                  ple_lnum_t                   location_rank_id[],
+                  float                        distance[],
+                  ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  ple_lnum_t i, j, k;
+
+  const int dim = this_locator->dim;
+  const int have_tags = this_locator->have_tags;
+  const ple_lnum_t idb = this_locator->point_id_base;
+  const ple_lnum_t n_interior = this_locator->n_interior;
+  const ple_lnum_t n_dist
+    = (this_locator->n_intersects > 0) ?
+       this_locator->distant_points_idx[this_locator->n_intersects] : 0;
+
+  /* Exchanges use the variable exchange function, but are accounted
+     for as location communication */
+
+  const double e_wtime = this_locator->exchange_wtime[1];
+  const double e_cpu_time = this_locator->exchange_cpu_time[1];
+
+  ple_lnum_t *interior_rank, *loc_int, *loc_dist;
+  int *tag_int = NULL, *tag_dist = NULL;
+  float *dist_int, *dist_dist;
+  ple_coord_t *coords_int;
+
+  /* Initialize locations */
+
+  for (j = 0; j < n_points; j++) {
+    location[j] = -1;
+    location_rank_id[j] = -1;
+    distance[j] = -1;
+  }
+
+  /* Updated coordinates (and tags) of previously located points */
+
+  PLE_MALLOC(interior_rank, n_interior, ple_lnum_t);
+  PLE_MALLOC(coords_int, n_interior*dim, ple_coord_t);
+
+  for (i = 0; i < n_interior; i++) {
+    const ple_lnum_t coord_idx = this_locator->interior_list[i] - idb;
+    for (k = 0; k < dim; k++)
+      coords_int[i*dim + k] = point_coords[coord_idx*dim + k];
+  }
+
+  for (int li = 0; li < this_locator->n_intersects; li++) {
+    for (i = this_locator->local_points_idx[li];
+         i < this_locator->local_points_idx[li+1];
+         i++)
+      interior_rank[this_locator->local_point_ids[i]]
+        = this_locator->intersect_rank[li];
+  }
+
+  _exchange_point_var_distant(this_locator,
+                              this_locator->distant_point_coords,
+                              coords_int,
+                              NULL,
+                              PLE_MPI_COORD,
+                              dim,
+                              true);
+
+  PLE_FREE(coords_int);
+
+  if (have_tags) {
+    PLE_MALLOC(tag_int, n_interior, int);
+    PLE_MALLOC(tag_dist, n_dist, int);
+    for (i = 0; i < n_interior; i++)
+      tag_int[i] = point_tag[interior_id[i]];
+    _exchange_point_var_distant(this_locator,
+                                tag_dist,
+                                tag_int,
+                                NULL,
+                                MPI_INT,
+                                1,
+                                true);
+    PLE_FREE(tag_int);
+  }
+
+  /* Relocate distant points on local mesh */
+
+  PLE_MALLOC(loc_dist, n_dist, ple_lnum_t);
+  PLE_MALLOC(dist_dist, n_dist, float);
+
+  for (i = 0; i < n_dist; i++) {
+    loc_dist[i] = -1;
+    dist_dist[i] = -1.0;
+  }
+
+  if (mesh != NULL && n_dist > 0)
+    mesh_locate_f(mesh,
+                  tolerance_base,
+                  tolerance_fraction,
+                  n_dist,
+                  this_locator->distant_point_coords,
+                  tag_dist,
+                  loc_dist,
+                  dist_dist);
+
+  PLE_FREE(tag_dist);
+
+  for (i = 0; i < n_dist; i++) {
+    if (dist_dist[i] < 0 || dist_dist[i] >= 1) {
+      loc_dist[i] = -1;
+      dist_dist[i] = -1.0;
+    }
+  }
+
+  /* Return relocation info to ranks owning the points */
+
+  PLE_MALLOC(loc_int, n_interior, ple_lnum_t);
+  PLE_MALLOC(dist_int, n_interior, float);
+
+  _exchange_point_var_distant(this_locator,
+                              loc_dist,
+                              loc_int,
+                              NULL,
+                              PLE_MPI_LNUM,
+                              1,
+                              false);
+
+  _exchange_point_var_distant(this_locator,
+                              dist_dist,
+                              dist_int,
+                              NULL,
+                              MPI_FLOAT,
+                              1,
+                              false);
+
+  PLE_FREE(loc_dist);
+  PLE_FREE(dist_dist);
+
+  for (i = 0; i < n_interior; i++) {
+    if (loc_int[i] > -1) {
+      j = interior_id[i];
+      location[j] = loc_int[i];
+      location_rank_id[j] = interior_rank[i];
+      distance[j] = dist_int[i];
+    }
+  }
+
+  PLE_FREE(dist_int);
+  PLE_FREE(loc_int);
+  PLE_FREE(interior_rank);
+
+  this_locator->location_wtime[1]
+    += this_locator->exchange_wtime[1] - e_wtime;
+  this_locator->location_cpu_time[1]
+    += this_locator->exchange_cpu_time[1] - e_cpu_time;
+  this_locator->exchange_wtime[1] = e_wtime;
+  this_locator->exchange_cpu_time[1] = e_cpu_time;
+
+  /* Release previous location info */
+
+  _clear_location_info(this_locator);
+  PLE_FREE(this_locator->comm_order);
+
+  this_locator->n_interior = 0;
+  this_locator->n_exterior = 0;
+}
+
 #endif /* defined(PLE_HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -2751,6 +3167,76 @@ _get_times(const ple_locator_t  *this_locator,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update point ids in location info once location is done.
+ *
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *   n_points     <-- number of points to locate
+ *   point_list   <-- optional indirection array to point_coords
+ *----------------------------------------------------------------------------*/
+
+static void
+_finalize_location(ple_locator_t     *this_locator,
+                   ple_lnum_t         n_points,
+                   const ple_lnum_t   point_list[])
+{
+  ple_lnum_t i;
+
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  /* Update local_point_ids values */
+  /*-------------------------------*/
+
+  if (   this_locator->n_interior > 0
+      && this_locator->local_point_ids != NULL) {
+
+    ple_lnum_t  *reduced_index;
+
+    PLE_MALLOC(reduced_index, n_points, ple_lnum_t);
+
+    for (i = 0; i < n_points; i++)
+      reduced_index[i] = -1;
+
+    assert(  this_locator->local_points_idx[this_locator->n_intersects]
+           == this_locator->n_interior);
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      reduced_index[this_locator->interior_list[i] - idb] = i;
+
+    /* Update this_locator->local_point_ids[] so that it refers
+       to an index in a dense [0, this_locator->n_interior] subset
+       of the local points */
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      this_locator->local_point_ids[i]
+        = reduced_index[this_locator->local_point_ids[i]];
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      assert(this_locator->local_point_ids[i] > -1);
+
+    PLE_FREE(reduced_index);
+
+  }
+
+  /* If an initial point list was given, update
+     this_locator->interior_list and this_locator->exterior_list
+     so that they refer to the same point set as that initial
+     list (and not to an index within the selected point set) */
+
+  if (point_list != NULL) {
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      this_locator->interior_list[i]
+        = point_list[this_locator->interior_list[i] - idb];
+
+    for (i = 0; i < this_locator->n_exterior; i++)
+      this_locator->exterior_list[i]
+        = point_list[this_locator->exterior_list[i] - idb];
+
+  }
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -2822,6 +3308,9 @@ ple_locator_create(void)
   this_locator->n_exterior = 0;
   this_locator->exterior_list = NULL;
 
+  this_locator->location_shift = 0;
+  this_locator->extents_cache = NULL;
+
   for (i = 0; i < 2; i++) {
     this_locator->location_wtime[i] = 0.;
     this_locator->location_cpu_time[i] = 0.;
@@ -2865,6 +3354,8 @@ ple_locator_destroy(ple_locator_t  *this_locator)
     PLE_FREE(this_locator->interior_list);
     PLE_FREE(this_locator->exterior_list);
 
+    PLE_FREE(this_locator->extents_cache);
+
     PLE_FREE(this_locator);
   }
 
@@ -2940,6 +3431,9 @@ ple_locator_set_mesh(ple_locator_t               *this_locator,
 
   _clear_location_info(this_locator);
 
+  this_locator->location_shift = 0;
+  PLE_FREE(this_locator->extents_cache);
+
   ple_locator_extend_search(this_locator,
                             mesh,
                             options,
@@ -3009,7 +3503,6 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                           ple_mesh_extents_t          *mesh_extents_f,
                           ple_mesh_elements_locate_t  *mesh_locate_f)
 {
-  int i;
   double w_start, w_end, cpu_start, cpu_end;
   ple_lnum_t  *location;
 
@@ -3028,8 +3521,6 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
   else
     this_locator->point_id_base = 0;
 
-  const int idb = this_locator->point_id_base;
-
   this_locator->have_tags = 0;
 
   /* Prepare locator (MPI version) */
@@ -3099,7 +3590,7 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
     globflag[3] = -globflag[3];
 
     /* Compatibility with older versions */
-    for (i = 2; i < 5; i++) {
+    for (int i = 2; i < 5; i++) {
       if (globflag[i] == 1)
         globflag[i] = _LOCATE_BB_SENDRECV;
     }
@@ -3144,7 +3635,8 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                         location_rank_id,
                         distance,
                         mesh_extents_f,
-                        mesh_locate_f);
+                        mesh_locate_f,
+                        false);
 
     PLE_FREE(location_rank_id);
   }
@@ -3185,55 +3677,256 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
 
   }
 
-  /* Update local_point_ids values */
-  /*-------------------------------*/
+  _finalize_location(this_locator, n_points, point_list);
 
-  if (   this_locator->n_interior > 0
-      && this_locator->local_point_ids != NULL) {
+  /* Finalize timing */
 
-    ple_lnum_t  *reduced_index;
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
 
-    PLE_MALLOC(reduced_index, n_points, ple_lnum_t);
+  this_locator->location_wtime[0] += (w_end - w_start);
+  this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
 
-    for (i = 0; i < n_points; i++)
-      reduced_index[i] = -1;
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
+}
 
-    assert(  this_locator->local_points_idx[this_locator->n_intersects]
-           == this_locator->n_interior);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update location of points for a locator for which set_mesh has
+ *        already been called, after mesh or point displacement.
+ *
+ * The mesh and point set should be the same as for the previous call to
+ * ple_locator_set_mesh() or ple_locator_relocate(), though mesh vertex
+ * and point coordinates may have changed, and the same options
+ * (numbering base) are used.
+ *
+ * If the location function returns distances normalized relative to
+ * elements (0 - 1 inside, > 1 outside, as is the case for volume elements)
+ * on all ranks, points previously located are first relocated on the local
+ * mesh of the rank on which they were located. Points which remain inside
+ * an element of that mesh keep that location as a candidate, which is then
+ * only replaced by a closer element of another rank in the distributed
+ * search. Rank extents used by that search are computed with an added
+ * margin, and reused as long as local mesh and point extents remain within
+ * them, so that small displacements only require a global reduction
+ * instead of an exchange of extents.
+ *
+ * Otherwise (absolute distances to surface elements or nodal supports,
+ * point set different from the previous one, or serial mode), a full
+ * location is done, as with ple_locator_set_mesh().
+ *
+ * Location id shifts previously applied using
+ * ple_locator_shift_locations() are maintained.
+ *
+ * \param[in, out] this_locator        pointer to locator structure
+ * \param[in]      mesh                pointer to mesh representation structure
+ * \param[in]      tolerance_base      associated fixed tolerance
+ * \param[in]      tolerance_fraction  associated fraction of element bounding
+ *                                     boxes added to tolerance
+ * \param[in]      normalized_dist     1 if mesh_locate_f returns distances
+ *                                     normalized relative to elements for
+ *                                     the local mesh, 0 otherwise
+ * \param[in]      n_points            number of points to locate
+ * \param[in]      point_list          optional indirection array to point_coords
+ * \param[in]      point_tag           optional point tag (size: n_points)
+ * \param[in]      point_coords        coordinates of points to locate
+ *                                     (dimension: dim * n_points)
+ * \param[out]     distance            optional distance from point to matching
+ *                                     element: < 0 if unlocated; 0 - 1 if inside
+ *                                     and > 1 if outside a volume element, or
+ *                                     absolute distance to a surface element
+ *                                     (size: n_points)
+ * \param[in]      mesh_extents_f      pointer to function computing mesh or mesh
+ *                                     subset or element extents
+ * \param[in]      mesh_locate_f       pointer to function wich updates the
+ *                                     location[] and distance[] arrays
+ *                                     associated with a set of points for
+ *                                     points that are in an element of this
+ *                                     mesh, or closer to one than to previously
+ *                                     encountered elements.
+ */
+/*----------------------------------------------------------------------------*/
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      reduced_index[this_locator->interior_list[i] - idb] = i;
+void
+ple_locator_relocate(ple_locator_t               *this_locator,
+                     const void                  *mesh,
+                     float                        tolerance_base,
+                     float                        tolerance_fraction,
+                     int                          normalized_dist,
+                     ple_lnum_t                   n_points,
+                     const ple_lnum_t             point_list[],
+                     const int                    point_tag[],
+                     const ple_coord_t            point_coords[],
+                     float                        distance[],
+                     ple_mesh_extents_t          *mesh_extents_f,
+                     ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  double w_start, w_end, cpu_start, cpu_end;
+  ple_lnum_t  *interior_id = NULL;
 
-    /* Update this_locator->local_point_ids[] so that it refers
-       to an index in a dense [0, this_locator->n_interior] subset
-       of the local points */
+  double comm_timing[4] = {0., 0., 0., 0.};
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      this_locator->local_point_ids[i]
-        = reduced_index[this_locator->local_point_ids[i]];
+  /* Flag values
+     0: have mesh
+     1: have points
+     2: full location required */
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      assert(this_locator->local_point_ids[i] > -1);
+  int globflag[3] = {-1, -1, 1};
 
-    PLE_FREE(reduced_index);
+  /* Initialize timing */
+
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
+
+#if defined(PLE_HAVE_MPI)
+
+  /* Check if previous location may be reused (in serial mode, full
+     location is always done) */
+
+  PLE_MALLOC(interior_id, this_locator->n_interior, ple_lnum_t);
+
+  int reuse = _interior_point_ids(this_locator,
+                                  n_points,
+                                  point_list,
+                                  interior_id);
+
+  if (mesh != NULL && normalized_dist == 0)
+    reuse = 0;
+
+  int mpi_flag = 0;
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    int locflag[3] = {-1, -1, 0};
+
+    if (mesh != NULL)
+      locflag[0] = 1;
+    if (n_points > 0)
+      locflag[1] = 1;
+    if (reuse == 0)
+      locflag[2] = 1;
+
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+    MPI_Allreduce(locflag, globflag, 3, MPI_INT, MPI_MAX,
+                  this_locator->comm);
+
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
 
   }
 
-  /* If an initial point list was given, update
-     this_locator->interior_list and this_locator->exterior_list
-     so that they refer to the same point set as that initial
-     list (and not to an index within the selected point set) */
+#else
 
-  if (point_list != NULL) {
+  PLE_UNUSED(normalized_dist);
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      this_locator->interior_list[i]
-        = point_list[this_locator->interior_list[i] - idb];
+#endif
 
-    for (i = 0; i < this_locator->n_exterior; i++)
-      this_locator->exterior_list[i]
-        = point_list[this_locator->exterior_list[i] - idb];
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
+
+  /* Full location if required, or in serial mode (in which relocation
+     would search the same local mesh) */
+
+  if (globflag[2] > 0) {
+
+    PLE_FREE(interior_id);
+
+    int options[PLE_LOCATOR_N_OPTIONS];
+    options[PLE_LOCATOR_NUMBERING] = this_locator->point_id_base;
+
+    ple_lnum_t location_shift = this_locator->location_shift;
+
+    /* Location time is then accounted for by ple_locator_set_mesh */
+
+    this_locator->location_wtime[0] += (ple_timer_wtime() - w_start);
+    this_locator->location_cpu_time[0] += (ple_timer_cpu_time() - cpu_start);
+
+    ple_locator_set_mesh(this_locator,
+                         mesh,
+                         options,
+                         tolerance_base,
+                         tolerance_fraction,
+                         this_locator->dim,
+                         n_points,
+                         point_list,
+                         point_tag,
+                         point_coords,
+                         distance,
+                         mesh_extents_f,
+                         mesh_locate_f);
 
+    if (location_shift != 0)
+      ple_locator_shift_locations(this_locator, location_shift);
+
+    return;
+  }
+
+  /* Relocate (MPI version) */
+  /*------------------------*/
+
+#if defined(PLE_HAVE_MPI)
+
+  ple_lnum_t  *location, *location_rank_id;
+  float *_distance = distance;
+
+  if (distance == NULL)
+    PLE_MALLOC(_distance, n_points, float);
+
+  PLE_MALLOC(location, n_points, ple_lnum_t);
+  PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
+
+  _relocate_distant(this_locator,
+                    mesh,
+                    tolerance_base,
+                    tolerance_fraction,
+                    n_points,
+                    point_tag,
+                    point_coords,
+                    interior_id,
+                    location,
+                    location_rank_id,
+                    _distance,
+                    mesh_locate_f);
+
+  if (globflag[0] > 0 && globflag[1] > 0)
+    _locate_all_distant(this_locator,
+                        mesh,
+                        tolerance_base,
+                        tolerance_fraction,
+                        n_points,
+                        point_list,
+                        point_tag,
+                        point_coords,
+                        location,
+                        location_rank_id,
+                        _distance,
+                        mesh_extents_f,
+                        mesh_locate_f,
+                        true);
+
+  PLE_FREE(location_rank_id);
+  PLE_FREE(location);
+
+  if (_distance != distance)
+    PLE_FREE(_distance);
+
+#endif
+
+  PLE_FREE(interior_id);
+
+  _finalize_location(this_locator, n_points, point_list);
+
+  /* Reapply previous location id shift */
+
+  if (this_locator->location_shift != 0) {
+    ple_lnum_t location_shift = this_locator->location_shift;
+    this_locator->location_shift = 0;
+    ple_locator_shift_locations(this_locator, location_shift);
   }
 
   /* Finalize timing */
@@ -3243,9 +3936,6 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
 
   this_locator->location_wtime[0] += (w_end - w_start);
   this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
-
-  this_locator->location_wtime[1] += comm_timing[0];
-  this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3263,6 +3953,8 @@ void
 ple_locator_shift_locations(ple_locator_t  *this_locator,
                             ple_lnum_t      location_shift)
 {
+  this_locator->location_shift += location_shift;
+
   int n_intersects = this_locator->n_intersects;
   if (n_intersects == 0)
     return;
@@ -301,6 +301,60 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                           ple_mesh_extents_t          *mesh_extents_f,
                           ple_mesh_elements_locate_t  *mesh_locate_f);
 
+/*----------------------------------------------------------------------------
+ * Update location of points for a locator for which set_mesh has already
+ * been called, after mesh or point displacement.
+ *
+ * The mesh and point set should be the same as for the previous location,
+ * though mesh vertex and point coordinates may have changed.
+ *
+ * If distances returned by locate_f are normalized relative to elements
+ * on all ranks, points previously located are first relocated on the rank
+ * on which they were located, and that location is only replaced by a
+ * closer one found in the distributed search. Otherwise, or if the point
+ * set has changed, a full location is done.
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated base tolerance (used for bounding
+ *                          box check only, not for location test)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   normalized_dist    <-- 1 if locate_f returns distances normalized
+ *                          relative to elements (0 - 1 inside, > 1
+ *                          outside) for the local mesh, 0 otherwise
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   distance           --> optional distance from point to matching element:
+ *                          < 0 if unlocated; 0 - 1 if inside and > 1 if
+ *                          outside a volume element, or absolute distance
+ *                          to a surface element (size: n_points)
+ *   mesh_extents_f     <-- pointer to function computing mesh extents
+ *   locate_f           <-- pointer to function wich updates the location[]
+ *                          and distance[] arrays associated with a set of
+ *                          points for points that are in an element of this
+ *                          mesh, or closer to one than to previously
+ *                          encountered elements.
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_relocate(ple_locator_t               *this_locator,
+                     const void                  *mesh,
+                     float                        tolerance_base,
+                     float                        tolerance_fraction,
+                     int                          normalized_dist,
+                     ple_lnum_t                   n_points,
+                     const ple_lnum_t             point_list[],
+                     const int                    point_tag[],
+                     const ple_coord_t            point_coords[],
+                     float                        distance[],
+                     ple_mesh_extents_t          *mesh_extents_f,
+                     ple_mesh_elements_locate_t  *mesh_locate_f);
+
 /*----------------------------------------------------------------------------
  * Shift location ids for located points after locator initialization.
  *
@@ -88,6 +88,11 @@
 
 #define ECS_LOC_LNG_MAX_CHAINE_GMSH  2048 /* Max file line length */
 
+/* Line decoding of memory-mapped text files */
+
+#define ECS_LOC_GMSH_BLOC_LIGNES    65536 /* Lines decoded per block */
+#define ECS_LOC_GMSH_NBR_MAX_SOM_LIN    8 /* Max linear nodes per element */
+
 typedef int gmsh_int_t;
 
 /*============================================================================
@@ -138,6 +143,38 @@ typedef struct {
 
 } ecs_gmsh_elt_t;
 
+/* Line decoding function for memory-mapped text files; returns true
+   if line i, starting at s and ending before e, was decoded successfully */
+
+typedef bool
+(ecs_loc_gmsh_decode_t) (const char  *s,
+                         const char  *e,
+                         size_t       i,
+                         void        *data);
+
+/* Decoded node values */
+
+typedef struct {
+
+  ecs_int_t    *label;      /* Node labels, or NULL */
+  ecs_coord_t  *coord;      /* Node coordinates, or NULL */
+
+} ecs_loc_gmsh_noeuds_t;
+
+/* Decoded element values */
+
+typedef struct {
+
+  int           version;    /* Gmsh format major version */
+  int           type_bloc;  /* Element type of block (version 4) */
+
+  long         *label;      /* Element labels */
+  int          *type;       /* Element types (versions 1 and 2) */
+  ecs_int_t    *coul;       /* Element colors (versions 1 and 2) */
+  ecs_int_t    *nod;        /* Element linear nodes (strided) */
+
+} ecs_loc_gmsh_elts_t;
+
 /*============================================================================
  *  Définitions de variables globales statiques
  *============================================================================*/
@@ -329,6 +366,449 @@ const ecs_gmsh_elt_t ecs_gmsh_elt_liste_c[ECS_GMSH_NBR_TYP_ELT] = {
  *  Fonctions privées
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Skip blanks in a line.
+ *----------------------------------------------------------------------------*/
+
+static inline const char *
+ecs_loc_pre_gmsh__saute_blancs(const char  *s,
+                               const char  *e)
+{
+  while (s < e && (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n'))
+    s++;
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode an integer value in a line (similar to strtol, but the string
+ * is not null-terminated).
+ *
+ * returns:
+ *   pointer to character following the value, or NULL in case of error.
+ *----------------------------------------------------------------------------*/
+
+static inline const char *
+ecs_loc_pre_gmsh__lit_int(const char  *s,
+                          const char  *e,
+                          long        *val)
+{
+  s = ecs_loc_pre_gmsh__saute_blancs(s, e);
+
+  bool neg = false;
+  if (s < e && (*s == '-' || *s == '+')) {
+    neg = (*s == '-');
+    s++;
+  }
+
+  if (s >= e || *s < '0' || *s > '9')
+    return NULL;
+
+  long v = 0;
+  while (s < e && *s >= '0' && *s <= '9') {
+    v = v*10 + (*s - '0');
+    s++;
+  }
+
+  *val = (neg) ? -v : v;
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a real value in a line.
+ *
+ * Values whose mantissa is exactly representable and whose decimal
+ * exponent is small enough are converted with a single (correctly rounded)
+ * multiplication or division by an exact power of 10, so the result is
+ * identical to that of strtod(); other values are handled by strtod().
+ *
+ * returns:
+ *   pointer to character following the value, or NULL in case of error.
+ *----------------------------------------------------------------------------*/
+
+static const char *
+ecs_loc_pre_gmsh__lit_real(const char  *s,
+                           const char  *e,
+                           double      *val)
+{
+  static const double p10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                               1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+                               1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+                               1e22};
+
+  s = ecs_loc_pre_gmsh__saute_blancs(s, e);
+
+  const char *p = s;
+
+  bool neg = false;
+  if (p < e && (*p == '-' || *p == '+')) {
+    neg = (*p == '-');
+    p++;
+  }
+
+  uint64_t m = 0;
+  int n_dig = 0, n_sig = 0, exp10 = 0;
+
+  for (; p < e && *p >= '0' && *p <= '9'; p++, n_dig++) {
+    if (m > 0 || *p > '0')
+      n_sig++;
+    if (n_sig <= 19)
+      m = m*10 + (uint64_t)(*p - '0');
+  }
+
+  if (p < e && *p == '.') {
+    for (p++; p < e && *p >= '0' && *p <= '9'; p++, n_dig++) {
+      if (m > 0 || *p > '0')
+        n_sig++;
+      if (n_sig <= 19)
+        m = m*10 + (uint64_t)(*p - '0');
+      exp10--;
+    }
+  }
+
+  if (n_dig > 0 && p < e && (*p == 'e' || *p == 'E')) {
+    const char *pe = p + 1;
+    int e_sign = 1, ev = 0;
+    if (pe < e && (*pe == '-' || *pe == '+')) {
+      e_sign = (*pe == '-') ? -1 : 1;
+      pe++;
+    }
+    if (pe < e && *pe >= '0' && *pe <= '9') {
+      for (; pe < e && *pe >= '0' && *pe <= '9'; pe++) {
+        if (ev < 10000)
+          ev = ev*10 + (*pe - '0');
+      }
+      exp10 += e_sign*ev;
+      p = pe;
+    }
+  }
+
+  /* Fast path */
+
+  if (   n_dig > 0 && n_sig <= 19 && m <= ((uint64_t)1 << 53)
+      && exp10 >= -22 && exp10 <= 22
+      && (   p >= e || *p == ' ' || *p == '\t'
+          || *p == '\r' || *p == '\n')) {
+    double v = (double)m;
+    if (exp10 < 0)
+      v /= p10[-exp10];
+    else
+      v *= p10[exp10];
+    *val = (neg) ? -v : v;
+    return p;
+  }
+
+  /* General case */
+
+  char buf[128];
+  size_t l = 0;
+  while (s + l < e && l < 127 && s[l] != ' ' && s[l] != '\t'
+         && s[l] != '\r' && s[l] != '\n') {
+    buf[l] = s[l];
+    l++;
+  }
+  buf[l] = '\0';
+
+  char *end = NULL;
+  *val = strtod(buf, &end);
+  if (end == buf)
+    return NULL;
+
+  return s + (end - buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Decode lines of a text file using a memory mapping of that file.
+ *
+ * Lines are located by blocks, and each block of lines is then decoded
+ * using the provided function, in parallel when OpenMP is available.
+ *
+ * The file position is then set to the beginning of the line following
+ * the last successfully decoded line, so that reading may continue using
+ * the usual (line by line) functions, which also handle error reporting
+ * or files which can not be mapped (such as compressed files).
+ *
+ * parameters:
+ *   fic_maillage <-- pointer to file structure
+ *   num_ligne    <-> current line number
+ *   n_lignes     <-- number of lines to read
+ *   decode       <-- line decoding function
+ *   data         <-> pointer to structure used by decoding function
+ *
+ * returns:
+ *   the number of lines successfully decoded (n_lignes if no error,
+ *   0 if the file could not be mapped)
+ *----------------------------------------------------------------------------*/
+
+static size_t
+ecs_loc_pre_gmsh__lit_lignes_map(ecs_file_t                 *fic_maillage,
+                                 int                        *num_ligne,
+                                 size_t                      n_lignes,
+                                 ecs_loc_gmsh_decode_t      *decode,
+                                 void                       *data)
+{
+  size_t buf_size = 0;
+  const char *buf = ecs_file_map(fic_maillage, &buf_size);
+
+  if (buf == NULL || n_lignes < 1)
+    return 0;
+
+  ecs_file_off_t pos = ecs_file_tell(fic_maillage);
+  if (pos < 0 || (size_t)pos > buf_size)
+    return 0;
+
+  const size_t block_size = ECS_MIN(n_lignes, ECS_LOC_GMSH_BLOC_LIGNES);
+
+  size_t *l_idx;
+  char   *l_err;
+  ECS_MALLOC(l_idx, block_size + 1, size_t);
+  ECS_MALLOC(l_err, block_size, char);
+
+  size_t n_ok = 0;
+  l_idx[0] = pos;
+
+  while (n_ok < n_lignes) {
+
+    /* Locate lines */
+
+    size_t n = 0;
+    size_t n_max = ECS_MIN(n_lignes - n_ok, block_size);
+    size_t p = l_idx[0];
+
+    while (n < n_max && p < buf_size) {
+      const char *eol = memchr(buf + p, '\n', buf_size - p);
+      p = (eol != NULL) ? (size_t)(eol - buf) + 1 : buf_size;
+      l_idx[++n] = p;
+    }
+
+    /* Decode lines */
+
+    const ecs_int_t _n = n;
+
+#   pragma omp parallel for if (_n > 1024)
+    for (ecs_int_t i = 0; i < _n; i++) {
+      if (decode(buf + l_idx[i], buf + l_idx[i+1], n_ok + i, data))
+        l_err[i] = 0;
+      else
+        l_err[i] = 1;
+    }
+
+    size_t n_ok_b = 0;
+    while (n_ok_b < n && l_err[n_ok_b] == 0)
+      n_ok_b++;
+
+    n_ok += n_ok_b;
+    *num_ligne += n_ok_b;
+    l_idx[0] = l_idx[n_ok_b];
+
+    if (n_ok_b < n_max) /* Error or premature end of file */
+      break;
+
+  }
+
+  ecs_file_seek(fic_maillage, l_idx[0], ECS_FILE_SEEK_SET);
+
+  ECS_FREE(l_err);
+  ECS_FREE(l_idx);
+
+  return n_ok;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a "label x y z" node line.
+ *----------------------------------------------------------------------------*/
+
+static bool
+ecs_loc_pre_gmsh__decode_noeud(const char  *s,
+                               const char  *e,
+                               size_t       i,
+                               void        *data)
+{
+  ecs_loc_gmsh_noeuds_t *d = data;
+
+  long label = 0;
+  double coord[3];
+
+  if (d->label != NULL) {
+    s = ecs_loc_pre_gmsh__lit_int(s, e, &label);
+    if (s == NULL)
+      return false;
+    d->label[i] = label;
+  }
+
+  if (d->coord != NULL) {
+    for (int j = 0; j < 3 && s != NULL; j++)
+      s = ecs_loc_pre_gmsh__lit_real(s, e, coord + j);
+    if (s == NULL)
+      return false;
+    for (int j = 0; j < 3; j++)
+      d->coord[i*3 + j] = coord[j];
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode an element line.
+ *
+ * For Gmsh version 1, an element is described by:
+ *   label type reg-phys reg-elem number-of-nodes <node-list>
+ * For Gmsh version 2:
+ *   label type number-of-tags <tag-list> <node-list>
+ * For Gmsh version 4:
+ *   label <node-list>
+ * with type and number of nodes given by the element block.
+ *
+ * Points and edges are ignored, so their node lists are not decoded.
+ *----------------------------------------------------------------------------*/
+
+static bool
+ecs_loc_pre_gmsh__decode_elt(const char  *s,
+                             const char  *e,
+                             size_t       i,
+                             void        *data)
+{
+  ecs_loc_gmsh_elts_t *d = data;
+
+  long val = 0;
+  int type_gmsh = d->type_bloc;
+  ecs_int_t coul = 0;
+
+  /* Label and type */
+
+  s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+  if (s == NULL)
+    return false;
+
+  d->label[i] = val;
+
+  if (d->version < 4) {
+    s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+    if (s == NULL)
+      return false;
+    type_gmsh = val;
+    d->type[i] = type_gmsh;
+  }
+
+  if (   type_gmsh < (int)GMSH_SEG2 || type_gmsh > (int)GMSH_POINT1
+      || type_gmsh == GMSH_POINT1
+      || type_gmsh == GMSH_SEG2 || type_gmsh == GMSH_SEG3)
+    return true;
+
+  /* Tags */
+
+  if (d->version == 2) {
+    s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+    const long n_tags = val;
+    for (long j = 0; j < n_tags && s != NULL; j++) {
+      s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+      if (j == 0)
+        coul = val;
+    }
+  }
+  else if (d->version == 1) {
+    s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+    coul = val;
+    for (int j = 0; j < 2 && s != NULL; j++)
+      s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+  }
+
+  if (s == NULL)
+    return false;
+
+  if (d->coul != NULL)
+    d->coul[i] = coul;
+
+  /* Nodes (only the first, linear element nodes are kept) */
+
+  const int n_nod = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
+  ecs_int_t *nod = d->nod + i*ECS_LOC_GMSH_NBR_MAX_SOM_LIN;
+
+  for (int j = 0; j < n_nod; j++) {
+    s = ecs_loc_pre_gmsh__lit_int(s, e, &val);
+    if (s == NULL)
+      return false;
+    if (j < ECS_LOC_GMSH_NBR_MAX_SOM_LIN)
+      nod[j] = val;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Store an element read in a Gmsh (version 1 or 2) file before transfer
+ * to the mesh structure.
+ *----------------------------------------------------------------------------*/
+
+static void
+ecs_loc_pre_gmsh__stocke_elt(int               type_gmsh,
+                             ecs_int_t         coul_elt,
+                             const ecs_int_t   num_nod_elt_gmsh[],
+                             size_t            cpt_elt_ent[],
+                             ecs_size_t       *elt_pos_som_ent[],
+                             ecs_int_t        *elt_val_som_ent[],
+                             ecs_int_t        *elt_val_color_ent[],
+                             ecs_int_t         cpt_coul_ent[],
+                             ecs_int_t        *val_coul_ent[],
+                             ecs_size_t       *cpt_elt_coul_ent[])
+{
+  ecs_int_t  ind_som_elt;
+  ecs_int_t  icoul;
+
+  ecs_int_t  type_ecs    = ecs_gmsh_elt_liste_c[type_gmsh - 1].ecs_typ;
+  ecs_int_t  nbr_som_elt = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
+
+  /* Identification de l'entité concernée */
+
+  ecs_int_t  ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
+
+  /* Position des numéros de sommets du prochain élément */
+
+  elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
+    elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
+
+  /* Connectivité de l'élément par ses numéros de sommets */
+
+  for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
+
+    elt_val_som_ent
+      [ent_num]
+      [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
+      = num_nod_elt_gmsh
+      [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
+
+  }
+
+  /* Couleur (tag) de l'élément lu */
+
+  icoul = 0;
+  while (icoul < cpt_coul_ent[ent_num]           &&
+         val_coul_ent[ent_num][icoul] != coul_elt)
+    icoul++;
+
+  if (icoul == cpt_coul_ent[ent_num]) {
+
+    /* La valeur de la couleur n'a pas encore été stockée */
+
+    ECS_REALLOC(val_coul_ent[ent_num]    , cpt_coul_ent[ent_num] + 1,
+                ecs_int_t);
+    ECS_REALLOC(cpt_elt_coul_ent[ent_num], cpt_coul_ent[ent_num] + 1,
+                ecs_size_t);
+    cpt_elt_coul_ent[ent_num][icoul] = 0;
+    val_coul_ent[ent_num][icoul] = coul_elt;
+    cpt_coul_ent[ent_num]++;
+
+  }
+
+  cpt_elt_coul_ent[ent_num][icoul]++;
+  elt_val_color_ent[ent_num][cpt_elt_ent[ent_num]] = icoul + 1;
+
+  /* Incrémentation du nombre d'éléments lus */
+
+  cpt_elt_ent[ent_num]++;
+}
+
 /*----------------------------------------------------------------------------
  *  Lecture et vérification de la version du format (pour version 2.0)
  *----------------------------------------------------------------------------*/
@@ -440,7 +920,18 @@ ecs_loc_pre_gmsh__lit_nodes(ecs_maillage_t   *maillage,
 
   if (type_fmt_gmsh == 0) {
 
-    for (ind_nod = 0; ind_nod < nbr_nod; ind_nod++) {
+    /* Decode lines in place when possible, line by line otherwise
+       (or after a line which could not be decoded) */
+
+    ecs_loc_gmsh_noeuds_t  d_nod = {*som_val_label, som_val_coord};
+
+    ind_nod = ecs_loc_pre_gmsh__lit_lignes_map(fic_maillage,
+                                               num_ligne,
+                                               nbr_nod,
+                                               ecs_loc_pre_gmsh__decode_noeud,
+                                               &d_nod);
+
+    for ( ; ind_nod < nbr_nod; ind_nod++) {
 
       ecs_file_gets(chaine,
                     ECS_LOC_LNG_MAX_CHAINE_GMSH,
@@ -947,7 +1438,18 @@ ecs_loc_pre_gmsh__lit_nodes_v4(ecs_maillage_t   *maillage,
 
       if (version_fmt_gmsh < 41) {
 
-        for (unsigned long bn = 0; bn < n_ent_nodes; bn++, ind_nod++) {
+        ecs_loc_gmsh_noeuds_t  d_nod = {*som_val_label + ind_nod,
+                                        som_val_coord + ind_nod*3};
+
+        unsigned long bn
+          = ecs_loc_pre_gmsh__lit_lignes_map(fic_maillage,
+                                             num_ligne,
+                                             n_ent_nodes,
+                                             ecs_loc_pre_gmsh__decode_noeud,
+                                             &d_nod);
+        ind_nod += bn;
+
+        for ( ; bn < n_ent_nodes; bn++, ind_nod++) {
 
           ecs_file_gets(chaine,
                         ECS_LOC_LNG_MAX_CHAINE_GMSH,
@@ -980,7 +1482,17 @@ ecs_loc_pre_gmsh__lit_nodes_v4(ecs_maillage_t   *maillage,
       }
       else {
 
-        for (unsigned long bn = 0; bn < n_ent_nodes; bn++, ind_nod++) {
+        ecs_loc_gmsh_noeuds_t  d_nod = {*som_val_label + ind_nod, NULL};
+
+        unsigned long bn
+          = ecs_loc_pre_gmsh__lit_lignes_map(fic_maillage,
+                                             num_ligne,
+                                             n_ent_nodes,
+                                             ecs_loc_pre_gmsh__decode_noeud,
+                                             &d_nod);
+        ind_nod += bn;
+
+        for ( ; bn < n_ent_nodes; bn++, ind_nod++) {
 
           ecs_file_gets(chaine,
                         ECS_LOC_LNG_MAX_CHAINE_GMSH,
@@ -1006,7 +1518,17 @@ ecs_loc_pre_gmsh__lit_nodes_v4(ecs_maillage_t   *maillage,
 
         ind_nod -= n_ent_nodes;
 
-        for (unsigned long bn = 0; bn < n_ent_nodes; bn++, ind_nod++) {
+        d_nod.label = NULL;
+        d_nod.coord = som_val_coord + ind_nod*3;
+
+        bn = ecs_loc_pre_gmsh__lit_lignes_map(fic_maillage,
+                                              num_ligne,
+                                              n_ent_nodes,
+                                              ecs_loc_pre_gmsh__decode_noeud,
+                                              &d_nod);
+        ind_nod += bn;
+
+        for ( ; bn < n_ent_nodes; bn++, ind_nod++) {
 
           ecs_file_gets(chaine,
                         ECS_LOC_LNG_MAX_CHAINE_GMSH,
@@ -1151,15 +1673,12 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
   /* Variables Gmsh lues */
 
   long        label;
-  ecs_int_t   type_ecs;
   ecs_int_t   coul_elt;
   ecs_int_t   ind_elt;
   ecs_int_t   nbr_elt;
   ecs_int_t   nbr_elt_lus;
   ecs_int_t   nbr_elt_tot;
   ecs_int_t   ind_nod_elt;
-  ecs_int_t   ind_som_elt;
-  ecs_int_t   nbr_som_elt;
   ecs_int_t   ind_tag_elt;
   ecs_int_t   nbr_tag_elt;
 
@@ -1169,9 +1688,7 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
   int         type_gmsh;
   ecs_int_t   nbr_nod_elt_gmsh;
   ecs_int_t   num_nod_elt_gmsh[ECS_GMSH_NBR_MAX_SOM];
-  ecs_int_t   ent_num;
 
-  ecs_int_t   icoul;
   ecs_int_t   ient;
 
   ecs_int_t    cpt_coul_ent[ECS_N_ENTMAIL]; /* Compteur de couleurs         */
@@ -1250,7 +1767,78 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
 
   if (type_fmt_gmsh == 0) {
 
-    for (ind_elt = 0; ind_elt < nbr_elt; ind_elt++) {
+    /* Decode lines in place when possible, line by line otherwise
+       (or after a line which could not be decoded) */
+
+    ecs_loc_gmsh_elts_t  d_elt;
+
+    size_t  n_max_b = ECS_MIN((size_t)nbr_elt, ECS_LOC_GMSH_BLOC_LIGNES);
+
+    d_elt.version = _version_fmt;
+    d_elt.type_bloc = 0;
+
+    ECS_MALLOC(d_elt.label, n_max_b, long);
+    ECS_MALLOC(d_elt.type, n_max_b, int);
+    ECS_MALLOC(d_elt.coul, n_max_b, ecs_int_t);
+    ECS_MALLOC(d_elt.nod, n_max_b*ECS_LOC_GMSH_NBR_MAX_SOM_LIN, ecs_int_t);
+
+    ind_elt = 0;
+
+    while (ind_elt < nbr_elt) {
+
+      size_t n_b = ECS_MIN((size_t)(nbr_elt - ind_elt), n_max_b);
+
+      size_t n_dec
+        = ecs_loc_pre_gmsh__lit_lignes_map(fic_maillage,
+                                           num_ligne,
+                                           n_b,
+                                           ecs_loc_pre_gmsh__decode_elt,
+                                           &d_elt);
+
+      for (size_t j = 0; j < n_dec; j++, ind_elt++) {
+
+        type_gmsh = d_elt.type[j];
+
+        if (type_gmsh < (int)GMSH_SEG2 || type_gmsh > (int) GMSH_POINT1)
+          ecs_error(__FILE__, __LINE__, 0,
+                    _("Error reading a Gmsh mesh file:\n"
+                      "at line %ld of file \"%s\".\n"
+                      "Type identifier <%d> for element <%ld> "
+                      "is not recognized."),
+                    (long)(*num_ligne - n_dec + j + 1),
+                    ecs_file_get_name(fic_maillage),
+                    (int)type_gmsh, (long)(d_elt.label[j]));
+
+        if (type_gmsh == GMSH_POINT1)
+          cpt_point += 1;
+        else if (type_gmsh == GMSH_SEG2 || type_gmsh == GMSH_SEG3)
+          cpt_are += 1;
+        else
+          ecs_loc_pre_gmsh__stocke_elt
+            (type_gmsh,
+             d_elt.coul[j],
+             d_elt.nod + j*ECS_LOC_GMSH_NBR_MAX_SOM_LIN,
+             cpt_elt_ent,
+             elt_pos_som_ent,
+             elt_val_som_ent,
+             elt_val_color_ent,
+             cpt_coul_ent,
+             val_coul_ent,
+             cpt_elt_coul_ent);
+
+      }
+
+      if (n_dec < n_b)
+        break;
+
+    }
+
+    ECS_FREE(d_elt.nod);
+    ECS_FREE(d_elt.coul);
+    ECS_FREE(d_elt.type);
+    ECS_FREE(d_elt.label);
+
+    for ( ; ind_elt < nbr_elt; ind_elt++) {
 
       if (ligne_decodee == false)
         break;
@@ -1290,9 +1878,7 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
                   (long)(*num_ligne), ecs_file_get_name(fic_maillage),
                   (int)type_gmsh, (long)label);
 
-      type_ecs         = ecs_gmsh_elt_liste_c[type_gmsh - 1].ecs_typ;
       nbr_nod_elt_gmsh = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
-      nbr_som_elt      = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
 
       if (type_gmsh == GMSH_POINT1) {
         cpt_point += 1;
@@ -1381,54 +1967,16 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
       /* Stockage des valeurs avant transfert dans la structure `maillage' */
       /*===================================================================*/
 
-      /* Identification de l'entité concernée */
-
-      ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
-
-      /* Position des numéros de sommets du prochain élément */
-
-      elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
-        elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
-
-      /* Connectivité de l'élément par ses numéros de sommets */
-
-      for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
-
-        elt_val_som_ent
-          [ent_num]
-          [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
-          = num_nod_elt_gmsh
-          [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
-
-      }
-
-      /* Couleur (tag) de l'élément lu */
-
-      icoul = 0;
-      while (icoul < cpt_coul_ent[ent_num]           &&
-             val_coul_ent[ent_num][icoul] != coul_elt)
-        icoul++;
-
-      if (icoul == cpt_coul_ent[ent_num]) {
-
-        /* La valeur de la couleur n'a pas encore été stockée */
-
-        ECS_REALLOC(val_coul_ent[ent_num]    , cpt_coul_ent[ent_num] + 1,
-                    ecs_int_t);
-        ECS_REALLOC(cpt_elt_coul_ent[ent_num], cpt_coul_ent[ent_num] + 1,
-                    ecs_size_t);
-        cpt_elt_coul_ent[ent_num][icoul] = 0;
-        val_coul_ent[ent_num][icoul] = coul_elt;
-        cpt_coul_ent[ent_num]++;
-
-      }
-
-      cpt_elt_coul_ent[ent_num][icoul]++;
-      elt_val_color_ent[ent_num][cpt_elt_ent[ent_num]] = icoul + 1;
-
-      /* Incrémentation du nombre d'éléments lus */
-
-      cpt_elt_ent[ent_num]++;
+      ecs_loc_pre_gmsh__stocke_elt(type_gmsh,
+                                   coul_elt,
+                                   num_nod_elt_gmsh,
+                                   cpt_elt_ent,
+                                   elt_pos_som_ent,
+                                   elt_val_som_ent,
+                                   elt_val_color_ent,
+                                   cpt_coul_ent,
+                                   val_coul_ent,
+                                   cpt_elt_coul_ent);
 
     }
 
@@ -1465,9 +2013,7 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
                     "Type identifier <%d> is not recognized."),
                   ecs_file_get_name(fic_maillage), (int)type_gmsh);
 
-      type_ecs         = ecs_gmsh_elt_liste_c[type_gmsh - 1].ecs_typ;
       nbr_nod_elt_gmsh = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
-      nbr_som_elt      = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
 
       for (ind_elt = 0; ind_elt < nbr_elt; ind_elt++) {
 
@@ -1499,54 +2045,16 @@ ecs_loc_pre_gmsh__lit_elements(ecs_maillage_t  *maillage,
         /* Stockage des valeurs avant transfert dans la structure `maillage' */
         /*===================================================================*/
 
-        /* Identification de l'entité concernée */
-
-        ent_num = ecs_maillage_pre__ret_typ_geo(type_ecs);
-
-        /* Position des numéros de sommets du prochain élément */
-
-        elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num] + 1] =
-          elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] + nbr_som_elt;
-
-        /* Connectivité de l'élément par ses numéros de sommets */
-
-        for (ind_som_elt = 0; ind_som_elt < nbr_som_elt; ind_som_elt++) {
-
-          elt_val_som_ent
-            [ent_num]
-            [elt_pos_som_ent[ent_num][cpt_elt_ent[ent_num]] - 1 + ind_som_elt]
-            = num_nod_elt_gmsh
-            [ecs_gmsh_elt_liste_c[type_gmsh - 1].num_som[ind_som_elt] - 1];
-
-        }
-
-        /* Couleur (tag) de l'élément lu */
-
-        icoul = 0;
-        while (icoul < cpt_coul_ent[ent_num]           &&
-               val_coul_ent[ent_num][icoul] != coul_elt)
-          icoul++;
-
-        if (icoul == cpt_coul_ent[ent_num]) {
-
-          /* La valeur de la couleur n'a pas encore été stockée */
-
-          ECS_REALLOC(val_coul_ent[ent_num]    , cpt_coul_ent[ent_num] + 1,
-                      ecs_int_t);
-          ECS_REALLOC(cpt_elt_coul_ent[ent_num], cpt_coul_ent[ent_num] + 1,
-                      ecs_size_t);
-          cpt_elt_coul_ent[ent_num][icoul] = 0;
-          val_coul_ent[ent_num][icoul] = coul_elt;
-          cpt_coul_ent[ent_num]++;
-
-        }
-
-        cpt_elt_coul_ent[ent_num][icoul]++;
-        elt_val_color_ent[ent_num][cpt_elt_ent[ent_num]] = icoul + 1;
-
-        /* Incrémentation du nombre d'éléments lus */
-
-        cpt_elt_ent[ent_num]++;
+        ecs_loc_pre_gmsh__stocke_elt(type_gmsh,
+                                     coul_elt,
+                                     num_nod_elt_gmsh,
+                                     cpt_elt_ent,
+                                     elt_pos_som_ent,
+                                     elt_val_som_ent,
+                                     elt_val_color_ent,
+                                     cpt_coul_ent,
+                                     val_coul_ent,
+                                     cpt_elt_coul_ent);
 
       }
 
@@ -1750,6 +2258,21 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
 
   if (type_fmt_gmsh == 0) {
 
+    /* Buffers for in-place decoding */
+
+    ecs_loc_gmsh_elts_t  d_elt;
+
+    bool    lignes_map = true;
+    size_t  n_max_b = ECS_MIN((size_t)nbr_elt, ECS_LOC_GMSH_BLOC_LIGNES);
+
+    d_elt.version = 4;
+    d_elt.type_bloc = 0;
+    d_elt.type = NULL;
+    d_elt.coul = NULL;
+
+    ECS_MALLOC(d_elt.label, n_max_b, long);
+    ECS_MALLOC(d_elt.nod, n_max_b*ECS_LOC_GMSH_NBR_MAX_SOM_LIN, ecs_int_t);
+
     for (unsigned long eb = 0; eb < n_ent_blocks; eb++) {
 
       int tag_ent, dim_ent, elt_type;
@@ -1790,6 +2313,10 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
       nbr_nod_elt_gmsh = ecs_gmsh_elt_liste_c[type_gmsh - 1].nbr_som;
       nbr_som_elt      = ecs_fic_elt_typ_liste_c[type_ecs].nbr_som;
 
+      size_t  n_dec = 0, j_dec = 0;
+
+      d_elt.type_bloc = type_gmsh;
+
       for (unsigned long be = 0; be < n_ent_elt; be++, ind_elt++) {
 
         if (ligne_decodee == false)
@@ -1797,17 +2324,41 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
 
         ligne_decodee = false;
 
-        ecs_file_gets(chaine, ECS_LOC_LNG_MAX_CHAINE_GMSH,
-                      fic_maillage, num_ligne);
+        /* Decode lines in place by blocks when possible,
+           line by line otherwise */
+
+        if (j_dec == n_dec && lignes_map) {
+          size_t n_b = ECS_MIN((size_t)(n_ent_elt - be), n_max_b);
+          n_dec = ecs_loc_pre_gmsh__lit_lignes_map(fic_maillage,
+                                                   num_ligne,
+                                                   n_b,
+                                                   ecs_loc_pre_gmsh__decode_elt,
+                                                   &d_elt);
+          j_dec = 0;
+          if (n_dec < n_b)
+            lignes_map = false;
+        }
+
+        bool ligne_map = (j_dec < n_dec);
 
-        /* Au format Gmsh 4.0, pour chaque élément, on a les entiers suivants :
-           <tag> <liste_sommets> */
+        if (ligne_map)
+          j_dec++;
 
-        /* Lecture du label de l'élément courant */
+        else {
 
-        ssch = strtok(chaine, " ");
-        if (ssch == NULL)
-          break;
+          ecs_file_gets(chaine, ECS_LOC_LNG_MAX_CHAINE_GMSH,
+                        fic_maillage, num_ligne);
+
+          /* Au format Gmsh 4.0, pour chaque élément, on a les entiers
+             suivants : <tag> <liste_sommets> */
+
+          /* Lecture du label de l'élément courant */
+
+          ssch = strtok(chaine, " ");
+          if (ssch == NULL)
+            break;
+
+        }
 
         if (type_gmsh == GMSH_POINT1) {
           cpt_point += 1;
@@ -1822,17 +2373,33 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
 
         /* Lecture des numéros des sommets de l'élément courant */
 
-        for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++) {
+        if (ligne_map) {
 
-          ssch   = strtok(NULL, " ");
-          if (ssch == NULL)
-            break;
+          const ecs_int_t *nod
+            = d_elt.nod + (j_dec - 1)*ECS_LOC_GMSH_NBR_MAX_SOM_LIN;
+
+          for (ind_nod_elt = 0;
+               (   ind_nod_elt < nbr_nod_elt_gmsh
+                && ind_nod_elt < ECS_LOC_GMSH_NBR_MAX_SOM_LIN);
+               ind_nod_elt++)
+            num_nod_elt_gmsh[ind_nod_elt] = nod[ind_nod_elt];
 
-          num_nod_elt_gmsh[ind_nod_elt] = (ecs_int_t)(atol(ssch));
         }
+        else {
 
-        if (ssch == NULL && ind_nod_elt < nbr_nod_elt_gmsh)
-          break;
+          for (ind_nod_elt = 0; ind_nod_elt < nbr_nod_elt_gmsh; ind_nod_elt++) {
+
+            ssch   = strtok(NULL, " ");
+            if (ssch == NULL)
+              break;
+
+            num_nod_elt_gmsh[ind_nod_elt] = (ecs_int_t)(atol(ssch));
+          }
+
+          if (ssch == NULL && ind_nod_elt < nbr_nod_elt_gmsh)
+            break;
+
+        }
 
         ligne_decodee = true;
 
@@ -1884,6 +2451,9 @@ ecs_loc_pre_gmsh__lit_elements_v4(ecs_maillage_t  *maillage,
 
     }
 
+    ECS_FREE(d_elt.nod);
+    ECS_FREE(d_elt.label);
+
   }
   else {
 
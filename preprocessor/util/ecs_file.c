@@ -65,6 +65,10 @@
 #include <sys/types.h>
 #endif /* defined(HAVE_SYS_TYPES_H) && defined(HAVE_SYS_STAT_H) */
 
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP) && defined(HAVE_MUNMAP)
+#include <sys/mman.h>
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -109,6 +113,10 @@ struct _ecs_file_t {
   ecs_file_type_t    type;        /* Type (text, binary, Fortan binary) */
   int                swp_endian;  /* Swap big-endian and little-endian ? */
 
+  char              *map;         /* Mapped (or loaded) file contents */
+  size_t             map_size;    /* Size of mapped contents */
+  int                map_type;    /* 0: none, 1: mmap, 2: loaded in memory */
+
 };
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -598,6 +606,10 @@ ecs_file_open(const char             *name,
 
   f->swp_endian = 0;
 
+  f->map = NULL;
+  f->map_size = 0;
+  f->map_type = 0;
+
   /* Open file. In case of failure, destroy the allocated structure;
      this is only useful with a non-default error handler,
      as the program is terminated by default */
@@ -793,6 +805,8 @@ ecs_file_close_stream(ecs_file_t  *f)
 
   assert(f != NULL);
 
+  ecs_file_unmap(f);
+
   if (f->ptr != NULL) {
     retval = fclose(f->ptr);
     if (retval != 0) {
@@ -1129,6 +1143,118 @@ ecs_file_seek(ecs_file_t             *f,
   return retval;
 }
 
+/*!
+ * \brief Map the contents of a file to memory.
+ *
+ * The whole file is mapped in read-only mode, using mmap() when available,
+ * or loaded in memory otherwise. This allows parsing large text files
+ * in place, possibly in parallel, avoiding line-by-line reads.
+ * The file's position indicator is not modified.
+ *
+ * Compressed (gzipped) files are not mapped, in which case NULL is
+ * returned, and the caller should fall back to the usual read functions.
+ *
+ * The mapping remains valid until ecs_file_unmap() or ecs_file_close_stream()
+ * is called; calling this function on an already mapped file simply
+ * returns the current mapping.
+ *
+ * \param [in]  f    ecs_file_t descriptor.
+ * \param [out] size size of mapped contents, in bytes.
+ *
+ * \return pointer to mapped contents, or NULL if not available.
+ */
+
+const char *
+ecs_file_map(ecs_file_t  *f,
+             size_t      *size)
+{
+  assert(f != NULL);
+
+  *size = 0;
+
+  if (f->map != NULL) {
+    *size = f->map_size;
+    return f->map;
+  }
+
+  if (f->ptr == NULL)
+    return NULL;
+
+  ecs_file_off_t cur_pos = ecs_file_tell(f);
+  ecs_file_seek(f, 0, ECS_FILE_SEEK_END);
+  ecs_file_off_t end_pos = ecs_file_tell(f);
+
+  if (end_pos > 0) {
+
+    size_t map_size = end_pos;
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP) && defined(HAVE_MUNMAP)
+
+    fflush(f->ptr);
+
+    void *p = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE,
+                   fileno(f->ptr), 0);
+
+    if (p != MAP_FAILED) {
+      f->map = p;
+      f->map_type = 1;
+    }
+
+#endif
+
+    /* Fallback to loading file contents */
+
+    if (f->map == NULL) {
+      ECS_MALLOC(f->map, map_size, char);
+      ecs_file_rewind(f);
+      if (fread(f->map, 1, map_size, f->ptr) != map_size)
+        ecs_error(__FILE__, __LINE__, 0,
+                  _("Error loading contents of file \"%s\":\n\n  %s"),
+                  f->name, _ecs_file_error_string(f));
+      f->map_type = 2;
+    }
+
+    f->map_size = map_size;
+
+  }
+
+  ecs_file_seek(f, cur_pos, ECS_FILE_SEEK_SET);
+
+  *size = f->map_size;
+
+  return f->map;
+}
+
+/*!
+ * \brief Release a file's memory mapping, if present.
+ *
+ * \param [in] f ecs_file_t descriptor.
+ */
+
+void
+ecs_file_unmap(ecs_file_t  *f)
+{
+  assert(f != NULL);
+
+  if (f->map == NULL)
+    return;
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP) && defined(HAVE_MUNMAP)
+  if (f->map_type == 1) {
+    if (munmap(f->map, f->map_size) != 0)
+      ecs_error(__FILE__, __LINE__, errno,
+                _("Error unmapping file \"%s\"."), f->name);
+  }
+#endif
+
+  if (f->map_type == 2)
+    ECS_FREE(f->map);
+
+  f->map = NULL;
+  f->map_size = 0;
+  f->map_type = 0;
+}
+
 /*!
  * \brief Return a file's name.
  *
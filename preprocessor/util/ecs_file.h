@@ -251,6 +251,38 @@ ecs_file_seek(ecs_file_t             *f,
               const ecs_file_off_t    offset,
               const ecs_file_seek_t   whence);
 
+/*
+ * Map the contents of a file to memory.
+ *
+ * The whole file is mapped in read-only mode, using mmap() when available,
+ * or loaded in memory otherwise. The file's position indicator is not
+ * modified. Compressed files are not mapped, in which case NULL is returned.
+ *
+ * The mapping remains valid until ecs_file_unmap() or ecs_file_close_stream()
+ * is called.
+ *
+ * parameters:
+ *   f:    <-- ecs_file_t descriptor.
+ *   size: --> size of mapped contents, in bytes.
+ *
+ * returns:
+ *   pointer to mapped contents, or NULL if not available.
+ */
+
+const char *
+ecs_file_map(ecs_file_t  *f,
+             size_t      *size);
+
+/*
+ * Release a file's memory mapping, if present.
+ *
+ * parameter:
+ *   f: <-- ecs_file_t descriptor.
+ */
+
+void
+ecs_file_unmap(ecs_file_t  *f);
+
 /*
  * Return a file's name.
  *
@@ -99,6 +99,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_benchmark.h"
+#include "cs_benchmark_kernels.h"
 #include "cs_benchmark_matrix.h"
 
 /*----------------------------------------------------------------------------*/
@@ -1082,6 +1083,11 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  /* Time other main computational kernels */
+  /*----------------------------------------*/
+
+  cs_benchmark_kernels(t_measure);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
@@ -0,0 +1,1015 @@
+/*============================================================================
+ * Computational kernels benchmarking
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_boundary_conditions.h"
+#include "cs_convection_diffusion.h"
+#include "cs_gradient.h"
+#include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_matrix.h"
+#include "cs_matrix_default.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_multigrid.h"
+#include "cs_numbering.h"
+#include "cs_parall.h"
+#include "cs_parameters.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_benchmark_kernels.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Kernel input (shared by all kernels, each using only part of it) */
+/*------------------------------------------------------------------*/
+
+typedef struct {
+
+  /* Options */
+
+  cs_gradient_type_t     gradient_type;   /* Gradient type */
+  cs_halo_type_t         halo_type;       /* Halo type */
+  int                    stride;          /* Values per cell */
+
+  cs_var_cal_opt_t       eqp;             /* Equation parameters */
+
+  /* Boundary condition coefficients */
+
+  cs_real_t             *coefa;           /* Scalar BC coefficients */
+  cs_real_t             *coefb;
+  cs_real_3_t           *coefav;          /* Vector BC coefficients */
+  cs_real_33_t          *coefbv;
+
+  /* Face fluxes */
+
+  cs_real_t             *i_massflux;
+  cs_real_t             *b_massflux;
+  cs_real_t             *i_visc;
+  cs_real_t             *b_visc;
+
+  /* Work arrays */
+
+  cs_real_t             *val;             /* Values (n_cells_ext*3) */
+  cs_real_t             *val_pre;         /* Previous values */
+  cs_real_t             *rhs;             /* Right-hand side (n_cells_ext*3) */
+  cs_real_t             *grad;            /* Gradient (n_cells_ext*9) */
+
+  /* Multigrid */
+
+  cs_multigrid_t        *mg;
+  const cs_matrix_t     *a;
+  int                    n_iter;
+  double                 residue;
+
+  /* All-to-all exchange */
+
+  cs_lnum_t              n_elts;
+  int                   *dest_rank;
+
+} _kernel_input_t;
+
+/* Kernel function */
+
+typedef void
+(_kernel_t) (_kernel_input_t  *ki);
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Print kernel timing statistics.
+ *
+ * Operation and byte counts are local estimates for a single call;
+ * either may be 0 if not relevant. In parallel, aggregate rates are
+ * based on the maximum time, and load imbalance is the ratio of the
+ * maximum to mean time.
+ *
+ * parameters:
+ *   name    <-- kernel name
+ *   n_runs  <-- number of runs
+ *   n_flops <-- estimated local floating-point operations per run
+ *   n_bytes <-- estimated local memory traffic (or data exchanged) per run
+ *   wt      <-- wall-clock time
+ *----------------------------------------------------------------------------*/
+
+static void
+_print_kernel_stats(const char  *name,
+                    int          n_runs,
+                    double       n_flops,
+                    double       n_bytes,
+                    double       wt)
+{
+  size_t l = strlen(name);
+  char underline[81];
+
+  l = CS_MIN(l, 80);
+  memset(underline, '-', l);
+  underline[l] = '\0';
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "%s\n"
+                "%s\n"
+                "  (calls: %d)\n",
+                name, underline, n_runs);
+
+  double t = wt / n_runs;
+
+  if (cs_glob_n_ranks == 1) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  Wall clock:  %12.5e\n", t);
+    if (n_flops > 0 && t > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  GFLOPS:      %12.5e\n", n_flops/t*1e-9);
+    if (n_bytes > 0 && t > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  GB/s:        %12.5e\n", n_bytes/t*1e-9);
+    return;
+  }
+
+  double t_min = t, t_max = t, t_sum = t;
+  double c_sum[2] = {n_flops, n_bytes};
+
+  cs_parall_min(1, CS_DOUBLE, &t_min);
+  cs_parall_max(1, CS_DOUBLE, &t_max);
+  cs_parall_sum(1, CS_DOUBLE, &t_sum);
+  cs_parall_sum(2, CS_DOUBLE, c_sum);
+
+  double t_mean = t_sum / cs_glob_n_ranks;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "               Mean         Min          Max          Total\n"
+                "  Wall clock:  %12.5e %12.5e %12.5e\n",
+                t_mean, t_min, t_max);
+
+  if (c_sum[0] > 0 && t_max > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  GFLOPS:      %38s %12.5e\n", "", c_sum[0]/t_max*1e-9);
+  if (c_sum[1] > 0 && t_max > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  GB/s:        %38s %12.5e\n", "", c_sum[1]/t_max*1e-9);
+  if (t_mean > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  Imbalance:   %12.5e\n", t_max/t_mean);
+}
+
+/*----------------------------------------------------------------------------
+ * Time a kernel.
+ *
+ * The kernel is called once before timing (so as to exclude lazy
+ * initializations), then the number of runs is doubled until the
+ * minimum measure time is reached on all ranks.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   kernel    <-- kernel function
+ *   ki        <-> kernel input
+ *   n_runs    --> number of runs
+ *
+ * returns:
+ *   local wall-clock time for n_runs calls
+ *----------------------------------------------------------------------------*/
+
+static double
+_time_kernel(double            t_measure,
+             _kernel_t        *kernel,
+             _kernel_input_t  *ki,
+             int              *n_runs)
+{
+  int run_id = 0;
+
+  kernel(ki);
+
+  *n_runs = (t_measure > 0) ? 4 : 1;
+
+  double wt0 = cs_timer_wtime(), wt1 = wt0;
+
+  while (run_id < *n_runs) {
+    while (run_id < *n_runs) {
+      kernel(ki);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    double wt_r0 = wt1 - wt0;
+    cs_parall_max(1, CS_DOUBLE, &wt_r0);
+    if (wt_r0 < t_measure)
+      *n_runs *= 2;
+  }
+
+  return wt1 - wt0;
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate operation and memory traffic counts for a gradient.
+ *
+ * Only the face-based loops of a single reconstruction pass are
+ * considered, so these should be seen as effective rates.
+ *
+ * parameters:
+ *   stride  <-- number of components of the variable
+ *   n_flops --> estimated number of floating-point operations
+ *   n_bytes --> estimated memory traffic
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_counts(int      stride,
+                 double  *n_flops,
+                 double  *n_bytes)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const double nc = m->n_cells, nce = m->n_cells_with_ghosts;
+  const double nif = m->n_i_faces, nbf = m->n_b_faces;
+  const double l = sizeof(cs_lnum_t), r = sizeof(cs_real_t);
+  const double s = stride;
+
+  *n_flops = s*(9*nif + 5*nbf + 3*nc);
+
+  *n_bytes =   nif*(2*l + 4*r)           /* face -> cells, normal, weight */
+             + nbf*(l + 3*r)             /* face -> cell, normal */
+             + nc*r                      /* cell volume */
+             + nce*s*r                   /* values */
+             + nbf*(s + s*s)*r           /* BC coefficients */
+             + nc*3*s*r*2;               /* gradient (read/write) */
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate operation and memory traffic counts for a convection-diffusion
+ * balance (excluding the gradient used for reconstruction).
+ *
+ * parameters:
+ *   stride  <-- number of components of the variable
+ *   n_flops --> estimated number of floating-point operations
+ *   n_bytes --> estimated memory traffic
+ *----------------------------------------------------------------------------*/
+
+static void
+_convection_diffusion_counts(int      stride,
+                             double  *n_flops,
+                             double  *n_bytes)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const double nc = m->n_cells, nce = m->n_cells_with_ghosts;
+  const double nif = m->n_i_faces, nbf = m->n_b_faces;
+  const double l = sizeof(cs_lnum_t), r = sizeof(cs_real_t);
+  const double s = stride;
+
+  *n_flops = s*(30*nif + 12*nbf);
+
+  *n_bytes =   nif*(2*l + 12*r)          /* connectivity, geometry, fluxes */
+             + nbf*(l + 6*r)
+             + nce*s*r*2                 /* values (current and previous) */
+             + nce*3*s*r                 /* gradient */
+             + nbf*(s + s*s)*r*2         /* BC coefficients */
+             + nc*s*r*2;                 /* right-hand side (read/write) */
+}
+
+/*----------------------------------------------------------------------------
+ * Scalar gradient kernel.
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_scalar_gradient(_kernel_input_t  *ki)
+{
+  cs_gradient_scalar("benchmark",
+                     ki->gradient_type,
+                     ki->halo_type,
+                     1,                    /* inc */
+                     false,                /* recompute_cocg */
+                     ki->eqp.nswrgr,
+                     0,                    /* tr_dim */
+                     0,                    /* hyd_p_flag */
+                     1,                    /* w_stride */
+                     0,                    /* verbosity */
+                     ki->eqp.imligr,
+                     ki->eqp.epsrgr,
+                     ki->eqp.climgr,
+                     NULL,                 /* f_ext */
+                     ki->coefa,
+                     ki->coefb,
+                     ki->val,
+                     NULL,                 /* c_weight */
+                     NULL,                 /* internal coupling */
+                     (cs_real_3_t *)ki->grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Vector gradient kernel.
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_vector_gradient(_kernel_input_t  *ki)
+{
+  cs_gradient_vector("benchmark",
+                     ki->gradient_type,
+                     ki->halo_type,
+                     1,                    /* inc */
+                     ki->eqp.nswrgr,
+                     0,                    /* verbosity */
+                     ki->eqp.imligr,
+                     ki->eqp.epsrgr,
+                     ki->eqp.climgr,
+                     (const cs_real_3_t *)ki->coefav,
+                     (const cs_real_33_t *)ki->coefbv,
+                     (cs_real_3_t *)ki->val,
+                     NULL,                 /* c_weight */
+                     NULL,                 /* internal coupling */
+                     (cs_real_33_t *)ki->grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Scalar convection-diffusion kernel.
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_scalar_convection_diffusion(_kernel_input_t  *ki)
+{
+  cs_convection_diffusion_scalar(0,        /* idtvar */
+                                 -1,       /* f_id */
+                                 ki->eqp,
+                                 0,        /* icvflb */
+                                 1,        /* inc */
+                                 1,        /* iccocg */
+                                 0,        /* imasac */
+                                 ki->val,
+                                 ki->val_pre,
+                                 NULL,     /* icvfli */
+                                 ki->coefa,
+                                 ki->coefb,
+                                 ki->coefa,
+                                 ki->coefb,
+                                 ki->i_massflux,
+                                 ki->b_massflux,
+                                 ki->i_visc,
+                                 ki->b_visc,
+                                 ki->rhs);
+}
+
+/*----------------------------------------------------------------------------
+ * Vector convection-diffusion kernel.
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_vector_convection_diffusion(_kernel_input_t  *ki)
+{
+  cs_convection_diffusion_vector(0,        /* idtvar */
+                                 -1,       /* f_id */
+                                 ki->eqp,
+                                 0,        /* icvflb */
+                                 1,        /* inc */
+                                 0,        /* ivisep */
+                                 0,        /* imasac */
+                                 (cs_real_3_t *)ki->val,
+                                 (const cs_real_3_t *)ki->val_pre,
+                                 NULL,     /* icvfli */
+                                 (const cs_real_3_t *)ki->coefav,
+                                 (const cs_real_33_t *)ki->coefbv,
+                                 (const cs_real_3_t *)ki->coefav,
+                                 (const cs_real_33_t *)ki->coefbv,
+                                 ki->i_massflux,
+                                 ki->b_massflux,
+                                 ki->i_visc,
+                                 ki->b_visc,
+                                 NULL,     /* i_secvis */
+                                 NULL,     /* b_secvis */
+                                 (cs_real_3_t *)ki->rhs);
+}
+
+/*----------------------------------------------------------------------------
+ * Halo synchronization kernel.
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_sync(_kernel_input_t  *ki)
+{
+  cs_halo_sync_var_strided(cs_glob_mesh->halo,
+                           ki->halo_type,
+                           ki->grad,
+                           ki->stride);
+}
+
+/*----------------------------------------------------------------------------
+ * Multigrid setup kernel (setup and free).
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_setup(_kernel_input_t  *ki)
+{
+  cs_multigrid_setup(ki->mg, "benchmark", ki->a, 0);
+  cs_multigrid_free(ki->mg);
+}
+
+/*----------------------------------------------------------------------------
+ * Multigrid solve kernel (setup must have been done).
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_solve(_kernel_input_t  *ki)
+{
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    ki->grad[i] = 0.;
+
+  cs_multigrid_solve(ki->mg,
+                     "benchmark",
+                     ki->a,
+                     0,                    /* verbosity */
+                     1e-8,                 /* precision */
+                     1.,                   /* r_norm */
+                     &(ki->n_iter),
+                     &(ki->residue),
+                     ki->rhs,
+                     ki->grad,
+                     0,
+                     NULL);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * All-to-all exchange kernel (create, copy and destroy).
+ *
+ * parameters:
+ *   ki <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_all_to_all(_kernel_input_t  *ki)
+{
+  cs_all_to_all_t *d = cs_all_to_all_create(ki->n_elts,
+                                            0,     /* flags */
+                                            NULL,  /* dest_id */
+                                            ki->dest_rank,
+                                            cs_glob_mpi_comm);
+
+  cs_real_t *recv = cs_all_to_all_copy_array(d,
+                                             CS_REAL_TYPE,
+                                             ki->stride,
+                                             false,
+                                             ki->val,
+                                             NULL);
+
+  BFT_FREE(recv);
+
+  cs_all_to_all_destroy(&d);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Benchmark gradients.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   ki        <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_benchmark_gradients(double            t_measure,
+                     _kernel_input_t  *ki)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const cs_gradient_type_t g_types[] = {CS_GRADIENT_GREEN_ITER,
+                                        CS_GRADIENT_LSQ,
+                                        CS_GRADIENT_GREEN_LSQ,
+                                        CS_GRADIENT_GREEN_VTX};
+
+  const char *h_name[] = {"standard", "extended"};
+
+  int n_halo_types = (m->halo_type == CS_HALO_EXTENDED) ? 2 : 1;
+
+  char name[128];
+  double n_flops, n_bytes;
+  int n_runs;
+
+  for (int h = 0; h < n_halo_types; h++) {
+
+    ki->halo_type = (h == 0) ? CS_HALO_STANDARD : CS_HALO_EXTENDED;
+
+    for (int t = 0; t < 4; t++) {
+
+      /* The extended neighborhood is only used by least-squares variants */
+
+      if (h > 0 && (   g_types[t] == CS_GRADIENT_GREEN_ITER
+                    || g_types[t] == CS_GRADIENT_GREEN_VTX))
+        continue;
+
+      ki->gradient_type = g_types[t];
+
+      double wt = _time_kernel(t_measure, _scalar_gradient, ki, &n_runs);
+
+      snprintf(name, 127, "Scalar gradient: %s (%s halo)",
+               _(cs_gradient_type_name[g_types[t]]), h_name[h]);
+      name[127] = '\0';
+
+      _gradient_counts(1, &n_flops, &n_bytes);
+      _print_kernel_stats(name, n_runs, n_flops, n_bytes, wt);
+
+      wt = _time_kernel(t_measure, _vector_gradient, ki, &n_runs);
+
+      snprintf(name, 127, "Vector gradient: %s (%s halo)",
+               _(cs_gradient_type_name[g_types[t]]), h_name[h]);
+      name[127] = '\0';
+
+      _gradient_counts(3, &n_flops, &n_bytes);
+      _print_kernel_stats(name, n_runs, n_flops, n_bytes, wt);
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark convection-diffusion balances.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   ki        <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_benchmark_convection_diffusion(double            t_measure,
+                                _kernel_input_t  *ki)
+{
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  double n_flops, n_bytes, g_flops, g_bytes;
+  int n_runs;
+
+  /* Boundary face types are needed by the balance operators */
+
+  bool free_bc_type = false;
+  if (cs_glob_bc_type == NULL) {
+    cs_boundary_conditions_create();
+    free_bc_type = true;
+  }
+
+  ki->halo_type = CS_HALO_STANDARD;
+
+  for (cs_lnum_t i = 0; i < n_cells_ext*3; i++)
+    ki->rhs[i] = 0.;
+
+  double wt = _time_kernel(t_measure,
+                           _scalar_convection_diffusion,
+                           ki,
+                           &n_runs);
+
+  _convection_diffusion_counts(1, &n_flops, &n_bytes);
+  _gradient_counts(1, &g_flops, &g_bytes);
+  _print_kernel_stats("Scalar convection-diffusion balance",
+                      n_runs, n_flops + g_flops, n_bytes + g_bytes, wt);
+
+  wt = _time_kernel(t_measure,
+                    _vector_convection_diffusion,
+                    ki,
+                    &n_runs);
+
+  _convection_diffusion_counts(3, &n_flops, &n_bytes);
+  _gradient_counts(3, &g_flops, &g_bytes);
+  _print_kernel_stats("Vector convection-diffusion balance",
+                      n_runs, n_flops + g_flops, n_bytes + g_bytes, wt);
+
+  if (free_bc_type)
+    cs_boundary_conditions_free();
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark halo synchronizations.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   ki        <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_benchmark_halo(double            t_measure,
+                _kernel_input_t  *ki)
+{
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+
+  if (halo == NULL)
+    return;
+
+  const int strides[] = {1, 3, 6, 9};
+
+  char name[64];
+  int n_runs;
+
+  ki->halo_type = CS_HALO_STANDARD;
+
+  for (int i = 0; i < 4; i++) {
+
+    ki->stride = strides[i];
+
+    double wt = _time_kernel(t_measure, _halo_sync, ki, &n_runs);
+
+    double n_bytes =   (halo->n_send_elts[0] + halo->n_elts[0])
+                     * ki->stride * sizeof(cs_real_t);
+
+    snprintf(name, 63, "Halo synchronization (stride %d)", ki->stride);
+    name[63] = '\0';
+
+    _print_kernel_stats(name, n_runs, 0, n_bytes, wt);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark multigrid setup and solve.
+ *
+ * A Laplacian-type matrix with Dirichlet conditions on all boundary
+ * faces is used.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   ki        <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_benchmark_multigrid(double            t_measure,
+                     _kernel_input_t  *ki)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  const cs_multigrid_type_t mg_types[] = {CS_MULTIGRID_V_CYCLE,
+                                          CS_MULTIGRID_K_CYCLE};
+
+  cs_real_t *da, *xa;
+
+  BFT_MALLOC(da, n_cells_ext, cs_real_t);
+  BFT_MALLOC(xa, n_i_faces, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    da[i] = 0.;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    xa[f_id] = -mq->i_face_surf[f_id] / mq->i_dist[f_id];
+    da[i_face_cells[f_id][0]] -= xa[f_id];
+    da[i_face_cells[f_id][1]] -= xa[f_id];
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++)
+    da[m->b_face_cells[f_id]] += mq->b_face_surf[f_id] / mq->b_dist[f_id];
+
+  cs_matrix_t *a = cs_matrix_default(true, NULL, NULL);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_i_faces, i_face_cells, da, xa);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    ki->rhs[i] = mq->cell_vol[i];
+
+  ki->a = a;
+
+  char name[96];
+  int n_runs;
+
+  for (int t = 0; t < 2; t++) {
+
+    ki->mg = cs_multigrid_create(mg_types[t]);
+
+    double wt = _time_kernel(t_measure, _multigrid_setup, ki, &n_runs);
+
+    snprintf(name, 95, "Multigrid setup (%s)",
+             _(cs_multigrid_type_name[mg_types[t]]));
+    name[95] = '\0';
+
+    _print_kernel_stats(name, n_runs, 0, 0, wt);
+
+    cs_multigrid_setup(ki->mg, "benchmark", a, 0);
+
+    wt = _time_kernel(t_measure, _multigrid_solve, ki, &n_runs);
+
+    snprintf(name, 95, "Multigrid solve (%s)",
+             _(cs_multigrid_type_name[mg_types[t]]));
+    name[95] = '\0';
+
+    _print_kernel_stats(name, n_runs, 0, 0, wt);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  Cycles:      %12d\n"
+                  "  Residue:     %12.5e\n",
+                  ki->n_iter, ki->residue);
+
+    cs_multigrid_free(ki->mg);
+
+    void *mg = ki->mg;
+    cs_multigrid_destroy(&mg);
+    ki->mg = NULL;
+
+  }
+
+  ki->a = NULL;
+
+  BFT_FREE(xa);
+  BFT_FREE(da);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Benchmark all-to-all exchanges.
+ *
+ * Each cell's values are sent to a rank based on its global number,
+ * as is done when redistributing mesh data to or from blocks.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   ki        <-> kernel input
+ *----------------------------------------------------------------------------*/
+
+static void
+_benchmark_all_to_all(double            t_measure,
+                      _kernel_input_t  *ki)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  const cs_all_to_all_type_t a2a_types[] = {CS_ALL_TO_ALL_MPI_DEFAULT,
+                                            CS_ALL_TO_ALL_CRYSTAL_ROUTER};
+  const char *a2a_name[] = {"MPI_Alltoall and MPI_Alltoallv",
+                            "crystal router"};
+
+  cs_all_to_all_type_t a2a_type_prev = cs_all_to_all_get_type();
+
+  ki->n_elts = m->n_cells;
+  ki->stride = 3;
+
+  BFT_MALLOC(ki->dest_rank, ki->n_elts, int);
+
+  /* Scatter cells across ranks */
+
+  for (cs_lnum_t i = 0; i < ki->n_elts; i++) {
+    cs_gnum_t g_id = (m->global_cell_num != NULL) ?
+      m->global_cell_num[i] - 1 : (cs_gnum_t)i;
+    ki->dest_rank[i] = (g_id * 7919) % cs_glob_n_ranks;
+  }
+
+  char name[96];
+  int n_runs;
+
+  for (int t = 0; t < 2; t++) {
+
+    cs_all_to_all_set_type(a2a_types[t]);
+
+    double wt = _time_kernel(t_measure, _all_to_all, ki, &n_runs);
+
+    double n_bytes = ki->n_elts * ki->stride * sizeof(cs_real_t);
+
+    snprintf(name, 95, "All-to-all exchange, stride %d (%s)",
+             ki->stride, a2a_name[t]);
+    name[95] = '\0';
+
+    _print_kernel_stats(name, n_runs, 0, n_bytes, wt);
+
+  }
+
+  cs_all_to_all_set_type(a2a_type_prev);
+
+  BFT_FREE(ki->dest_rank);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Time main computational kernels on the current mesh.
+ *
+ * Scalar and vector gradients (for each gradient type), explicit
+ * convection-diffusion balances, halo synchronizations, multigrid
+ * setup and solve, and all-to-all exchanges are timed, and the
+ * wall-clock time, estimated GFlop/s and GB/s rates, and load
+ * imbalance are logged for each kernel.
+ *
+ * The mesh, its quantities and matrix API should be initialized.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_kernels(double  t_measure)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *i_face_cog = (const cs_real_3_t *)mq->i_face_cog;
+  const cs_real_t *i_face_surf = mq->i_face_surf;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Timing for computational kernels\n"
+                "================================\n\n"
+                "  Threads per rank:            %d\n"
+                "  Interior faces numbering:    %s\n\n"
+                "  (GFLOPS and GB/s are estimated from simplified\n"
+                "   operation and memory traffic counts for each kernel,\n"
+                "   so should be considered as effective rates.)\n",
+                cs_glob_n_threads,
+                (m->i_face_numbering != NULL) ?
+                _(cs_numbering_type_name[m->i_face_numbering->type]) : "-");
+
+  /* Initialize kernel input */
+
+  _kernel_input_t ki;
+
+  memset(&ki, 0, sizeof(_kernel_input_t));
+
+  ki.eqp = cs_parameters_var_cal_opt_default();
+  ki.eqp.imrgra = 0;
+  ki.stride = 1;
+  ki.halo_type = CS_HALO_STANDARD;
+
+  BFT_MALLOC(ki.val, n_cells_ext*3, cs_real_t);
+  BFT_MALLOC(ki.val_pre, n_cells_ext*3, cs_real_t);
+  BFT_MALLOC(ki.rhs, n_cells_ext*3, cs_real_t);
+  BFT_MALLOC(ki.grad, n_cells_ext*9, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++) {
+    for (cs_lnum_t j = 0; j < 3; j++)
+      ki.val[i*3 + j] = sin(cell_cen[i][j]) + cell_cen[i][(j+1)%3];
+  }
+  memcpy(ki.val_pre, ki.val, n_cells_ext*3*sizeof(cs_real_t));
+  for (cs_lnum_t i = 0; i < n_cells_ext*9; i++)
+    ki.grad[i] = 0.;
+
+  /* Homogeneous Neumann boundary conditions */
+
+  BFT_MALLOC(ki.coefa, n_b_faces, cs_real_t);
+  BFT_MALLOC(ki.coefb, n_b_faces, cs_real_t);
+  BFT_MALLOC(ki.coefav, n_b_faces, cs_real_3_t);
+  BFT_MALLOC(ki.coefbv, n_b_faces, cs_real_33_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    ki.coefa[f_id] = 0.;
+    ki.coefb[f_id] = 1.;
+    for (cs_lnum_t j = 0; j < 3; j++) {
+      ki.coefav[f_id][j] = 0.;
+      for (cs_lnum_t k = 0; k < 3; k++)
+        ki.coefbv[f_id][j][k] = (j == k) ? 1. : 0.;
+    }
+  }
+
+  /* Face fluxes */
+
+  BFT_MALLOC(ki.i_massflux, n_i_faces, cs_real_t);
+  BFT_MALLOC(ki.i_visc, n_i_faces, cs_real_t);
+  BFT_MALLOC(ki.b_massflux, n_b_faces, cs_real_t);
+  BFT_MALLOC(ki.b_visc, n_b_faces, cs_real_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    ki.i_massflux[f_id] = i_face_surf[f_id] * sin(i_face_cog[f_id][0]);
+    ki.i_visc[f_id] = i_face_surf[f_id];
+  }
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    ki.b_massflux[f_id] = 0.;
+    ki.b_visc[f_id] = 0.;
+  }
+
+  /* Run kernels */
+
+  cs_gradient_initialize();
+
+  _benchmark_gradients(t_measure, &ki);
+
+  _benchmark_convection_diffusion(t_measure, &ki);
+
+  cs_gradient_finalize();
+
+  _benchmark_halo(t_measure, &ki);
+
+  _benchmark_multigrid(t_measure, &ki);
+
+#if defined(HAVE_MPI)
+  _benchmark_all_to_all(t_measure, &ki);
+#endif
+
+  BFT_FREE(ki.b_visc);
+  BFT_FREE(ki.b_massflux);
+  BFT_FREE(ki.i_visc);
+  BFT_FREE(ki.i_massflux);
+
+  BFT_FREE(ki.coefbv);
+  BFT_FREE(ki.coefav);
+  BFT_FREE(ki.coefb);
+  BFT_FREE(ki.coefa);
+
+  BFT_FREE(ki.grad);
+  BFT_FREE(ki.rhs);
+  BFT_FREE(ki.val_pre);
+  BFT_FREE(ki.val);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
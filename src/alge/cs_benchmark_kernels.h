@@ -0,0 +1,74 @@
+#ifndef __CS_BENCHMARK_KERNELS_H__
+#define __CS_BENCHMARK_KERNELS_H__
+
+/*============================================================================
+ * Computational kernels benchmarking
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Time main computational kernels on the current mesh.
+ *
+ * Scalar and vector gradients (for each gradient type), explicit
+ * convection-diffusion balances, halo synchronizations, multigrid
+ * setup and solve, and all-to-all exchanges are timed, and the
+ * wall-clock time, estimated GFlop/s and GB/s rates, and load
+ * imbalance are logged for each kernel.
+ *
+ * The mesh, its quantities and matrix API should be initialized.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_kernels(double  t_measure);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_BENCHMARK_KERNELS_H__ */
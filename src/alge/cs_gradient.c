@@ -2243,6 +2243,96 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Recompute the boundary cells part of the least-squares cocg matrix
+ * for a scalar, given its boundary condition coefficients.
+ *
+ * parameters:
+ *   m       <-- pointer to associated mesh structure
+ *   fvq     <-- pointer to associated finite volume quantities
+ *   cpl     <-- structure associated with internal coupling, or NULL
+ *   coefbp  <-- B.C. coefficients for boundary face normals
+ *   cocgb   <-- saved boundary cells contribution of interior faces
+ *   cocg    <-> cocg matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           const cs_internal_coupling_t   *cpl,
+                           const cs_real_t                 coefbp[],
+                           const cs_real_33_t    *restrict cocgb,
+                           cs_real_33_t          *restrict cocg)
+{
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const bool  *coupled_faces = (cpl == NULL) ?
+    NULL : (const bool *)cpl->coupled_faces;
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t c_id = m->b_cells[ii];
+    for (cs_lnum_t ll = 0; ll < 3; ll++) {
+      for (cs_lnum_t mm = 0; mm < 3; mm++)
+        cocg[c_id][ll][mm] = cocgb[ii][ll][mm];
+    }
+  }
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        if (cpl == NULL || !coupled_faces[f_id]) {
+
+          cs_lnum_t ii = b_face_cells[f_id];
+
+          cs_real_t umcbdd = (1. - coefbp[f_id]) / b_dist[f_id];
+          cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+          cs_real_t dddij[3];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                        + umcbdd * diipb[f_id][ll];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            for (cs_lnum_t mm = 0; mm < 3; mm++)
+              cocg[ii][ll][mm] += dddij[ll]*dddij[mm];
+          }
+
+        }  /* face without internal coupling */
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t c_id = m->b_cells[ii];
+    cs_math_33_inv_cramer_sym_in_place(cocg[c_id]);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1).
@@ -2359,60 +2449,8 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   /* Compute cocg and save contribution at boundaries */
 
-  if (recompute_cocg) {
-
-    /* Recompute cocg at boundaries, using saved cocgb */
-
-#   pragma omp parallel for
-    for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
-      cs_lnum_t c_id = m->b_cells[ii];
-      for (cs_lnum_t ll = 0; ll < 3; ll++) {
-        for (cs_lnum_t mm = 0; mm < 3; mm++)
-          cocg[c_id][ll][mm] = cocgb[ii][ll][mm];
-      }
-    }
-
-    for (g_id = 0; g_id < n_b_groups; g_id++) {
-
-#     pragma omp parallel for
-      for (t_id = 0; t_id < n_b_threads; t_id++) {
-
-        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             f_id++) {
-
-          if (cpl == NULL || !coupled_faces[f_id]) {
-
-            cs_lnum_t ii = b_face_cells[f_id];
-
-            cs_real_t umcbdd = (1. - coefbp[f_id]) / b_dist[f_id];
-            cs_real_t udbfs = 1. / b_face_surf[f_id];
-
-            cs_real_t dddij[3];
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              dddij[ll] =   udbfs * b_face_normal[f_id][ll]
-                          + umcbdd * diipb[f_id][ll];
-
-            for (cs_lnum_t ll = 0; ll < 3; ll++) {
-              for (cs_lnum_t mm = 0; mm < 3; mm++)
-                cocg[ii][ll][mm] += dddij[ll]*dddij[mm];
-            }
-
-          }  /* face without internal coupling */
-
-        } /* loop on faces */
-
-      } /* loop on threads */
-
-    } /* loop on thread groups */
-
-#   pragma omp parallel for
-    for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
-      cs_lnum_t c_id = m->b_cells[ii];
-      cs_math_33_inv_cramer_sym_in_place(cocg[c_id]);
-    }
-
-  } /* End of recompute_cocg */
+  if (recompute_cocg)
+    _recompute_lsq_scalar_cocg(m, fvq, cpl, coefbp, cocgb, cocg);
 
   /* Compute Right-Hand Side */
   /*-------------------------*/
@@ -2777,6 +2815,372 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   BFT_FREE(rhsv);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalars using least-squares
+ * reconstruction in a single sweep over faces.
+ *
+ * Right-hand sides of all fields are interlaced, so that mesh geometry
+ * is read only once per face; the resulting gradient halos are
+ * synchronized in a single exchange.
+ *
+ * Hydrostatic pressure, internal coupling and anisotropic weighting are
+ * not handled here. Results are identical to those of successive calls
+ * to _lsq_scalar_gradient.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   n_fields       <-- number of fields
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   pvar           <-- variable, for each field
+ *   c_weight       <-- weighted gradient coefficient variable (shared),
+ *                      or NULL
+ *   grad           <-> gradient of each pvar (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           cs_halo_type_t                  halo_type,
+                           bool                            recompute_cocg,
+                           int                             n_fields,
+                           cs_real_t                       inc,
+                           const cs_real_t                *coefap[],
+                           const cs_real_t                *coefbp[],
+                           const cs_real_t         *const  pvar[],
+                           const cs_real_t       *restrict c_weight,
+                           cs_real_3_t                    *grad[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_real_t *restrict weight = fvq->weight;
+
+  const int n_f = n_fields;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     NULL,
+                     &cocg,
+                     &cocgb);
+
+  /* Boundary cells cocg depend on each field's B.C. coefficients */
+  /*--------------------------------------------------------------*/
+
+  cs_lnum_t *cell_b_id = NULL;
+  cs_real_33_t *b_cocg = NULL;
+
+  if (recompute_cocg) {
+
+    BFT_MALLOC(cell_b_id, n_cells, cs_lnum_t);
+    BFT_MALLOC(b_cocg, n_b_cells*n_f, cs_real_33_t);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      cell_b_id[c_id] = -1;
+
+#   pragma omp parallel for if (n_b_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      cell_b_id[m->b_cells[ii]] = ii;
+      for (int k = 0; k < n_f; k++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          for (cs_lnum_t mm = 0; mm < 3; mm++)
+            b_cocg[ii*n_f + k][ll][mm] = cocgb[ii][ll][mm];
+        }
+      }
+    }
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t ii = cell_b_id[b_face_cells[f_id]];
+
+          cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+          for (int k = 0; k < n_f; k++) {
+
+            cs_real_t umcbdd = (1. - coefbp[k][f_id]) / b_dist[f_id];
+
+            cs_real_t dddij[3];
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                          + umcbdd * diipb[f_id][ll];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              for (cs_lnum_t mm = 0; mm < 3; mm++)
+                b_cocg[ii*n_f + k][ll][mm] += dddij[ll]*dddij[mm];
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+#   pragma omp parallel for if (n_b_cells*n_f > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_b_cells*n_f; i++)
+      cs_math_33_inv_cramer_sym_in_place(b_cocg[i]);
+
+  } /* End of recompute_cocg */
+
+  /* Compute interlaced Right-Hand Sides */
+  /*-------------------------------------*/
+
+  cs_real_4_t  *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext*n_f, cs_real_4_t);
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    for (int k = 0; k < n_f; k++) {
+      rhsv[c_id*n_f + k][0] = 0.0;
+      rhsv[c_id*n_f + k][1] = 0.0;
+      rhsv[c_id*n_f + k][2] = 0.0;
+      rhsv[c_id*n_f + k][3] = pvar[k][c_id];
+    }
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+        cs_real_4_t *rhs_i = rhsv + ii*n_f;
+        cs_real_4_t *rhs_j = rhsv + jj*n_f;
+
+        if (c_weight != NULL) {
+          cs_real_t pond = weight[f_id];
+          cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                  + (1. - pond)*c_weight[jj]);
+          cs_real_t w_i = c_weight[jj] * denom;
+          cs_real_t w_j = c_weight[ii] * denom;
+
+          for (int k = 0; k < n_f; k++) {
+            /* (P_j - P_i) / ||d||^2 */
+            cs_real_t pfac = (rhs_j[k][3] - rhs_i[k][3]) / ddc;
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              cs_real_t fctb = dc[ll] * pfac;
+              rhs_i[k][ll] += w_i * fctb;
+              rhs_j[k][ll] += w_j * fctb;
+            }
+          }
+        }
+        else {
+          for (int k = 0; k < n_f; k++) {
+            /* (P_j - P_i) / ||d||^2 */
+            cs_real_t pfac = (rhs_j[k][3] - rhs_i[k][3]) / ddc;
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              cs_real_t fctb = dc[ll] * pfac;
+              rhs_i[k][ll] += fctb;
+              rhs_j[k][ll] += fctb;
+            }
+          }
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+      cs_real_4_t *rhs_i = rhsv + ii*n_f;
+
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+        const cs_real_4_t *rhs_j = rhsv + jj*n_f;
+
+        for (int k = 0; k < n_f; k++) {
+          cs_real_t pfac = (rhs_j[k][3] - rhs_i[k][3]) / ddc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhs_i[k][ll] += dc[ll] * pfac;
+        }
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = b_face_cells[f_id];
+
+        cs_real_t unddij = 1. / b_dist[f_id];
+        cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+        cs_real_4_t *rhs_i = rhsv + ii*n_f;
+
+        for (int k = 0; k < n_f; k++) {
+
+          cs_real_t umcbdd = (1. - coefbp[k][f_id]) * unddij;
+
+          cs_real_t dsij[3];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                       + umcbdd*diipb[f_id][ll];
+
+          cs_real_t pfac =   (coefap[k][f_id]*inc + (coefbp[k][f_id] -1.)
+                           * rhs_i[k][3]) * unddij;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhs_i[k][ll] += dsij[ll] * pfac;
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Compute gradients (interlaced) */
+  /*--------------------------------*/
+
+  cs_real_3_t *restrict gradv;
+  BFT_MALLOC(gradv, n_cells_ext*n_f, cs_real_3_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_lnum_t b_id = (cell_b_id != NULL) ? cell_b_id[c_id] : -1;
+
+    for (int k = 0; k < n_f; k++) {
+
+      const cs_real_33_t *c_cocg
+        = (b_id > -1) ? b_cocg + b_id*n_f + k : cocg + c_id;
+      const cs_real_t *rhs = rhsv[c_id*n_f + k];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        gradv[c_id*n_f + k][ll] =   (*c_cocg)[ll][0] *rhs[0]
+                                  + (*c_cocg)[ll][1] *rhs[1]
+                                  + (*c_cocg)[ll][2] *rhs[2];
+
+    }
+
+  }
+
+  /* Keep last field's boundary cocg, as successive calls would */
+
+  if (recompute_cocg) {
+#   pragma omp parallel for if (n_b_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      cs_lnum_t c_id = m->b_cells[ii];
+      for (cs_lnum_t ll = 0; ll < 3; ll++) {
+        for (cs_lnum_t mm = 0; mm < 3; mm++)
+          cocg[c_id][ll][mm] = b_cocg[ii*n_f + n_f-1][ll][mm];
+      }
+    }
+  }
+
+  BFT_FREE(b_cocg);
+  BFT_FREE(cell_b_id);
+  BFT_FREE(rhsv);
+
+  /* Synchronize halos (single exchange for all fields) */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD,
+                             (cs_real_t *)gradv, 3*n_f);
+
+  for (int k = 0; k < n_f; k++) {
+    cs_real_3_t *restrict _grad = grad[k];
+#   pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        _grad[c_id][ll] = gradv[c_id*n_f + k][ll];
+    }
+    if (m->halo != NULL && m->n_init_perio > 0)
+      cs_halo_perio_sync_var_vect
+        (m->halo, CS_HALO_STANDARD, (cs_real_t *)_grad, 3);
+  }
+
+  BFT_FREE(gradv);
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1) in the anisotropic case.
@@ -8705,6 +9109,58 @@ cs_gradient_scalar(const char                    *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update the least-squares cocg matrix used for scalar gradients
+ *         with given boundary conditions, as cs_gradient_scalar would with
+ *         recompute_cocg set to true.
+ *
+ * This is useful when a gradient is obtained otherwise (for example
+ * from a cache), so that following computations with recompute_cocg
+ * set to false use the expected matrix. Gradient types not based on
+ * least squares are not affected.
+ *
+ * \param[in]  gradient_type  gradient type
+ * \param[in]  halo_type      halo type
+ * \param[in]  bc_coeff_b     boundary condition term b, or NULL
+ * \param[in]  cpl            associated internal coupling, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_update_cocg(cs_gradient_type_t             gradient_type,
+                               cs_halo_type_t                 halo_type,
+                               const cs_real_t                bc_coeff_b[],
+                               const cs_internal_coupling_t  *cpl)
+{
+  if (   gradient_type != CS_GRADIENT_LSQ
+      && gradient_type != CS_GRADIENT_GREEN_LSQ)
+    return;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  cs_real_33_t  *cocgb = NULL, *cocg = NULL;
+
+  _get_cell_cocg_lsq(mesh, halo_type, fvq, cpl, &cocg, &cocgb);
+
+  /* Use Neumann BC's as default if not provided */
+
+  cs_real_t *_bc_coeff_b = NULL;
+
+  if (bc_coeff_b == NULL) {
+    const cs_lnum_t n_b_faces = mesh->n_b_faces;
+    BFT_MALLOC(_bc_coeff_b, n_b_faces, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_b_faces; i++)
+      _bc_coeff_b[i] = 1;
+    bc_coeff_b = _bc_coeff_b;
+  }
+
+  _recompute_lsq_scalar_cocg(mesh, fvq, cpl, bc_coeff_b, cocgb, cocg);
+
+  BFT_FREE(_bc_coeff_b);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -8898,6 +9354,261 @@ cs_gradient_tensor(const char                *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields sharing the same
+ *         gradient options.
+ *
+ * Ghost cell values of all variables are synchronized in a single halo
+ * exchange. For least-squares based gradient types (without internal
+ * coupling), right-hand sides of all fields are assembled in a single
+ * sweep over faces, so mesh geometry is read only once per face.
+ * For other gradient types, gradients are computed successively.
+ *
+ * Results are identical to those of successive calls to
+ * \ref cs_gradient_scalar (without hydrostatic pressure).
+ *
+ * \param[in]       n_fields       number of fields
+ * \param[in]       var_name       variable name, for each field
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       bc_coeff_a     boundary condition term a, for each field
+ *                                 (or NULL)
+ * \param[in]       bc_coeff_b     boundary condition term b, for each field
+ *                                 (or NULL)
+ * \param[in, out]  var            gradient's base variable, for each field
+ * \param[in, out]  c_weight       cell variable weight (shared by all
+ *                                 fields, stride 1), or NULL
+ * \param[in]       cpl            associated internal coupling, or NULL
+ * \param[out]      grad           gradient, for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                             n_fields,
+                         const char                     *var_name[],
+                         cs_gradient_type_t              gradient_type,
+                         cs_halo_type_t                  halo_type,
+                         int                             inc,
+                         bool                            recompute_cocg,
+                         int                             n_r_sweeps,
+                         int                             verbosity,
+                         cs_gradient_limit_t             clip_mode,
+                         double                          epsilon,
+                         double                          clip_coeff,
+                         const cs_real_t                *bc_coeff_a[],
+                         const cs_real_t                *bc_coeff_b[],
+                         cs_real_t                      *var[],
+                         cs_real_t             *restrict c_weight,
+                         const cs_internal_coupling_t   *cpl,
+                         cs_real_3_t                    *grad[])
+{
+  if (n_fields < 1)
+    return;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  cs_gradient_info_t **gradient_info;
+  BFT_MALLOC(gradient_info, n_fields, cs_gradient_info_t *);
+
+  for (int k = 0; k < n_fields; k++)
+    gradient_info[k] = _find_or_add_system(var_name[k], gradient_type);
+
+  /* Synchronize variables (single exchange) and weights */
+
+  if (mesh->halo != NULL) {
+
+    if (n_fields > 1) {
+      cs_real_t *buf;
+      BFT_MALLOC(buf, n_cells_ext*n_fields, cs_real_t);
+      for (int k = 0; k < n_fields; k++) {
+        const cs_real_t *_var = var[k];
+#       pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+          buf[c_id*n_fields + k] = _var[c_id];
+      }
+      cs_halo_sync_var_strided(mesh->halo, halo_type, buf, n_fields);
+      for (int k = 0; k < n_fields; k++) {
+        cs_real_t *_var = var[k];
+#       pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+        for (cs_lnum_t c_id = mesh->n_cells; c_id < n_cells_ext; c_id++)
+          _var[c_id] = buf[c_id*n_fields + k];
+      }
+      BFT_FREE(buf);
+    }
+    else
+      cs_halo_sync_var(mesh->halo, halo_type, var[0]);
+
+    if (c_weight != NULL)
+      cs_halo_sync_var(mesh->halo, halo_type, c_weight);
+
+  }
+
+  if (   (   gradient_type == CS_GRADIENT_LSQ
+          || gradient_type == CS_GRADIENT_GREEN_LSQ)
+      && cpl == NULL && n_fields > 1) {
+
+    static int last_fvm_count = 0;
+
+    if (n_r_sweeps > 0) {
+      int prev_fvq_count = last_fvm_count;
+      last_fvm_count = cs_mesh_quantities_compute_count();
+      if (last_fvm_count != prev_fvq_count)
+        recompute_cocg = true;
+    }
+
+    /* Use Neumann BC's as default if not provided */
+
+    const cs_real_t **coefa, **coefb;
+    BFT_MALLOC(coefa, n_fields, const cs_real_t *);
+    BFT_MALLOC(coefb, n_fields, const cs_real_t *);
+
+    cs_real_t *_bc_coeff_a = NULL;
+    cs_real_t *_bc_coeff_b = NULL;
+
+    for (int k = 0; k < n_fields; k++) {
+      coefa[k] = (bc_coeff_a != NULL) ? bc_coeff_a[k] : NULL;
+      coefb[k] = (bc_coeff_b != NULL) ? bc_coeff_b[k] : NULL;
+      if (coefa[k] == NULL) {
+        if (_bc_coeff_a == NULL) {
+          BFT_MALLOC(_bc_coeff_a, n_b_faces, cs_real_t);
+          for (cs_lnum_t i = 0; i < n_b_faces; i++)
+            _bc_coeff_a[i] = 0;
+        }
+        coefa[k] = _bc_coeff_a;
+      }
+      if (coefb[k] == NULL) {
+        if (_bc_coeff_b == NULL) {
+          BFT_MALLOC(_bc_coeff_b, n_b_faces, cs_real_t);
+          for (cs_lnum_t i = 0; i < n_b_faces; i++)
+            _bc_coeff_b[i] = 1;
+        }
+        coefb[k] = _bc_coeff_b;
+      }
+    }
+
+    cs_real_3_t **r_grad = grad;
+
+    if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
+      BFT_MALLOC(r_grad, n_fields, cs_real_3_t *);
+      for (int k = 0; k < n_fields; k++)
+        BFT_MALLOC(r_grad[k], n_cells_ext, cs_real_3_t);
+    }
+
+    _lsq_scalar_gradient_multi(mesh,
+                               fvq,
+                               halo_type,
+                               recompute_cocg,
+                               n_fields,
+                               inc,
+                               coefa,
+                               coefb,
+                               (const cs_real_t *const *)var,
+                               c_weight,
+                               r_grad);
+
+    for (int k = 0; k < n_fields; k++) {
+
+      _scalar_gradient_clipping(halo_type,
+                                clip_mode,
+                                verbosity,
+                                clip_coeff,
+                                var_name[k],
+                                var[k], r_grad[k]);
+
+      if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
+        _reconstruct_scalar_gradient(mesh,
+                                     fvq,
+                                     NULL,
+                                     0,
+                                     inc,
+                                     NULL,
+                                     coefa[k],
+                                     coefb[k],
+                                     c_weight,
+                                     var[k],
+                                     r_grad[k],
+                                     grad[k]);
+        BFT_FREE(r_grad[k]);
+      }
+
+      if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+        cs_bad_cells_regularisation_vector(grad[k], 0);
+
+    }
+
+    if (r_grad != grad)
+      BFT_FREE(r_grad);
+
+    BFT_FREE(_bc_coeff_a);
+    BFT_FREE(_bc_coeff_b);
+    BFT_FREE(coefa);
+    BFT_FREE(coefb);
+
+  }
+  else {
+
+    for (int k = 0; k < n_fields; k++)
+      _gradient_scalar(var_name[k],
+                       gradient_info[k],
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       recompute_cocg,
+                       n_r_sweeps,
+                       0, /* hyd_p_flag */
+                       1, /* w_stride */
+                       verbosity,
+                       clip_mode,
+                       epsilon,
+                       clip_coeff,
+                       NULL, /* f_ext */
+                       (bc_coeff_a != NULL) ? bc_coeff_a[k] : NULL,
+                       (bc_coeff_b != NULL) ? bc_coeff_b[k] : NULL,
+                       var[k],
+                       c_weight,
+                       cpl,
+                       grad[k]);
+
+  }
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  /* Share elapsed time between fields for logging */
+
+  cs_timer_counter_t tc;
+  CS_TIMER_COUNTER_INIT(tc);
+  cs_timer_counter_add_diff(&tc, &t0, &t1);
+
+  for (int k = 0; k < n_fields; k++) {
+    gradient_info[k]->n_calls += 1;
+    gradient_info[k]->t_tot.nsec += tc.nsec / n_fields;
+  }
+
+  BFT_FREE(gradient_info);
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -206,6 +206,30 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      grad[restrict][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update the least-squares cocg matrix used for scalar gradients
+ *         with given boundary conditions, as cs_gradient_scalar would with
+ *         recompute_cocg set to true.
+ *
+ * This is useful when a gradient is obtained otherwise (for example
+ * from a cache), so that following computations with recompute_cocg
+ * set to false use the expected matrix. Gradient types not based on
+ * least squares are not affected.
+ *
+ * \param[in]  gradient_type  gradient type
+ * \param[in]  halo_type      halo type
+ * \param[in]  bc_coeff_b     boundary condition term b, or NULL
+ * \param[in]  cpl            associated internal coupling, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_update_cocg(cs_gradient_type_t             gradient_type,
+                               cs_halo_type_t                 halo_type,
+                               const cs_real_t                bc_coeff_b[],
+                               const cs_internal_coupling_t  *cpl);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -284,6 +308,63 @@ cs_gradient_tensor(const char                *var_name,
                    cs_real_6_t      *restrict var,
                    cs_real_63_t     *restrict grad);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields sharing the same
+ *         gradient options.
+ *
+ * Ghost cell values of all variables are synchronized in a single halo
+ * exchange. For least-squares based gradient types (without internal
+ * coupling), right-hand sides of all fields are assembled in a single
+ * sweep over faces, so mesh geometry is read only once per face.
+ * For other gradient types, gradients are computed successively.
+ *
+ * Results are identical to those of successive calls to
+ * \ref cs_gradient_scalar (without hydrostatic pressure).
+ *
+ * \param[in]       n_fields       number of fields
+ * \param[in]       var_name       variable name, for each field
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       bc_coeff_a     boundary condition term a, for each field
+ *                                 (or NULL)
+ * \param[in]       bc_coeff_b     boundary condition term b, for each field
+ *                                 (or NULL)
+ * \param[in, out]  var            gradient's base variable, for each field
+ * \param[in, out]  c_weight       cell variable weight (shared by all
+ *                                 fields, stride 1), or NULL
+ * \param[in]       cpl            associated internal coupling, or NULL
+ * \param[out]      grad           gradient, for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                             n_fields,
+                         const char                     *var_name[],
+                         cs_gradient_type_t              gradient_type,
+                         cs_halo_type_t                  halo_type,
+                         int                             inc,
+                         bool                            recompute_cocg,
+                         int                             n_r_sweeps,
+                         int                             verbosity,
+                         cs_gradient_limit_t             clip_mode,
+                         double                          epsilon,
+                         double                          clip_coeff,
+                         const cs_real_t                *bc_coeff_a[],
+                         const cs_real_t                *bc_coeff_b[],
+                         cs_real_t                      *var[],
+                         cs_real_t             *restrict c_weight,
+                         const cs_internal_coupling_t   *cpl,
+                         cs_real_3_t                    *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -65,6 +65,7 @@
 #include "cs_sles.h"
 #include "cs_sles_it.h"
 #include "cs_sles_pc.h"
+#include "cs_sles_tuning.h"
 #include "cs_timer.h"
 
 #if defined(HAVE_HYPRE)
@@ -181,6 +182,8 @@ _sles_default_native(int                f_id,
 
   /* Final default */
 
+  bool tunable = false;
+
   if (sles_it_type == CS_SLES_N_IT_TYPES) {
 
     int coupling_id = -1;
@@ -202,6 +205,11 @@ _sles_default_native(int                f_id,
       else
         sles_it_type = CS_SLES_BICGSTAB;
     }
+
+    /* Systems requiring a matrix assembler are not autotuned */
+
+    if (coupling_id < 0)
+      tunable = true;
   }
 
   if (multigrid == 1) {
@@ -236,6 +244,8 @@ _sles_default_native(int                f_id,
                             _poly_degree_default,
                             n_max_iter);
 
+  if (tunable)
+    cs_sles_tuning_add_default(f_id, name);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -536,6 +546,8 @@ cs_sles_default_setup(void)
 void
 cs_sles_default_finalize(void)
 {
+  cs_sles_tuning_finalize();
+
   cs_sles_log(CS_LOG_PERFORMANCE);
 
   cs_multigrid_finalize();
@@ -770,6 +782,11 @@ cs_sles_solve_native(int                  f_id,
 
   cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
 
+  /* Autotuning may redefine the solver on a new setup,
+     so must be called before the matrix is built */
+
+  cs_sles_tuning_solve_start(sc, symmetric);
+
   int setup_id = 0;
   while (setup_id < _n_setups) {
     if (_sles_setup[setup_id] == sc)
@@ -875,6 +892,8 @@ cs_sles_solve_native(int                  f_id,
                       0,
                       NULL);
 
+  cs_sles_tuning_solve_end(sc, cvg);
+
   BFT_FREE(_rhs);
   if (_vx != vx) {
     size_t stride = 1;
@@ -926,6 +945,8 @@ cs_sles_free_native(int          f_id,
 
     _n_setups -= 1;
 
+    cs_sles_tuning_setup_end(sc);
+
     if (setup_id < _n_setups) {
       for (int i = 0; i < 3; i++) {
         _matrix_setup[setup_id][i] = _matrix_setup[_n_setups][i];
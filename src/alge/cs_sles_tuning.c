@@ -0,0 +1,848 @@
+/*============================================================================
+ * Automatic selection of default sparse linear equation solver settings
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_multigrid.h"
+#include "cs_parall.h"
+#include "cs_sles.h"
+#include "cs_sles_default.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_sles_tuning.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_sles_tuning.c
+
+  \brief Automatic selection of default sparse linear equation solver settings.
+
+  When enabled using \ref cs_sles_tuning_set_options, linear systems
+  using the default solver settings (i.e. not defined by the user)
+  are solved successively with each of a small set of candidate
+  configurations, depending on matrix symmetry:
+
+  - for symmetric matrices: flexible conjugate gradient preconditioned by
+    a multigrid V-cycle or K-cycle, or multigrid V-cycle used as a solver;
+  - for non-symmetric matrices: process-local symmetric Gauss-Seidel,
+    Jacobi-preconditioned BiCGStab or GMRES.
+
+  Each candidate is used for a given number of resolutions, whose cost
+  (including matrix and solver setup, and all solves until the setup is
+  freed, but not the computations done by the caller between solves)
+  is measured. Candidates for which a resolution did not converge
+  are discarded, and the fastest remaining one is used for the rest of the
+  computation.
+
+  Selected configurations are written to a tuning file at the end of the
+  computation, with one line per system, containing the global number of
+  cells, the number of ranks, the configuration name, and the system name.
+  When a matching line is found in this file, its configuration is used
+  directly.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_SLES_TUNING_MAX_CANDIDATES 3
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+/* Candidate solver configuration */
+/*--------------------------------*/
+
+typedef struct {
+
+  const char         *key;        /* name in tuning file */
+  bool                symmetric;  /* true for symmetric matrices,
+                                     false for general matrices */
+  cs_sles_it_type_t   it_type;    /* iterative solver type, or
+                                     CS_SLES_N_IT_TYPES for multigrid
+                                     used as solver */
+  int                 mg_type;    /* multigrid type, or -1 */
+
+} _sles_tuning_config_t;
+
+/* Tuning state for a given linear system */
+/*----------------------------------------*/
+
+typedef struct {
+
+  const cs_sles_t  *sles;          /* associated solver object */
+  char             *name;          /* system name (set when started) */
+
+  int               status;        /* 0: not started, 1: tuning,
+                                      2: configuration selected */
+  bool              in_setup;      /* true between first solve and free */
+  bool              from_file;     /* configuration read from tuning file */
+
+  int               n_candidates;  /* number of candidate configurations */
+  int               candidate_id[CS_SLES_TUNING_MAX_CANDIDATES];
+  int               c_id;          /* current candidate */
+  int               n_done;        /* resolutions done with current
+                                      candidate */
+
+  int               defined_id;    /* configuration currently defined,
+                                      or -1 */
+  int               selected_id;   /* selected configuration, or -1 */
+
+  double            t_start;       /* start of current solve */
+  double            t_sum[CS_SLES_TUNING_MAX_CANDIDATES];
+  int               n_failed[CS_SLES_TUNING_MAX_CANDIDATES];
+
+} _sles_tuning_system_t;
+
+/* Tuning file entry */
+/*-------------------*/
+
+typedef struct {
+
+  cs_gnum_t   n_g_cells;   /* global number of cells */
+  int         n_ranks;     /* number of ranks */
+  int         config_id;   /* configuration id */
+  char       *name;        /* system name */
+
+} _sles_tuning_entry_t;
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+static const _sles_tuning_config_t _configs[] = {
+  {"fcg_mg_v",  true,  CS_SLES_FCG,                CS_MULTIGRID_V_CYCLE},
+  {"fcg_mg_k",  true,  CS_SLES_FCG,                CS_MULTIGRID_K_CYCLE},
+  {"mg_v",      true,  CS_SLES_N_IT_TYPES,         CS_MULTIGRID_V_CYCLE},
+  {"p_sym_gs",  false, CS_SLES_P_SYM_GAUSS_SEIDEL, -1},
+  {"bicgstab",  false, CS_SLES_BICGSTAB,           -1},
+  {"gmres",     false, CS_SLES_GMRES,              -1}
+};
+
+static const int _n_configs
+  = sizeof(_configs) / sizeof(_sles_tuning_config_t);
+
+static const int _n_max_iter_default = 10000;
+
+static int    _n_trials = 0;
+static char  *_path = NULL;
+
+static int                     _n_systems = 0;
+static _sles_tuning_system_t  *_systems = NULL;
+
+static bool                    _file_read = false;
+static int                     _n_entries = 0;
+static _sles_tuning_entry_t   *_entries = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return tuning file path.
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_tuning_path(void)
+{
+  return (_path != NULL) ? _path : "sles_tuning.txt";
+}
+
+/*----------------------------------------------------------------------------
+ * Return configuration id matching a given key, or -1.
+ *
+ * parameters:
+ *   key <-- configuration name
+ *----------------------------------------------------------------------------*/
+
+static int
+_config_id(const char  *key)
+{
+  for (int i = 0; i < _n_configs; i++) {
+    if (strcmp(_configs[i].key, key) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Return tuning state associated with a solver object, or NULL.
+ *
+ * parameters:
+ *   sles <-- pointer to solver object
+ *----------------------------------------------------------------------------*/
+
+static _sles_tuning_system_t *
+_find_system(const cs_sles_t  *sles)
+{
+  for (int i = 0; i < _n_systems; i++) {
+    if (_systems[i].sles == sles)
+      return _systems + i;
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Find tuning file entry matching the current mesh and a given system name.
+ *
+ * parameters:
+ *   name <-- system name
+ *
+ * returns:
+ *   entry id, or -1 if not found
+ *----------------------------------------------------------------------------*/
+
+static int
+_find_entry(const char  *name)
+{
+  const cs_gnum_t n_g_cells = cs_glob_mesh->n_g_cells;
+
+  for (int i = 0; i < _n_entries; i++) {
+    if (   _entries[i].n_g_cells == n_g_cells
+        && _entries[i].n_ranks == cs_glob_n_ranks
+        && strcmp(_entries[i].name, name) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Add an entry to the tuning file data.
+ *
+ * parameters:
+ *   n_g_cells <-- global number of cells
+ *   n_ranks   <-- number of ranks
+ *   config_id <-- configuration id
+ *   name      <-- system name
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_entry(cs_gnum_t    n_g_cells,
+           int          n_ranks,
+           int          config_id,
+           const char  *name)
+{
+  BFT_REALLOC(_entries, _n_entries + 1, _sles_tuning_entry_t);
+
+  _sles_tuning_entry_t *e = _entries + _n_entries;
+
+  e->n_g_cells = n_g_cells;
+  e->n_ranks = n_ranks;
+  e->config_id = config_id;
+  BFT_MALLOC(e->name, strlen(name) + 1, char);
+  strcpy(e->name, name);
+
+  _n_entries += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Read tuning file if present.
+ *
+ * The file is read on rank 0 and its contents broadcast to other ranks.
+ * Lines which can not be decoded are ignored.
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_tuning_file(void)
+{
+  int n_chars = 0;
+  char *buf = NULL;
+
+  _file_read = true;
+
+  if (cs_glob_rank_id < 1) {
+    FILE *f = fopen(_tuning_path(), "r");
+    if (f != NULL) {
+      if (fseek(f, 0, SEEK_END) == 0) {
+        long l = ftell(f);
+        if (l > 0 && l < 1 << 30)
+          n_chars = l;
+      }
+      if (n_chars > 0) {
+        rewind(f);
+        BFT_MALLOC(buf, n_chars + 1, char);
+        n_chars = fread(buf, 1, n_chars, f);
+      }
+      fclose(f);
+    }
+  }
+
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &n_chars);
+
+  if (n_chars < 1) {
+    BFT_FREE(buf);
+    return;
+  }
+
+  if (buf == NULL)
+    BFT_MALLOC(buf, n_chars + 1, char);
+
+  cs_parall_bcast(0, n_chars, CS_CHAR, buf);
+  buf[n_chars] = '\0';
+
+  /* Decode lines */
+
+  char *s = buf;
+
+  while (*s != '\0') {
+
+    char *e = s;
+    while (*e != '\0' && *e != '\n')
+      e++;
+    char *next = (*e == '\n') ? e + 1 : e;
+    *e = '\0';
+
+    /* Remove trailing whitespace (including '\r') */
+
+    while (e > s && isspace((unsigned char)*(e-1)))
+      *(--e) = '\0';
+
+    unsigned long long n_g_cells;
+    int n_ranks, pos = 0;
+    char key[32];
+
+    if (   s[0] != '#'
+        && sscanf(s, "%llu %d %31s %n", &n_g_cells, &n_ranks, key, &pos) == 3
+        && pos > 0 && s[pos] != '\0') {
+      int config_id = _config_id(key);
+      if (config_id > -1)
+        _add_entry(n_g_cells, n_ranks, config_id, s + pos);
+    }
+
+    s = next;
+  }
+
+  BFT_FREE(buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Write tuning file (on rank 0).
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_tuning_file(void)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  FILE *f = fopen(_tuning_path(), "w");
+
+  if (f == NULL) {
+    bft_printf(_("\nWarning: unable to write linear solver tuning file "
+                 "\"%s\".\n"), _tuning_path());
+    return;
+  }
+
+  fprintf(f,
+          "# Linear solver tuning\n"
+          "# n_g_cells n_ranks configuration system\n");
+
+  for (int i = 0; i < _n_entries; i++) {
+    const _sles_tuning_entry_t *e = _entries + i;
+    fprintf(f, "%llu %d %s %s\n",
+            (unsigned long long)(e->n_g_cells), e->n_ranks,
+            _configs[e->config_id].key, e->name);
+  }
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Define a solver configuration for a given system.
+ *
+ * parameters:
+ *   s         <-> system tuning state
+ *   config_id <-- configuration id
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_config(_sles_tuning_system_t  *s,
+               int                     config_id)
+{
+  const _sles_tuning_config_t *c = _configs + config_id;
+
+  const int f_id = cs_sles_get_f_id(s->sles);
+  const char *name = cs_sles_get_name(s->sles);
+
+  if (c->it_type == CS_SLES_N_IT_TYPES)
+    cs_multigrid_define(f_id, name, c->mg_type);
+
+  else if (c->mg_type > -1) {
+    cs_sles_it_t *it = cs_sles_it_define(f_id,
+                                         name,
+                                         c->it_type,
+                                         -1, /* poly_degree */
+                                         _n_max_iter_default);
+    cs_sles_pc_t *pc = cs_multigrid_pc_create(c->mg_type);
+    cs_sles_it_transfer_pc(it, &pc);
+    cs_sles_set_error_handler(cs_sles_find(f_id, name),
+                              cs_sles_default_error);
+  }
+
+  else
+    (void)cs_sles_it_define(f_id,
+                            name,
+                            c->it_type,
+                            0, /* poly_degree */
+                            _n_max_iter_default);
+
+  s->defined_id = config_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Start tuning for a given system.
+ *
+ * parameters:
+ *   s         <-> system tuning state
+ *   symmetric <-- indicates if matrix coefficients are symmetric
+ *----------------------------------------------------------------------------*/
+
+static void
+_start_system(_sles_tuning_system_t  *s,
+              bool                    symmetric)
+{
+  const char *name = cs_sles_base_name(cs_sles_get_f_id(s->sles),
+                                       cs_sles_get_name(s->sles));
+
+  BFT_MALLOC(s->name, strlen(name) + 1, char);
+  strcpy(s->name, name);
+
+  if (_file_read == false)
+    _read_tuning_file();
+
+  int e_id = _find_entry(s->name);
+
+  if (e_id > -1 && _configs[_entries[e_id].config_id].symmetric == symmetric) {
+    s->selected_id = _entries[e_id].config_id;
+    s->from_file = true;
+    s->status = 2;
+    return;
+  }
+
+  s->n_candidates = 0;
+  for (int i = 0; i < _n_configs; i++) {
+    if (   _configs[i].symmetric == symmetric
+        && s->n_candidates < CS_SLES_TUNING_MAX_CANDIDATES) {
+      s->candidate_id[s->n_candidates] = i;
+      s->t_sum[s->n_candidates] = 0.;
+      s->n_failed[s->n_candidates] = 0;
+      s->n_candidates += 1;
+    }
+  }
+
+  s->c_id = 0;
+  s->n_done = 0;
+  s->status = 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Select best configuration for a given system once all candidates
+ * have been tried.
+ *
+ * parameters:
+ *   s <-> system tuning state
+ *----------------------------------------------------------------------------*/
+
+static void
+_select_config(_sles_tuning_system_t  *s)
+{
+  const int n = s->n_candidates;
+
+  /* Use slowest rank's time and any rank's failure so that all ranks
+     make the same choice */
+
+  cs_parall_max(n, CS_DOUBLE, s->t_sum);
+  cs_parall_max(n, CS_INT_TYPE, s->n_failed);
+
+  int best = -1;
+  for (int i = 0; i < n; i++) {
+    if (s->n_failed[i] > 0)
+      continue;
+    if (best < 0 || s->t_sum[i] < s->t_sum[best])
+      best = i;
+  }
+
+  /* If all candidates failed, use the fastest one anyways */
+
+  if (best < 0) {
+    best = 0;
+    for (int i = 1; i < n; i++) {
+      if (s->t_sum[i] < s->t_sum[best])
+        best = i;
+    }
+  }
+
+  s->selected_id = s->candidate_id[best];
+  s->status = 2;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\nLinear solver autotuning for \"%s\": "
+                  "selected configuration \"%s\"\n"),
+                s->name, _configs[s->selected_id].key);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set linear solver autotuning options.
+ *
+ * When autotuning is active, each linear system using the default
+ * (non user-defined) solver settings successively tries a small set of
+ * solver and preconditioner configurations during its first resolutions,
+ * then keeps the fastest one for the rest of the computation.
+ *
+ * The selected configurations are saved to a tuning file, keyed by
+ * global number of cells, number of ranks and system name, so that
+ * later runs of the same case start with a tuned setup. Using an absolute
+ * path (for example in the case's DATA directory) allows sharing this
+ * file between runs.
+ *
+ * \param[in]  n_trials  number of measured resolutions per candidate
+ *                       configuration (0 to disable autotuning)
+ * \param[in]  path      path to tuning file, or NULL for default
+ *                       ("sles_tuning.txt")
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_set_options(int          n_trials,
+                           const char  *path)
+{
+  _n_trials = CS_MAX(n_trials, 0);
+
+  BFT_FREE(_path);
+  if (path != NULL) {
+    BFT_MALLOC(_path, strlen(path) + 1, char);
+    strcpy(_path, path);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate a given linear system uses default solver settings,
+ *        so that it may be autotuned.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_add_default(int          f_id,
+                           const char  *name)
+{
+  if (_n_trials < 1)
+    return;
+
+  const cs_sles_t *sles = cs_sles_find_or_add(f_id, name);
+
+  if (_find_system(sles) != NULL)
+    return;
+
+  BFT_REALLOC(_systems, _n_systems + 1, _sles_tuning_system_t);
+
+  _sles_tuning_system_t *s = _systems + _n_systems;
+
+  memset(s, 0, sizeof(_sles_tuning_system_t));
+
+  s->sles = sles;
+  s->name = NULL;
+  s->status = 0;
+  s->in_setup = false;
+  s->from_file = false;
+  s->n_candidates = 0;
+  s->defined_id = -1;
+  s->selected_id = -1;
+
+  _n_systems += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Prepare for resolution of a linear system.
+ *
+ * If a new setup is starting and the system is being tuned, the next
+ * candidate configuration is defined, so this must be called before
+ * the system's matrix is built.
+ *
+ * \param[in, out]  sles       pointer to solver object
+ * \param[in]       symmetric  indicates if matrix coefficients are symmetric
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_solve_start(cs_sles_t  *sles,
+                           bool        symmetric)
+{
+  if (_n_trials < 1)
+    return;
+
+  _sles_tuning_system_t *s = _find_system(sles);
+  if (s == NULL)
+    return;
+
+  if (s->in_setup == false) {
+
+    if (s->status == 0)
+      _start_system(s, symmetric);
+
+    int config_id = (s->status == 1) ?
+      s->candidate_id[s->c_id] : s->selected_id;
+
+    if (config_id > -1 && config_id != s->defined_id)
+      _define_config(s, config_id);
+
+    s->in_setup = true;
+
+  }
+
+  s->t_start = cs_timer_wtime();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Measure the cost and register the convergence state of
+ *        a linear system resolution.
+ *
+ * \param[in]  sles   pointer to solver object
+ * \param[in]  state  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_solve_end(const cs_sles_t              *sles,
+                         cs_sles_convergence_state_t   state)
+{
+  if (_n_trials < 1)
+    return;
+
+  _sles_tuning_system_t *s = _find_system(sles);
+  if (s == NULL || s->in_setup == false)
+    return;
+
+  if (s->status == 1)
+    s->t_sum[s->c_id] += cs_timer_wtime() - s->t_start;
+
+  if (state < CS_SLES_CONVERGED) {
+
+    if (s->status == 1)
+      s->n_failed[s->c_id] += 1;
+
+    /* The error handler may have redefined the solver */
+
+    s->defined_id = -1;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Count a linear system resolution whose setup has been freed,
+ *        and select the best configuration once all candidates have
+ *        been tried.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  sles  pointer to solver object
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_setup_end(const cs_sles_t  *sles)
+{
+  if (_n_trials < 1)
+    return;
+
+  _sles_tuning_system_t *s = _find_system(sles);
+  if (s == NULL || s->in_setup == false)
+    return;
+
+  s->in_setup = false;
+
+  if (s->status != 1)
+    return;
+
+  s->n_done += 1;
+
+  if (s->n_done >= _n_trials) {
+    s->n_done = 0;
+    s->c_id += 1;
+    if (s->c_id >= s->n_candidates)
+      _select_config(s);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log autotuning results and update tuning file.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_finalize(void)
+{
+  int n_started = 0;
+  for (int i = 0; i < _n_systems; i++) {
+    if (_systems[i].status > 0)
+      n_started += 1;
+  }
+
+  if (n_started > 0) {
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Linear solver autotuning\n"
+                    "------------------------\n"));
+
+    bool update_file = false;
+
+    for (int i = 0; i < _n_systems; i++) {
+
+      _sles_tuning_system_t *s = _systems + i;
+
+      if (s->status == 0)
+        continue;
+
+      cs_log_printf(CS_LOG_PERFORMANCE, "\n  %s\n", s->name);
+
+      if (s->from_file) {
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("    configuration from tuning file: %s\n"),
+                      _configs[s->selected_id].key);
+        continue;
+      }
+
+      for (int j = 0; j < s->n_candidates; j++) {
+        const char *key = _configs[s->candidate_id[j]].key;
+        if (s->status == 2) {
+          cs_log_printf(CS_LOG_PERFORMANCE,
+                        _("    %-12s mean time: %12.5e"),
+                        key, s->t_sum[j] / _n_trials);
+          if (s->n_failed[j] > 0)
+            cs_log_printf(CS_LOG_PERFORMANCE, _(" (not converged)"));
+          if (s->candidate_id[j] == s->selected_id)
+            cs_log_printf(CS_LOG_PERFORMANCE, _(" (selected)"));
+          cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+        }
+      }
+
+      if (s->status == 1) {
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("    tuning not completed (%d of %d candidates)\n"),
+                      s->c_id, s->n_candidates);
+        continue;
+      }
+
+      /* Update tuning file data */
+
+      int e_id = _find_entry(s->name);
+      if (e_id > -1)
+        _entries[e_id].config_id = s->selected_id;
+      else
+        _add_entry(cs_glob_mesh->n_g_cells, cs_glob_n_ranks,
+                   s->selected_id, s->name);
+      update_file = true;
+
+    }
+
+    if (update_file)
+      _write_tuning_file();
+
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+    cs_log_separator(CS_LOG_PERFORMANCE);
+
+  }
+
+  for (int i = 0; i < _n_systems; i++)
+    BFT_FREE(_systems[i].name);
+  BFT_FREE(_systems);
+  _n_systems = 0;
+
+  for (int i = 0; i < _n_entries; i++)
+    BFT_FREE(_entries[i].name);
+  BFT_FREE(_entries);
+  _n_entries = 0;
+  _file_read = false;
+
+  BFT_FREE(_path);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,159 @@
+#ifndef __CS_SLES_TUNING_H__
+#define __CS_SLES_TUNING_H__
+
+/*============================================================================
+ * Automatic selection of default sparse linear equation solver settings
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_sles.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set linear solver autotuning options.
+ *
+ * When autotuning is active, each linear system using the default
+ * (non user-defined) solver settings successively tries a small set of
+ * solver and preconditioner configurations during its first resolutions,
+ * then keeps the fastest one for the rest of the computation.
+ *
+ * The selected configurations are saved to a tuning file, keyed by
+ * global number of cells, number of ranks and system name, so that
+ * later runs of the same case start with a tuned setup. Using an absolute
+ * path (for example in the case's DATA directory) allows sharing this
+ * file between runs.
+ *
+ * \param[in]  n_trials  number of measured resolutions per candidate
+ *                       configuration (0 to disable autotuning)
+ * \param[in]  path      path to tuning file, or NULL for default
+ *                       ("sles_tuning.txt")
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_set_options(int          n_trials,
+                           const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate a given linear system uses default solver settings,
+ *        so that it may be autotuned.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_add_default(int          f_id,
+                           const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Prepare for resolution of a linear system.
+ *
+ * If a new setup is starting and the system is being tuned, the next
+ * candidate configuration is defined, so this must be called before
+ * the system's matrix is built.
+ *
+ * \param[in, out]  sles       pointer to solver object
+ * \param[in]       symmetric  indicates if matrix coefficients are symmetric
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_solve_start(cs_sles_t  *sles,
+                           bool        symmetric);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Measure the cost and register the convergence state of
+ *        a linear system resolution.
+ *
+ * \param[in]  sles   pointer to solver object
+ * \param[in]  state  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_solve_end(const cs_sles_t              *sles,
+                         cs_sles_convergence_state_t   state);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Count a linear system resolution whose setup has been freed,
+ *        and select the best configuration once all candidates have
+ *        been tried.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  sles  pointer to solver object
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_setup_end(const cs_sles_t  *sles);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log autotuning results and update tuning file.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_tuning_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_SLES_TUNING_H__ */
@@ -61,8 +61,10 @@
 #include "cs_ext_library_info.h"
 #include "cs_fan.h"
 #include "cs_field.h"
+#include "cs_field_operator.h"
 #include "cs_field_pointer.h"
 #include "cs_file.h"
+#include "cs_file_server.h"
 #include "cs_fp_exception.h"
 #include "cs_gradient.h"
 #include "cs_gui.h"
@@ -78,6 +80,7 @@
 #include "cs_join.h"
 #include "cs_lagr.h"
 #include "cs_lagr_tracking.h"
+#include "cs_les_filter.h"
 #include "cs_les_inflow.h"
 #include "cs_log.h"
 #include "cs_log_setup.h"
@@ -283,6 +286,10 @@ _run(void)
 
     cs_ctwr_build_zones();
 
+    /* Build tables of thermal properties if tabulation is active */
+
+    cs_thermal_table_build_tabulation();
+
     cs_timer_stats_set_start_time(cs_glob_time_step->nt_cur);
 
   }
@@ -543,6 +550,7 @@ _run(void)
 
   cs_probe_finalize();
   cs_post_finalize();
+  cs_file_server_finalize();
   cs_log_iteration_destroy_all();
 
   /* Free moments info */
@@ -556,6 +564,7 @@ _run(void)
 
   cs_notebook_destroy_all();
 
+  cs_field_gradient_cache_clear();
   cs_field_pointer_destroy_all();
   cs_field_destroy_all();
   cs_field_destroy_all_keys();
@@ -567,6 +576,7 @@ _run(void)
   /* Free main mesh after printing some statistics */
 
   cs_cell_to_vertex_free();
+  cs_les_filter_free();
   cs_mesh_adjacencies_finalize();
 
   cs_boundary_zone_finalize();
@@ -664,6 +674,13 @@ main(int    argc,
 
   cs_base_error_init(opts.sig_defaults);
 
+  /* Ranks reserved for I/O servers only serve output requests */
+
+  if (cs_file_server_is_server()) {
+    cs_file_server_run();
+    cs_exit(EXIT_SUCCESS);
+  }
+
   /* Open 'run_solver.log' (log) files */
 
   cs_base_trace_set(opts.trace);
@@ -78,6 +78,28 @@ double precision, allocatable, dimension(:) ::  reacnum
 !> maximal time step for chemistry resolution
 double precision dtchemmax
 
+!> relative tolerance for adaptive chemistry sub-steps
+!> (sub-steps of dtchemmax are used if not positive)
+double precision, save :: rtolchem
+!> absolute tolerance for adaptive chemistry sub-steps
+double precision, save :: atolchem
+
+!> number of cells integrated together by the batched Rosenbrock solver
+integer, parameter :: nbchem = 16
+
+!> position of each entry of the Rosenbrock matrix in the packed storage
+!> shared by all cells (0 for entries which are always zero, including
+!> fill-in of the LU factorization)
+integer, allocatable, dimension(:,:) :: chem_lu_pos
+!> LU factorization operations on packed entries (p1, p2, p3):
+!> a(p1) = a(p1) - a(p2)*a(p3), or a(p1) = a(p1)/a(p2) if p3 = 0
+integer, allocatable, dimension(:,:) :: chem_lu_ops
+!> forward substitution operations (i, k, p): x(i) = x(i) - a(p)*x(k)
+integer, allocatable, dimension(:,:) :: chem_lu_fwd
+!> backward substitution operations (i, j, p): x(i) = x(i) - a(p)*x(j),
+!> or x(i) = x(i)/a(p) if j = 0
+integer, allocatable, dimension(:,:) :: chem_lu_bwd
+
 !> number of time steps for the concentration profiles file
 integer, save         ::  nbchim
 !> number of altitudes for the concentration profiles file
@@ -321,6 +343,13 @@ deallocate(tchem)
 deallocate(xchem)
 deallocate(ychem)
 
+if (allocated(chem_lu_pos)) then
+  deallocate(chem_lu_pos)
+  deallocate(chem_lu_ops)
+  deallocate(chem_lu_fwd)
+  deallocate(chem_lu_bwd)
+endif
+
 end subroutine finalize_chemistry
 
 end module atchem
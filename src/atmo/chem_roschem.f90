@@ -158,3 +158,279 @@ enddo
 
 return
 end subroutine chem_roschem
+
+!===============================================================================
+
+!> \brief Batched Rosenbrock solver for atmospheric chemistry.
+!>
+!> A batch of cells is integrated over each cell's time step with the same
+!> second-order Rosenbrock scheme as chem_roschem. Linear systems of all
+!> cells of the batch are factorized and solved together, using the
+!> sparsity pattern shared by all cells (see chem_lu_pattern_init).
+!>
+!> Each cell uses its own sub-steps, of at most dtchemmax. If rtolchem is
+!> positive, sub-steps are adapted in each cell based on the difference
+!> between the second-order solution and the embedded first-order one,
+!> with relative and absolute tolerances rtolchem and atolchem.
+!> Cells which are done are masked until the whole batch is done.
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+! Arguments
+!------------------------------------------------------------------------------
+!   mode          name          role
+!------------------------------------------------------------------------------
+!> \param[in]     nb            number of cells in batch
+!> \param[in,out] dlconc        concentrations vectors
+!> \param[in]     zcsourc       source terms
+!> \param[in]     conv_factor   conversion factors
+!> \param[in]     dltime        time step of each cell
+!> \param[in]     dlrk          kinetic rates
+!______________________________________________________________________________
+
+subroutine chem_roschem_batch (nb,dlconc,zcsourc,conv_factor,dltime,dlrk)
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use atchem
+
+implicit none
+
+! Arguments
+
+integer nb
+double precision dlconc(nespg,nb)
+double precision zcsourc(nespg,nb)
+double precision conv_factor(nespg,nb)
+double precision dltime(nb)
+double precision dlrk(nrg,nb)
+
+! Local variables
+
+integer ib, ji, jj, pp, nnz, n_active
+logical active(nb)
+double precision igamma, dlerr, dlsc, dlfac
+double precision dlt(nb), dlstep(nb)
+double precision dlr(nespg), dlconcbis(nespg), dlconcnew(nespg)
+double precision dldrdc(nespg,nespg)
+double precision dlk1(nb,nespg), dlk2(nb,nespg)
+double precision, allocatable, dimension(:,:) :: dlmat
+
+!------------------------------------------------------------------------
+!*    0. Setup
+
+igamma = 1.d0 + 1.d0/dsqrt(2.d0)
+
+nnz = maxval(chem_lu_pos)
+allocate(dlmat(nb,nnz))
+
+do ib = 1, nb
+  dlt(ib) = 0.d0
+  dlstep(ib) = min(dltime(ib), dtchemmax)
+enddo
+
+do
+
+  n_active = 0
+  do ib = 1, nb
+    active(ib) = (dltime(ib) - dlt(ib) .gt. 1.d-12*dltime(ib))
+    if (active(ib)) then
+      n_active = n_active + 1
+      dlstep(ib) = min(dlstep(ib), dltime(ib) - dlt(ib))
+    endif
+  enddo
+
+  if (n_active.eq.0) exit
+
+  !------------------------------------------------------------------------
+  !*    1. Chemistry and Jacobian for each cell; matrices of cells which
+  !        are done are set to identity.
+
+  do pp = 1, nnz
+    do ib = 1, nb
+      dlmat(ib,pp) = 0.d0
+    enddo
+  enddo
+
+  do ib = 1, nb
+
+    if (active(ib)) then
+
+      call chem_fexchem_batch_cell(dlconc(:,ib), dlrk(:,ib), zcsourc(:,ib), &
+                                   conv_factor(:,ib), dlr)
+
+      if (ichemistry.eq.1) then
+        call jacdchemdc_1 (nespg,nrg,dlconc(:,ib),conv_factor(:,ib),        &
+                           conv_factor_jac,dlrk(:,ib),dldrdc)
+      else if (ichemistry.eq.2) then
+        call jacdchemdc_2 (nespg,nrg,dlconc(:,ib),conv_factor(:,ib),        &
+                           conv_factor_jac,dlrk(:,ib),dldrdc)
+      else if (ichemistry.eq.3) then
+        call jacdchemdc_3 (nespg,nrg,dlconc(:,ib),conv_factor(:,ib),        &
+                           conv_factor_jac,dlrk(:,ib),dldrdc)
+      else if (ichemistry.eq.4) then
+        call ssh_jacdchemdc (nespg,nrg,dlconc(:,ib),conv_factor(:,ib),      &
+                             conv_factor_jac,dlrk(:,ib),dldrdc)
+      endif
+
+      do jj = 1, nespg
+        dlk1(ib,jj) = dlr(jj)
+        do ji = 1, nespg
+          pp = chem_lu_pos(ji,jj)
+          if (pp.gt.0) dlmat(ib,pp) = -igamma*dlstep(ib)*dldrdc(ji,jj)
+        enddo
+      enddo
+
+    else
+
+      do jj = 1, nespg
+        dlk1(ib,jj) = 0.d0
+      enddo
+
+    endif
+
+    do jj = 1, nespg
+      pp = chem_lu_pos(jj,jj)
+      dlmat(ib,pp) = 1.d0 + dlmat(ib,pp)
+    enddo
+
+  enddo
+
+  !------------------------------------------------------------------------
+  !*    2. Computes K1    system: DLmat * K1 = DLb1
+
+  call chem_lu_decompose_batch(nb, nnz, dlmat)
+  call chem_lu_solve_batch(nb, nnz, dlmat, dlk1)
+
+  !------------------------------------------------------------------------
+  !*    3. Computes K2    system: DLmat * K2 = DLb2
+
+  do ib = 1, nb
+
+    if (active(ib)) then
+
+      do ji = 1, nespg
+        dlconcbis(ji) = dlconc(ji,ib) + dlstep(ib) * dlk1(ib,ji)
+        if (dlconcbis(ji) .lt. 0.d0) then
+          dlconcbis(ji) = 0.d0
+          dlk1(ib,ji) = (dlconcbis(ji) - dlconc(ji,ib)) / dlstep(ib)
+        endif
+      enddo
+
+      call chem_fexchem_batch_cell(dlconcbis, dlrk(:,ib), zcsourc(:,ib),    &
+                                   conv_factor(:,ib), dlr)
+
+      do ji = 1, nespg
+        dlk2(ib,ji) =  dlr(ji) - 2.d0*dlk1(ib,ji)
+      enddo
+
+    else
+
+      do ji = 1, nespg
+        dlk2(ib,ji) = 0.d0
+      enddo
+
+    endif
+
+  enddo
+
+  call chem_lu_solve_batch(nb, nnz, dlmat, dlk2)
+
+  !------------------------------------------------------------------------
+  !*    4. Advance the time in each cell, or reject the sub-step
+
+  do ib = 1, nb
+
+    if (.not. active(ib)) cycle
+
+    dlerr = 0.d0
+
+    do ji = 1, nespg
+      dlconcnew(ji) = dlconc(ji,ib) + 1.5d0 * dlstep(ib) * dlk1(ib,ji)     &
+                    + 0.5d0 * dlstep(ib) * dlk2(ib,ji)
+      if (dlconcnew(ji) .lt. 0.0d0) then
+        dlconcnew(ji) = 0.d0
+      endif
+      ! Difference with the embedded first order solution
+      dlsc = atolchem + rtolchem*max(dabs(dlconc(ji,ib)), dlconcnew(ji))
+      dlsc = max(dlsc, 1.d-300)
+      dlerr = max(dlerr,                                                     &
+                  0.5d0*dlstep(ib)*dabs(dlk1(ib,ji) + dlk2(ib,ji)) / dlsc)
+    enddo
+
+    if (rtolchem.le.0.d0) then
+      dlerr = 0.d0
+    endif
+
+    ! Step size factor
+    dlfac = 2.d0
+    if (dlerr.gt.0.d0) then
+      dlfac = min(dlfac, max(0.2d0, 0.9d0/dsqrt(dlerr)))
+    endif
+
+    if (dlerr.le.1.d0 .or. dlstep(ib).le.1.d-6*dtchemmax) then
+      do ji = 1, nespg
+        dlconc(ji,ib) = dlconcnew(ji)
+      enddo
+      dlt(ib) = dlt(ib) + dlstep(ib)
+    endif
+
+    if (rtolchem.gt.0.d0) then
+      dlstep(ib) = min(dlstep(ib)*dlfac, dtchemmax)
+    endif
+
+  enddo
+
+enddo
+
+deallocate(dlmat)
+
+return
+end subroutine chem_roschem_batch
+
+!===============================================================================
+
+!> \brief Chemical production terms for one cell of a batch.
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+! Arguments
+!------------------------------------------------------------------------------
+!   mode          name          role
+!------------------------------------------------------------------------------
+!> \param[in]     dlconc        concentrations vector
+!> \param[in]     dlrk          kinetic rates
+!> \param[in]     zcsourc       source term
+!> \param[in]     conv_factor   conversion factors
+!> \param[out]    dlr           chemical production terms
+!______________________________________________________________________________
+
+subroutine chem_fexchem_batch_cell (dlconc,dlrk,zcsourc,conv_factor,dlr)
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use atchem
+
+implicit none
+
+! Arguments
+
+double precision dlconc(nespg), dlrk(nrg), zcsourc(nespg)
+double precision conv_factor(nespg), dlr(nespg)
+
+if (ichemistry.eq.1) then
+  call fexchem_1 (nespg,nrg,dlconc,dlrk,zcsourc,conv_factor,dlr)
+else if (ichemistry.eq.2) then
+  call fexchem_2 (nespg,nrg,dlconc,dlrk,zcsourc,conv_factor,dlr)
+else if (ichemistry.eq.3) then
+  call fexchem_3 (nespg,nrg,dlconc,dlrk,zcsourc,conv_factor,dlr)
+else if (ichemistry.eq.4) then
+  call fexchem_4 (nespg,nrg,dlconc,dlrk,zcsourc,conv_factor,dlr)
+endif
+
+return
+end subroutine chem_fexchem_batch_cell
@@ -102,3 +102,279 @@ else
 endif
 
 end subroutine cs_solvlin
+
+!===============================================================================
+
+!> \brief Build the sparsity pattern of the Rosenbrock matrix and of its LU
+!>        factors, shared by all cells, and the associated operation lists
+!>        used by the batched LU solver.
+!>
+!> The pattern of the Jacobian is obtained by evaluating it for generic
+!> concentrations and kinetic rates, so that only structural zeros remain.
+!------------------------------------------------------------------------------
+
+subroutine chem_lu_pattern_init
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use atchem
+
+implicit none
+
+! Local variables
+
+integer ii, jj, kk, nnz, nops, nfwd, nbwd
+double precision dlconc(nespg), conv_factor(nespg), dlrk(nrg)
+double precision dldrdc(nespg,nespg)
+logical lnz(nespg,nespg)
+
+!------------------------------------------------------------------------
+!*    1. Structure of the Jacobian, with the diagonal
+
+do ii = 1, nespg
+  dlconc(ii) = 1.d0 + 0.1d0*dsqrt(dble(ii))
+  conv_factor(ii) = 1.d0
+enddo
+do ii = 1, nrg
+  dlrk(ii) = 1.d0 + 0.01d0*dsqrt(dble(ii))
+enddo
+
+if (ichemistry.eq.1) then
+  call jacdchemdc_1 (nespg,nrg,dlconc,conv_factor,conv_factor_jac,dlrk,dldrdc)
+else if (ichemistry.eq.2) then
+  call jacdchemdc_2 (nespg,nrg,dlconc,conv_factor,conv_factor_jac,dlrk,dldrdc)
+else if (ichemistry.eq.3) then
+  call jacdchemdc_3 (nespg,nrg,dlconc,conv_factor,conv_factor_jac,dlrk,dldrdc)
+else if (ichemistry.eq.4) then
+  call ssh_jacdchemdc (nespg,nrg,dlconc,conv_factor,conv_factor_jac,dlrk,dldrdc)
+endif
+
+do jj = 1, nespg
+  do ii = 1, nespg
+    lnz(ii,jj) = (dabs(dldrdc(ii,jj)).gt.0.d0) .or. (ii.eq.jj)
+  enddo
+enddo
+
+!------------------------------------------------------------------------
+!*    2. Symbolic factorization (no pivoting, as in lu_decompose_*)
+
+nops = 0
+do kk = 1, nespg
+  do ii = kk+1, nespg
+    if (lnz(ii,kk)) then
+      nops = nops + 1
+      do jj = kk+1, nespg
+        if (lnz(kk,jj)) then
+          lnz(ii,jj) = .true.
+          nops = nops + 1
+        endif
+      enddo
+    endif
+  enddo
+enddo
+
+allocate(chem_lu_pos(nespg,nespg))
+
+nnz = 0
+nfwd = 0
+nbwd = nespg
+do jj = 1, nespg
+  do ii = 1, nespg
+    if (lnz(ii,jj)) then
+      nnz = nnz + 1
+      chem_lu_pos(ii,jj) = nnz
+      if (ii.gt.jj) then
+        nfwd = nfwd + 1
+      else if (ii.lt.jj) then
+        nbwd = nbwd + 1
+      endif
+    else
+      chem_lu_pos(ii,jj) = 0
+    endif
+  enddo
+enddo
+
+!------------------------------------------------------------------------
+!*    3. Operation lists
+
+allocate(chem_lu_ops(3,nops))
+allocate(chem_lu_fwd(3,nfwd))
+allocate(chem_lu_bwd(3,nbwd))
+
+nops = 0
+do kk = 1, nespg
+  do ii = kk+1, nespg
+    if (chem_lu_pos(ii,kk).gt.0) then
+      nops = nops + 1
+      chem_lu_ops(1,nops) = chem_lu_pos(ii,kk)
+      chem_lu_ops(2,nops) = chem_lu_pos(kk,kk)
+      chem_lu_ops(3,nops) = 0
+      do jj = kk+1, nespg
+        if (chem_lu_pos(kk,jj).gt.0) then
+          nops = nops + 1
+          chem_lu_ops(1,nops) = chem_lu_pos(ii,jj)
+          chem_lu_ops(2,nops) = chem_lu_pos(ii,kk)
+          chem_lu_ops(3,nops) = chem_lu_pos(kk,jj)
+        endif
+      enddo
+    endif
+  enddo
+enddo
+
+nfwd = 0
+do ii = 2, nespg
+  do kk = 1, ii-1
+    if (chem_lu_pos(ii,kk).gt.0) then
+      nfwd = nfwd + 1
+      chem_lu_fwd(1,nfwd) = ii
+      chem_lu_fwd(2,nfwd) = kk
+      chem_lu_fwd(3,nfwd) = chem_lu_pos(ii,kk)
+    endif
+  enddo
+enddo
+
+nbwd = 0
+do ii = nespg, 1, -1
+  do jj = ii+1, nespg
+    if (chem_lu_pos(ii,jj).gt.0) then
+      nbwd = nbwd + 1
+      chem_lu_bwd(1,nbwd) = ii
+      chem_lu_bwd(2,nbwd) = jj
+      chem_lu_bwd(3,nbwd) = chem_lu_pos(ii,jj)
+    endif
+  enddo
+  nbwd = nbwd + 1
+  chem_lu_bwd(1,nbwd) = ii
+  chem_lu_bwd(2,nbwd) = 0
+  chem_lu_bwd(3,nbwd) = chem_lu_pos(ii,ii)
+enddo
+
+return
+end subroutine chem_lu_pattern_init
+
+!===============================================================================
+
+!> \brief LU factorization of a batch of matrices sharing the sparsity
+!>        pattern built by chem_lu_pattern_init.
+!>
+!> Matrices are stored with the batch index first, so that each operation
+!> is applied to all cells of the batch with unit stride.
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+! Arguments
+!------------------------------------------------------------------------------
+!   mode          name          role
+!------------------------------------------------------------------------------
+!> \param[in]     nb            number of cells in batch
+!> \param[in]     nnz           number of entries in packed matrices
+!> \param[in,out] dla           packed matrices, replaced by their LU factors
+!______________________________________________________________________________
+
+subroutine chem_lu_decompose_batch (nb,nnz,dla)
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use atchem
+
+implicit none
+
+! Arguments
+
+integer nb, nnz
+double precision dla(nb,nnz)
+
+! Local variables
+
+integer iop, ib, p1, p2, p3
+
+do iop = 1, size(chem_lu_ops, 2)
+  p1 = chem_lu_ops(1,iop)
+  p2 = chem_lu_ops(2,iop)
+  p3 = chem_lu_ops(3,iop)
+  if (p3.eq.0) then
+    do ib = 1, nb
+      dla(ib,p1) = dla(ib,p1) / dla(ib,p2)
+    enddo
+  else
+    do ib = 1, nb
+      dla(ib,p1) = dla(ib,p1) - dla(ib,p2)*dla(ib,p3)
+    enddo
+  endif
+enddo
+
+return
+end subroutine chem_lu_decompose_batch
+
+!===============================================================================
+
+!> \brief Solve systems for a batch of LU factors computed by
+!>        chem_lu_decompose_batch.
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+! Arguments
+!------------------------------------------------------------------------------
+!   mode          name          role
+!------------------------------------------------------------------------------
+!> \param[in]     nb            number of cells in batch
+!> \param[in]     nnz           number of entries in packed matrices
+!> \param[in]     dlalu         packed LU factors
+!> \param[in,out] dlx           on entry, right-hand sides;
+!>                              on exit, solutions
+!______________________________________________________________________________
+
+subroutine chem_lu_solve_batch (nb,nnz,dlalu,dlx)
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use atchem
+
+implicit none
+
+! Arguments
+
+integer nb, nnz
+double precision dlalu(nb,nnz)
+double precision dlx(nb,nespg)
+
+! Local variables
+
+integer iop, ib, ii, jj, pp
+
+! Forward substitution (unit lower triangular factor)
+
+do iop = 1, size(chem_lu_fwd, 2)
+  ii = chem_lu_fwd(1,iop)
+  jj = chem_lu_fwd(2,iop)
+  pp = chem_lu_fwd(3,iop)
+  do ib = 1, nb
+    dlx(ib,ii) = dlx(ib,ii) - dlalu(ib,pp)*dlx(ib,jj)
+  enddo
+enddo
+
+! Backward substitution
+
+do iop = 1, size(chem_lu_bwd, 2)
+  ii = chem_lu_bwd(1,iop)
+  jj = chem_lu_bwd(2,iop)
+  pp = chem_lu_bwd(3,iop)
+  if (jj.eq.0) then
+    do ib = 1, nb
+      dlx(ib,ii) = dlx(ib,ii) / dlalu(ib,pp)
+    enddo
+  else
+    do ib = 1, nb
+      dlx(ib,ii) = dlx(ib,ii) - dlalu(ib,pp)*dlx(ib,jj)
+    enddo
+  endif
+enddo
+
+return
+end subroutine chem_lu_solve_batch
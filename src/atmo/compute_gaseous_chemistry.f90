@@ -70,18 +70,15 @@ double precision dt(ncelet)
 
 ! Local Variables
 
-integer iel,ii
+integer iel,ii,ib,nb,ibatch
 double precision rom
 
-!  Variables used for Rosenbrock resolution
-double precision  dlconc(nespg)
-double precision  source(nespg)
 double precision  dchema(nespg)
-double precision  conv_factor(nespg) ! conversion factors for reaction rates
-double precision rk(nrg)
-double precision dtc
-integer ncycle
-double precision dtrest
+double precision  dlconc(nespg,nbchem)
+double precision  source(nespg,nbchem)
+double precision  conv_factor(nespg,nbchem) ! conversion factors for reaction rates
+double precision  rk(nrg,nbchem)
+double precision  dtc(nbchem)
 
 double precision, dimension(:), pointer :: crom
 type(pmapper_double_r1), dimension(:), allocatable :: cvar_espg, cvara_espg
@@ -99,82 +96,92 @@ do ii = 1, nespg
   call field_get_val_prev_s(ivarfl(isca(isca_chem(ii))), cvara_espg(ii)%p)
 enddo
 
-do iel = 1, ncel
+! Sparsity pattern of the Rosenbrock matrix, shared by all cells
 
-  ! time step
-  dtc = dt(iel)
+if (.not. allocated(chem_lu_pos)) then
+  call chem_lu_pattern_init
+endif
 
-  ! density
-  rom = crom(iel)
+! Cells are integrated by batches of nbchem cells, whose linear systems are
+! solved together (see chem_roschem_batch). Batches are independent, and
+! the number of sub-steps may vary from one batch to another, so they are
+! distributed dynamically among threads.
+! User-defined (SSH) schemes are not assumed to be thread-safe.
 
-  ! Filling working array rk
-  do ii = 1, nrg
-    rk(ii) = reacnum((ii-1)*ncel+iel)
-  enddo
+!$omp parallel do schedule(dynamic) if(ichemistry.ne.4)                   &
+!$omp private(ibatch, ib, nb, iel, ii, rom, dchema, dlconc, source,       &
+!$omp         conv_factor, rk, dtc)
+do ibatch = 1, (ncel + nbchem - 1) / nbchem
 
-  do ii = 1, nespg
-    conv_factor(chempoint(ii)) = rom*navo*(1.0d-9)/dmmk(ii)
-    source(ii) = 0.0d0
-  enddo
+  nb = min(nbchem, ncel - (ibatch-1)*nbchem)
 
-  if ((isepchemistry.eq.1).or.(ntcabs.lt.ntinit)) then
-    ! -----------------------------
-    ! -- splitted Rosenbrock solver
-    ! -----------------------------
+  do ib = 1, nb
 
-    ! Filling working array dlconc with values at current time step
-    do ii = 1, nespg
-      dlconc(chempoint(ii)) = cvar_espg(ii)%p(iel)
-    enddo
+    iel = (ibatch-1)*nbchem + ib
 
-  else
-    ! -----------------------------
-    ! -- semi-coupled Rosenbrock solver
-    ! -----------------------------
+    ! time step
+    dtc(ib) = dt(iel)
 
-    ! Filling working array dlconc with values at previous time step
-    do ii = 1, nespg
-      dlconc(chempoint(ii)) = cvara_espg(ii)%p(iel)
+    ! density
+    rom = crom(iel)
+
+    ! Filling working array rk
+    do ii = 1, nrg
+      rk(ii,ib) = reacnum((ii-1)*ncel+iel)
     enddo
 
-    ! Computation of C(Xn)
-    if (ichemistry.eq.1) then
-      call fexchem_1 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
-    else if (ichemistry.eq.2) then
-      call fexchem_2 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
-    else if (ichemistry.eq.3) then
-      call fexchem_3 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
-    else if (ichemistry.eq.4) then
-      call fexchem_4 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
-    endif
-
-    ! Explicit contribution from dynamics as a source term:
-    ! (X*-Xn)/dt(dynamics) - C(Xn). See usatch.f90
-    ! The first nespg user scalars are supposed to be chemical species
     do ii = 1, nespg
-      source(chempoint(ii)) = (cvar_espg(ii)%p(iel)-cvara_espg(ii)%p(iel))/dtc  &
-                            - dchema(chempoint(ii))
+      conv_factor(chempoint(ii),ib) = rom*navo*(1.0d-9)/dmmk(ii)
+      source(ii,ib) = 0.0d0
     enddo
 
-  endif ! End test isepchemistry
+    if ((isepchemistry.eq.1).or.(ntcabs.lt.ntinit)) then
+      ! -----------------------------
+      ! -- splitted Rosenbrock solver
+      ! -----------------------------
+
+      ! Filling working array dlconc with values at current time step
+      do ii = 1, nespg
+        dlconc(chempoint(ii),ib) = cvar_espg(ii)%p(iel)
+      enddo
+
+    else
+      ! -----------------------------
+      ! -- semi-coupled Rosenbrock solver
+      ! -----------------------------
+
+      ! Filling working array dlconc with values at previous time step
+      do ii = 1, nespg
+        dlconc(chempoint(ii),ib) = cvara_espg(ii)%p(iel)
+      enddo
+
+      ! Computation of C(Xn)
+      call chem_fexchem_batch_cell(dlconc(:,ib), rk(:,ib), source(:,ib),   &
+                                   conv_factor(:,ib), dchema)
+
+      ! Explicit contribution from dynamics as a source term:
+      ! (X*-Xn)/dt(dynamics) - C(Xn). See usatch.f90
+      ! The first nespg user scalars are supposed to be chemical species
+      do ii = 1, nespg
+        source(chempoint(ii),ib) =   (cvar_espg(ii)%p(iel)                  &
+                                    - cvara_espg(ii)%p(iel))/dtc(ib)        &
+                                   - dchema(chempoint(ii))
+      enddo
+
+    endif ! End test isepchemistry
 
-  ! Rosenbrock resoluion
+  enddo
 
-  ! The maximum time step used for chemistry resolution is dtchemmax
-  if (dtc.le.dtchemmax) then
-    call chem_roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
-  else
-    ncycle = int(dtc/dtchemmax)
-    dtrest = mod(dtc,dtchemmax)
-    do ii = 1, ncycle
-      call chem_roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
-    enddo
-    call chem_roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
-  endif
+  ! Rosenbrock resolution, with sub-steps of at most dtchemmax
+
+  call chem_roschem_batch(nb, dlconc, source, conv_factor, dtc, rk)
 
   ! Update of values at current time step
-  do ii = 1, nespg
-    cvar_espg(ii)%p(iel) = dlconc(chempoint(ii))
+  do ib = 1, nb
+    iel = (ibatch-1)*nbchem + ib
+    do ii = 1, nespg
+      cvar_espg(ii)%p(iel) = dlconc(chempoint(ii),ib)
+    enddo
   enddo
 
 enddo
@@ -198,9 +198,9 @@ cs_air_dxsath(cs_real_t  th,
     c1 = 271.68;
     ps = a1 + (b1 * th)/(c1 + th);
     pv = exp(ps);
-    grpim =  b1 *   c1 / pow(c1 + th,2.);
+    grpim =  b1 *   c1 / cs_math_pow2(c1 + th);
 
-    dxsath = 0.622 * pv * p0 * grpim /pow(p0 - pv,2.);
+    dxsath = 0.622 * pv * p0 * grpim / cs_math_pow2(p0 - pv);
 
   }
 
@@ -213,9 +213,9 @@ cs_air_dxsath(cs_real_t  th,
     c1 = 239.78;
     ps = a1 + (b1 * th)/(c1 + th);
     pv = exp(ps);
-    grpim =  b1 *   c1 / pow(c1 + th,2.);
+    grpim =  b1 *   c1 / cs_math_pow2(c1 + th);
 
-    dxsath =0.622 * pv * p0 * grpim /pow(p0 - pv,2.);
+    dxsath =0.622 * pv * p0 * grpim / cs_math_pow2(p0 - pv);
 
   }
 
@@ -241,18 +241,18 @@ cs_air_dxsath(cs_real_t  th,
     py = Ay *tt / (1. + tt );
     py10 = pow( 10., py );
     g1 = a1 * tt / (1. + tt);
-    g1pr = a1 / (T0 * pow(1. + tt, 2.) );
+    g1pr = a1 / (T0 * cs_math_pow2(1. + tt));
     g2 = - A2 * log10(1. + tt );
     g2pr = - A2 /(T0 * log(10.)*(1. + tt));
     g3 = A3 *(1. - 1. /px10);
     g3pr = A3 * Ax * log(10.) / (T0 * px10);
     g4 = A4 *(py10 - 1.);
-    g4pr = A4 * Ay * log (10.) * py10 / (T0* pow(1. + tt, 2.));
+    g4pr = A4 * Ay * log (10.) * py10 / (T0* cs_math_pow2(1. + tt));
     ps = A0 + g1 + g2 + g3 + g4;
     pspr = g1pr + g2pr + g3pr + g4pr;
     pv = pow(10., ps) *100.;
     pvpr  = log(10.) * pspr * pv;
-    dxsath= p0 * pvpr * 0.622 / pow (p0 - pv, 2);
+    dxsath= p0 * pvpr * 0.622 / cs_math_pow2(p0 - pv);
 
   }
   else if (th > 80.) {
@@ -357,6 +357,66 @@ cs_air_t_humidair(cs_real_t  cp_h,
   return  t_h;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Calculation of the saturation humidity, Cp and specific enthalpy
+ *        of humid air for a set of values.
+ *
+ * This is equivalent to calling \ref cs_air_x_sat, \ref cs_air_cp_humidair
+ * and \ref cs_air_h_humidair for each element, with the air properties
+ * loaded only once, and the Cp and enthalpy evaluated in a branch-free
+ * loop the compiler may vectorize.
+ *
+ * \param[in]     n_elts        number of elements
+ * \param[in]     p0            reference pressure
+ * \param[in]     t_h           temperature of humid air in Celsius
+ * \param[in]     x             absolute humidity of humid air
+ * \param[out]    x_s           absolute humidity of saturated humid air
+ * \param[out]    cp_h          Cp of humid air, or NULL
+ * \param[out]    h_h           specific enthalpy of humid air, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_air_humidair_props(cs_lnum_t         n_elts,
+                      cs_real_t         p0,
+                      const cs_real_t   t_h[],
+                      const cs_real_t   x[],
+                      cs_real_t         x_s[],
+                      cs_real_t         cp_h[],
+                      cs_real_t         h_h[])
+{
+  const cs_air_fluid_props_t  *ct_prop = cs_glob_air_props;
+
+  const cs_real_t cp_a = ct_prop->cp_a;
+  const cs_real_t cp_v = ct_prop->cp_v;
+  const cs_real_t cp_l = ct_prop->cp_l;
+  const cs_real_t hv0 = ct_prop->hv0;
+  const cs_real_t tkelvi = cs_physical_constants_celsius_to_kelvin;
+
+  /* Saturation humidity (piecewise correlations) */
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    x_s[i] = cs_air_x_sat(t_h[i], p0);
+
+  if (cp_h == NULL && h_h == NULL)
+    return;
+
+  /* Cp and enthalpy; the vapor part is bounded by saturation, the
+     remainder being condensed liquid */
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    cs_real_t x_v = CS_MIN(x[i], x_s[i]);
+    cs_real_t cp = (cp_a + x_v*cp_v + (x[i] - x_v)*cp_l) / (1.0 + x[i]);
+    if (cp_h != NULL)
+      cp_h[i] = cp;
+    if (h_h != NULL)
+      h_h[i] = cp*(t_h[i] + tkelvi) + x_v*hv0/(1.0 + x[i]);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Calculation of the temperature of liquid water
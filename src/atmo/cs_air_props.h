@@ -165,6 +165,30 @@ cs_air_t_humidair(cs_real_t  cp_h,
                   cs_real_t  x_s,
                   cs_real_t  h_h);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Calculation of the saturation humidity, Cp and specific enthalpy
+ *        of humid air for a set of values.
+ *
+ * \param[in]     n_elts        number of elements
+ * \param[in]     p0            reference pressure
+ * \param[in]     t_h           temperature of humid air in Celsius
+ * \param[in]     x             absolute humidity of humid air
+ * \param[out]    x_s           absolute humidity of saturated humid air
+ * \param[out]    cp_h          Cp of humid air, or NULL
+ * \param[out]    h_h           specific enthalpy of humid air, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_air_humidair_props(cs_lnum_t         n_elts,
+                      cs_real_t         p0,
+                      const cs_real_t   t_h[],
+                      const cs_real_t   x[],
+                      cs_real_t         x_s[],
+                      cs_real_t         cp_h[],
+                      cs_real_t         h_h[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Calculation of the temperature of liquid water
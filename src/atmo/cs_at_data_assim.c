@@ -296,11 +296,24 @@ cs_at_data_assim_build_ops(void)
 #if _DA_DEBUG_
     if (cs_glob_rank_id <= 0) {
       bft_printf("   *Building HBHT\n");
-      for (int ii = 0; ii < n_obs; ii++) {
-        bft_printf("    ");
-        for (int jj = 0; jj < n_obs; jj++)
-          bft_printf("%.8f ", oi->b_proj[ii*n_obs + jj]);
-        bft_printf("\n");
+      if (oi->b_proj_idx == NULL) {
+        for (int ii = 0; ii < n_obs; ii++) {
+          bft_printf("    ");
+          for (int jj = 0; jj < n_obs; jj++)
+            bft_printf("%.8f ", oi->b_proj[ii*n_obs + jj]);
+          bft_printf("\n");
+        }
+      }
+      else { /* localized: print non-zero coefficients (obs. id, value) */
+        for (int ii = 0; ii < n_obs; ii++) {
+          bft_printf("    ");
+          for (cs_lnum_t kk = oi->b_proj_idx[ii];
+               kk < oi->b_proj_idx[ii+1];
+               kk++)
+            bft_printf("(%d) %.8f ", (int)oi->b_proj_ids[kk],
+                       oi->b_proj[kk]);
+          bft_printf("\n");
+        }
       }
       bft_printf("\n");
 
@@ -476,6 +489,11 @@ cs_at_data_assim_log(cs_measures_set_t     *ms,
   bft_printf("  Influence radii of observations (m, used for Model covariance "
              "error matrix) : %.2f %.2f\n",
              oi->ir[0], oi->ir[1]);
+  if (oi->cutoff > 0.)
+    bft_printf("  Localization cutoff (relative to influence radii) : %.2f\n",
+               oi->cutoff);
+  else
+    bft_printf("  No localization of covariances\n");
   for (int kk = 0; kk < f->dim; kk++) {
     bft_printf("  Relaxation factor (1/s) for comp. %i: %.1e\n",
                kk, oi->relax[kk]);
@@ -575,6 +593,7 @@ cs_at_data_assim_source_term(int        f_id,
 
     /* explicit */
     if (oi->type_nudging == 1) {
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
         cs_real_t rovol = cell_f_vol[c_id]*CS_F_(rho)->val[c_id];
         for (int ii = 0; ii < dim; ii++) {
@@ -583,6 +602,7 @@ cs_at_data_assim_source_term(int        f_id,
         }
       }
     } else { /* implicit */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
         cs_real_t rovol = cell_f_vol[c_id]*CS_F_(rho)->val[c_id];
         for (int ii = 0; ii < dim; ii++) {
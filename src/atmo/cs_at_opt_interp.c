@@ -87,10 +87,28 @@ BEGIN_C_DECLS
 /* maximum size of line in measures files */
 #define MAX_LINE_SIZE 1000
 
+/* maximum number of buckets per direction for observation search grids */
+#define _OBS_GRID_MAX_DIM 64
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
 
+/* Uniform bucket grid of observation points, in coordinates normalized
+   by influence radii, used for localized neighbor searches */
+
+typedef struct {
+
+  cs_real_t   ir_inv[3];  /* inverse of influence radii per direction */
+  cs_real_t   h;          /* search radius (normalized) */
+  cs_real_t   x_min[3];   /* grid origin (normalized) */
+  cs_real_t   dx[3];      /* bucket size per direction (normalized) */
+  cs_lnum_t   n_b[3];     /* number of buckets per direction */
+  cs_lnum_t  *idx;        /* bucket -> points index */
+  cs_lnum_t  *ids;        /* bucket -> points (ids in point list) */
+
+} _obs_grid_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -153,6 +171,12 @@ _p0_projection(cs_measures_set_t  *ms,
   cs_real_t *proj = oi->model_to_obs_proj;
   cs_lnum_t *proj_c_ids = oi->model_to_obs_proj_c_ids;
 
+  for (cs_lnum_t ii = 0; ii < n_obs * stride; ii++)
+    proj[ii] = 0.;
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    proj_c_ids[ii] = -1;
+
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
     cs_lnum_t c_id0 = ig->cell_connect[ii];
 
@@ -170,14 +194,10 @@ _p0_projection(cs_measures_set_t  *ms,
     }
   }
 
-  /* exchange size of neighborhood of each observation */
+  /* exchange size of neighborhood of each observation
+     (each observation is located on a single rank, others contribute 0) */
 
-  if (cs_glob_rank_id > -1) {
-    for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-      int r_id0 = ig->rank_connect[ii];
-      cs_parall_bcast(r_id0, 1, CS_INT_TYPE, &(proj_idx[ii+1]));
-    }
-  }
+  cs_parall_sum(n_obs, CS_LNUM_TYPE, proj_idx + 1);
 
   /* build observations neighborhood index */
 
@@ -186,14 +206,7 @@ _p0_projection(cs_measures_set_t  *ms,
 
   /* exchange projection values on neighborhood of each observation */
 
-  if (cs_glob_rank_id > -1) {
-    for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-      cs_lnum_t s_idx = proj_idx[ii];
-      cs_lnum_t l_size = stride*(proj_idx[ii+1] - s_idx);
-      int r_id0 = ig->rank_connect[ii];
-      cs_parall_bcast(r_id0, l_size, CS_DOUBLE, proj + stride*s_idx);
-    }
-  }
+  cs_parall_sum(stride*proj_idx[n_obs], CS_DOUBLE, proj);
 }
 
 /*----------------------------------------------------------------------------
@@ -270,13 +283,17 @@ _p1_projection(cs_measures_set_t  *ms,
     }
   }
 
-  /* exchange size of neighborhood of each observation */
+  /* exchange size of neighborhood of each observation
+     (each observation is located on a single rank, others contribute 0) */
 
-  if (cs_glob_rank_id > -1) {
-    for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-      int r_id0 = ig->rank_connect[ii];
-      cs_parall_bcast(r_id0, 1, CS_INT_TYPE, &(proj_idx[ii+1]));
-    }
+  cs_parall_sum(n_obs, CS_LNUM_TYPE, proj_idx + 1);
+
+  /* compute max. size and build observations neighborhood index */
+
+  cs_lnum_t n_max_size = 0;
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
+    n_max_size = CS_MAX(proj_idx[ii+1], n_max_size);
+    proj_idx[ii+1] += proj_idx[ii];
   }
 
   /* now allocate projection matrix values and cell ids */
@@ -289,13 +306,11 @@ _p1_projection(cs_measures_set_t  *ms,
   cs_real_t *proj = oi->model_to_obs_proj;
   cs_lnum_t *proj_c_ids = oi->model_to_obs_proj_c_ids;
 
-  /* compute max. size and build observations neighborhood index */
+  for (cs_lnum_t ii = 0; ii < proj_idx[n_obs] * stride; ii++)
+    proj[ii] = 0.;
 
-  cs_lnum_t n_max_size = 0;
-  for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    n_max_size = CS_MAX(proj_idx[ii+1], n_max_size);
-    proj_idx[ii+1] += proj_idx[ii];
-  }
+  for (cs_lnum_t ii = 0; ii < proj_idx[n_obs]; ii++)
+    proj_c_ids[ii] = -1;
 
   /* compute projection matrix coefficients */
 
@@ -333,8 +348,8 @@ _p1_projection(cs_measures_set_t  *ms,
       /* (partially) extended neighborhood */
 
       if (halo_type == CS_HALO_EXTENDED) {
-        for (cs_lnum_t jj = cell_cells_idx[c_id0];
-             jj < cell_cells_idx[c_id0+1];
+        for (cs_lnum_t jj = cell_cells_e_idx[c_id0];
+             jj < cell_cells_e_idx[c_id0+1];
              jj++) {
           cs_lnum_t tot_ccount = proj_idx[ii] + ccount;
           cs_lnum_t c_id1 = cell_cells_e[jj];
@@ -405,14 +420,7 @@ _p1_projection(cs_measures_set_t  *ms,
 
   /* exchange projection values on neighborhood of each observation */
 
-  if (cs_glob_rank_id > -1) {
-    for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-      cs_lnum_t s_idx = proj_idx[ii];
-      cs_lnum_t l_size = stride*(proj_idx[ii+1] - s_idx);
-      int r_id0 = ig->rank_connect[ii];
-      cs_parall_bcast(r_id0, l_size, CS_DOUBLE, proj + stride*s_idx);
-    }
-  }
+  cs_parall_sum(stride*proj_idx[n_obs], CS_DOUBLE, proj);
 }
 
 /*----------------------------------------------------------------------------
@@ -447,6 +455,331 @@ _b_matrix(cs_real_t  xi,
   return (1. + dist) * exp(-dist);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute localization coefficient between points I and J, using the
+ * compactly supported fifth-order function of Gaspari and Cohn (1999),
+ * which vanishes beyond the cutoff distance.
+ *
+ * parameters:
+ *   xi     <-- x coordinate of point I
+ *   yi     <-- y coordinate of point I
+ *   zi     <-- z coordinate of point I
+ *   xj     <-- x coordinate of point J
+ *   yj     <-- y coordinate of point J
+ *   zj     <-- z coordinate of point J
+ *   ir_xy2 <-- square of influence radius with respect to x and y
+ *   ir_z2  <-- square of influence radius with respect to z
+ *   cutoff <-- cutoff distance, relative to influence radii
+ *
+ * returns:
+ *   localization coefficient, in [0, 1]
+ *----------------------------------------------------------------------------*/
+
+inline static cs_real_t
+_localization(cs_real_t  xi,
+              cs_real_t  yi,
+              cs_real_t  zi,
+              cs_real_t  xj,
+              cs_real_t  yj,
+              cs_real_t  zj,
+              cs_real_t  ir_xy2,
+              cs_real_t  ir_z2,
+              cs_real_t  cutoff)
+{
+  cs_real_t dist = sqrt( ( cs_math_sq(xi - xj)
+                         + cs_math_sq(yi - yj) )/ir_xy2
+                       + cs_math_sq(zi - zj)/ir_z2);
+
+  cs_real_t r = 2.*dist/cutoff;
+
+  if (r >= 2.)
+    return 0.;
+  else if (r > 1.)
+    return ((((r/12. - 0.5)*r + 0.625)*r + 5./3.)*r - 5.)*r
+           + 4. - 2./(3.*r);
+  else
+    return (((-0.25*r + 0.5)*r + 0.625)*r - 5./3.)*r*r + 1.;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute coefficients of HB(H)t between observations I and J from the
+ * interpolation stencils of both observations.
+ *
+ * parameters:
+ *   proj     <-- projection values and stencil point coordinates
+ *   proj_idx <-- observations stencil index
+ *   dim      <-- dimension of measures
+ *   ii       <-- id of observation I
+ *   jj       <-- id of observation J
+ *   ir_xy2   <-- square of influence radius with respect to x and y
+ *   ir_z2    <-- square of influence radius with respect to z
+ *   hbht     --> coefficients for each measures component
+ *----------------------------------------------------------------------------*/
+
+static void
+_hbht_coeffs(const cs_real_t  *proj,
+             const cs_lnum_t  *proj_idx,
+             int               dim,
+             cs_lnum_t         ii,
+             cs_lnum_t         jj,
+             cs_real_t         ir_xy2,
+             cs_real_t         ir_z2,
+             cs_real_t         hbht[])
+{
+  const int stride = dim + 3; /* dimension of field + dimension of space */
+
+  for (int pp = 0; pp < dim; pp++)
+    hbht[pp] = 0;
+
+  for (cs_lnum_t kk = proj_idx[ii]; kk < proj_idx[ii+1]; kk++) {
+    cs_real_t x1 = (proj + kk*stride)[dim  ];
+    cs_real_t y1 = (proj + kk*stride)[dim+1];
+    cs_real_t z1 = (proj + kk*stride)[dim+2];
+
+    for (cs_lnum_t ll = proj_idx[jj]; ll < proj_idx[jj+1]; ll++) {
+      cs_real_t x2 = (proj + ll*stride)[dim  ];
+      cs_real_t y2 = (proj + ll*stride)[dim+1];
+      cs_real_t z2 = (proj + ll*stride)[dim+2];
+
+      cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
+
+      for (int pp = 0; pp < dim; pp++)
+        hbht[pp] += (proj + kk*stride)[pp] * (proj + ll*stride)[pp] * influ;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build a bucket grid for a set of observation points.
+ *
+ * Coordinates are normalized by the influence radii, so that points
+ * closer than the cutoff are found in neighboring buckets.
+ *
+ * parameters:
+ *   n_pts  <-- number of points
+ *   pt_ids <-- ids of points in coordinates array, or NULL
+ *   coords <-- points coordinates (interleaved)
+ *   ir     <-- influence radii (xy, z)
+ *   cutoff <-- search radius, relative to influence radii
+ *   g      --> grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_obs_grid_build(cs_lnum_t         n_pts,
+                const int        *pt_ids,
+                const cs_real_t  *coords,
+                const cs_real_t   ir[2],
+                cs_real_t         cutoff,
+                _obs_grid_t      *g)
+{
+  g->ir_inv[0] = 1./ir[0];
+  g->ir_inv[1] = 1./ir[0];
+  g->ir_inv[2] = 1./ir[1];
+  g->h = cutoff;
+
+  cs_real_t x_max[3];
+  for (int kk = 0; kk < 3; kk++) {
+    g->x_min[kk] = cs_math_big_r;
+    x_max[kk] = -cs_math_big_r;
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_pts; ii++) {
+    cs_lnum_t p_id = (pt_ids != NULL) ? pt_ids[ii] : ii;
+    for (int kk = 0; kk < 3; kk++) {
+      cs_real_t x = coords[3*p_id + kk]*g->ir_inv[kk];
+      g->x_min[kk] = CS_MIN(g->x_min[kk], x);
+      x_max[kk] = CS_MAX(x_max[kk], x);
+    }
+  }
+
+  cs_lnum_t n_buckets = 1;
+  for (int kk = 0; kk < 3; kk++) {
+    if (n_pts < 1) {
+      g->x_min[kk] = 0.;
+      x_max[kk] = 0.;
+    }
+    cs_real_t extent = x_max[kk] - g->x_min[kk];
+    cs_real_t n_b = floor(extent/cutoff) + 1;
+    g->n_b[kk] = (n_b < _OBS_GRID_MAX_DIM) ? (cs_lnum_t)n_b : _OBS_GRID_MAX_DIM;
+    g->dx[kk] = CS_MAX(cutoff, extent/g->n_b[kk]);
+    n_buckets *= g->n_b[kk];
+  }
+
+  BFT_MALLOC(g->idx, n_buckets + 1, cs_lnum_t);
+  BFT_MALLOC(g->ids, n_pts, cs_lnum_t);
+
+  cs_lnum_t *b_ids = NULL;
+  BFT_MALLOC(b_ids, n_pts, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_buckets + 1; ii++)
+    g->idx[ii] = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_pts; ii++) {
+    cs_lnum_t p_id = (pt_ids != NULL) ? pt_ids[ii] : ii;
+    cs_lnum_t b_c[3];
+    for (int kk = 0; kk < 3; kk++) {
+      cs_real_t x = coords[3*p_id + kk]*g->ir_inv[kk] - g->x_min[kk];
+      b_c[kk] = CS_MIN((cs_lnum_t)(x/g->dx[kk]), g->n_b[kk] - 1);
+    }
+    b_ids[ii] = (b_c[0]*g->n_b[1] + b_c[1])*g->n_b[2] + b_c[2];
+    g->idx[b_ids[ii] + 1] += 1;
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_buckets; ii++)
+    g->idx[ii+1] += g->idx[ii];
+
+  for (cs_lnum_t ii = 0; ii < n_pts; ii++) {
+    cs_lnum_t b_id = b_ids[ii];
+    g->ids[g->idx[b_id]] = ii;
+    g->idx[b_id] += 1;
+  }
+
+  /* restore index (shifted by filling) */
+
+  for (cs_lnum_t ii = n_buckets; ii > 0; ii--)
+    g->idx[ii] = g->idx[ii-1];
+  g->idx[0] = 0;
+
+  BFT_FREE(b_ids);
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of an observation points bucket grid.
+ *
+ * parameters:
+ *   g <-> grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_obs_grid_free(_obs_grid_t  *g)
+{
+  BFT_FREE(g->idx);
+  BFT_FREE(g->ids);
+}
+
+/*----------------------------------------------------------------------------
+ * Determine the range of buckets of an observation points grid which may
+ * contain points within the search radius of a given point.
+ *
+ * parameters:
+ *   g   <-- grid structure
+ *   x   <-- point coordinates
+ *   b_s --> range start for each direction
+ *   b_e --> range end (past the end) for each direction
+ *
+ * returns:
+ *   true if the range is not empty, false otherwise
+ *----------------------------------------------------------------------------*/
+
+inline static bool
+_obs_grid_range(const _obs_grid_t  *g,
+                const cs_real_t     x[3],
+                cs_lnum_t           b_s[3],
+                cs_lnum_t           b_e[3])
+{
+  for (int kk = 0; kk < 3; kk++) {
+    cs_real_t xn = x[kk]*g->ir_inv[kk] - g->x_min[kk];
+    cs_real_t lo = floor((xn - g->h)/g->dx[kk]);
+    cs_real_t hi = floor((xn + g->h)/g->dx[kk]);
+    if (hi < 0 || lo > g->n_b[kk] - 1)
+      return false;
+    b_s[kk] = (lo < 0) ? 0 : (cs_lnum_t)lo;
+    b_e[kk] = (hi > g->n_b[kk] - 1) ? g->n_b[kk] : (cs_lnum_t)hi + 1;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Find points of an observation grid within the cutoff distance of a
+ * given point.
+ *
+ * parameters:
+ *   g       <-- grid structure
+ *   pt_ids  <-- ids of grid points in coordinates array, or NULL
+ *   coords  <-- points coordinates (interleaved)
+ *   x       <-- coordinates of the searched point
+ *   ir_xy2  <-- square of influence radius with respect to x and y
+ *   ir_z2   <-- square of influence radius with respect to z
+ *   nbr_ids --> ids (in grid point list) of neighbors, or NULL
+ *
+ * returns:
+ *   number of neighbors
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_obs_grid_neighbors(const _obs_grid_t  *g,
+                    const int          *pt_ids,
+                    const cs_real_t    *coords,
+                    const cs_real_t     x[3],
+                    cs_real_t           ir_xy2,
+                    cs_real_t           ir_z2,
+                    cs_lnum_t           nbr_ids[])
+{
+  cs_lnum_t n_nbr = 0;
+  cs_lnum_t b_s[3], b_e[3];
+
+  if (!_obs_grid_range(g, x, b_s, b_e))
+    return 0;
+
+  for (cs_lnum_t bi = b_s[0]; bi < b_e[0]; bi++) {
+    for (cs_lnum_t bj = b_s[1]; bj < b_e[1]; bj++) {
+      for (cs_lnum_t bk = b_s[2]; bk < b_e[2]; bk++) {
+        cs_lnum_t b_id = (bi*g->n_b[1] + bj)*g->n_b[2] + bk;
+        for (cs_lnum_t ll = g->idx[b_id]; ll < g->idx[b_id+1]; ll++) {
+          cs_lnum_t p_id = (pt_ids != NULL) ? pt_ids[g->ids[ll]] : g->ids[ll];
+          const cs_real_t *y = coords + 3*p_id;
+          cs_real_t loc = _localization(x[0], x[1], x[2], y[0], y[1], y[2],
+                                        ir_xy2, ir_z2, g->h);
+          if (loc > 0.) {
+            if (nbr_ids != NULL)
+              nbr_ids[n_nbr] = g->ids[ll];
+            n_nbr++;
+          }
+        }
+      }
+    }
+  }
+
+  return n_nbr;
+}
+
+/*----------------------------------------------------------------------------
+ * Add observation error covariance (with time weighting) to diagonal
+ * coefficient of active observation.
+ *
+ * parameters:
+ *   oi     <-- pointer to an optimal interpolation
+ *   m_dim  <-- dimension of measures
+ *   n_obs  <-- number of observations
+ *   obs_id <-- observation id
+ *   mc_id  <-- measures component id
+ *
+ * returns:
+ *   diagonal contribution of R
+ *----------------------------------------------------------------------------*/
+
+inline static cs_real_t
+_obs_cov_diag(const cs_at_opt_interp_t  *oi,
+              int                        m_dim,
+              cs_lnum_t                  n_obs,
+              int                        obs_id,
+              int                        mc_id)
+{
+  cs_real_t r;
+
+  if (!oi->obs_cov_is_diag)
+    r = oi->obs_cov[m_dim*(obs_id * n_obs + obs_id)+mc_id];
+  else
+    r = oi->obs_cov[m_dim*obs_id+mc_id];
+
+  /* time weighting of variances */
+  if (oi->steady <= 0)
+    return (r + 1.) / oi->time_weights[m_dim*obs_id+mc_id] - 1.;
+  else
+    return r;
+}
+
 /*----------------------------------------------------------------------------
  * Assemble full matrix HB(H)t+R.
  *----------------------------------------------------------------------------*/
@@ -461,7 +794,7 @@ _assembly_adding_obs_covariance(cs_measures_set_t  *ms,
   cs_lnum_t n_obs = ms->nb_measures;
   cs_real_t *obs_cov = oi->obs_cov;
   cs_real_t *b_proj = oi->b_proj;
-  cs_real_t *a, r;
+  cs_real_t *a;
 
   int m_dim = ms->dim;
   int a_l_size = n_active_obs;
@@ -470,31 +803,56 @@ _assembly_adding_obs_covariance(cs_measures_set_t  *ms,
 
   /* filling in the full matrix */
 
+# pragma omp parallel for if (a_size > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < a_size; ii++)
     a[ii] = 0.;
 
-  for (cs_lnum_t ii = 0; ii < n_active_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_active_obs; jj++) {
+  if (oi->b_proj_idx == NULL) {
+#   pragma omp parallel for if (n_active_obs > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_active_obs; ii++) {
+      for (cs_lnum_t jj = 0; jj < n_active_obs; jj++)
+        a[ii*a_l_size + jj]
+          = b_proj[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+    }
+  }
 
-      int id = ii*a_l_size + jj;
-      a[id] = b_proj[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+  /* localized HB(H)t: scatter non-zero coefficients */
 
-      /* time weighting of variances */
-      if (ii == jj) {
-        if (!oi->obs_cov_is_diag) {
-          r = obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
-        } else if (oi->obs_cov_is_diag) {
-          r = obs_cov[m_dim*ao_idx[ii]+mc_id];
-        }
+  else {
+    const cs_lnum_t *b_proj_idx = oi->b_proj_idx;
+    const cs_lnum_t *b_proj_ids = oi->b_proj_ids;
 
-        if (oi->steady <= 0) {
-          a[id] += (r + 1.) / oi->time_weights[m_dim*ao_idx[ii]+mc_id] - 1.;
-        } else {
-          a[id] += r;
-        }
+    int *ao_map = NULL;
+    BFT_MALLOC(ao_map, n_obs, int);
+    for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+      ao_map[ii] = -1;
+    for (int ii = 0; ii < n_active_obs; ii++)
+      ao_map[ao_idx[ii]] = ii;
 
-      } else if (!oi->obs_cov_is_diag) {
-        a[id] += obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+#   pragma omp parallel for if (n_active_obs > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_active_obs; ii++) {
+      int obs_id = ao_idx[ii];
+      for (cs_lnum_t kk = b_proj_idx[obs_id]; kk < b_proj_idx[obs_id+1]; kk++) {
+        int jj = ao_map[b_proj_ids[kk]];
+        if (jj > -1)
+          a[ii*a_l_size + jj] = b_proj[m_dim*kk + mc_id];
+      }
+    }
+
+    BFT_FREE(ao_map);
+  }
+
+  /* adding observation covariance */
+
+# pragma omp parallel for if (n_active_obs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_active_obs; ii++) {
+    a[ii*a_l_size + ii] += _obs_cov_diag(oi, m_dim, n_obs, ao_idx[ii], mc_id);
+
+    if (!oi->obs_cov_is_diag) {
+      for (cs_lnum_t jj = 0; jj < n_active_obs; jj++) {
+        if (ii != jj)
+          a[ii*a_l_size + jj]
+            += obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
       }
     }
   }
@@ -502,6 +860,170 @@ _assembly_adding_obs_covariance(cs_measures_set_t  *ms,
   return a;
 }
 
+/*----------------------------------------------------------------------------
+ * Solve (HB(H)t+R).x = b using a Jacobi preconditioned conjugate gradient
+ * on the localized (sparse) HB(H)t, with a diagonal R.
+ *
+ * parameters:
+ *   ms           <-- pointer to measures set
+ *   oi           <-- pointer to an optimal interpolation
+ *   ao_idx       <-- index of active observations
+ *   n_active_obs <-- number of active observations
+ *   mc_id        <-- measures component id
+ *   b            <-- right hand side
+ *   x            --> solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_solve_localized(cs_measures_set_t         *ms,
+                 const cs_at_opt_interp_t  *oi,
+                 const int                 *ao_idx,
+                 int                        n_active_obs,
+                 int                        mc_id,
+                 const cs_real_t            b[],
+                 cs_real_t                  x[])
+{
+  const cs_lnum_t n_obs = ms->nb_measures;
+  const int m_dim = ms->dim;
+  const cs_lnum_t n = n_active_obs;
+
+  const cs_lnum_t *b_proj_idx = oi->b_proj_idx;
+  const cs_lnum_t *b_proj_ids = oi->b_proj_ids;
+  const cs_real_t *b_proj = oi->b_proj;
+
+  /* build matrix restricted to active observations
+     (diagonal + extra-diagonal CSR) */
+
+  int *ao_map = NULL;
+  BFT_MALLOC(ao_map, n_obs, int);
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    ao_map[ii] = -1;
+  for (cs_lnum_t ii = 0; ii < n; ii++)
+    ao_map[ao_idx[ii]] = ii;
+
+  cs_lnum_t *a_idx = NULL;
+  cs_real_t *ad = NULL;
+  BFT_MALLOC(a_idx, n+1, cs_lnum_t);
+  BFT_MALLOC(ad, n, cs_real_t);
+
+  a_idx[0] = 0;
+
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    int obs_id = ao_idx[ii];
+    cs_lnum_t n_nbr = 0;
+    for (cs_lnum_t kk = b_proj_idx[obs_id]; kk < b_proj_idx[obs_id+1]; kk++) {
+      cs_lnum_t jj = b_proj_ids[kk];
+      if (jj != obs_id && ao_map[jj] > -1)
+        n_nbr++;
+    }
+    a_idx[ii+1] = n_nbr;
+  }
+
+  for (cs_lnum_t ii = 0; ii < n; ii++)
+    a_idx[ii+1] += a_idx[ii];
+
+  cs_lnum_t *a_ids = NULL;
+  cs_real_t *ax = NULL;
+  BFT_MALLOC(a_ids, a_idx[n], cs_lnum_t);
+  BFT_MALLOC(ax, a_idx[n], cs_real_t);
+
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    int obs_id = ao_idx[ii];
+    cs_lnum_t s_id = a_idx[ii];
+    ad[ii] = _obs_cov_diag(oi, m_dim, n_obs, obs_id, mc_id);
+    for (cs_lnum_t kk = b_proj_idx[obs_id]; kk < b_proj_idx[obs_id+1]; kk++) {
+      cs_lnum_t jj = b_proj_ids[kk];
+      if (jj == obs_id)
+        ad[ii] += b_proj[m_dim*kk + mc_id];
+      else if (ao_map[jj] > -1) {
+        a_ids[s_id] = ao_map[jj];
+        ax[s_id] = b_proj[m_dim*kk + mc_id];
+        s_id++;
+      }
+    }
+  }
+
+  BFT_FREE(ao_map);
+
+  /* Jacobi preconditioned conjugate gradient; dot products are computed
+     sequentially so that all ranks obtain identical results */
+
+  cs_real_t *_work = NULL;
+  BFT_MALLOC(_work, 3*n, cs_real_t);
+  cs_real_t *restrict r = _work;
+  cs_real_t *restrict p = _work + n;
+  cs_real_t *restrict q = _work + 2*n;
+
+  cs_real_t rz = 0., b_norm = 0.;
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    x[ii] = 0.;
+    r[ii] = b[ii];
+    p[ii] = r[ii] / ad[ii];
+    rz += r[ii]*p[ii];
+    b_norm += b[ii]*b[ii];
+  }
+  b_norm = sqrt(b_norm);
+
+  const cs_real_t epsilon = 1.e-12;
+  const int n_max_iter = 2*n + 10;
+
+  int n_iter = 0;
+  cs_real_t r_norm = b_norm;
+
+  while (r_norm > epsilon*b_norm && n_iter < n_max_iter) {
+
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      cs_real_t s = ad[ii]*p[ii];
+      for (cs_lnum_t kk = a_idx[ii]; kk < a_idx[ii+1]; kk++)
+        s += ax[kk]*p[a_ids[kk]];
+      q[ii] = s;
+    }
+
+    cs_real_t pq = 0.;
+    for (cs_lnum_t ii = 0; ii < n; ii++)
+      pq += p[ii]*q[ii];
+
+    cs_real_t alpha = rz / pq;
+
+    cs_real_t rz_new = 0.;
+    r_norm = 0.;
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      x[ii] += alpha*p[ii];
+      r[ii] -= alpha*q[ii];
+      rz_new += r[ii]*r[ii]/ad[ii];
+      r_norm += r[ii]*r[ii];
+    }
+    r_norm = sqrt(r_norm);
+
+    cs_real_t beta = rz_new / rz;
+    rz = rz_new;
+
+    for (cs_lnum_t ii = 0; ii < n; ii++)
+      p[ii] = r[ii]/ad[ii] + beta*p[ii];
+
+    n_iter++;
+  }
+
+#if _OI_DEBUG_
+  bft_printf("\n   * Localized solve: %d iterations, residual %.3e\n",
+             n_iter, r_norm);
+#endif
+
+  if (r_norm > epsilon*b_norm)
+    bft_printf(_("\n   * Optimal interpolation \"%s\": localized solve not\n"
+                 "     converged after %d iterations (residual %.3e).\n"),
+               oi->name, n_iter, r_norm);
+
+  BFT_FREE(_work);
+  BFT_FREE(a_ids);
+  BFT_FREE(ax);
+  BFT_FREE(ad);
+  BFT_FREE(a_idx);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -583,6 +1105,11 @@ cs_at_opt_interp_create(const char   *name)
 
   if (!reall) {
     oi->b_proj = NULL;
+    oi->b_proj_idx = NULL;
+    oi->b_proj_ids = NULL;
+    oi->n_comp_lu = 0;
+    oi->a_lu_size = NULL;
+    oi->a_lu = NULL;
     oi->relax = NULL;
     oi->times = NULL;
     oi->times_read = NULL;
@@ -597,6 +1124,13 @@ cs_at_opt_interp_create(const char   *name)
   }
   else {
     BFT_FREE(oi->b_proj);
+    BFT_FREE(oi->b_proj_idx);
+    BFT_FREE(oi->b_proj_ids);
+    for (int kk = 0; kk < oi->n_comp_lu; kk++)
+      BFT_FREE(oi->a_lu[kk]);
+    oi->n_comp_lu = 0;
+    BFT_FREE(oi->a_lu_size);
+    BFT_FREE(oi->a_lu);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->times);
     BFT_FREE(oi->times_read);
@@ -677,6 +1211,12 @@ cs_at_opt_interps_destroy(void)
   for (int i = 0; i < _n_opt_interps; i++) {
     cs_at_opt_interp_t  *oi = _opt_interps + i;
     BFT_FREE(oi->b_proj);
+    BFT_FREE(oi->b_proj_idx);
+    BFT_FREE(oi->b_proj_ids);
+    for (int kk = 0; kk < oi->n_comp_lu; kk++)
+      BFT_FREE(oi->a_lu[kk]);
+    BFT_FREE(oi->a_lu_size);
+    BFT_FREE(oi->a_lu);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->obs_cov);
     BFT_FREE(oi->times);
@@ -730,6 +1270,7 @@ cs_at_opt_interp_read_file(char const           filename[50],
   oi->nb_times = 0;
   oi->ir[0] = 100.;
   oi->ir[1] = 100.;
+  oi->cutoff = 0.;
   oi->n_log_data = 10;
   oi->interp_type = CS_AT_OPT_INTERP_P0;
   oi->steady = -1;
@@ -897,6 +1438,21 @@ cs_at_opt_interp_read_file(char const           filename[50],
       }
     }
 
+    /* Reading localization cutoff */
+    if (strncmp(line, "_cutoff_", 8) == 0) {
+      fscanf(fichier, "%lf", &(oi->cutoff));
+
+#if _OI_DEBUG_
+      bft_printf("   * Reading _cutoff_ : %.2f\n", oi->cutoff);
+#endif
+
+      if (oi->cutoff < 0.) {
+        bft_printf(" File %s. The localization cutoff (_cutoff_, relative to"
+                   " influence radii) must be positive - exit\n", filename);
+        cs_exit(EXIT_FAILURE);
+      }
+    }
+
     /* Reading relaxation time */
     if (strncmp(line, "_t_", 3) == 0) {
       cs_real_t *tau = NULL;
@@ -1322,6 +1878,17 @@ cs_at_opt_interp_map_values(cs_at_opt_interp_t *oi,
     for (int kk = 0; kk < ms->dim; kk++)
       oi->active_time[ms->dim*ii+kk] = oi->measures_idx[ms->dim*ii+kk];
 
+  /* Stored factorizations of HB(H)t+R (dense solve) */
+  for (int kk = 0; kk < oi->n_comp_lu; kk++)
+    BFT_FREE(oi->a_lu[kk]);
+  oi->n_comp_lu = ms->dim;
+  BFT_REALLOC(oi->a_lu_size, ms->dim, int);
+  BFT_REALLOC(oi->a_lu, ms->dim, cs_real_t *);
+  for (int kk = 0; kk < ms->dim; kk++) {
+    oi->a_lu_size[kk] = 0;
+    oi->a_lu[kk] = NULL;
+  }
+
   /* Initialising time weighting coefficients */
   if (oi->steady <= 0) {
     BFT_MALLOC(oi->time_weights, ms->dim*n_obs, cs_real_t);
@@ -1382,38 +1949,80 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
   cs_lnum_t *proj_idx = oi->model_to_obs_proj_idx;
 
   const int dim = ms->dim;
-  const int stride = dim + 3; /* dimension of field + dimension of space */
-
-  BFT_MALLOC(oi->b_proj, n_obs*n_obs*dim, cs_real_t);
-  cs_real_t *b_proj = oi->b_proj;
 
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
 
+  /* no localization: full matrix */
+
+  if (oi->cutoff <= 0.) {
+
+    BFT_MALLOC(oi->b_proj, n_obs*n_obs*dim, cs_real_t);
+    cs_real_t *b_proj = oi->b_proj;
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
+      for (cs_lnum_t jj = 0; jj < n_obs; jj++)
+        _hbht_coeffs(proj, proj_idx, dim, ii, jj, ir_xy2, ir_z2,
+                     b_proj + dim*(ii*n_obs + jj));
+    }
+
+    return;
+  }
+
+  /* localization: only pairs of observations closer than the cutoff
+     are kept, with coefficients tapered by the localization function */
+
+  const cs_real_t *coords = ms->coords;
+
+  _obs_grid_t g;
+  _obs_grid_build(n_obs, NULL, coords, oi->ir, oi->cutoff, &g);
+
+  BFT_MALLOC(oi->b_proj_idx, n_obs + 1, cs_lnum_t);
+  cs_lnum_t *b_proj_idx = oi->b_proj_idx;
+
+  b_proj_idx[0] = 0;
+
+# pragma omp parallel for if (n_obs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    b_proj_idx[ii+1] = _obs_grid_neighbors(&g, NULL, coords, coords + 3*ii,
+                                           ir_xy2, ir_z2, NULL);
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    b_proj_idx[ii+1] += b_proj_idx[ii];
+
+  BFT_MALLOC(oi->b_proj_ids, b_proj_idx[n_obs], cs_lnum_t);
+  BFT_MALLOC(oi->b_proj, b_proj_idx[n_obs]*dim, cs_real_t);
+  cs_lnum_t *b_proj_ids = oi->b_proj_ids;
+  cs_real_t *b_proj = oi->b_proj;
+
+# pragma omp parallel for
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
-      for (int pp = 0; pp < dim; pp++)
-        b_proj[dim*(ii*n_obs + jj) + pp] = 0;
+    const cs_real_t *x = coords + 3*ii;
 
-      for (cs_lnum_t kk = proj_idx[ii]; kk < proj_idx[ii+1]; kk++) {
-        cs_real_t x1 = (proj + kk*stride)[dim  ];
-        cs_real_t y1 = (proj + kk*stride)[dim+1];
-        cs_real_t z1 = (proj + kk*stride)[dim+2];
+    _obs_grid_neighbors(&g, NULL, coords, x, ir_xy2, ir_z2,
+                        b_proj_ids + b_proj_idx[ii]);
 
-        for (cs_lnum_t ll = proj_idx[jj]; ll < proj_idx[jj+1]; ll++) {
-          cs_real_t x2 = (proj + ll*stride)[dim  ];
-          cs_real_t y2 = (proj + ll*stride)[dim+1];
-          cs_real_t z2 = (proj + ll*stride)[dim+2];
+    for (cs_lnum_t kk = b_proj_idx[ii]; kk < b_proj_idx[ii+1]; kk++) {
+      cs_lnum_t jj = b_proj_ids[kk];
+      const cs_real_t *y = coords + 3*jj;
+      cs_real_t loc = _localization(x[0], x[1], x[2], y[0], y[1], y[2],
+                                    ir_xy2, ir_z2, oi->cutoff);
 
-          cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
+      _hbht_coeffs(proj, proj_idx, dim, ii, jj, ir_xy2, ir_z2,
+                   b_proj + dim*kk);
 
-          for (int pp = 0; pp < dim; pp++)
-            b_proj[dim*(ii*n_obs + jj) + pp] += (proj + kk*stride)[pp] * (proj + ll*stride)[pp]
-                                              * influ;
-        }
-      }
+      for (int pp = 0; pp < dim; pp++)
+        b_proj[dim*kk + pp] *= loc;
     }
   }
+
+  _obs_grid_free(&g);
+
+#if _OI_DEBUG_
+  bft_printf("   * Localized HBHT: %ld non-zero coefficients (%ld full)\n",
+             (long)b_proj_idx[n_obs], (long)n_obs*n_obs);
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1646,9 +2255,14 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   cs_real_t *inc = NULL;
   BFT_MALLOC(inc, a_l_size, cs_real_t);
 
+  /* observations located on other ranks contribute 0 */
+
+# pragma omp parallel for if (n_active_obs > CS_THR_MIN)
   for (int ii = 0; ii < n_active_obs; ii++) {
     int obs_id = ao_idx[ii]; /* retrieve obs id */
 
+    inc[ii] = 0.;
+
     int r_id0 = 0;
     if (cs_glob_rank_id > -1) r_id0 = ig->rank_connect[obs_id];
 
@@ -1665,13 +2279,7 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
 
   /* exchange innovation */
 
-  if (cs_glob_rank_id > -1) {
-    for (int ii = 0; ii < n_active_obs; ii++) {
-      int obs_id = ao_idx[ii];
-      int r_id0 = ig->rank_connect[obs_id];
-      cs_parall_bcast(r_id0, 1, CS_DOUBLE, &(inc[ii]));
-    }
-  }
+  cs_parall_sum(n_active_obs, CS_DOUBLE, inc);
 
 #if _OI_DEBUG_
   bft_printf("\n   * Observation increments\n    ");
@@ -1682,66 +2290,157 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   bft_printf("\n");
 #endif
 
-  cs_real_t *alu = NULL;
-  if (inverse) {
-    cs_real_t *a = _assembly_adding_obs_covariance(ms,
-                                                   oi,
-                                                   ao_idx,
-                                                   n_active_obs,
-                                                   mc_id);
-    BFT_MALLOC(alu, a_size, cs_real_t);
+  cs_real_t *vect = NULL;
+  BFT_MALLOC(vect, a_l_size, cs_real_t);
 
-    cs_math_fact_lu(1, a_l_size, a, alu);
-    BFT_FREE(a);
+  /* localized HB(H)t and diagonal R: sparse iterative solve */
+
+  if (oi->b_proj_idx != NULL && oi->obs_cov_is_diag) {
 
 #if _OI_DEBUG_
-    bft_printf("\n   * LU Matrix\n");
-    for (int ii = 0; ii < n_active_obs; ii++) {
-      bft_printf("    ");
-      for (int jj = 0; jj < n_active_obs; jj++) {
-        int id = ii*a_l_size + jj;
-        bft_printf("%.8f ", alu[id]);
-      }
-      bft_printf("\n");
-    }
+    bft_printf("\n   * Computing (HBHT + R)^-1*I (localized)\n");
 #endif
+
+    _solve_localized(ms, oi, ao_idx, n_active_obs, mc_id, inc, vect);
+
   }
 
+  /* otherwise, dense LU factorization, kept while
+     active observations and time weights do not change */
+
+  else {
+
+    if (   inverse
+        || oi->a_lu[mc_id] == NULL
+        || oi->a_lu_size[mc_id] != a_l_size) {
+      cs_real_t *a = _assembly_adding_obs_covariance(ms,
+                                                     oi,
+                                                     ao_idx,
+                                                     n_active_obs,
+                                                     mc_id);
+      BFT_REALLOC(oi->a_lu[mc_id], a_size, cs_real_t);
+      oi->a_lu_size[mc_id] = a_l_size;
+
+      cs_math_fact_lu(1, a_l_size, a, oi->a_lu[mc_id]);
+      BFT_FREE(a);
+
 #if _OI_DEBUG_
-  bft_printf("\n   * Computing (HBHT + R)^-1*I\n");
+      cs_real_t *alu = oi->a_lu[mc_id];
+      bft_printf("\n   * LU Matrix\n");
+      for (int ii = 0; ii < n_active_obs; ii++) {
+        bft_printf("    ");
+        for (int jj = 0; jj < n_active_obs; jj++) {
+          int id = ii*a_l_size + jj;
+          bft_printf("%.8f ", alu[id]);
+        }
+        bft_printf("\n");
+      }
 #endif
+    }
 
-  cs_real_t *vect = NULL;
-  BFT_MALLOC(vect, a_l_size, cs_real_t);
+#if _OI_DEBUG_
+    bft_printf("\n   * Computing (HBHT + R)^-1*I\n");
+#endif
 
-  /* Forward and backward */
+    /* Forward and backward */
 
-  cs_math_fw_and_bw_lu(alu, a_l_size, vect, inc);
+    cs_math_fw_and_bw_lu(oi->a_lu[mc_id], a_l_size, vect, inc);
+
+  }
 
-  BFT_FREE(alu);
   BFT_FREE(inc);
 
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
 
-  for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
-    f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
-      f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
-
-    for (int ll = 0; ll < n_active_obs; ll++) {
-      for (int mm = proj_idx[ao_idx[ll]];
-           mm < proj_idx[ao_idx[ll]+1];
-           mm++) {
-        cs_real_t x = (proj + mm*stride)[m_dim  ];
-        cs_real_t y = (proj + mm*stride)[m_dim+1];
-        cs_real_t z = (proj + mm*stride)[m_dim+2];
-        f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] +=  (proj + mm*stride)[mc_id] * vect[ll]
-                                                   * _b_matrix(cell_cen[ii][0],
-                                                               cell_cen[ii][1],
-                                                               cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const int c_id = ms->comp_ids[mc_id];
+
+  /* analysis without localization: all active observations contribute */
+
+  if (oi->cutoff <= 0.) {
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      cs_real_t val = f->val_pre[ii*f_dim+c_id];
+
+      for (int ll = 0; ll < n_active_obs; ll++) {
+        for (int mm = proj_idx[ao_idx[ll]];
+             mm < proj_idx[ao_idx[ll]+1];
+             mm++) {
+          cs_real_t x = (proj + mm*stride)[m_dim  ];
+          cs_real_t y = (proj + mm*stride)[m_dim+1];
+          cs_real_t z = (proj + mm*stride)[m_dim+2];
+          val +=  (proj + mm*stride)[mc_id] * vect[ll]
+                * _b_matrix(cell_cen[ii][0], cell_cen[ii][1], cell_cen[ii][2],
+                            x, y, z, ir_xy2, ir_z2);
+        }
       }
+
+      f_oia->val[ii*f_dim+c_id] = val;
     }
+
+  }
+
+  /* localized analysis: only active observations closer than
+     the cutoff contribute */
+
+  else {
+
+    _obs_grid_t g;
+    _obs_grid_build(n_active_obs, ao_idx, ms->coords, oi->ir, oi->cutoff,
+                    &g);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      cs_real_t val = f->val_pre[ii*f_dim+c_id];
+
+      cs_lnum_t b_s[3], b_e[3];
+      if (_obs_grid_range(&g, cell_cen[ii], b_s, b_e)) {
+
+        for (cs_lnum_t bi = b_s[0]; bi < b_e[0]; bi++) {
+          for (cs_lnum_t bj = b_s[1]; bj < b_e[1]; bj++) {
+            for (cs_lnum_t bk = b_s[2]; bk < b_e[2]; bk++) {
+              cs_lnum_t b_id = (bi*g.n_b[1] + bj)*g.n_b[2] + bk;
+
+              for (cs_lnum_t kk = g.idx[b_id]; kk < g.idx[b_id+1]; kk++) {
+                int ll = g.ids[kk];
+                const cs_real_t *xo = ms->coords + 3*ao_idx[ll];
+                cs_real_t loc = _localization(cell_cen[ii][0],
+                                              cell_cen[ii][1],
+                                              cell_cen[ii][2],
+                                              xo[0], xo[1], xo[2],
+                                              ir_xy2, ir_z2, oi->cutoff);
+                if (loc <= 0.)
+                  continue;
+
+                cs_real_t l_val = 0.;
+                for (int mm = proj_idx[ao_idx[ll]];
+                     mm < proj_idx[ao_idx[ll]+1];
+                     mm++) {
+                  cs_real_t x = (proj + mm*stride)[m_dim  ];
+                  cs_real_t y = (proj + mm*stride)[m_dim+1];
+                  cs_real_t z = (proj + mm*stride)[m_dim+2];
+                  l_val +=  (proj + mm*stride)[mc_id]
+                          * _b_matrix(cell_cen[ii][0],
+                                      cell_cen[ii][1],
+                                      cell_cen[ii][2],
+                                      x, y, z, ir_xy2, ir_z2);
+                }
+                val += loc * vect[ll] * l_val;
+              }
+
+            }
+          }
+        }
+
+      }
+
+      f_oia->val[ii*f_dim+c_id] = val;
+    }
+
+    _obs_grid_free(&g);
+
   }
 
   BFT_FREE(vect);
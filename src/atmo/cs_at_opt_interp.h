@@ -71,7 +71,18 @@ typedef struct _cs_at_opt_interp_t {
   cs_lnum_t               *model_to_obs_proj_idx;
   cs_lnum_t               *model_to_obs_proj_c_ids;
   cs_real_t               *b_proj;
+  cs_lnum_t               *b_proj_idx;          /* Localized HB(H)t index
+                                                   (NULL if dense) */
+  cs_lnum_t               *b_proj_ids;          /* Localized HB(H)t
+                                                   observation ids */
   cs_real_t                ir[2];
+  cs_real_t                cutoff;              /* Localization cutoff,
+                                                   relative to influence
+                                                   radii (0: none) */
+  int                      n_comp_lu;
+  int                     *a_lu_size;
+  cs_real_t              **a_lu;                /* LU factors of HB(H)t+R
+                                                   by component */
   cs_real_t               *relax;
   int                      nb_times;
   int                     *measures_idx;
@@ -120,6 +120,12 @@ azi = dabs(dacos(dlmuzero)*180.d0/pi)
 ! Note: Photolysis should be cut in SPACK and not here even if the azimuthal angle is > 90
 
 ! Loop on cells
+! Kinetic rates are computed independently for each cell
+! (user-defined schemes are not assumed to be thread-safe)
+
+!$omp parallel do if(ichemistry.ne.4 .and. ncel > thr_n_min)               &
+!$omp private(iel, ii, zent, temp, dens, press, hspec, rk)                &
+!$omp firstprivate(azi)
 do iel = 1, ncel
   zent = xyzcen(3,iel) ! Z coordinate of the cell
 
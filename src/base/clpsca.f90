@@ -155,6 +155,9 @@ if (iiscav.ne.0.and. iclvfl(iscal).eq.1) then
 
 endif
 
+! Values may have been clipped
+call field_increment_version(iflid)
+
 call log_iteration_clipping_field(iflid, iclmin(1), iclmax(1), vmin, vmax, iclmin(1), iclmax(1))
 
 !--------
@@ -30,6 +30,8 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <string.h>
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -55,6 +57,7 @@
 #include "cs_field_operator.h"
 #include "cs_gui_mobile_mesh.h"
 #include "cs_interface.h"
+#include "cs_les_filter.h"
 #include "cs_log.h"
 #include "cs_physical_constants.h"
 #include "cs_math.h"
@@ -130,6 +133,12 @@ typedef struct {
 static cs_real_3_t  *_vtx_coord0 = NULL;
 static cs_ale_cdo_bc_t  *_cdo_bc = NULL;
 
+/* Vertex coordinates used for the last mesh quantities update */
+
+static cs_lnum_t     _n_vtx_q = 0;
+static cs_real_3_t  *_vtx_coord_q = NULL;
+static int           _n_q_computations = -1;
+
 static bool cs_ale_active = false;
 
 /*----------------------------------------------------------------------------
@@ -1137,8 +1146,50 @@ cs_ale_update_mesh_quantities(cs_real_t  *min_vol,
   cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
 
   cs_gradient_free_quantities();
+  cs_field_gradient_cache_clear();
   cs_cell_to_vertex_free();
-  cs_mesh_quantities_compute(m, mq);
+  cs_les_filter_free();
+
+  /* Only update quantities impacted by moved vertices if the previous
+     computation was based on the saved coordinates */
+
+  const cs_lnum_t n_vertices = m->n_vertices;
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)(m->vtx_coord);
+
+  if (   _vtx_coord_q != NULL
+      && _n_vtx_q == n_vertices
+      && _n_q_computations == cs_mesh_quantities_compute_count()) {
+
+    char *vtx_flag;
+    BFT_MALLOC(vtx_flag, n_vertices, char);
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      if (memcmp(vtx_coord[i], _vtx_coord_q[i], sizeof(cs_real_3_t)) != 0) {
+        vtx_flag[i] = 1;
+        for (cs_lnum_t j = 0; j < 3; j++)
+          _vtx_coord_q[i][j] = vtx_coord[i][j];
+      }
+      else
+        vtx_flag[i] = 0;
+    }
+
+    cs_mesh_quantities_update_moved(m, mq, vtx_flag);
+
+    BFT_FREE(vtx_flag);
+
+  }
+  else {
+
+    cs_mesh_quantities_compute(m, mq);
+
+    BFT_REALLOC(_vtx_coord_q, n_vertices, cs_real_3_t);
+    _n_vtx_q = n_vertices;
+    memcpy(_vtx_coord_q, vtx_coord, n_vertices*sizeof(cs_real_3_t));
+
+  }
+
+  _n_q_computations = cs_mesh_quantities_compute_count();
+
   cs_mesh_bad_cells_detect(m, mq);
 
   *min_vol = mq->min_vol;
@@ -1746,6 +1797,8 @@ void
 cs_ale_destroy_all(void)
 {
   BFT_FREE(_vtx_coord0);
+  BFT_FREE(_vtx_coord_q);
+  _n_vtx_q = 0;
 
   if (_cdo_bc != NULL) {
     BFT_FREE(_cdo_bc->vtx_values);
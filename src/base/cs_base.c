@@ -206,6 +206,12 @@ static cs_base_atexit_t  * _cs_base_atexit = NULL;
 static int        _n_step_comms = 0;
 static int       *_step_ranks = NULL;
 static MPI_Comm  *_step_comm = NULL;
+
+/* Ranks reserved for dedicated I/O servers */
+
+static int        _n_io_server_ranks = 0;
+static bool       _is_io_server = false;
+static MPI_Comm   _io_parent_comm = MPI_COMM_NULL;
 #endif
 
 /*============================================================================
@@ -852,6 +858,10 @@ _cs_base_mpi_fin(void)
   if (   cs_glob_mpi_comm != MPI_COMM_NULL
       && cs_glob_mpi_comm != MPI_COMM_WORLD)
     MPI_Comm_free(&cs_glob_mpi_comm);
+
+  if (   _io_parent_comm != MPI_COMM_NULL
+      && _io_parent_comm != MPI_COMM_WORLD)
+    MPI_Comm_free(&_io_parent_comm);
 }
 
 
@@ -1021,6 +1031,26 @@ _cs_base_mpi_setup(const char *app_name)
   else
     cs_glob_mpi_comm = MPI_COMM_WORLD;
 
+  /* Reserve the last ranks of this application for dedicated I/O servers
+     if requested; the remaining (compute) ranks keep the same rank ids
+     in the parent and compute communicators. */
+
+  if (_n_io_server_ranks > 0) {
+
+    MPI_Comm_size(cs_glob_mpi_comm, &nbr);
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+    if (_n_io_server_ranks < nbr) {
+      _io_parent_comm = cs_glob_mpi_comm;
+      _is_io_server = (rank >= nbr - _n_io_server_ranks) ? true : false;
+      MPI_Comm_split(_io_parent_comm, (_is_io_server) ? 1 : 0, rank,
+                     &cs_glob_mpi_comm);
+    }
+    else
+      _n_io_server_ranks = 0;
+
+  }
+
   MPI_Comm_size(cs_glob_mpi_comm, &nbr);
   MPI_Comm_rank(cs_glob_mpi_comm, &rank);
 
@@ -1305,6 +1335,15 @@ cs_base_mpi_init(int    *argc,
     if (strcmp(s, "--mpi") == 0)
       use_mpi = true;
 
+    /* Ranks reserved for I/O servers */
+
+    else if (strcmp(s, "--io-servers") == 0) {
+      if (arg_id + 1 < *argc) {
+        int n = atoi((*argv)[arg_id + 1]);
+        _n_io_server_ranks = (n > 0) ? n : 0;
+      }
+    }
+
   } /* End of loop on command line arguments */
 
   if (use_mpi == true) {
@@ -1410,6 +1449,36 @@ cs_base_get_rank_step_comm(int  rank_step)
   return _step_comm[comm_id];
 }
 
+/*----------------------------------------------------------------------------
+ * Query ranks reserved for dedicated I/O servers.
+ *
+ * If I/O server ranks are defined (using the --io-servers command-line
+ * option), the last ranks of the application are separated from the
+ * compute ranks, so cs_glob_mpi_comm only contains compute ranks on
+ * compute ranks, and only I/O server ranks on server ranks.
+ *
+ * parameters:
+ *   parent_comm  --> communicator including both compute and I/O server
+ *                    ranks, or MPI_COMM_NULL (or NULL if unused)
+ *   n_io_servers --> number of ranks reserved for I/O servers
+ *                    (or NULL if unused)
+ *
+ * returns:
+ *   true if the current rank is an I/O server rank, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_base_get_io_server_info(MPI_Comm  *parent_comm,
+                           int       *n_io_servers)
+{
+  if (parent_comm != NULL)
+    *parent_comm = _io_parent_comm;
+  if (n_io_servers != NULL)
+    *n_io_servers = _n_io_server_ranks;
+
+  return _is_io_server;
+}
+
 #endif /* HAVE_MPI */
 
 /*----------------------------------------------------------------------------
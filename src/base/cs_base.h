@@ -167,6 +167,29 @@ cs_base_mpi_init(int    *argc,
 MPI_Comm
 cs_base_get_rank_step_comm(int  rank_step);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query ranks reserved for dedicated I/O servers.
+ *
+ * If I/O server ranks are defined (using the --io-servers command-line
+ * option), the last ranks of the application are separated from the
+ * compute ranks, so cs_glob_mpi_comm only contains compute ranks on
+ * compute ranks, and only I/O server ranks on server ranks.
+ *
+ * \param[out]  parent_comm   communicator including both compute and
+ *                            I/O server ranks, or MPI_COMM_NULL
+ *                            (or NULL if unused)
+ * \param[out]  n_io_servers  number of ranks reserved for I/O servers
+ *                            (or NULL if unused)
+ *
+ * \return  true if the current rank is an I/O server rank, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_base_get_io_server_info(MPI_Comm  *parent_comm,
+                           int       *n_io_servers);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -0,0 +1,832 @@
+/*============================================================================
+ * Lossless and error-bounded compression of numerical arrays.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_compress.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional Doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_compress.c
+        Lossless and error-bounded compression of numerical arrays.
+
+  Each compressed stream starts with a 4-byte header (codec id, flags,
+  value size, and a reserved byte), followed by the codec's payload:
+
+  - stored values (when compression does not reduce size);
+  - byte shuffle + LZ: the k-th bytes of all values are grouped together,
+    so that slowly-varying high order bytes form long runs, then
+    compressed using a simple LZ77 variant with a 64 KiB window;
+  - quantization: floating-point values are rounded to the nearest multiple
+    of a power of 2 step, and differences between successive quantized
+    values are zigzag-encoded before byte shuffle + LZ compression.
+
+  The codec is self-contained so that it may be used for any output
+  without depending on external libraries.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/* Codec ids */
+
+#define _CODEC_STORED       0
+#define _CODEC_SHUFFLE_LZ   1
+#define _CODEC_QUANTIZE_LZ  2
+
+/* Stream header size, and flags */
+
+#define _HEADER_SIZE        4
+#define _FLAG_BIG_ENDIAN    1
+
+/* LZ parameters */
+
+#define _LZ_HASH_LOG       14
+#define _LZ_MIN_MATCH       4
+#define _LZ_MAX_OFFSET  65535
+
+/* Quantized values must fit exactly in a double mantissa */
+
+#define _Q_MAX  4503599627370496.0 /* 2^52 */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return true if the current platform is big-endian.
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_big_endian(void)
+{
+  const uint16_t one = 1;
+  return (*((const unsigned char *)&one) == 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Swap byte order of values in place.
+ *
+ * parameters:
+ *   buf  <-> values
+ *   size <-- size of each value
+ *   n    <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_swap_endian(unsigned char  *buf,
+             size_t          size,
+             size_t          n)
+{
+  for (size_t i = 0; i < n; i++) {
+    unsigned char *p = buf + i*size;
+    for (size_t j = 0; j < size/2; j++) {
+      unsigned char t = p[j];
+      p[j] = p[size - 1 - j];
+      p[size - 1 - j] = t;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Group the k-th byte of all values together.
+ *
+ * parameters:
+ *   size <-- size of each value
+ *   n    <-- number of values
+ *   src  <-- values
+ *   dest --> shuffled bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_shuffle(size_t                size,
+         size_t                n,
+         const unsigned char  *src,
+         unsigned char        *dest)
+{
+  for (size_t k = 0; k < size; k++) {
+    unsigned char *d = dest + k*n;
+    for (size_t i = 0; i < n; i++)
+      d[i] = src[i*size + k];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Reverse of _shuffle.
+ *
+ * parameters:
+ *   size <-- size of each value
+ *   n    <-- number of values
+ *   src  <-- shuffled bytes
+ *   dest --> values
+ *----------------------------------------------------------------------------*/
+
+static void
+_unshuffle(size_t                size,
+           size_t                n,
+           const unsigned char  *src,
+           unsigned char        *dest)
+{
+  for (size_t k = 0; k < size; k++) {
+    const unsigned char *s = src + k*n;
+    for (size_t i = 0; i < n; i++)
+      dest[i*size + k] = s[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read 4 bytes as an unsigned integer (byte order irrelevant here).
+ *----------------------------------------------------------------------------*/
+
+static inline uint32_t
+_read32(const unsigned char  *p)
+{
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Write an LZ length extension (sequence of 255 bytes and remainder).
+ *
+ * returns:
+ *   updated output position, or 0 in case of overflow
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_lz_write_length(size_t          l,
+                 unsigned char  *dest,
+                 size_t          op,
+                 size_t          dest_max)
+{
+  while (l >= 255) {
+    if (op >= dest_max)
+      return 0;
+    dest[op++] = 255;
+    l -= 255;
+  }
+  if (op >= dest_max)
+    return 0;
+  dest[op++] = l;
+
+  return op;
+}
+
+/*----------------------------------------------------------------------------
+ * Write an LZ sequence (literals, then optional match).
+ *
+ * parameters:
+ *   lit      <-- pointer to literals
+ *   n_lit    <-- number of literals
+ *   offset   <-- match offset (0 for last sequence)
+ *   m_len    <-- match length (ignored for last sequence)
+ *   dest     <-> output buffer
+ *   op       <-- current output position
+ *   dest_max <-- output buffer size
+ *
+ * returns:
+ *   updated output position, or 0 in case of overflow
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_lz_write_sequence(const unsigned char  *lit,
+                   size_t                n_lit,
+                   size_t                offset,
+                   size_t                m_len,
+                   unsigned char        *dest,
+                   size_t                op,
+                   size_t                dest_max)
+{
+  size_t m_code = (offset > 0) ? m_len - _LZ_MIN_MATCH : 0;
+  size_t t_pos = op;
+
+  if (op >= dest_max)
+    return 0;
+
+  dest[t_pos] = (  ((n_lit < 15) ? n_lit : 15) << 4)
+                 | ((m_code < 15) ? m_code : 15);
+  op++;
+
+  if (n_lit >= 15) {
+    op = _lz_write_length(n_lit - 15, dest, op, dest_max);
+    if (op == 0)
+      return 0;
+  }
+
+  if (op + n_lit > dest_max)
+    return 0;
+  memcpy(dest + op, lit, n_lit);
+  op += n_lit;
+
+  if (offset > 0) {
+    if (op + 2 > dest_max)
+      return 0;
+    dest[op++] = offset & 0xff;
+    dest[op++] = (offset >> 8) & 0xff;
+    if (m_code >= 15) {
+      op = _lz_write_length(m_code - 15, dest, op, dest_max);
+      if (op == 0)
+        return 0;
+    }
+  }
+
+  return op;
+}
+
+/*----------------------------------------------------------------------------
+ * LZ compression of a byte array.
+ *
+ * parameters:
+ *   src      <-- bytes to compress
+ *   n        <-- number of bytes
+ *   dest     --> compressed bytes
+ *   dest_max <-- maximum size of compressed output
+ *
+ * returns:
+ *   compressed size, or 0 if it would exceed dest_max
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_lz_encode(const unsigned char  *src,
+           size_t                n,
+           unsigned char        *dest,
+           size_t                dest_max)
+{
+  const size_t hash_size = 1 << _LZ_HASH_LOG;
+  const size_t match_limit = (n > _LZ_MIN_MATCH) ? n - _LZ_MIN_MATCH : 0;
+
+  size_t ip = 0, anchor = 0, op = 0;
+  bool overflow = false;
+
+  /* Positions + 1 of last occurence of hashed sequences (0 if none) */
+
+  size_t *ht;
+  BFT_MALLOC(ht, hash_size, size_t);
+  memset(ht, 0, hash_size*sizeof(size_t));
+
+  while (ip < match_limit) {
+
+    uint32_t seq = _read32(src + ip);
+    size_t h = (seq * 2654435761U) >> (32 - _LZ_HASH_LOG);
+    size_t ref = ht[h];
+    ht[h] = ip + 1;
+
+    if (   ref > 0 && ip - (ref - 1) <= _LZ_MAX_OFFSET
+        && _read32(src + ref - 1) == seq) {
+
+      ref -= 1;
+
+      size_t m_len = _LZ_MIN_MATCH;
+      while (ip + m_len < n && src[ref + m_len] == src[ip + m_len])
+        m_len++;
+
+      op = _lz_write_sequence(src + anchor, ip - anchor,
+                              ip - ref, m_len,
+                              dest, op, dest_max);
+      if (op == 0) {
+        overflow = true;
+        break;
+      }
+
+      ip += m_len;
+      anchor = ip;
+
+    }
+    else
+      ip++;
+
+  }
+
+  /* Last literals */
+
+  if (!overflow)
+    op = _lz_write_sequence(src + anchor, n - anchor, 0, 0,
+                            dest, op, dest_max);
+
+  BFT_FREE(ht);
+
+  return op;
+}
+
+/*----------------------------------------------------------------------------
+ * Read an LZ length extension.
+ *
+ * returns:
+ *   0 on success, 1 in case of truncated input
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_lz_read_length(const unsigned char  *src,
+                size_t                src_size,
+                size_t               *ip,
+                size_t               *l)
+{
+  unsigned char b;
+  do {
+    if (*ip >= src_size)
+      return 1;
+    b = src[(*ip)++];
+    *l += b;
+  } while (b == 255);
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * LZ decompression of a byte array.
+ *
+ * parameters:
+ *   src       <-- compressed bytes
+ *   src_size  <-- number of compressed bytes
+ *   dest      --> decompressed bytes
+ *   dest_size <-- expected number of decompressed bytes
+ *
+ * returns:
+ *   0 on success, 1 in case of corrupted input
+ *----------------------------------------------------------------------------*/
+
+static int
+_lz_decode(const unsigned char  *src,
+           size_t                src_size,
+           unsigned char        *dest,
+           size_t                dest_size)
+{
+  size_t ip = 0, op = 0;
+
+  while (ip < src_size) {
+
+    unsigned char token = src[ip++];
+
+    size_t n_lit = token >> 4;
+    if (n_lit == 15 && _lz_read_length(src, src_size, &ip, &n_lit))
+      return 1;
+
+    if (ip + n_lit > src_size || op + n_lit > dest_size)
+      return 1;
+    memcpy(dest + op, src + ip, n_lit);
+    ip += n_lit;
+    op += n_lit;
+
+    if (ip == src_size)
+      break;
+
+    if (ip + 2 > src_size)
+      return 1;
+    size_t offset = src[ip] | ((size_t)(src[ip+1]) << 8);
+    ip += 2;
+
+    size_t m_len = token & 15;
+    if (m_len == 15 && _lz_read_length(src, src_size, &ip, &m_len))
+      return 1;
+    m_len += _LZ_MIN_MATCH;
+
+    if (offset == 0 || offset > op || op + m_len > dest_size)
+      return 1;
+
+    /* Byte by byte copy, as source and destination may overlap */
+    const unsigned char *ref = dest + op - offset;
+    for (size_t i = 0; i < m_len; i++)
+      dest[op + i] = ref[i];
+    op += m_len;
+
+  }
+
+  return (op == dest_size) ? 0 : 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute quantization step for a given error bound.
+ *
+ * The step is the largest power of 2 not larger than twice the error bound,
+ * so that reconstructed values are exact multiples of the step.
+ *
+ * returns:
+ *   quantization step, or 0 if the error bound is not usable
+ *----------------------------------------------------------------------------*/
+
+static double
+_quantization_step(double  error_bound)
+{
+  if (!(error_bound > 0) || !isfinite(error_bound))
+    return 0.;
+
+  int e;
+  frexp(2.*error_bound, &e);
+
+  return ldexp(1., e - 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Quantize and delta-encode floating-point values.
+ *
+ * parameters:
+ *   step        <-- quantization step
+ *   error_bound <-- absolute error bound
+ *   datatype    <-- CS_FLOAT or CS_DOUBLE
+ *   n           <-- number of values
+ *   src         <-- values
+ *   q           --> zigzag-encoded differences of quantized values
+ *
+ * returns:
+ *   true if all values could be quantized, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_quantize_delta(double          step,
+                double          error_bound,
+                cs_datatype_t   datatype,
+                size_t          n,
+                const void     *src,
+                uint64_t        q[])
+{
+  int64_t q_prev = 0;
+
+  for (size_t i = 0; i < n; i++) {
+
+    double v = (datatype == CS_FLOAT) ?
+      ((const float *)src)[i] : ((const double *)src)[i];
+
+    if (!isfinite(v))
+      return false;
+
+    double r = nearbyint(v / step);
+    if (fabs(r) > _Q_MAX)
+      return false;
+
+    if (datatype == CS_FLOAT) {
+      float vq = r*step;
+      if (fabs((double)vq - v) > error_bound)
+        return false;
+    }
+
+    int64_t qi = r;
+    int64_t d = qi - q_prev;
+    q_prev = qi;
+
+    q[i] = ((uint64_t)d << 1) ^ (uint64_t)(d >> 63);
+
+  }
+
+  return true;
+}
+
+/*! (end of DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum size of a compressed stream for a given array.
+ *
+ * \param[in]  datatype  datatype of array values
+ * \param[in]  n_vals    number of array values
+ *
+ * \return  maximum size of compressed stream, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_compress_bound(cs_datatype_t  datatype,
+                  size_t         n_vals)
+{
+  return _HEADER_SIZE + n_vals*cs_datatype_size[datatype];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compress an array of values.
+ *
+ * The stream is self-describing, and if compression does not reduce
+ * the data size, values are simply stored.
+ *
+ * With \ref CS_COMPRESS_QUANTIZE, floating-point values are rounded to
+ * a multiple of a power of 2 so that the absolute difference between
+ * original and decompressed values is at most error_bound. If some values
+ * can not be quantized (i.e. are not finite or too large relative to the
+ * error bound), lossless compression is used instead.
+ *
+ * \param[in]   type         compression type
+ * \param[in]   error_bound  absolute error bound for quantization
+ * \param[in]   datatype     datatype of array values
+ * \param[in]   n_vals       number of values
+ * \param[in]   src          values to compress
+ * \param[out]  dest         compressed stream (size: see
+ *                           \ref cs_compress_bound)
+ *
+ * \return  size of compressed stream, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_compress_encode(cs_compress_type_t   type,
+                   double               error_bound,
+                   cs_datatype_t        datatype,
+                   size_t               n_vals,
+                   const void          *src,
+                   unsigned char        dest[])
+{
+  const size_t size = cs_datatype_size[datatype];
+  const size_t raw_size = n_vals*size;
+  const size_t dest_max = raw_size;
+
+  size_t c_size = 0;
+  unsigned char *payload = dest + _HEADER_SIZE;
+
+  dest[0] = _CODEC_STORED;
+  dest[1] = (_is_big_endian()) ? _FLAG_BIG_ENDIAN : 0;
+  dest[2] = size;
+  dest[3] = 0;
+
+  /* Quantization */
+
+  if (   type == CS_COMPRESS_QUANTIZE && n_vals > 0
+      && (datatype == CS_FLOAT || datatype == CS_DOUBLE)
+      && dest_max > sizeof(double)) {
+
+    double step = _quantization_step(error_bound);
+
+    if (step > 0) {
+
+      uint64_t *q;
+      unsigned char *s;
+      BFT_MALLOC(q, n_vals, uint64_t);
+      BFT_MALLOC(s, n_vals*sizeof(uint64_t), unsigned char);
+
+      if (_quantize_delta(step, error_bound, datatype, n_vals, src, q)) {
+        _shuffle(sizeof(uint64_t), n_vals, (const unsigned char *)q, s);
+        memcpy(payload, &step, sizeof(double));
+        c_size = _lz_encode(s,
+                            n_vals*sizeof(uint64_t),
+                            payload + sizeof(double),
+                            dest_max - sizeof(double));
+        if (c_size > 0) {
+          c_size += sizeof(double);
+          dest[0] = _CODEC_QUANTIZE_LZ;
+        }
+      }
+
+      BFT_FREE(s);
+      BFT_FREE(q);
+
+    }
+
+  }
+
+  /* Lossless compression */
+
+  if (   c_size == 0 && type != CS_COMPRESS_NONE
+      && datatype != CS_CHAR && raw_size > 0) {
+
+    unsigned char *s;
+    BFT_MALLOC(s, raw_size, unsigned char);
+
+    _shuffle(size, n_vals, src, s);
+    c_size = _lz_encode(s, raw_size, payload, dest_max);
+    if (c_size > 0)
+      dest[0] = _CODEC_SHUFFLE_LZ;
+
+    BFT_FREE(s);
+
+  }
+
+  /* Stored values */
+
+  if (c_size == 0) {
+    memcpy(payload, src, raw_size);
+    c_size = raw_size;
+  }
+
+  return _HEADER_SIZE + c_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decompress an array of values.
+ *
+ * Streams written on a platform with a different endianness are
+ * handled transparently.
+ *
+ * \param[in]   datatype  datatype of array values
+ * \param[in]   n_vals    number of values
+ * \param[in]   src_size  size of compressed stream, in bytes
+ * \param[in]   src       compressed stream
+ * \param[out]  dest      decompressed values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_compress_decode(cs_datatype_t         datatype,
+                   size_t                n_vals,
+                   size_t                src_size,
+                   const unsigned char   src[],
+                   void                 *dest)
+{
+  const size_t size = cs_datatype_size[datatype];
+  const size_t raw_size = n_vals*size;
+
+  if (src_size < _HEADER_SIZE || src[2] != size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Compressed data header is inconsistent with\n"
+                "expected values of size %d."), (int)size);
+
+  const unsigned char *payload = src + _HEADER_SIZE;
+  const size_t p_size = src_size - _HEADER_SIZE;
+
+  const bool swap = (   ((src[1] & _FLAG_BIG_ENDIAN) != 0)
+                     != _is_big_endian());
+
+  int retval = 0;
+
+  switch(src[0]) {
+
+  case _CODEC_STORED:
+    if (p_size != raw_size)
+      retval = 1;
+    else {
+      memcpy(dest, payload, raw_size);
+      if (swap && size > 1)
+        _swap_endian(dest, size, n_vals);
+    }
+    break;
+
+  case _CODEC_SHUFFLE_LZ:
+    {
+      unsigned char *s;
+      BFT_MALLOC(s, raw_size, unsigned char);
+      retval = _lz_decode(payload, p_size, s, raw_size);
+      if (retval == 0) {
+        _unshuffle(size, n_vals, s, dest);
+        if (swap && size > 1)
+          _swap_endian(dest, size, n_vals);
+      }
+      BFT_FREE(s);
+    }
+    break;
+
+  case _CODEC_QUANTIZE_LZ:
+    {
+      double step;
+      uint64_t *q;
+      unsigned char *s;
+
+      if (   (datatype != CS_FLOAT && datatype != CS_DOUBLE)
+          || p_size < sizeof(double)) {
+        retval = 1;
+        break;
+      }
+
+      memcpy(&step, payload, sizeof(double));
+      if (swap)
+        _swap_endian((unsigned char *)&step, sizeof(double), 1);
+
+      BFT_MALLOC(q, n_vals, uint64_t);
+      BFT_MALLOC(s, n_vals*sizeof(uint64_t), unsigned char);
+
+      retval = _lz_decode(payload + sizeof(double),
+                          p_size - sizeof(double),
+                          s,
+                          n_vals*sizeof(uint64_t));
+
+      if (retval == 0) {
+        _unshuffle(sizeof(uint64_t), n_vals, s, (unsigned char *)q);
+        if (swap)
+          _swap_endian((unsigned char *)q, sizeof(uint64_t), n_vals);
+
+        int64_t qi = 0;
+        for (size_t i = 0; i < n_vals; i++) {
+          int64_t d = (int64_t)(q[i] >> 1) ^ -(int64_t)(q[i] & 1);
+          qi += d;
+          if (datatype == CS_FLOAT)
+            ((float *)dest)[i] = qi*step;
+          else
+            ((double *)dest)[i] = qi*step;
+        }
+      }
+
+      BFT_FREE(s);
+      BFT_FREE(q);
+    }
+    break;
+
+  default:
+    retval = 1;
+  }
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error decompressing data (codec %d, %llu bytes):\n"
+                "the compressed stream is corrupted."),
+              (int)src[0], (unsigned long long)src_size);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply error-bounded quantization to floating-point values in place.
+ *
+ * This is intended for formats which store raw values: quantized values
+ * have many trailing zero bits, so that the resulting files compress
+ * much better with general purpose tools.
+ *
+ * Values which can not be quantized within the error bound are unchanged.
+ *
+ * \param[in]       error_bound  absolute error bound
+ * \param[in]       datatype     datatype of values (CS_FLOAT or CS_DOUBLE)
+ * \param[in]       n_vals       number of values
+ * \param[in, out]  vals         values to quantize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_compress_quantize(double          error_bound,
+                     cs_datatype_t   datatype,
+                     size_t          n_vals,
+                     void           *vals)
+{
+  const double step = _quantization_step(error_bound);
+
+  if (step <= 0)
+    return;
+
+  if (datatype == CS_FLOAT) {
+    float *v = vals;
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (size_t i = 0; i < n_vals; i++) {
+      double r = nearbyint(v[i] / step);
+      if (fabs(r) <= _Q_MAX) {
+        float vq = r*step;
+        if (fabs((double)vq - v[i]) <= error_bound)
+          v[i] = vq;
+      }
+    }
+  }
+
+  else if (datatype == CS_DOUBLE) {
+    double *v = vals;
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (size_t i = 0; i < n_vals; i++) {
+      double r = nearbyint(v[i] / step);
+      if (fabs(r) <= _Q_MAX)
+        v[i] = r*step;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
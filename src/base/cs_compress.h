@@ -0,0 +1,157 @@
+#ifndef __CS_COMPRESS_H__
+#define __CS_COMPRESS_H__
+
+/*============================================================================
+ * Lossless and error-bounded compression of numerical arrays.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Compression type */
+
+typedef enum {
+
+  CS_COMPRESS_NONE,       /*!< no compression */
+  CS_COMPRESS_LOSSLESS,   /*!< lossless byte shuffle + LZ compression */
+  CS_COMPRESS_QUANTIZE    /*!< error-bounded quantization of floating-point
+                            values, followed by lossless compression;
+                            other datatypes use lossless compression */
+
+} cs_compress_type_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum size of a compressed stream for a given array.
+ *
+ * \param[in]  datatype  datatype of array values
+ * \param[in]  n_vals    number of array values
+ *
+ * \return  maximum size of compressed stream, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_compress_bound(cs_datatype_t  datatype,
+                  size_t         n_vals);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compress an array of values.
+ *
+ * The stream is self-describing, and if compression does not reduce
+ * the data size, values are simply stored.
+ *
+ * With \ref CS_COMPRESS_QUANTIZE, floating-point values are rounded to
+ * a multiple of a power of 2 so that the absolute difference between
+ * original and decompressed values is at most error_bound. If some values
+ * can not be quantized (i.e. are not finite or too large relative to the
+ * error bound), lossless compression is used instead.
+ *
+ * \param[in]   type         compression type
+ * \param[in]   error_bound  absolute error bound for quantization
+ * \param[in]   datatype     datatype of array values
+ * \param[in]   n_vals       number of values
+ * \param[in]   src          values to compress
+ * \param[out]  dest         compressed stream (size: see
+ *                           \ref cs_compress_bound)
+ *
+ * \return  size of compressed stream, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_compress_encode(cs_compress_type_t   type,
+                   double               error_bound,
+                   cs_datatype_t        datatype,
+                   size_t               n_vals,
+                   const void          *src,
+                   unsigned char        dest[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decompress an array of values.
+ *
+ * Streams written on a platform with a different endianness are
+ * handled transparently.
+ *
+ * \param[in]   datatype  datatype of array values
+ * \param[in]   n_vals    number of values
+ * \param[in]   src_size  size of compressed stream, in bytes
+ * \param[in]   src       compressed stream
+ * \param[out]  dest      decompressed values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_compress_decode(cs_datatype_t         datatype,
+                   size_t                n_vals,
+                   size_t                src_size,
+                   const unsigned char   src[],
+                   void                 *dest);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply error-bounded quantization to floating-point values in place.
+ *
+ * This is intended for formats which store raw values: quantized values
+ * have many trailing zero bits, so that the resulting files compress
+ * much better with general purpose tools.
+ *
+ * Values which can not be quantized within the error bound are unchanged.
+ *
+ * \param[in]       error_bound  absolute error bound
+ * \param[in]       datatype     datatype of values (CS_FLOAT or CS_DOUBLE)
+ * \param[in]       n_vals       number of values
+ * \param[in, out]  vals         values to quantize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_compress_quantize(double          error_bound,
+                     cs_datatype_t   datatype,
+                     size_t          n_vals,
+                     void           *vals);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_COMPRESS_H__ */
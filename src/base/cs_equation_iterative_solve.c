@@ -858,6 +858,7 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   if (f_id > -1) {
     f = cs_field_by_id(f_id);
     cs_field_set_key_struct(f, key_sinfo_id, &sinfo);
+    cs_field_increment_version(f);
   }
 
   if (iwarnp >= 1) {
@@ -1835,6 +1836,7 @@ cs_equation_iterative_solve_vector(int                   idtvar,
   if (f_id > -1) {
     f = cs_field_by_id(f_id);
     cs_field_set_key_struct(f, key_sinfo_id, &sinfo);
+    cs_field_increment_version(f);
   }
 
   /*============================================================================
@@ -2676,6 +2678,7 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   if (f_id > -1) {
     f = cs_field_by_id(f_id);
     cs_field_set_key_struct(f, key_sinfo_id, &sinfo);
+    cs_field_increment_version(f);
   }
 
   /*==========================================================================
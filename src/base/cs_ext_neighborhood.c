@@ -140,6 +140,12 @@ BEGIN_C_DECLS
 
 #define CS_VS  8
 
+/* Minimum number of cells per chunk and maximum number of chunks when
+   building the extended neighborhood */
+
+#define CS_EXT_NEIGHBORHOOD_CHUNK_SIZE  16384
+#define CS_EXT_NEIGHBORHOOD_N_CHUNKS_MAX  8
+
 /*============================================================================
  * Type definition
  *============================================================================*/
@@ -348,140 +354,6 @@ _get_cell_b_faces_connectivity(const cs_mesh_t          *mesh,
   *p_cell_b_faces_lst = cell_faces_lst;
 }
 
-/*----------------------------------------------------------------------------
- * Create a "vertex -> cells" connectivity.
- *
- * parameters:
- *   mesh            <-- pointer to a cs_mesh_t structure
- *   p_vtx_cells_idx --> pointer to the "vtx -> cells" connectivity index
- *   p_vtx_cells_lst --> pointer to the "vtx -> cells" connectivity list
- *----------------------------------------------------------------------------*/
-
-static void
-_create_vtx_cells_connect(cs_mesh_t  *mesh,
-                          cs_lnum_t  *p_vtx_cells_idx[],
-                          cs_lnum_t  *p_vtx_cells_lst[])
-{
-  cs_lnum_t  i, j, idx;
-  cs_lnum_t  vtx_id, face_id, cell_id;
-
-  bool      already_seen;
-
-  cs_lnum_t  vtx_cells_connect_size = 0;
-
-  cs_lnum_t  *vtx_faces_idx = NULL, *vtx_faces_lst = NULL;
-  cs_lnum_t  *vtx_cells_idx = NULL, *vtx_cells_lst = NULL;
-
-  const cs_lnum_t  n_vertices = mesh->n_vertices;
-  const cs_lnum_t  n_faces = mesh->n_i_faces;
-  const cs_lnum_t  *face_vtx_idx = mesh->i_face_vtx_idx;
-  const cs_lnum_t  *face_vtx_lst = mesh->i_face_vtx_lst;
-  const cs_lnum_2_t  *face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
-
-  cs_lnum_t  vtx_cells_estimated_connect_size = 3 * n_vertices;
-
-  BFT_MALLOC(vtx_cells_idx, n_vertices + 1, cs_lnum_t);
-  BFT_MALLOC(vtx_faces_idx, n_vertices + 1, cs_lnum_t);
-
-  for (vtx_id = 0; vtx_id < n_vertices + 1; vtx_id++) {
-    vtx_cells_idx[vtx_id] = 0;
-    vtx_faces_idx[vtx_id] = 0;
-  }
-
-  /* Define vtx -> faces connectivity index */
-
-  for (face_id = 0; face_id < n_faces; face_id++) {
-
-    for (i = face_vtx_idx[face_id]; i < face_vtx_idx[face_id+1]; i++) {
-      vtx_id = face_vtx_lst[i];
-      vtx_faces_idx[vtx_id + 1] += 1;
-    }
-
-  } /* End of loop on faces */
-
-  vtx_faces_idx[0] = 0;
-  for (vtx_id = 0; vtx_id < n_vertices; vtx_id++)
-    vtx_faces_idx[vtx_id + 1] += vtx_faces_idx[vtx_id];
-
-  /* Allocation and definiton of "vtx -> faces" connectivity list */
-
-  BFT_MALLOC(vtx_faces_lst, vtx_faces_idx[n_vertices], cs_lnum_t);
-
-  for (face_id = 0; face_id < n_faces; face_id++) {
-
-    for (i = face_vtx_idx[face_id]; i < face_vtx_idx[face_id+1]; i++) {
-
-      vtx_id = face_vtx_lst[i];
-      vtx_faces_lst[vtx_faces_idx[vtx_id]] = face_id;
-      vtx_faces_idx[vtx_id] += 1;
-
-    }
-
-  } /* End of loop on faces */
-
-  for (vtx_id = n_vertices; vtx_id > 0; vtx_id--)
-    vtx_faces_idx[vtx_id] = vtx_faces_idx[vtx_id-1];
-  vtx_faces_idx[0] = 0;
-
-  /* Define "vertex -> cells" connectivity.
-     Use "vertex -> faces" connectivity and "face -> cells" connectivity */
-
-  BFT_MALLOC(vtx_cells_lst, vtx_cells_estimated_connect_size, cs_lnum_t);
-
-  vtx_cells_idx[0] = 0;
-
-  for (vtx_id = 0; vtx_id < n_vertices; vtx_id++) {
-
-    for (i = vtx_faces_idx[vtx_id]; i < vtx_faces_idx[vtx_id+1]; i++) {
-
-      face_id = vtx_faces_lst[i];
-
-      for (j = 0; j < 2; j++) { /* For the cells sharing this face */
-
-        cell_id = face_cells[face_id][j];
-
-        already_seen = false;
-        idx = vtx_cells_idx[vtx_id];
-
-        while ((already_seen == false) && (idx < vtx_cells_connect_size)) {
-          if (cell_id == vtx_cells_lst[idx])
-            already_seen = true;
-          idx++;
-        }
-
-        if (already_seen == false) {
-
-          if (vtx_cells_connect_size + 1 > vtx_cells_estimated_connect_size) {
-            vtx_cells_estimated_connect_size *= 2;
-            BFT_REALLOC(vtx_cells_lst,
-                        vtx_cells_estimated_connect_size, cs_lnum_t);
-          }
-
-          vtx_cells_lst[vtx_cells_connect_size] = cell_id;
-          vtx_cells_connect_size += 1;
-
-        }
-
-      } /* End of loop on cells sharing this face */
-
-    } /* End of loop on faces sharing this vertex */
-
-    vtx_cells_idx[vtx_id+1] = vtx_cells_connect_size;
-
-  } /* End of loop on vertices */
-
-  BFT_REALLOC(vtx_cells_lst, vtx_cells_connect_size, cs_lnum_t);
-
-  /* Free memory */
-
-  BFT_FREE(vtx_faces_idx);
-  BFT_FREE(vtx_faces_lst);
-
-  *p_vtx_cells_idx = vtx_cells_idx;
-  *p_vtx_cells_lst = vtx_cells_lst;
-
-}
-
 /*----------------------------------------------------------------------------
  * Create a "vertex -> cells" connectivity.
  *
@@ -773,10 +645,14 @@ _create_vtx_gcells_connect(cs_halo_t    *halo,
 /*---------------------------------------------------------------------------
  * Create a "vertex -> cells" connectivity.
  *
+ * If a vertex selection is given, the connectivity is empty for
+ * vertices not selected.
+ *
  * parameters:
  *   mesh              <-- pointer to cs_mesh_t structure
  *   cell_i_faces_idx  <-- "cell -> internal faces" connectivity index
  *   cell_i_faces_lst  <-- "cell -> internal faces" connectivity list
+ *   vtx_select        <-- vertex selection flag, or NULL for all
  *   p_vtx_cells_idx   --> pointer to "vertex -> cells" connectivity index
  *   p_vtx_cells_lst   --> pointer to "vertex -> cells" connectivity list
  *---------------------------------------------------------------------------*/
@@ -785,6 +661,7 @@ static void
 _create_vtx_cells_connect2(cs_mesh_t   *mesh,
                            cs_lnum_t   *cell_i_faces_idx,
                            cs_lnum_t   *cell_i_faces_lst,
+                           const char   vtx_select[],
                            cs_lnum_t   *p_vtx_cells_idx[],
                            cs_lnum_t   *p_vtx_cells_lst[])
 {
@@ -830,6 +707,9 @@ _create_vtx_cells_connect2(cs_mesh_t   *mesh,
 
         vtx_id = fac_vtx_lst[i_vtx];
 
+        if (vtx_select != NULL && vtx_select[vtx_id] == 0)
+          continue;
+
         if (vtx_tag[vtx_id] != cell_id) {
 
           vtx_cells_idx[vtx_id+1] += 1;
@@ -866,6 +746,9 @@ _create_vtx_cells_connect2(cs_mesh_t   *mesh,
 
         vtx_id = fac_vtx_lst[i_vtx];
 
+        if (vtx_select != NULL && vtx_select[vtx_id] == 0)
+          continue;
+
         if (vtx_tag[vtx_id] != cell_id) {
 
           shift = vtx_cells_idx[vtx_id] + vtx_count[vtx_id];
@@ -891,14 +774,15 @@ _create_vtx_cells_connect2(cs_mesh_t   *mesh,
 /*---------------------------------------------------------------------------
  * Create a "cell -> cells" connectivity.
  *
+ * Cells are handled by chunks, and the "vertex -> cells" connectivity
+ * is only built for the vertices of the current chunk's cells.
+ *
  * parameters:
  *   mesh              <-- pointer to cs_mesh_t structure
  *   cell_i_faces_idx  <-- "cell -> faces" connectivity index
  *   cell_i_faces_lst  <-- "cell -> faces" connectivity list
  *   vtx_gcells_idx    --> "vertex -> ghost cells" connectivity index
  *   vtx_gcells_lst    --> "vertex -> ghost cells" connectivity list
- *   vtx_cells_idx     --> "vertex -> cells" connectivity index
- *   vtx_cells_lst     --> "vertex -> cells" connectivity list
  *   p_cell_cells_idx  --> pointer to "cell -> cells" connectivity index
  *   p_cell_cells_lst  --> pointer to "cell -> cells" connectivity list
  *---------------------------------------------------------------------------*/
@@ -909,19 +793,16 @@ _create_cell_cells_connect(cs_mesh_t  *mesh,
                            cs_lnum_t  *cell_i_faces_lst,
                            cs_lnum_t  *vtx_gcells_idx,
                            cs_lnum_t  *vtx_gcells_lst,
-                           cs_lnum_t  *vtx_cells_idx,
-                           cs_lnum_t  *vtx_cells_lst,
                            cs_lnum_t  *p_cell_cells_idx[],
                            cs_lnum_t  *p_cell_cells_lst[])
 {
-  cs_lnum_t  i, j, i_cel, fac_id, i_vtx;
-  cs_lnum_t  cell_id, vtx_id, shift;
-
-  cs_lnum_t  *cell_buffer = NULL, *cell_tag = NULL, *cell_count = NULL;
+  cs_lnum_t  *cell_tag = NULL;
   cs_lnum_t  *cell_cells_idx = NULL, *cell_cells_lst = NULL;
+  char  *vtx_select = NULL;
 
   const cs_lnum_t  n_cells = mesh->n_cells;
   const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
+  const cs_lnum_t  n_vertices = mesh->n_vertices;
   const cs_lnum_2_t  *face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
   const cs_lnum_t  *fac_vtx_idx = mesh->i_face_vtx_idx;
   const cs_lnum_t  *fac_vtx_lst = mesh->i_face_vtx_lst;
@@ -929,163 +810,134 @@ _create_cell_cells_connect(cs_mesh_t  *mesh,
   /* Allocate and initialize buffers */
 
   BFT_MALLOC(cell_cells_idx, n_cells + 1, cs_lnum_t);
-  BFT_MALLOC(cell_buffer, n_cells_wghosts + n_cells, cs_lnum_t);
-
-  cell_tag = &(cell_buffer[0]);
-  cell_count = &(cell_buffer[n_cells_wghosts]);
+  BFT_MALLOC(cell_tag, n_cells_wghosts, cs_lnum_t);
+  BFT_MALLOC(vtx_select, n_vertices, char);
 
   cell_cells_idx[0] = 0;
-  for (i = 0; i < n_cells; i++) {
-    cell_cells_idx[i+1] = 0;
-    cell_count[i] = 0;
-  }
 
-  for (i = 0; i < n_cells_wghosts; i++)
+  for (cs_lnum_t i = 0; i < n_cells_wghosts; i++)
     cell_tag[i] = -1;
 
-  /* Define index */
+  /* Each chunk requires a pass on all cells to build its "vertex -> cells"
+     connectivity, so the number of chunks is bounded */
 
-  for (i_cel = 0; i_cel < n_cells; i_cel++) {
+  cs_lnum_t  chunk_size = n_cells / CS_EXT_NEIGHBORHOOD_N_CHUNKS_MAX + 1;
+  chunk_size = CS_MAX(chunk_size, CS_EXT_NEIGHBORHOOD_CHUNK_SIZE);
 
-    /* First loop on faces to tag cells sharing a face */
+  cs_lnum_t  lst_size = 0;
 
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
+  for (cs_lnum_t s_id = 0; s_id < n_cells; s_id += chunk_size) {
 
-      fac_id = cell_i_faces_lst[i];
+    cs_lnum_t  e_id = CS_MIN(s_id + chunk_size, n_cells);
 
-      cell_tag[face_cells[fac_id][0]] = i_cel;
-      cell_tag[face_cells[fac_id][1]] = i_cel;
+    /* Build "vertex -> cells" connectivity for this chunk's vertices */
 
-    } /* End of loop on cell's faces */
-
-    /* Second loop on faces to update index */
+    cs_lnum_t  *vtx_cells_idx = NULL, *vtx_cells_lst = NULL;
 
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
+    memset(vtx_select, 0, n_vertices);
 
-      fac_id = cell_i_faces_lst[i];
-
-      for (i_vtx = fac_vtx_idx[fac_id];
+    for (cs_lnum_t i = cell_i_faces_idx[s_id];
+         i < cell_i_faces_idx[e_id];
+         i++) {
+      cs_lnum_t  fac_id = cell_i_faces_lst[i];
+      for (cs_lnum_t i_vtx = fac_vtx_idx[fac_id];
            i_vtx < fac_vtx_idx[fac_id+1];
-           i_vtx++) {
-
-        vtx_id = fac_vtx_lst[i_vtx];
-
-        /* For cells belonging to this rank, get vertex -> cells connect. */
-
-        for (j = vtx_cells_idx[vtx_id]; j < vtx_cells_idx[vtx_id+1]; j++) {
-
-          cell_id = vtx_cells_lst[j];
-
-          if (cell_tag[cell_id] != i_cel) {
-            cell_cells_idx[i_cel+1] += 1;
-            cell_tag[cell_id] = i_cel;
-          }
-
-        }
-
-        if (n_cells_wghosts - n_cells > 0) { /* If there are ghost cells */
-
-          /* For ghost cells, get vertex -> ghost cells connect. */
-
-          for (j = vtx_gcells_idx[vtx_id]; j < vtx_gcells_idx[vtx_id+1]; j++) {
-
-            cell_id = vtx_gcells_lst[j] + n_cells;
-
-            if (cell_tag[cell_id] != i_cel) {
-              cell_cells_idx[i_cel+1] += 1;
-              cell_tag[cell_id] = i_cel;
-            }
-
-          }
-
-        } /* If there are ghost cells */
-
-      } /* End of loop on vertices */
-
-    } /* End of loop on cell's faces */
-
-  } /* End of loop on cells */
-
-  /* Create index */
-
-  for (i = 0; i < n_cells; i++)
-    cell_cells_idx[i+1] += cell_cells_idx[i];
-
-  for (i = 0; i < n_cells_wghosts; i++)
-    cell_tag[i] = -1;
-
-  BFT_MALLOC(cell_cells_lst, cell_cells_idx[n_cells], cs_lnum_t);
-
-  /* Fill list */
-
-  for (i_cel = 0; i_cel < n_cells; i_cel++) {
+           i_vtx++)
+        vtx_select[fac_vtx_lst[i_vtx]] = 1;
+    }
 
-    /* First loop on faces to tag cells sharing a face */
+    _create_vtx_cells_connect2(mesh,
+                               cell_i_faces_idx,
+                               cell_i_faces_lst,
+                               vtx_select,
+                               &vtx_cells_idx,
+                               &vtx_cells_lst);
 
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
+    for (cs_lnum_t i_cel = s_id; i_cel < e_id; i_cel++) {
 
-      fac_id = cell_i_faces_lst[i];
+      const cs_lnum_t  f_s_id = cell_i_faces_idx[i_cel];
+      const cs_lnum_t  f_e_id = cell_i_faces_idx[i_cel+1];
 
-      cell_tag[face_cells[fac_id][0]] = i_cel;
-      cell_tag[face_cells[fac_id][1]] = i_cel;
+      cs_lnum_t  n = cell_cells_idx[i_cel];
 
-    } /* End of loop on cell's faces */
+      /* First loop on faces to tag cells sharing a face */
 
-    /* Second loop on faces to update list */
-
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
-
-      fac_id = cell_i_faces_lst[i];
+      for (cs_lnum_t i = f_s_id; i < f_e_id; i++) {
+        cs_lnum_t  fac_id = cell_i_faces_lst[i];
+        cell_tag[face_cells[fac_id][0]] = i_cel;
+        cell_tag[face_cells[fac_id][1]] = i_cel;
+      }
 
-      for (i_vtx = fac_vtx_idx[fac_id];
-           i_vtx < fac_vtx_idx[fac_id+1];
-           i_vtx++) {
+      /* Second loop on faces to add cells sharing only vertices */
 
-        vtx_id = fac_vtx_lst[i_vtx];
+      for (cs_lnum_t i = f_s_id; i < f_e_id; i++) {
 
-        /* For cells belonging to this rank, get vertex -> cells connect. */
+        cs_lnum_t  fac_id = cell_i_faces_lst[i];
 
-        for (j = vtx_cells_idx[vtx_id]; j < vtx_cells_idx[vtx_id+1]; j++) {
+        for (cs_lnum_t i_vtx = fac_vtx_idx[fac_id];
+             i_vtx < fac_vtx_idx[fac_id+1];
+             i_vtx++) {
 
-          cell_id = vtx_cells_lst[j];
+          cs_lnum_t  vtx_id = fac_vtx_lst[i_vtx];
 
-          if (cell_tag[cell_id] != i_cel) {
+          /* Ensure room for all cells sharing this vertex; the list grows
+             geometrically, to at least its final size estimated from
+             the mean number of neighbors so far */
 
-            shift = cell_cells_idx[i_cel] + cell_count[i_cel];
-            cell_cells_lst[shift] = cell_id;
-            cell_tag[cell_id] = i_cel;
-            cell_count[i_cel] += 1;
+          cs_lnum_t  n_max = vtx_cells_idx[vtx_id+1] - vtx_cells_idx[vtx_id];
+          if (vtx_gcells_idx != NULL)
+            n_max += vtx_gcells_idx[vtx_id+1] - vtx_gcells_idx[vtx_id];
 
-          } /* Add this cell_id */
+          if (n + n_max > lst_size) {
+            cs_lnum_t  n_est = (double)n / (i_cel + 1) * n_cells * 1.1;
+            lst_size = CS_MAX(lst_size + lst_size/2, n + n_max);
+            lst_size = CS_MAX(lst_size, n_est);
+            BFT_REALLOC(cell_cells_lst, lst_size, cs_lnum_t);
+          }
 
-        }
+          /* For cells belonging to this rank, get vertex -> cells connect. */
 
-        if (n_cells_wghosts - n_cells > 0) { /* If there are ghost cells */
+          for (cs_lnum_t j = vtx_cells_idx[vtx_id];
+               j < vtx_cells_idx[vtx_id+1];
+               j++) {
+            cs_lnum_t  cell_id = vtx_cells_lst[j];
+            if (cell_tag[cell_id] != i_cel) {
+              cell_cells_lst[n++] = cell_id;
+              cell_tag[cell_id] = i_cel;
+            }
+          }
 
           /* For ghost cells, get vertex -> ghost cells connect. */
 
-          for (j = vtx_gcells_idx[vtx_id]; j < vtx_gcells_idx[vtx_id+1]; j++){
+          if (vtx_gcells_idx != NULL) {
+            for (cs_lnum_t j = vtx_gcells_idx[vtx_id];
+                 j < vtx_gcells_idx[vtx_id+1];
+                 j++) {
+              cs_lnum_t  cell_id = vtx_gcells_lst[j] + n_cells;
+              if (cell_tag[cell_id] != i_cel) {
+                cell_cells_lst[n++] = cell_id;
+                cell_tag[cell_id] = i_cel;
+              }
+            }
+          }
 
-            cell_id = vtx_gcells_lst[j] + n_cells;
+        } /* End of loop on vertices */
 
-            if (cell_tag[cell_id] != i_cel) {
+      } /* End of loop on cell's faces */
 
-              shift = cell_cells_idx[i_cel] + cell_count[i_cel];
-              cell_cells_lst[shift] = cell_id;
-              cell_tag[cell_id] = i_cel;
-              cell_count[i_cel] += 1;
+      cell_cells_idx[i_cel+1] = n;
 
-            }
+    } /* End of loop on chunk cells */
 
-          }
+    BFT_FREE(vtx_cells_idx);
+    BFT_FREE(vtx_cells_lst);
 
-        } /* If there are ghost cells */
+  } /* End of loop on chunks */
 
-      } /* End of loop on vertices */
+  BFT_FREE(vtx_select);
+  BFT_FREE(cell_tag);
 
-    } /* End of loop on cell's faces */
-
-  } /* End of loop on cells */
+  BFT_REALLOC(cell_cells_lst, cell_cells_idx[n_cells], cs_lnum_t);
 
   /* Sort line elements by column id (for better access patterns) */
 
@@ -1095,10 +947,6 @@ _create_cell_cells_connect(cs_mesh_t  *mesh,
 
   *p_cell_cells_idx = cell_cells_idx;
   *p_cell_cells_lst = cell_cells_lst;
-
-  /* Free memory */
-
-  BFT_FREE(cell_buffer);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1127,6 +975,7 @@ _neighborhood_reduce_anomax(cs_mesh_t             *mesh,
   cs_real_t  norm_ij, face_norm, cos_ij_fn;
   cs_real_t  dprod;
 
+  cs_lnum_t  *cell_i_faces_idx = NULL, *cell_i_faces_lst = NULL;
   cs_lnum_t  *vtx_cells_idx = NULL, *vtx_cells_lst = NULL;
   cs_lnum_t  *vtx_gcells_idx = NULL, *vtx_gcells_lst = NULL;
 
@@ -1156,13 +1005,23 @@ _neighborhood_reduce_anomax(cs_mesh_t             *mesh,
   /*
     First: re-build a "vertex -> cells" connectivity
     ------------------------------------------------
-    We have to invert the "face -> vertices" connectivity and then
-    we will use the "face -> cells" conectivity.
+    We use the "cell -> internal faces" and "face -> vertices"
+    connectivities, so as to size it exactly.
   */
 
-  _create_vtx_cells_connect(mesh,
-                            &vtx_cells_idx,
-                            &vtx_cells_lst);
+  _get_cell_i_faces_connectivity(mesh,
+                                 &cell_i_faces_idx,
+                                 &cell_i_faces_lst);
+
+  _create_vtx_cells_connect2(mesh,
+                             cell_i_faces_idx,
+                             cell_i_faces_lst,
+                             NULL,
+                             &vtx_cells_idx,
+                             &vtx_cells_lst);
+
+  BFT_FREE(cell_i_faces_idx);
+  BFT_FREE(cell_i_faces_lst);
 
   if (cs_mesh_n_g_ghost_cells(mesh) > 0)
     _create_vtx_gcells_connect(mesh->halo,
@@ -1747,7 +1606,6 @@ void
 cs_ext_neighborhood_define(cs_mesh_t  *mesh)
 {
   cs_lnum_t  *vtx_gcells_idx = NULL, *vtx_gcells_lst = NULL;
-  cs_lnum_t  *vtx_cells_idx = NULL, *vtx_cells_lst = NULL;
   cs_lnum_t  *cell_i_faces_idx = NULL, *cell_i_faces_lst = NULL;
   cs_lnum_t  *cell_cells_idx = NULL, *cell_cells_lst = NULL;
 
@@ -1759,14 +1617,6 @@ cs_ext_neighborhood_define(cs_mesh_t  *mesh)
                                  &cell_i_faces_idx,
                                  &cell_i_faces_lst);
 
-  /* Create a "vertex -> cell" connectivity */
-
-  _create_vtx_cells_connect2(mesh,
-                             cell_i_faces_idx,
-                             cell_i_faces_lst,
-                             &vtx_cells_idx,
-                             &vtx_cells_lst);
-
   if (cs_mesh_n_g_ghost_cells(mesh) > 0) {
 
     /* Create a "vertex -> ghost cells" connectivity */
@@ -1787,8 +1637,6 @@ cs_ext_neighborhood_define(cs_mesh_t  *mesh)
                              cell_i_faces_lst,
                              vtx_gcells_idx,
                              vtx_gcells_lst,
-                             vtx_cells_idx,
-                             vtx_cells_lst,
                              &cell_cells_idx,
                              &cell_cells_lst);
 
@@ -1802,8 +1650,6 @@ cs_ext_neighborhood_define(cs_mesh_t  *mesh)
 
   BFT_FREE(cell_i_faces_idx);
   BFT_FREE(cell_i_faces_lst);
-  BFT_FREE(vtx_cells_idx);
-  BFT_FREE(vtx_cells_lst);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -127,6 +127,9 @@ BEGIN_C_DECLS
         Boundary condition coefficients, for variable type fields
   \var  cs_field_t::is_owner
         Ownership flag for values
+  \var  cs_field_t::version
+        Modification counter for values, incremented when val or val_pre
+        are updated (see \ref cs_field_increment_version)
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -509,6 +512,8 @@ _field_create(const char   *name,
 
   f->is_owner = true;
 
+  f->version = 0;
+
   /* Mark key values as not set */
 
   for (key_id = 0; key_id < _n_keys_max; key_id++) {
@@ -1728,6 +1733,8 @@ cs_field_allocate_values(cs_field_t  *f)
     if (f->n_time_vals > 1)
       f->val_pre = f->vals[1];
   }
+
+  f->version += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1764,6 +1771,8 @@ cs_field_map_values(cs_field_t   *f,
     f->val_pre = val_pre;
     f->vals[1] = val_pre;
   }
+
+  f->version += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2151,6 +2160,8 @@ cs_field_set_values(cs_field_t  *f,
 # pragma omp parallel for if (_n_vals > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
     f->val[ii] = c;
+
+  f->version += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2213,9 +2224,32 @@ cs_field_current_to_previous(cs_field_t  *f)
 
     }
 
+    f->version += 1;
+
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate that field values have been modified.
+ *
+ * This increments the field's modification counter, so that quantities
+ * derived from the field values (such as cached gradients) are
+ * recomputed when needed. Code updating field values directly
+ * (rather than through the solver) should call this function.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_increment_version(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  f->version += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy all defined fields.
@@ -155,6 +155,10 @@ typedef struct {
 
   bool                    is_owner;     /* Ownership flag for values */
 
+  int                     version;      /* Modification counter for values,
+                                           incremented when val or val_pre
+                                           are updated */
+
 } cs_field_t;
 
 /*----------------------------------------------------------------------------
@@ -364,6 +368,20 @@ cs_field_set_values(cs_field_t  *f,
 void
 cs_field_current_to_previous(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Indicate that field values have been modified.
+ *
+ * This increments the field's modification counter, so that quantities
+ * derived from the field values (such as cached gradients) are
+ * recomputed when needed.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_increment_version(cs_field_t  *f);
+
 /*----------------------------------------------------------------------------
  * Destroy all defined fields.
  *----------------------------------------------------------------------------*/
@@ -34,6 +34,7 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -61,6 +62,7 @@
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_internal_coupling.h"
+#include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -100,10 +102,41 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Cached gradient */
+
+typedef struct {
+
+  int                  f_id;            /* Associated field id */
+  int                  version;         /* Field version at computation */
+  int                  nt_cur;          /* Time step at computation */
+  bool                 use_previous_t;  /* Previous values used ? */
+  int                  inc;             /* Increment flag */
+  int                  stride;          /* Gradient values per cell */
+  cs_gradient_type_t   gradient_type;   /* Gradient type */
+  cs_halo_type_t       halo_type;       /* Halo type */
+  int                  n_r_sweeps;      /* Number of reconstruction sweeps */
+  int                  clip_mode;       /* Clipping mode */
+  cs_real_t            epsilon;         /* Reconstruction precision */
+  cs_real_t            clip_coeff;      /* Clipping coefficient */
+  uint64_t             hash;            /* Hash of BC coefficients
+                                           and weights */
+  unsigned long long   age;             /* Last use counter */
+
+  cs_real_t           *grad;            /* Gradient values */
+
+} _gradient_cache_entry_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Gradient cache */
+
+static int  _n_grad_cache_max = 0;
+static int  _n_grad_cache = 0;
+static unsigned long long  _grad_cache_age = 0;
+static _gradient_cache_entry_t  *_grad_cache = NULL;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -521,35 +554,33 @@ cs_f_field_set_volume_average(int       f_id,
                               va);
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*=============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute cell gradient of scalar field or component of vector or
- * tensor field.
+/*----------------------------------------------------------------------------
+ * Determine gradient options associated with a scalar field.
  *
- * \param[in]       f               pointer to field
- * \param[in]       use_previous_t  should we use values from the previous
- *                                  time step ?
- * \param[in]       inc             if 0, solve on increment; 1 otherwise
- * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
- * \param[out]      grad            gradient
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   f             <-- pointer to field
+ *   eqp_default   <-- default equation parameters
+ *   gradient_type --> gradient type
+ *   halo_type     --> halo type
+ *   w_stride      --> stride for weighting coefficient
+ *   c_weight      --> weighting coefficient, or NULL
+ *   cpl           --> internal coupling, or NULL
+ *
+ * returns:
+ *   pointer to equation parameters used for gradient options
+ *----------------------------------------------------------------------------*/
 
-void
-cs_field_gradient_scalar(const cs_field_t          *f,
-                         bool                       use_previous_t,
-                         int                        inc,
-                         bool                       recompute_cocg,
-                         cs_real_3_t      *restrict grad)
+static const cs_equation_param_t *
+_field_gradient_scalar_options(const cs_field_t            *f,
+                               const cs_equation_param_t   *eqp_default,
+                               cs_gradient_type_t          *gradient_type,
+                               cs_halo_type_t              *halo_type,
+                               int                         *w_stride,
+                               cs_real_t                  **c_weight,
+                               cs_internal_coupling_t     **cpl)
 {
-  cs_halo_type_t halo_type = CS_HALO_STANDARD;
-  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+  *halo_type = CS_HALO_STANDARD;
+  *gradient_type = CS_GRADIENT_GREEN_ITER;
 
   /* Does the field have a parent (variable) ?
      Field is its own parent if not parent is specified */
@@ -562,7 +593,6 @@ cs_field_gradient_scalar(const cs_field_t          *f,
     parent_f = cs_field_by_id(f_parent_id);
 
   int imrgra = cs_glob_space_disc->imrgra;
-  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
 
   /* Get the calculation option from the field */
   const cs_equation_param_t
@@ -571,15 +601,15 @@ cs_field_gradient_scalar(const cs_field_t          *f,
   if (eqp != NULL)
     imrgra = eqp->imrgra;
   else
-    eqp = &eqp_default;
+    eqp = eqp_default;
 
   cs_gradient_type_by_imrgra(imrgra,
-                             &gradient_type,
-                             &halo_type);
+                             gradient_type,
+                             halo_type);
 
-  int w_stride = 1;
-  cs_real_t *c_weight = NULL;
-  cs_internal_coupling_t  *cpl = NULL;
+  *w_stride = 1;
+  *c_weight = NULL;
+  *cpl = NULL;
 
   if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
 
@@ -589,8 +619,8 @@ cs_field_gradient_scalar(const cs_field_t          *f,
       int diff_id = cs_field_get_key_int(parent_f, key_id);
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
-        c_weight = f_weight->val;
-        w_stride = f_weight->dim;
+        *c_weight = f_weight->val;
+        *w_stride = f_weight->dim;
       }
     }
 
@@ -599,11 +629,310 @@ cs_field_gradient_scalar(const cs_field_t          *f,
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(parent_f, key_id);
       if (coupl_id > -1)
-        cpl = cs_internal_coupling_by_id(coupl_id);
+        *cpl = cs_internal_coupling_by_id(coupl_id);
     }
 
   }
 
+  return eqp;
+}
+
+/*----------------------------------------------------------------------------
+ * Mix bits of a 64-bit integer (splitmix64 finalizer).
+ *----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_mix64(uint64_t  z)
+{
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/*----------------------------------------------------------------------------
+ * Update hash of an array of real values (used to detect changes in
+ * boundary condition coefficients or weights between gradient calls).
+ *
+ * parameters:
+ *   h      <-- initial hash value
+ *   n      <-- number of values
+ *   v      <-- values, or NULL
+ *
+ * returns:
+ *   updated hash value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_hash_values(uint64_t          h,
+             cs_lnum_t         n,
+             const cs_real_t  *v)
+{
+  if (v == NULL)
+    return _mix64(h + 1);
+
+  uint64_t s = 0;
+
+# pragma omp parallel for reduction(+:s) if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++) {
+    uint64_t b;
+    memcpy(&b, v + i, sizeof(uint64_t));
+    s += _mix64(b + (uint64_t)i * 0x9e3779b97f4a7c15ULL);
+  }
+
+  return _mix64(h ^ s) + (uint64_t)n;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if gradients of a given field may be cached.
+ *
+ * Only variable fields based on cells are handled, as their values
+ * are updated by the solver (which increments the field version).
+ *
+ * parameters:
+ *   f  <-- pointer to field
+ *
+ * returns:
+ *   true if the gradient cache may be used for this field
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_gradient_cache_active(const cs_field_t  *f)
+{
+  if (   _n_grad_cache_max > 0
+      && f->type & CS_FIELD_VARIABLE
+      && f->location_id == CS_MESH_LOCATION_CELLS)
+    return true;
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute hash of boundary condition coefficients and gradient weights.
+ *
+ * parameters:
+ *   a_stride  <-- number of values per face for coefficient a
+ *   b_stride  <-- number of values per face for coefficient b
+ *   bc_a      <-- boundary condition coefficient a, or NULL
+ *   bc_b      <-- boundary condition coefficient b, or NULL
+ *   w_stride  <-- number of values per cell for weights
+ *   c_weight  <-- cell weights, or NULL
+ *
+ * returns:
+ *   hash value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_gradient_cache_hash(int               a_stride,
+                     int               b_stride,
+                     const cs_real_t  *bc_a,
+                     const cs_real_t  *bc_b,
+                     int               w_stride,
+                     const cs_real_t  *c_weight)
+{
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  uint64_t h = 0;
+
+  h = _hash_values(h, n_b_faces*a_stride, bc_a);
+  h = _hash_values(h, n_b_faces*b_stride, bc_b);
+  h = _hash_values(h, n_cells*w_stride, c_weight);
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Retrieve a cached gradient if available.
+ *
+ * The decision is made collectively, so that either all ranks reuse
+ * their cached gradient or all ranks compute it (as gradient computations
+ * involve parallel operations).
+ *
+ * parameters:
+ *   f               <-- pointer to field
+ *   use_previous_t  <-- are values from the previous time step used ?
+ *   inc             <-- if 0, solve on increment; 1 otherwise
+ *   stride          <-- number of gradient values per cell
+ *   gradient_type   <-- gradient type
+ *   halo_type       <-- halo type
+ *   eqp             <-- gradient reconstruction and clipping options
+ *   hash            <-- hash of BC coefficients and weights
+ *   grad            --> gradient (unchanged if not found)
+ *
+ * returns:
+ *   true if a matching gradient was found on all ranks, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_get(const cs_field_t           *f,
+                    bool                        use_previous_t,
+                    int                         inc,
+                    int                         stride,
+                    cs_gradient_type_t          gradient_type,
+                    cs_halo_type_t              halo_type,
+                    const cs_equation_param_t  *eqp,
+                    uint64_t                    hash,
+                    cs_real_t                  *grad)
+{
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  _gradient_cache_entry_t *e = NULL;
+
+  for (int i = 0; i < _n_grad_cache; i++) {
+
+    _gradient_cache_entry_t *c = _grad_cache + i;
+
+    if (   c->f_id != f->id
+        || c->version != f->version
+        || c->nt_cur != nt_cur
+        || c->use_previous_t != use_previous_t
+        || c->inc != inc
+        || c->stride != stride
+        || c->gradient_type != gradient_type
+        || c->halo_type != halo_type
+        || c->n_r_sweeps != eqp->nswrgr
+        || c->clip_mode != eqp->imligr
+        || c->epsilon < eqp->epsrgr || c->epsilon > eqp->epsrgr
+        || c->clip_coeff < eqp->climgr || c->clip_coeff > eqp->climgr
+        || c->hash != hash)
+      continue;
+
+    e = c;
+    break;
+  }
+
+  int hit = (e != NULL) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &hit);
+
+  if (hit == 0)
+    return false;
+
+  const cs_lnum_t n_vals = cs_glob_mesh->n_cells_with_ghosts * stride;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t j = 0; j < n_vals; j++)
+    grad[j] = e->grad[j];
+
+  e->age = ++_grad_cache_age;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a gradient to the cache.
+ *
+ * If the cache is full, the least recently used entry is replaced.
+ *
+ * parameters:
+ *   f               <-- pointer to field
+ *   use_previous_t  <-- are values from the previous time step used ?
+ *   inc             <-- if 0, solve on increment; 1 otherwise
+ *   stride          <-- number of gradient values per cell
+ *   gradient_type   <-- gradient type
+ *   halo_type       <-- halo type
+ *   eqp             <-- gradient reconstruction and clipping options
+ *   hash            <-- hash of BC coefficients and weights
+ *   grad            <-- gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_add(const cs_field_t           *f,
+                    bool                        use_previous_t,
+                    int                         inc,
+                    int                         stride,
+                    cs_gradient_type_t          gradient_type,
+                    cs_halo_type_t              halo_type,
+                    const cs_equation_param_t  *eqp,
+                    uint64_t                    hash,
+                    const cs_real_t            *grad)
+{
+  _gradient_cache_entry_t *e = NULL;
+
+  if (_n_grad_cache < _n_grad_cache_max) {
+    BFT_REALLOC(_grad_cache, _n_grad_cache + 1, _gradient_cache_entry_t);
+    e = _grad_cache + _n_grad_cache;
+    e->stride = 0;
+    e->grad = NULL;
+    _n_grad_cache += 1;
+  }
+  else {
+    e = _grad_cache;
+    for (int i = 1; i < _n_grad_cache; i++) {
+      if (_grad_cache[i].age < e->age)
+        e = _grad_cache + i;
+    }
+  }
+
+  const cs_lnum_t n_vals = cs_glob_mesh->n_cells_with_ghosts * stride;
+
+  if (e->stride != stride || e->grad == NULL)
+    BFT_REALLOC(e->grad, n_vals, cs_real_t);
+
+  e->f_id = f->id;
+  e->version = f->version;
+  e->nt_cur = cs_glob_time_step->nt_cur;
+  e->use_previous_t = use_previous_t;
+  e->inc = inc;
+  e->stride = stride;
+  e->gradient_type = gradient_type;
+  e->halo_type = halo_type;
+  e->n_r_sweeps = eqp->nswrgr;
+  e->clip_mode = eqp->imligr;
+  e->epsilon = eqp->epsrgr;
+  e->clip_coeff = eqp->climgr;
+  e->hash = hash;
+  e->age = ++_grad_cache_age;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t j = 0; j < n_vals; j++)
+    e->grad[j] = grad[j];
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradient of scalar field or component of vector or
+ * tensor field.
+ *
+ * \param[in]       f               pointer to field
+ * \param[in]       use_previous_t  should we use values from the previous
+ *                                  time step ?
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[out]      grad            gradient
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar(const cs_field_t          *f,
+                         bool                       use_previous_t,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         cs_real_3_t      *restrict grad)
+{
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
+
+  int w_stride = 1;
+  cs_real_t *c_weight = NULL;
+  cs_internal_coupling_t  *cpl = NULL;
+
+  const cs_equation_param_t *eqp
+    = _field_gradient_scalar_options(f,
+                                     &eqp_default,
+                                     &gradient_type,
+                                     &halo_type,
+                                     &w_stride,
+                                     &c_weight,
+                                     &cpl);
+
   if (f->n_time_vals < 2 && use_previous_t)
     bft_error(__FILE__, __LINE__, 0,
               _("%s: field %s does not maintain previous time step values\n"
@@ -618,6 +947,26 @@ cs_field_gradient_scalar(const cs_field_t          *f,
     bc_coeff_b = f->bc_coeffs->b;
   }
 
+  /* Reuse gradient if field values and BC's have not changed */
+
+  const bool use_cache = (_gradient_cache_active(f) && cpl == NULL);
+  uint64_t hash = 0;
+
+  if (use_cache) {
+    hash = _gradient_cache_hash(1, 1, bc_coeff_a, bc_coeff_b,
+                                w_stride, c_weight);
+    if (_gradient_cache_get(f, use_previous_t, inc, 3,
+                            gradient_type, halo_type, eqp, hash,
+                            (cs_real_t *)grad)) {
+      /* The cocg matrix is shared between fields, so it must still
+         be based on this field's boundary conditions if requested */
+      if (recompute_cocg && !(w_stride == 6 && c_weight != NULL))
+        cs_gradient_scalar_update_cocg(gradient_type, halo_type,
+                                       bc_coeff_b, cpl);
+      return;
+    }
+  }
+
   cs_gradient_scalar(f->name,
                      gradient_type,
                      halo_type,
@@ -638,6 +987,153 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  if (use_cache)
+    _gradient_cache_add(f, use_previous_t, inc, 3,
+                        gradient_type, halo_type, eqp, hash,
+                        (const cs_real_t *)grad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradients of several scalar fields.
+ *
+ * If all fields share the same gradient options (gradient type and
+ * reconstruction parameters, weighting and internal coupling),
+ * gradients are computed together using \ref cs_gradient_scalar_multi,
+ * with a single halo exchange and a single sweep over mesh faces
+ * when possible. Otherwise, \ref cs_field_gradient_scalar is called
+ * for each field.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       f               pointer to fields
+ * \param[in]       use_previous_t  should we use values from the previous
+ *                                  time step ?
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[out]      grad            gradient, for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                  n_fields,
+                               const cs_field_t    *f[],
+                               bool                 use_previous_t,
+                               int                  inc,
+                               bool                 recompute_cocg,
+                               cs_real_3_t         *grad[])
+{
+  if (n_fields < 1)
+    return;
+
+  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
+
+  cs_halo_type_t halo_type[2];
+  cs_gradient_type_t gradient_type[2];
+  int w_stride[2];
+  cs_real_t *c_weight[2];
+  cs_internal_coupling_t  *cpl[2];
+  const cs_equation_param_t *eqp[2];
+
+  /* Check that gradient options are shared */
+
+  bool shared = true;
+
+  eqp[0] = _field_gradient_scalar_options(f[0],
+                                          &eqp_default,
+                                          &gradient_type[0],
+                                          &halo_type[0],
+                                          &w_stride[0],
+                                          &c_weight[0],
+                                          &cpl[0]);
+
+  if (w_stride[0] != 1)
+    shared = false;
+
+  for (int i = 1; i < n_fields && shared; i++) {
+
+    eqp[1] = _field_gradient_scalar_options(f[i],
+                                            &eqp_default,
+                                            &gradient_type[1],
+                                            &halo_type[1],
+                                            &w_stride[1],
+                                            &c_weight[1],
+                                            &cpl[1]);
+
+    if (   gradient_type[1] != gradient_type[0]
+        || halo_type[1] != halo_type[0]
+        || w_stride[1] != w_stride[0]
+        || c_weight[1] != c_weight[0]
+        || cpl[1] != cpl[0]
+        || eqp[1]->nswrgr != eqp[0]->nswrgr
+        || eqp[1]->verbosity != eqp[0]->verbosity
+        || eqp[1]->imligr != eqp[0]->imligr
+        || eqp[1]->epsrgr < eqp[0]->epsrgr
+        || eqp[1]->epsrgr > eqp[0]->epsrgr
+        || eqp[1]->climgr < eqp[0]->climgr
+        || eqp[1]->climgr > eqp[0]->climgr)
+      shared = false;
+
+  }
+
+  if (shared == false || n_fields == 1) {
+    for (int i = 0; i < n_fields; i++)
+      cs_field_gradient_scalar(f[i], use_previous_t, inc, recompute_cocg,
+                               grad[i]);
+    return;
+  }
+
+  const char **var_name;
+  const cs_real_t **bc_coeff_a, **bc_coeff_b;
+  cs_real_t **var;
+
+  BFT_MALLOC(var_name, n_fields, const char *);
+  BFT_MALLOC(bc_coeff_a, n_fields, const cs_real_t *);
+  BFT_MALLOC(bc_coeff_b, n_fields, const cs_real_t *);
+  BFT_MALLOC(var, n_fields, cs_real_t *);
+
+  for (int i = 0; i < n_fields; i++) {
+
+    if (f[i]->n_time_vals < 2 && use_previous_t)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field %s does not maintain previous time step values\n"
+                  "so \"use_previous_t\" can not be handled."),
+                __func__, f[i]->name);
+
+    var_name[i] = f[i]->name;
+    var[i] = (use_previous_t) ? f[i]->val_pre : f[i]->val;
+
+    bc_coeff_a[i] = NULL;
+    bc_coeff_b[i] = NULL;
+    if (f[i]->bc_coeffs != NULL) {
+      bc_coeff_a[i] = f[i]->bc_coeffs->a;
+      bc_coeff_b[i] = f[i]->bc_coeffs->b;
+    }
+
+  }
+
+  cs_gradient_scalar_multi(n_fields,
+                           var_name,
+                           gradient_type[0],
+                           halo_type[0],
+                           inc,
+                           recompute_cocg,
+                           eqp[0]->nswrgr,
+                           eqp[0]->verbosity,
+                           eqp[0]->imligr,
+                           eqp[0]->epsrgr,
+                           eqp[0]->climgr,
+                           bc_coeff_a,
+                           bc_coeff_b,
+                           var,
+                           c_weight[0],
+                           cpl[0],
+                           grad);
+
+  BFT_FREE(var);
+  BFT_FREE(bc_coeff_b);
+  BFT_FREE(bc_coeff_a);
+  BFT_FREE(var_name);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -793,6 +1289,7 @@ cs_field_gradient_vector(const cs_field_t          *f,
                              &gradient_type,
                              &halo_type);
 
+  int w_stride = 1;
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
@@ -805,6 +1302,7 @@ cs_field_gradient_vector(const cs_field_t          *f,
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
         c_weight = f_weight->val;
+        w_stride = f_weight->dim;
       }
     }
 
@@ -839,6 +1337,22 @@ cs_field_gradient_vector(const cs_field_t          *f,
     }
   }
 
+  /* Reuse gradient if field values and BC's have not changed */
+
+  const bool use_cache = (_gradient_cache_active(f) && cpl == NULL);
+  uint64_t hash = 0;
+
+  if (use_cache) {
+    hash = _gradient_cache_hash(3, 9,
+                                (const cs_real_t *)bc_coeff_a,
+                                (const cs_real_t *)bc_coeff_b,
+                                w_stride, c_weight);
+    if (_gradient_cache_get(f, use_previous_t, inc, 9,
+                            gradient_type, halo_type, eqp, hash,
+                            (cs_real_t *)grad))
+      return;
+  }
+
   cs_gradient_vector(f->name,
                      gradient_type,
                      halo_type,
@@ -854,6 +1368,11 @@ cs_field_gradient_vector(const cs_field_t          *f,
                      c_weight,
                      cpl,
                      grad);
+
+  if (use_cache)
+    _gradient_cache_add(f, use_previous_t, inc, 9,
+                        gradient_type, halo_type, eqp, hash,
+                        (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -913,6 +1432,22 @@ cs_field_gradient_tensor(const cs_field_t          *f,
     }
   }
 
+  /* Reuse gradient if field values and BC's have not changed */
+
+  const bool use_cache = _gradient_cache_active(f);
+  uint64_t hash = 0;
+
+  if (use_cache) {
+    hash = _gradient_cache_hash(6, 36,
+                                (const cs_real_t *)bc_coeff_a,
+                                (const cs_real_t *)bc_coeff_b,
+                                0, NULL);
+    if (_gradient_cache_get(f, use_previous_t, inc, 18,
+                            gradient_type, halo_type, eqp, hash,
+                            (cs_real_t *)grad))
+      return;
+  }
+
   cs_gradient_tensor(f->name,
                      gradient_type,
                      halo_type,
@@ -926,6 +1461,71 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                      bc_coeff_b,
                      var,
                      grad);
+
+  if (use_cache)
+    _gradient_cache_add(f, use_previous_t, inc, 18,
+                        gradient_type, halo_type, eqp, hash,
+                        (const cs_real_t *)grad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of cached field gradients.
+ *
+ * When active, gradients computed by \ref cs_field_gradient_scalar,
+ * \ref cs_field_gradient_vector, and \ref cs_field_gradient_tensor
+ * for variable fields are kept, and reused as long as the field version,
+ * time step, gradient options, boundary condition coefficients
+ * and gradient weights are unchanged.
+ *
+ * Code modifying variable field values outside the solver should call
+ * \ref cs_field_increment_version when this cache is used.
+ *
+ * The cache is disabled by default (0 entries).
+ *
+ * \param[in]  n_max  maximum number of cached gradients (0 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_set_max(int  n_max)
+{
+  _n_grad_cache_max = CS_MAX(n_max, 0);
+
+  if (_n_grad_cache > _n_grad_cache_max)
+    cs_field_gradient_cache_clear();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum number of cached field gradients.
+ *
+ * \return  maximum number of cached gradients (0 if disabled)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_field_gradient_cache_get_max(void)
+{
+  return _n_grad_cache_max;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all cached field gradients.
+ *
+ * This should be called when mesh quantities are modified.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_clear(void)
+{
+  for (int i = 0; i < _n_grad_cache; i++)
+    BFT_FREE(_grad_cache[i].grad);
+
+  BFT_FREE(_grad_cache);
+  _n_grad_cache = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -81,6 +81,30 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                          bool                       recompute_cocg,
                          cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalar fields.
+ *
+ * If all fields share the same gradient options, gradients are computed
+ * together (see cs_gradient_scalar_multi); otherwise,
+ * cs_field_gradient_scalar is called for each field.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f              <-- pointer to fields
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   grad           --> gradient, for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                  n_fields,
+                               const cs_field_t    *f[],
+                               bool                 use_previous_t,
+                               int                  inc,
+                               bool                 recompute_cocg,
+                               cs_real_3_t         *grad[]);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
@@ -137,6 +161,39 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                          int                        inc,
                          cs_real_63_t     *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Set the maximum number of cached field gradients.
+ *
+ * When active, gradients of variable fields are reused as long as the
+ * field version, time step, gradient options, boundary condition
+ * coefficients and gradient weights are unchanged.
+ *
+ * parameters:
+ *   n_max <-- maximum number of cached gradients (0 to disable)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_set_max(int  n_max);
+
+/*----------------------------------------------------------------------------
+ * Return the maximum number of cached field gradients.
+ *
+ * returns:
+ *   maximum number of cached gradients (0 if disabled)
+ *----------------------------------------------------------------------------*/
+
+int
+cs_field_gradient_cache_get_max(void);
+
+/*----------------------------------------------------------------------------
+ * Free all cached field gradients.
+ *
+ * This should be called when mesh quantities are modified.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_clear(void);
+
 /*----------------------------------------------------------------------------
  * Interpolate field values at a given set of points.
  *
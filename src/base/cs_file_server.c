@@ -0,0 +1,961 @@
+/*============================================================================
+ * Asynchronous file output through dedicated I/O server ranks.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_log.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_file_server.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional Doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_file_server.c
+        Asynchronous file output through dedicated I/O server ranks.
+
+  When the last ranks of the application are reserved as I/O servers
+  (using the --io-servers command-line option), compute ranks may ship
+  output data to those servers using nonblocking messages and continue
+  computing, while the servers handle redistribution of data to a
+  block distribution and the actual file writes.
+
+  The protocol is simple: rank 0 of the compute ranks sends a stream
+  of commands to all servers, and for partitioned data, each compute
+  rank sends to each server the values it owns in that server's block.
+  As all compute ranks issue the same sequence of calls, and MPI
+  guarantees message ordering between a given pair of ranks, servers
+  simply process commands in order.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/* Message tags */
+
+#define _CS_FILE_SERVER_TAG_CMD   631
+#define _CS_FILE_SERVER_TAG_DATA  632
+
+/* Maximum size of pending (not yet completed) sends before
+   waiting for completion */
+
+#define _CS_FILE_SERVER_MAX_PENDING_SIZE  (512*1024*1024)
+
+/* Maximum size of a single MPI message (larger buffers are sent in
+   several chunks, as MPI counts are limited to int) */
+
+#define _CS_FILE_SERVER_MAX_MSG_SIZE  (1024*1024*1024)
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Command types */
+
+typedef enum {
+
+  _CMD_OPEN,
+  _CMD_WRITE_GLOBAL,
+  _CMD_WRITE_BLOCK,
+  _CMD_CLOSE,
+  _CMD_SYNC,
+  _CMD_STOP
+
+} _cmd_type_t;
+
+/* Command header (followed by payload) */
+
+typedef struct {
+
+  cs_gnum_t   type;         /* Command type */
+  cs_gnum_t   flags;        /* Open mode and endianness, or interlace */
+  cs_gnum_t   n;            /* Number of items (or global entities) */
+  cs_gnum_t   size;         /* Size of each item */
+  cs_gnum_t   stride;       /* Number of values per entity */
+
+} _cmd_header_t;
+
+/* Pending send */
+
+typedef struct {
+
+  int              n_requests;  /* Number of associated MPI requests
+                                   (one per message chunk) */
+  MPI_Request     *requests;    /* Associated MPI requests */
+  unsigned char   *buffer;      /* Associated buffer */
+  size_t           size;        /* Associated buffer size */
+
+} _pending_send_t;
+
+#endif /* defined(HAVE_MPI) */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+static bool       _finalized = false;
+static MPI_Comm   _parent_comm = MPI_COMM_NULL;
+static int        _n_servers = 0;
+static int        _n_compute_ranks = 0;
+static int        _compute_rank = -1;
+
+/* Pending sends */
+
+static int               _n_pending = 0;
+static int               _n_pending_max = 0;
+static size_t            _pending_size = 0;
+static _pending_send_t  *_pending = NULL;
+
+/* Statistics */
+
+static unsigned long       _n_calls[2] = {0, 0};
+static size_t              _sent_size = 0;
+static cs_timer_counter_t  _timers[2];
+
+#endif /* defined(HAVE_MPI) */
+
+/*============================================================================
+ * Local function defintions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Initialize compute-side data if needed.
+ *
+ * returns:
+ *   true if servers are available, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_initialize(void)
+{
+  if (_n_servers > 0)
+    return true;
+  else if (_finalized)
+    return false;
+
+  MPI_Comm parent_comm = MPI_COMM_NULL;
+  int n_servers = 0;
+
+  bool is_server = cs_base_get_io_server_info(&parent_comm, &n_servers);
+
+  if (is_server || n_servers < 1 || parent_comm == MPI_COMM_NULL)
+    return false;
+
+  int parent_size;
+  MPI_Comm_size(parent_comm, &parent_size);
+  MPI_Comm_rank(parent_comm, &_compute_rank);
+
+  _parent_comm = parent_comm;
+  _n_servers = n_servers;
+  _n_compute_ranks = parent_size - n_servers;
+
+  CS_TIMER_COUNTER_INIT(_timers[0]);
+  CS_TIMER_COUNTER_INIT(_timers[1]);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Free buffers of completed sends.
+ *
+ * parameters:
+ *   max_size <-- wait for completion of oldest sends until the pending
+ *                size is not larger than this
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_pending(size_t  max_size)
+{
+  int i, j;
+
+  /* Wait for oldest messages if needed */
+
+  for (i = 0; i < _n_pending && _pending_size > max_size; i++) {
+    MPI_Waitall(_pending[i].n_requests, _pending[i].requests,
+                MPI_STATUSES_IGNORE);
+    BFT_FREE(_pending[i].requests);
+    BFT_FREE(_pending[i].buffer);
+    _pending_size -= _pending[i].size;
+  }
+
+  /* Check for other completed messages */
+
+  for (; i < _n_pending; i++) {
+    int flag = 0;
+    MPI_Testall(_pending[i].n_requests, _pending[i].requests,
+                &flag, MPI_STATUSES_IGNORE);
+    if (flag) {
+      BFT_FREE(_pending[i].requests);
+      BFT_FREE(_pending[i].buffer);
+      _pending_size -= _pending[i].size;
+    }
+  }
+
+  /* Compact list */
+
+  for (i = 0, j = 0; i < _n_pending; i++) {
+    if (_pending[i].buffer != NULL) {
+      _pending[j] = _pending[i];
+      j++;
+    }
+  }
+
+  _n_pending = j;
+}
+
+/*----------------------------------------------------------------------------
+ * Send a buffer to a given rank of the parent communicator, without waiting.
+ *
+ * The buffer is owned and freed by this module.
+ *
+ * Buffers are sent as a sequence of messages of _CS_FILE_SERVER_MAX_MSG_SIZE
+ * bytes, terminated by a (possibly empty) smaller message, so that sizes
+ * are not limited by the int type of MPI counts (see _recv).
+ *
+ * parameters:
+ *   buffer <-- buffer to send
+ *   size   <-- buffer size
+ *   dest   <-- destination rank in parent communicator
+ *   tag    <-- message tag
+ *----------------------------------------------------------------------------*/
+
+static void
+_send(unsigned char  *buffer,
+      size_t          size,
+      int             dest,
+      int             tag)
+{
+  if (_n_pending >= _n_pending_max) {
+    _n_pending_max = CS_MAX(_n_pending_max*2, 16);
+    BFT_REALLOC(_pending, _n_pending_max, _pending_send_t);
+  }
+
+  _pending_send_t *p = _pending + _n_pending;
+
+  const size_t max_msg_size = _CS_FILE_SERVER_MAX_MSG_SIZE;
+
+  p->n_requests = size / max_msg_size + 1;
+  p->buffer = buffer;
+  p->size = size;
+  BFT_MALLOC(p->requests, p->n_requests, MPI_Request);
+
+  for (int i = 0; i < p->n_requests; i++) {
+    size_t offset = (size_t)i * max_msg_size;
+    int count = (int)(CS_MIN(size - offset, max_msg_size));
+    MPI_Isend(buffer + offset, count, MPI_BYTE, dest, tag, _parent_comm,
+              p->requests + i);
+  }
+
+  _n_pending += 1;
+  _pending_size += size;
+  _sent_size += size;
+}
+
+/*----------------------------------------------------------------------------
+ * Send a command from compute rank 0 to all servers.
+ *
+ * parameters:
+ *   h            <-- command header
+ *   payload      <-- associated payload, or NULL
+ *   payload_size <-- associated payload size
+ *----------------------------------------------------------------------------*/
+
+static void
+_send_command(const _cmd_header_t  *h,
+              const void           *payload,
+              size_t                payload_size)
+{
+  if (_compute_rank != 0)
+    return;
+
+  size_t size = sizeof(_cmd_header_t) + payload_size;
+
+  for (int i = 0; i < _n_servers; i++) {
+    unsigned char *buffer;
+    BFT_MALLOC(buffer, size, unsigned char);
+    memcpy(buffer, h, sizeof(_cmd_header_t));
+    if (payload_size > 0)
+      memcpy(buffer + sizeof(_cmd_header_t), payload, payload_size);
+    _send(buffer, size, _n_compute_ranks + i, _CS_FILE_SERVER_TAG_CMD);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Receive a message of unknown size from a given source.
+ *
+ * The message may be split in several chunks (see _send); chunks are
+ * received until one smaller than _CS_FILE_SERVER_MAX_MSG_SIZE arrives.
+ *
+ * parameters:
+ *   source <-- source rank in parent communicator
+ *   tag    <-- message tag
+ *   comm   <-- parent communicator
+ *   size   --> received message size
+ *
+ * returns:
+ *   newly allocated buffer with received message
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_recv(int        source,
+      int        tag,
+      MPI_Comm   comm,
+      size_t    *size)
+{
+  const size_t max_msg_size = _CS_FILE_SERVER_MAX_MSG_SIZE;
+
+  int count = 0;
+  size_t _size = 0;
+  MPI_Status status;
+  unsigned char *buffer = NULL;
+
+  do {
+
+    MPI_Probe(source, tag, comm, &status);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+
+    BFT_REALLOC(buffer, CS_MAX(_size + count, 1), unsigned char);
+    MPI_Recv(buffer + _size, count, MPI_BYTE, source, tag, comm,
+             MPI_STATUS_IGNORE);
+
+    _size += count;
+
+  } while ((size_t)count >= max_msg_size);
+
+  *size = _size;
+
+  return buffer;
+}
+
+/*----------------------------------------------------------------------------
+ * Server-side handling of a block write command.
+ *
+ * parameters:
+ *   h               <-- command header
+ *   f               <-> current file
+ *   parent_comm     <-- parent communicator
+ *   n_compute_ranks <-- number of compute ranks
+ *   server_rank     <-- rank id among servers
+ *   n_servers       <-- number of servers
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_write_block(const _cmd_header_t  *h,
+                    cs_file_t            *f,
+                    MPI_Comm              parent_comm,
+                    int                   n_compute_ranks,
+                    int                   server_rank,
+                    int                   n_servers)
+{
+  const cs_gnum_t n_g_ents = h->n;
+  const size_t size = h->size;
+  const size_t stride = h->stride;
+  const cs_interlace_t interlace = h->flags;
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(server_rank,
+                                                        n_servers,
+                                                        1,
+                                                        0,
+                                                        n_g_ents);
+
+  const cs_gnum_t gnum_start = bi.gnum_range[0];
+  const cs_gnum_t gnum_end = bi.gnum_range[1];
+  const size_t n_block_ents = gnum_end - gnum_start;
+
+  const size_t v_size = size*stride;
+
+  unsigned char *block_values;
+  BFT_MALLOC(block_values, n_block_ents*v_size + 1, unsigned char);
+  memset(block_values, 0, n_block_ents*v_size + 1);
+
+  /* Receive and place values from each compute rank */
+
+  for (int r = 0; r < n_compute_ranks; r++) {
+
+    size_t msg_size = 0;
+    unsigned char *msg = _recv(r, _CS_FILE_SERVER_TAG_DATA, parent_comm,
+                               &msg_size);
+
+    cs_gnum_t n_ents = 0;
+    memcpy(&n_ents, msg, sizeof(cs_gnum_t));
+
+    const unsigned char *g_p = msg + sizeof(cs_gnum_t);
+    const unsigned char *v_p = g_p + n_ents*sizeof(cs_gnum_t);
+
+    assert(msg_size == sizeof(cs_gnum_t)*(n_ents+1) + n_ents*v_size);
+
+    for (cs_gnum_t i = 0; i < n_ents; i++) {
+      cs_gnum_t g;
+      memcpy(&g, g_p + i*sizeof(cs_gnum_t), sizeof(cs_gnum_t));
+      assert(g >= gnum_start && g < gnum_end);
+      size_t id = g - gnum_start;
+      if (interlace == CS_INTERLACE)
+        memcpy(block_values + id*v_size, v_p + i*v_size, v_size);
+      else {
+        for (size_t j = 0; j < stride; j++)
+          memcpy(block_values + (j*n_block_ents + id)*size,
+                 v_p + i*v_size + j*size,
+                 size);
+      }
+    }
+
+    BFT_FREE(msg);
+
+  }
+
+  /* Now write values */
+
+  if (interlace == CS_INTERLACE)
+    cs_file_write_block_buffer(f, block_values, size, stride,
+                               gnum_start, gnum_end);
+  else {
+    for (size_t j = 0; j < stride; j++)
+      cs_file_write_block_buffer(f, block_values + j*n_block_ents*size,
+                                 size, 1,
+                                 gnum_start, gnum_end);
+  }
+
+  BFT_FREE(block_values);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the current rank is a dedicated I/O server rank.
+ *
+ * \return  true if the current rank is an I/O server, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_server_is_server(void)
+{
+  bool retval = false;
+
+#if defined(HAVE_MPI)
+  retval = cs_base_get_io_server_info(NULL, NULL);
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if output may be shipped to dedicated I/O server ranks
+ *        from the current (compute) rank.
+ *
+ * \return  true if I/O servers are available, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_server_is_active(void)
+{
+  bool retval = false;
+
+#if defined(HAVE_MPI)
+  retval = _initialize();
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run the I/O server loop.
+ *
+ * This function should only be called on I/O server ranks, and returns
+ * only once compute ranks have called \ref cs_file_server_finalize.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_run(void)
+{
+#if defined(HAVE_MPI)
+
+  MPI_Comm parent_comm = MPI_COMM_NULL;
+  int n_servers = 0, parent_size = 0, server_rank = 0;
+
+  if (cs_base_get_io_server_info(&parent_comm, &n_servers) == false)
+    return;
+
+  MPI_Comm_size(parent_comm, &parent_size);
+  MPI_Comm_rank(cs_glob_mpi_comm, &server_rank);
+
+  const int n_compute_ranks = parent_size - n_servers;
+
+  cs_file_t *f = NULL;
+  bool running = true;
+
+  while (running) {
+
+    size_t msg_size = 0;
+    unsigned char *msg = _recv(0, _CS_FILE_SERVER_TAG_CMD, parent_comm,
+                               &msg_size);
+
+    _cmd_header_t h;
+    memcpy(&h, msg, sizeof(_cmd_header_t));
+
+    const unsigned char *payload = msg + sizeof(_cmd_header_t);
+
+    switch(h.type) {
+
+    case _CMD_OPEN:
+      {
+        cs_file_access_t method;
+        MPI_Info hints;
+        cs_file_mode_t mode = h.flags & 0xff;
+        cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+        if (f != NULL)
+          f = cs_file_free(f);
+        f = cs_file_open((const char *)payload,
+                         mode,
+                         method,
+                         hints,
+                         cs_glob_mpi_comm,
+                         cs_glob_mpi_comm);
+        if (h.flags >> 8)
+          cs_file_set_swap_endian(f, 1);
+      }
+      break;
+
+    case _CMD_WRITE_GLOBAL:
+      assert(f != NULL);
+      cs_file_write_global(f, payload, h.size, h.n);
+      break;
+
+    case _CMD_WRITE_BLOCK:
+      assert(f != NULL);
+      _server_write_block(&h, f, parent_comm, n_compute_ranks,
+                          server_rank, n_servers);
+      break;
+
+    case _CMD_CLOSE:
+      if (f != NULL)
+        f = cs_file_free(f);
+      break;
+
+    case _CMD_SYNC:
+      MPI_Barrier(parent_comm);
+      break;
+
+    case _CMD_STOP:
+      running = false;
+      break;
+
+    default:
+      bft_error(__FILE__, __LINE__, 0,
+                _("I/O server received unknown command %d."), (int)(h.type));
+
+    }
+
+    BFT_FREE(msg);
+  }
+
+  if (f != NULL)
+    f = cs_file_free(f);
+
+  /* Synchronize with compute ranks before leaving */
+
+  MPI_Barrier(parent_comm);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete pending output operations and stop I/O servers.
+ *
+ * This function is collective on compute ranks, and has no effect
+ * if no I/O servers are active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_finalize(void)
+{
+#if defined(HAVE_MPI)
+
+  if (_initialize() == false)
+    return;
+
+  _cmd_header_t h = {_CMD_STOP, 0, 0, 0, 0};
+  _send_command(&h, NULL, 0);
+
+  cs_timer_t t0 = cs_timer_time();
+
+  _update_pending(0);
+  BFT_FREE(_pending);
+  _n_pending_max = 0;
+
+  MPI_Barrier(_parent_comm);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(_timers[1]), &t0, &t1);
+
+  /* Log statistics */
+
+  double wtimes[2], wtimes_max[2];
+  unsigned long long sent_size = _sent_size, sent_size_sum = _sent_size;
+  for (int i = 0; i < 2; i++)
+    wtimes[i] = (_timers[i]).nsec*1e-9;
+
+  MPI_Allreduce(wtimes, wtimes_max, 2, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+  MPI_Allreduce(&sent_size, &sent_size_sum, 1, MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM, cs_glob_mpi_comm);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nOutput through dedicated I/O servers:\n\n"
+                  "  Number of I/O server ranks:      %d\n"
+                  "  Files written:                   %lu\n"
+                  "  Partitioned data writes:         %lu\n"
+                  "  Data shipped to servers:         %12.3f MiB\n"
+                  "  Max. time shipping data:         %12.5f s\n"
+                  "  Max. time waiting for servers:   %12.5f s\n"),
+                _n_servers, _n_calls[0], _n_calls[1],
+                (double)sent_size_sum / (1024.*1024.),
+                wtimes_max[0], wtimes_max[1]);
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  _n_servers = 0;
+  _parent_comm = MPI_COMM_NULL;
+  _finalized = true;
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open a file on the I/O servers.
+ *
+ * Only one server-side file may be open at a given time. This function
+ * is collective on compute ranks, but returns without waiting.
+ *
+ * \param[in]  name         file name
+ * \param[in]  mode         file access mode (write or append)
+ * \param[in]  swap_endian  if true, swap data endianness on output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_open(const char      *name,
+                    cs_file_mode_t   mode,
+                    bool             swap_endian)
+{
+#if defined(HAVE_MPI)
+
+  if (_initialize() == false)
+    return;
+
+  assert(mode != CS_FILE_MODE_READ);
+
+  cs_timer_t t0 = cs_timer_time();
+
+  _cmd_header_t h = {_CMD_OPEN, 0, 0, 0, 0};
+  h.flags = mode | ((swap_endian) ? (1 << 8) : 0);
+
+  _send_command(&h, name, strlen(name) + 1);
+
+  _update_pending(_CS_FILE_SERVER_MAX_PENDING_SIZE);
+
+  _n_calls[0] += 1;
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(_timers[0]), &t0, &t1);
+
+#else
+
+  CS_UNUSED(name);
+  CS_UNUSED(mode);
+  CS_UNUSED(swap_endian);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write global data to the current server-side file.
+ *
+ * Data is provided by rank 0 only, but this function is collective
+ * on compute ranks.
+ *
+ * \param[in]  buf   pointer to data to write (used on rank 0 only)
+ * \param[in]  size  size of each item of data in bytes
+ * \param[in]  ni    number of items to write
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_write_global(const void  *buf,
+                            size_t       size,
+                            size_t       ni)
+{
+#if defined(HAVE_MPI)
+
+  if (_initialize() == false)
+    return;
+
+  _cmd_header_t h = {_CMD_WRITE_GLOBAL, 0, ni, size, 1};
+
+  _send_command(&h, buf, size*ni);
+
+#else
+
+  CS_UNUSED(buf);
+  CS_UNUSED(size);
+  CS_UNUSED(ni);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write partitioned data to the current server-side file.
+ *
+ * Each compute rank provides values for the entities it owns, with
+ * their global numbers; redistribution to a block distribution and
+ * ordering are handled by the servers, and this function returns
+ * without waiting for the data to be written.
+ *
+ * With non-interlaced output, all values of a given component are
+ * written before those of the next component.
+ *
+ * \param[in]  n_g_ents   global number of entities
+ * \param[in]  size       size of each value in bytes
+ * \param[in]  stride     number of values per entity
+ * \param[in]  interlace  output interlace mode
+ * \param[in]  n_ents     local number of entities
+ * \param[in]  gnum       global number of local entities (1 to n)
+ * \param[in]  values     interlaced local values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_write_block(cs_gnum_t         n_g_ents,
+                           size_t            size,
+                           int               stride,
+                           cs_interlace_t    interlace,
+                           cs_lnum_t         n_ents,
+                           const cs_gnum_t   gnum[],
+                           const void       *values)
+{
+#if defined(HAVE_MPI)
+
+  if (_initialize() == false)
+    return;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  _cmd_header_t h = {_CMD_WRITE_BLOCK, interlace, n_g_ents, size, stride};
+
+  _send_command(&h, NULL, 0);
+
+  /* Block size is identical for all servers */
+
+  const cs_block_dist_info_t bi
+    = cs_block_dist_compute_sizes(0, _n_servers, 1, 0, n_g_ents);
+  const cs_gnum_t block_size = CS_MAX(bi.block_size, 1);
+
+  const size_t v_size = size*stride;
+  const unsigned char *_values = values;
+
+  /* Count values per server */
+
+  cs_gnum_t *send_count;
+  BFT_MALLOC(send_count, _n_servers, cs_gnum_t);
+
+  for (int i = 0; i < _n_servers; i++)
+    send_count[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_ents; i++) {
+    int s_id = (gnum[i] - 1) / block_size;
+    send_count[s_id] += 1;
+  }
+
+  /* Pack and send buffers; empty messages are also sent, as servers
+     expect a message from each compute rank */
+
+  unsigned char **send_buf;
+  cs_gnum_t *send_shift;
+  BFT_MALLOC(send_buf, _n_servers, unsigned char *);
+  BFT_MALLOC(send_shift, _n_servers, cs_gnum_t);
+
+  for (int i = 0; i < _n_servers; i++) {
+    size_t buf_size = (send_count[i] + 1)*sizeof(cs_gnum_t)
+                      + send_count[i]*v_size;
+    BFT_MALLOC(send_buf[i], buf_size, unsigned char);
+    memcpy(send_buf[i], send_count + i, sizeof(cs_gnum_t));
+    send_shift[i] = 0;
+  }
+
+  for (cs_lnum_t i = 0; i < n_ents; i++) {
+    int s_id = (gnum[i] - 1) / block_size;
+    cs_gnum_t j = send_shift[s_id];
+    unsigned char *g_p = send_buf[s_id] + sizeof(cs_gnum_t);
+    unsigned char *v_p = g_p + send_count[s_id]*sizeof(cs_gnum_t);
+    memcpy(g_p + j*sizeof(cs_gnum_t), gnum + i, sizeof(cs_gnum_t));
+    memcpy(v_p + j*v_size, _values + i*v_size, v_size);
+    send_shift[s_id] += 1;
+  }
+
+  for (int i = 0; i < _n_servers; i++) {
+    size_t buf_size = (send_count[i] + 1)*sizeof(cs_gnum_t)
+                      + send_count[i]*v_size;
+    _send(send_buf[i], buf_size, _n_compute_ranks + i,
+          _CS_FILE_SERVER_TAG_DATA);
+  }
+
+  BFT_FREE(send_shift);
+  BFT_FREE(send_buf);
+  BFT_FREE(send_count);
+
+  _update_pending(_CS_FILE_SERVER_MAX_PENDING_SIZE);
+
+  _n_calls[1] += 1;
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(_timers[0]), &t0, &t1);
+
+#else
+
+  CS_UNUSED(n_g_ents);
+  CS_UNUSED(size);
+  CS_UNUSED(stride);
+  CS_UNUSED(interlace);
+  CS_UNUSED(n_ents);
+  CS_UNUSED(gnum);
+  CS_UNUSED(values);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close the current server-side file.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_close(void)
+{
+#if defined(HAVE_MPI)
+
+  if (_initialize() == false)
+    return;
+
+  _cmd_header_t h = {_CMD_CLOSE, 0, 0, 0, 0};
+
+  _send_command(&h, NULL, 0);
+
+  _update_pending(_CS_FILE_SERVER_MAX_PENDING_SIZE);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait until I/O servers have completed all previous operations.
+ *
+ * This allows files written through the servers to be accessed directly
+ * (for example, to append data using the standard output path).
+ * This function is collective on compute ranks, and has no effect
+ * if no I/O servers are active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_sync(void)
+{
+#if defined(HAVE_MPI)
+
+  if (_initialize() == false)
+    return;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  _cmd_header_t h = {_CMD_SYNC, 0, 0, 0, 0};
+
+  _send_command(&h, NULL, 0);
+
+  _update_pending(0);
+
+  MPI_Barrier(_parent_comm);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(_timers[1]), &t0, &t1);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
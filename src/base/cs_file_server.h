@@ -0,0 +1,193 @@
+#ifndef __CS_FILE_SERVER_H__
+#define __CS_FILE_SERVER_H__
+
+/*============================================================================
+ * Asynchronous file output through dedicated I/O server ranks.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_file.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the current rank is a dedicated I/O server rank.
+ *
+ * \return  true if the current rank is an I/O server, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_server_is_server(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if output may be shipped to dedicated I/O server ranks
+ *        from the current (compute) rank.
+ *
+ * \return  true if I/O servers are available, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_server_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run the I/O server loop.
+ *
+ * This function should only be called on I/O server ranks, and returns
+ * only once compute ranks have called \ref cs_file_server_finalize.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_run(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete pending output operations and stop I/O servers.
+ *
+ * This function is collective on compute ranks, and has no effect
+ * if no I/O servers are active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open a file on the I/O servers.
+ *
+ * Only one server-side file may be open at a given time. This function
+ * is collective on compute ranks, but returns without waiting.
+ *
+ * \param[in]  name         file name
+ * \param[in]  mode         file access mode (write or append)
+ * \param[in]  swap_endian  if true, swap data endianness on output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_open(const char      *name,
+                    cs_file_mode_t   mode,
+                    bool             swap_endian);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write global data to the current server-side file.
+ *
+ * Data is provided by rank 0 only, but this function is collective
+ * on compute ranks.
+ *
+ * \param[in]  buf   pointer to data to write (used on rank 0 only)
+ * \param[in]  size  size of each item of data in bytes
+ * \param[in]  ni    number of items to write
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_write_global(const void  *buf,
+                            size_t       size,
+                            size_t       ni);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write partitioned data to the current server-side file.
+ *
+ * Each compute rank provides values for the entities it owns, with
+ * their global numbers; redistribution to a block distribution and
+ * ordering are handled by the servers, and this function returns
+ * without waiting for the data to be written.
+ *
+ * With non-interlaced output, all values of a given component are
+ * written before those of the next component.
+ *
+ * \param[in]  n_g_ents   global number of entities
+ * \param[in]  size       size of each value in bytes
+ * \param[in]  stride     number of values per entity
+ * \param[in]  interlace  output interlace mode
+ * \param[in]  n_ents     local number of entities
+ * \param[in]  gnum       global number of local entities (1 to n)
+ * \param[in]  values     interlaced local values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_write_block(cs_gnum_t         n_g_ents,
+                           size_t            size,
+                           int               stride,
+                           cs_interlace_t    interlace,
+                           cs_lnum_t         n_ents,
+                           const cs_gnum_t   gnum[],
+                           const void       *values);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close the current server-side file.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_close(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait until I/O servers have completed all previous operations.
+ *
+ * This function is collective on compute ranks, and has no effect
+ * if no I/O servers are active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_server_sync(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_FILE_SERVER_H__ */
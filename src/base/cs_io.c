@@ -57,6 +57,7 @@
 #include "bft_printf.h"
 
 #include "cs_base.h"
+#include "cs_compress.h"
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_file.h"
@@ -110,7 +111,8 @@ typedef struct {
    *   5: index of embedded data in data array + 1 if data is
    *      embedded, 0 otherwise
    *   6: datatype id in file
-   *   7: associated file id (in case of multiple files)
+   *   7: index of compressed chunk directory in data array + 1 if
+   *      section is compressed, 0 otherwise
    */
 
   cs_file_off_t  *h_vals;            /* Base values associated
@@ -163,6 +165,18 @@ struct _cs_io_t {
   void               *data;           /* Pointer to data in section header
                                          (if embedded; NULL otherwise) */
 
+  size_t              n_c_chunks;     /* Number of compressed chunks in
+                                         section (0 if not compressed) */
+  size_t              c_dir_size;     /* Allocated size of c_dir */
+  cs_file_off_t      *c_dir;          /* Past-the-end location number and
+                                         past-the-end byte offset (relative
+                                         to body start) of each chunk */
+
+  /* Compression options (for output) */
+
+  cs_compress_type_t  compression;    /* Compression type */
+  double              error_bound;    /* Quantization error bound */
+
   /* Other flags */
 
   long                echo;           /* Data echo level (verbosity) */
@@ -180,6 +194,12 @@ struct _cs_io_t {
 
 #define CS_IO_MPI_TAG     'C'+'S'+'_'+'I'+'O'
 
+/* Maximum uncompressed size of compressed section chunks, and minimum
+   section size for compression */
+
+#define CS_IO_COMPRESS_CHUNK_SIZE  (1024*1024)
+#define CS_IO_COMPRESS_MIN_SIZE    4096
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -410,6 +430,13 @@ _cs_io_create(cs_io_mode_t   mode,
   cs_io->type_name = NULL;
   cs_io->data = NULL;
 
+  cs_io->n_c_chunks = 0;
+  cs_io->c_dir_size = 0;
+  cs_io->c_dir = NULL;
+
+  cs_io->compression = CS_COMPRESS_NONE;
+  cs_io->error_bound = 0.;
+
   /* Verbosity and logging */
 
   cs_io->echo = echo;
@@ -423,6 +450,56 @@ _cs_io_create(cs_io_mode_t   mode,
   return cs_io;
 }
 
+/*----------------------------------------------------------------------------
+ * Resize a kernel IO structure's compressed chunk directory.
+ *
+ * parameters:
+ *   inp      <-> kernel IO structure
+ *   n_chunks <-- number of compressed chunks
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_c_dir_size(cs_io_t  *inp,
+                size_t    n_chunks)
+{
+  inp->n_c_chunks = n_chunks;
+
+  if (2*n_chunks > inp->c_dir_size) {
+    inp->c_dir_size = 2*n_chunks;
+    BFT_REALLOC(inp->c_dir, inp->c_dir_size, cs_file_off_t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the global number of the first location of a compressed chunk.
+ *
+ * parameters:
+ *   inp <-- kernel IO structure
+ *   c   <-- chunk id (n_c_chunks for past-the-end value)
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_c_loc_start(const cs_io_t  *inp,
+             size_t          c)
+{
+  return (c == 0) ? 1 : inp->c_dir[2*(c-1)];
+}
+
+/*----------------------------------------------------------------------------
+ * Return the byte offset (relative to body start) of a compressed chunk.
+ *
+ * parameters:
+ *   inp <-- kernel IO structure
+ *   c   <-- chunk id (n_c_chunks for past-the-end value)
+ *----------------------------------------------------------------------------*/
+
+static inline cs_file_off_t
+_c_byte_start(const cs_io_t  *inp,
+              size_t          c)
+{
+  return (c == 0) ? 0 : inp->c_dir[2*(c-1) + 1];
+}
+
 /*----------------------------------------------------------------------------
  * Add an empty index structure to a cs_io_t structure.
  *
@@ -442,7 +519,7 @@ _create_index(cs_io_t *inp)
   idx->size = 0;
   idx->max_size = 32;
 
-  BFT_MALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+  BFT_MALLOC(idx->h_vals, idx->max_size*8, cs_file_off_t);
   BFT_MALLOC(idx->offset, idx->max_size, cs_file_off_t);
 
   idx->max_names_size = 256;
@@ -513,7 +590,7 @@ _update_index_and_shift(cs_io_t             *inp,
       idx->max_size = 32;
     else
       idx->max_size *= 2;
-    BFT_REALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+    BFT_REALLOC(idx->h_vals, idx->max_size*8, cs_file_off_t);
     BFT_REALLOC(idx->offset, idx->max_size, cs_file_off_t);
   };
 
@@ -523,6 +600,9 @@ _update_index_and_shift(cs_io_t             *inp,
     new_data_size
       = idx->data_size + (  inp->n_vals
                           * cs_datatype_size[header->type_read]);
+  else if (inp->n_c_chunks > 0)
+    new_data_size
+      = idx->data_size + (1 + 2*inp->n_c_chunks)*sizeof(cs_file_off_t);
 
   if (new_names_size > idx->max_names_size) {
     if (idx->max_names_size == 0)
@@ -544,13 +624,14 @@ _update_index_and_shift(cs_io_t             *inp,
 
   id = idx->size;
 
-  idx->h_vals[id*7]     = inp->n_vals;
-  idx->h_vals[id*7 + 1] = inp->location_id;
-  idx->h_vals[id*7 + 2] = inp->index_id;
-  idx->h_vals[id*7 + 3] = inp->n_loc_vals;
-  idx->h_vals[id*7 + 4] = idx->names_size;
-  idx->h_vals[id*7 + 5] = 0;
-  idx->h_vals[id*7 + 6] = header->type_read;
+  idx->h_vals[id*8]     = inp->n_vals;
+  idx->h_vals[id*8 + 1] = inp->location_id;
+  idx->h_vals[id*8 + 2] = inp->index_id;
+  idx->h_vals[id*8 + 3] = inp->n_loc_vals;
+  idx->h_vals[id*8 + 4] = idx->names_size;
+  idx->h_vals[id*8 + 5] = 0;
+  idx->h_vals[id*8 + 6] = header->type_read;
+  idx->h_vals[id*8 + 7] = 0;
 
   strcpy(idx->names + idx->names_size, inp->sec_name);
   idx->names[new_names_size - 1] = '\0';
@@ -565,10 +646,22 @@ _update_index_and_shift(cs_io_t             *inp,
     }
     else
       idx->offset[id] = offset;
+    if (inp->n_c_chunks > 0) {
+      /* Save compressed chunk directory */
+      cs_file_off_t n_c_chunks = inp->n_c_chunks;
+      unsigned char *c_dir = idx->data + idx->data_size;
+      memcpy(c_dir, &n_c_chunks, sizeof(cs_file_off_t));
+      memcpy(c_dir + sizeof(cs_file_off_t),
+             inp->c_dir,
+             2*inp->n_c_chunks*sizeof(cs_file_off_t));
+      idx->h_vals[id*8 + 7] = idx->data_size + 1;
+      idx->data_size = new_data_size;
+      data_shift = _c_byte_start(inp, inp->n_c_chunks);
+    }
     cs_file_seek(inp->f, idx->offset[id] + data_shift, CS_FILE_SEEK_SET);
   }
   else {
-    idx->h_vals[id*7 + 5] = idx->data_size + 1;
+    idx->h_vals[id*8 + 5] = idx->data_size + 1;
     memcpy(idx->data + idx->data_size,
            inp->data,
            new_data_size - idx->data_size);
@@ -1259,6 +1352,272 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return the id of the first compressed chunk starting at or after
+ * a given location.
+ *
+ * parameters:
+ *   inp     <-- kernel IO structure
+ *   loc_num <-- global location number
+ *
+ * returns:
+ *   chunk id, or n_c_chunks if no chunk starts after loc_num
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_c_lower_bound(const cs_io_t  *inp,
+               cs_gnum_t       loc_num)
+{
+  size_t start_id = 0, end_id = inp->n_c_chunks;
+
+  while (start_id < end_id) {
+    size_t mid_id = (start_id + end_id) / 2;
+    if (_c_loc_start(inp, mid_id) < loc_num)
+      start_id = mid_id + 1;
+    else
+      end_id = mid_id;
+  }
+
+  return start_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Decompress a contiguous range of chunks of a compressed section.
+ *
+ * parameters:
+ *   inp       <-- kernel IO structure
+ *   type_read <-- datatype in file
+ *   stride    <-- number of values per location
+ *   c_first   <-- id of first chunk
+ *   c_last    <-- id of past-the-last chunk
+ *   c_buf     <-- compressed data, starting at first chunk
+ *   dest      --> decompressed data
+ *----------------------------------------------------------------------------*/
+
+static void
+_decode_chunks(const cs_io_t        *inp,
+               cs_datatype_t         type_read,
+               size_t                stride,
+               size_t                c_first,
+               size_t                c_last,
+               const unsigned char  *c_buf,
+               void                 *dest)
+{
+  const size_t loc_size = cs_datatype_size[type_read]*stride;
+  const cs_gnum_t loc_0 = _c_loc_start(inp, c_first);
+  const cs_file_off_t byte_0 = _c_byte_start(inp, c_first);
+
+  unsigned char *_dest = dest;
+
+# pragma omp parallel for schedule(dynamic) if (c_last - c_first > 1)
+  for (size_t c = c_first; c < c_last; c++) {
+    cs_gnum_t l_s = _c_loc_start(inp, c);
+    cs_gnum_t l_e = _c_loc_start(inp, c+1);
+    cs_file_off_t b_s = _c_byte_start(inp, c);
+    cs_file_off_t b_e = _c_byte_start(inp, c+1);
+    cs_compress_decode(type_read,
+                       (l_e - l_s)*stride,
+                       b_e - b_s,
+                       c_buf + (b_s - byte_0),
+                       _dest + (l_s - loc_0)*loc_size);
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Redistribute data between two contiguous block distributions.
+ *
+ * parameters:
+ *   comm       <-- associated MPI communicator
+ *   loc_size   <-- size of data per location, in bytes
+ *   src_range  <-- global location range of local source data
+ *   src        <-- local source data
+ *   dest_range <-- global location range of local destination data
+ *   dest       --> local destination data
+ *----------------------------------------------------------------------------*/
+
+static void
+_redistribute_block(MPI_Comm              comm,
+                    size_t                loc_size,
+                    const cs_gnum_t       src_range[2],
+                    const unsigned char  *src,
+                    const cs_gnum_t       dest_range[2],
+                    unsigned char        *dest)
+{
+  int n_ranks = 1;
+  MPI_Comm_size(comm, &n_ranks);
+
+  cs_gnum_t l_ranges[4] = {src_range[0], src_range[1],
+                           dest_range[0], dest_range[1]};
+  cs_gnum_t *g_ranges;
+  int *send_count, *send_shift, *recv_count, *recv_shift;
+
+  BFT_MALLOC(g_ranges, 4*n_ranks, cs_gnum_t);
+  BFT_MALLOC(send_count, n_ranks, int);
+  BFT_MALLOC(send_shift, n_ranks, int);
+  BFT_MALLOC(recv_count, n_ranks, int);
+  BFT_MALLOC(recv_shift, n_ranks, int);
+
+  MPI_Allgather(l_ranges, 4, CS_MPI_GNUM, g_ranges, 4, CS_MPI_GNUM, comm);
+
+  for (int i = 0; i < n_ranks; i++) {
+
+    cs_gnum_t s = CS_MAX(src_range[0], g_ranges[i*4 + 2]);
+    cs_gnum_t e = CS_MIN(src_range[1], g_ranges[i*4 + 3]);
+    send_count[i] = (e > s) ? (e - s)*loc_size : 0;
+    send_shift[i] = (e > s) ? (s - src_range[0])*loc_size : 0;
+
+    s = CS_MAX(dest_range[0], g_ranges[i*4]);
+    e = CS_MIN(dest_range[1], g_ranges[i*4 + 1]);
+    recv_count[i] = (e > s) ? (e - s)*loc_size : 0;
+    recv_shift[i] = (e > s) ? (s - dest_range[0])*loc_size : 0;
+
+  }
+
+  MPI_Alltoallv(src, send_count, send_shift, MPI_BYTE,
+                dest, recv_count, recv_shift, MPI_BYTE, comm);
+
+  BFT_FREE(recv_shift);
+  BFT_FREE(recv_count);
+  BFT_FREE(send_shift);
+  BFT_FREE(send_count);
+  BFT_FREE(g_ranges);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Read and decompress a compressed section body, replicated on all ranks.
+ *
+ * parameters:
+ *   inp       <-> input kernel IO structure
+ *   type_read <-- datatype in file
+ *   stride    <-- number of values per location
+ *   dest      --> decompressed data
+ *
+ * returns:
+ *   size of compressed data read, in bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_read_global_compressed(cs_io_t        *inp,
+                        cs_datatype_t   type_read,
+                        size_t          stride,
+                        void           *dest)
+{
+  unsigned char *c_buf = NULL;
+  size_t c_size = _c_byte_start(inp, inp->n_c_chunks);
+
+  BFT_MALLOC(c_buf, c_size, unsigned char);
+
+  size_t n_read = cs_file_read_global(inp->f, c_buf, 1, c_size);
+
+  if (n_read != c_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading %llu bytes from file \"%s\"."),
+              (unsigned long long)c_size, cs_file_get_name(inp->f));
+
+  _decode_chunks(inp, type_read, stride, 0, inp->n_c_chunks, c_buf, dest);
+
+  BFT_FREE(c_buf);
+
+  return c_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Read and decompress a compressed section body, assigning a different
+ * block to each rank.
+ *
+ * Each chunk is read and decompressed by the rank whose block contains
+ * the chunk's first location, and data is then redistributed so that
+ * each rank obtains the requested block.
+ *
+ * parameters:
+ *   inp              <-> input kernel IO structure
+ *   type_read        <-- datatype in file
+ *   stride           <-- number of values per location
+ *   global_num_start <-- global number of first block item
+ *   global_num_end   <-- global number of past-the end block item
+ *   dest             --> decompressed data
+ *
+ * returns:
+ *   size of compressed data read, in bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_read_block_compressed(cs_io_t        *inp,
+                       cs_datatype_t   type_read,
+                       size_t          stride,
+                       cs_gnum_t       global_num_start,
+                       cs_gnum_t       global_num_end,
+                       void           *dest)
+{
+  int n_ranks = 1;
+
+#if defined(HAVE_MPI)
+  if (inp->comm != MPI_COMM_NULL)
+    MPI_Comm_size(inp->comm, &n_ranks);
+#endif
+
+  const size_t loc_size = cs_datatype_size[type_read]*stride;
+
+  size_t c_first = _c_lower_bound(inp, global_num_start);
+  size_t c_last = _c_lower_bound(inp, global_num_end);
+
+  /* In serial mode, the chunk containing the first location is needed */
+
+  if (n_ranks == 1 && _c_loc_start(inp, c_first) > global_num_start)
+    c_first -= 1;
+
+  cs_file_off_t b_s = _c_byte_start(inp, c_first);
+  cs_file_off_t b_e = _c_byte_start(inp, c_last);
+  size_t c_size = b_e - b_s;
+
+  unsigned char *c_buf = NULL;
+  BFT_MALLOC(c_buf, c_size, unsigned char);
+
+  size_t n_read = cs_file_read_block(inp->f, c_buf, 1, 1, b_s + 1, b_e + 1);
+
+  if (n_read != c_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading %llu bytes from file \"%s\"."),
+              (unsigned long long)c_size, cs_file_get_name(inp->f));
+
+  /* Decompress local chunks */
+
+  cs_gnum_t src_range[2] = {_c_loc_start(inp, c_first),
+                            _c_loc_start(inp, c_last)};
+  cs_gnum_t dest_range[2] = {global_num_start, global_num_end};
+
+  unsigned char *d_buf = NULL;
+  BFT_MALLOC(d_buf, (src_range[1] - src_range[0])*loc_size, unsigned char);
+
+  _decode_chunks(inp, type_read, stride, c_first, c_last, c_buf, d_buf);
+
+  BFT_FREE(c_buf);
+
+  /* Extract or redistribute requested block */
+
+  if (n_ranks == 1) {
+    cs_gnum_t e = CS_MIN(dest_range[1], src_range[1]);
+    if (e > dest_range[0])
+      memcpy(dest,
+             d_buf + (dest_range[0] - src_range[0])*loc_size,
+             (e - dest_range[0])*loc_size);
+  }
+
+#if defined(HAVE_MPI)
+  else
+    _redistribute_block(inp->comm, loc_size,
+                        src_range, d_buf, dest_range, dest);
+#endif
+
+  BFT_FREE(d_buf);
+
+  return c_size;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1370,7 +1729,26 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
 
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
+    if (inp->n_c_chunks > 0) {
+      int t_id = (global_num_start > 0 && global_num_end > 0) ? 1 : 0;
+      size_t c_size = 0;
+      if (t_id == 1)
+        c_size = _read_block_compressed(inp,
+                                        header->type_read,
+                                        stride,
+                                        global_num_start,
+                                        global_num_end,
+                                        _buf);
+      else
+        c_size = _read_global_compressed(inp,
+                                         header->type_read,
+                                         stride,
+                                         _buf);
+      if (log != NULL)
+        log->data_size[t_id] += c_size;
+    }
+
+    else if (global_num_start > 0 && global_num_end > 0) {
       cs_file_read_block(inp->f,
                          _buf,
                          type_size,
@@ -1572,6 +1950,8 @@ _write_padding(size_t    align,
  *   n_location_vals  <-- number of values per location
  *   elt_type         <-- element type
  *   elts             <-- pointer to element data, if it may be embedded
+ *   n_c_chunks       <-- number of compressed chunks, or 0
+ *   c_dir            <-- compressed chunk directory (used on root rank)
  *   outp             --> output kernel IO structure
  *
  * returns:
@@ -1579,14 +1959,16 @@ _write_padding(size_t    align,
  *----------------------------------------------------------------------------*/
 
 static bool
-_write_header(const char     *sec_name,
-              cs_gnum_t       n_vals,
-              size_t          location_id,
-              size_t          index_id,
-              size_t          n_location_vals,
-              cs_datatype_t   elt_type,
-              const void     *elts,
-              cs_io_t        *outp)
+_write_header(const char           *sec_name,
+              cs_gnum_t             n_vals,
+              size_t                location_id,
+              size_t                index_id,
+              size_t                n_location_vals,
+              cs_datatype_t         elt_type,
+              const void           *elts,
+              size_t                n_c_chunks,
+              const cs_file_off_t   c_dir[],
+              cs_io_t              *outp)
 {
   cs_file_off_t header_vals[6];
 
@@ -1628,9 +2010,12 @@ _write_header(const char     *sec_name,
   header_vals[5] = name_size + name_pad_size;
   header_vals[0] += (name_size + name_pad_size);
 
+  if (n_c_chunks > 0)
+    header_vals[0] += (1 + 2*n_c_chunks)*8;
+
   /* Decide if data is to be embedded */
 
-  if (   n_vals > 0
+  if (   n_vals > 0 && n_c_chunks == 0
       && elts != NULL
       && (header_vals[0] + data_size <= (cs_file_off_t)(outp->header_size))) {
     header_vals[0] += data_size;
@@ -1708,6 +2093,24 @@ _write_header(const char     *sec_name,
 
   strcpy((char *)(outp->buffer) + 56, sec_name);
 
+  /* Compressed chunk directory */
+
+  if (n_c_chunks > 0) {
+
+    unsigned char *_c_dir =   (unsigned char *)(outp->buffer)
+                            + (56 + name_size + name_pad_size);
+    cs_file_off_t _n_c_chunks = n_c_chunks;
+
+    outp->type_name[6] = 'z';
+
+    _convert_from_offset(_c_dir, &_n_c_chunks, 1);
+    if (c_dir != NULL)
+      _convert_from_offset(_c_dir + 8, c_dir, 2*n_c_chunks);
+
+    if (cs_file_get_swap_endian(outp->f) == 1)
+      _swap_endian(_c_dir, 8, 1 + 2*n_c_chunks);
+  }
+
   if (embed == true) {
 
     unsigned char *data =   (unsigned char *)(outp->buffer)
@@ -1746,6 +2149,391 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a section should be compressed.
+ *
+ * parameters:
+ *   outp     <-- output kernel IO structure
+ *   n_g_vals <-- total number of values
+ *   stride   <-- number of values per location
+ *   elt_type <-- element type
+ *
+ * returns:
+ *   true if the section should be compressed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_compress_section(const cs_io_t  *outp,
+                  cs_gnum_t       n_g_vals,
+                  size_t          stride,
+                  cs_datatype_t   elt_type)
+{
+  if (   outp->compression == CS_COMPRESS_NONE
+      || elt_type == CS_CHAR || elt_type == CS_DATATYPE_NULL
+      || n_g_vals % stride != 0)
+    return false;
+
+  return (n_g_vals*cs_datatype_size[elt_type] >= CS_IO_COMPRESS_MIN_SIZE);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the maximum number of locations in a compressed chunk.
+ *
+ * parameters:
+ *   elt_type <-- element type
+ *   stride   <-- number of values per location
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_chunk_n_locs(cs_datatype_t  elt_type,
+              size_t         stride)
+{
+  size_t n = CS_IO_COMPRESS_CHUNK_SIZE / (cs_datatype_size[elt_type]*stride);
+
+  return CS_MAX(n, 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Compress a block of values, split in chunks.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * parameters:
+ *   outp     <-- output kernel IO structure
+ *   elt_type <-- element type
+ *   stride   <-- number of values per location
+ *   n_locs   <-- number of locations in block
+ *   elts     <-- pointer to element data
+ *   n_chunks --> number of chunks
+ *   c_dir    --> number of locations and compressed size of each chunk
+ *   c_buf    --> compressed chunks
+ *
+ * returns:
+ *   total size of compressed chunks, in bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_compress_chunks(const cs_io_t     *outp,
+                 cs_datatype_t      elt_type,
+                 size_t             stride,
+                 size_t             n_locs,
+                 const void        *elts,
+                 size_t            *n_chunks,
+                 cs_gnum_t        **c_dir,
+                 unsigned char    **c_buf)
+{
+  const size_t loc_size = cs_datatype_size[elt_type]*stride;
+  const size_t chunk_n_locs = _chunk_n_locs(elt_type, stride);
+  const size_t _n_chunks = (n_locs + chunk_n_locs - 1) / chunk_n_locs;
+  const size_t max_c_size = cs_compress_bound(elt_type, chunk_n_locs*stride);
+
+  const unsigned char *_elts = elts;
+
+  cs_gnum_t *_c_dir = NULL;
+  unsigned char *_c_buf = NULL;
+
+  BFT_MALLOC(_c_dir, 2*_n_chunks, cs_gnum_t);
+  BFT_MALLOC(_c_buf, _n_chunks*max_c_size, unsigned char);
+
+# pragma omp parallel for schedule(dynamic) if (_n_chunks > 1)
+  for (size_t c = 0; c < _n_chunks; c++) {
+    size_t s_id = c*chunk_n_locs;
+    size_t e_id = CS_MIN(s_id + chunk_n_locs, n_locs);
+    _c_dir[c*2] = e_id - s_id;
+    _c_dir[c*2 + 1] = cs_compress_encode(outp->compression,
+                                         outp->error_bound,
+                                         elt_type,
+                                         (e_id - s_id)*stride,
+                                         _elts + s_id*loc_size,
+                                         _c_buf + c*max_c_size);
+  }
+
+  /* Compact compressed chunks */
+
+  size_t c_size = 0;
+
+  for (size_t c = 0; c < _n_chunks; c++) {
+    memmove(_c_buf + c_size, _c_buf + c*max_c_size, _c_dir[c*2 + 1]);
+    c_size += _c_dir[c*2 + 1];
+  }
+
+  *n_chunks = _n_chunks;
+  *c_dir = _c_dir;
+  *c_buf = _c_buf;
+
+  return c_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a compressed global section.
+ *
+ * Data is only compressed and written by the associated communicator's
+ * root rank, though the call to this function is collective.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_vals           <-- total number of values
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_global_compressed(const char     *sec_name,
+                         cs_gnum_t       n_vals,
+                         size_t          location_id,
+                         size_t          index_id,
+                         size_t          n_location_vals,
+                         cs_datatype_t   elt_type,
+                         const void     *elts,
+                         cs_io_t        *outp)
+{
+  int rank_id = 0;
+  size_t stride = (n_location_vals > 1) ? n_location_vals : 1;
+  size_t n_locs = n_vals / stride;
+  size_t chunk_n_locs = _chunk_n_locs(elt_type, stride);
+  size_t n_chunks = (n_locs + chunk_n_locs - 1) / chunk_n_locs;
+
+  cs_gnum_t c_size = 0;
+  cs_gnum_t *l_dir = NULL;
+  cs_file_off_t *c_dir = NULL;
+  unsigned char *c_buf = NULL;
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL)
+    MPI_Comm_rank(outp->comm, &rank_id);
+#endif
+
+  if (rank_id == 0) {
+
+    c_size = _compress_chunks(outp, elt_type, stride, n_locs, elts,
+                              &n_chunks, &l_dir, &c_buf);
+
+    /* Convert to past-the-end values */
+
+    BFT_MALLOC(c_dir, 2*n_chunks, cs_file_off_t);
+
+    cs_gnum_t loc_end = 1;
+    cs_file_off_t byte_end = 0;
+    for (size_t c = 0; c < n_chunks; c++) {
+      loc_end += l_dir[c*2];
+      byte_end += l_dir[c*2 + 1];
+      c_dir[c*2] = loc_end;
+      c_dir[c*2 + 1] = byte_end;
+    }
+
+    BFT_FREE(l_dir);
+  }
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL)
+    MPI_Bcast(&c_size, 1, CS_MPI_GNUM, 0, outp->comm);
+#endif
+
+  _write_header(sec_name,
+                n_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                n_chunks,
+                c_dir,
+                outp);
+
+  BFT_FREE(c_dir);
+
+  double t_start = 0.;
+  cs_io_log_t  *log = NULL;
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  _write_padding(outp->body_align, outp);
+
+  size_t n_written = cs_file_write_global(outp->f, c_buf, 1, c_size);
+
+  if (c_size != (cs_gnum_t)n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)c_size, cs_file_get_name(outp->f));
+
+  BFT_FREE(c_buf);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[0] += t_end - t_start;
+    log->data_size[0] += c_size;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write a compressed section, each associated process providing
+ * a contiguous block of the section's body.
+ *
+ * Each rank compresses its own block, split in chunks, so the chunk
+ * directory is gathered on the root rank for the header, and compressed
+ * chunks are written at offsets based on the sizes on previous ranks.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_block_compressed(const char     *sec_name,
+                        cs_gnum_t       n_g_elts,
+                        cs_gnum_t       global_num_start,
+                        cs_gnum_t       global_num_end,
+                        size_t          location_id,
+                        size_t          index_id,
+                        size_t          n_location_vals,
+                        cs_datatype_t   elt_type,
+                        const void     *elts,
+                        cs_io_t        *outp)
+{
+  size_t stride = (n_location_vals > 1) ? n_location_vals : 1;
+  size_t n_l_chunks = 0, n_g_chunks = 0;
+
+  cs_gnum_t c_start = 0;
+  cs_gnum_t *l_dir = NULL, *g_dir = NULL;
+  cs_file_off_t *c_dir = NULL;
+  unsigned char *c_buf = NULL;
+
+#if defined(HAVE_MPI)
+  int rank_id = 0, n_ranks = 1;
+  if (outp->comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(outp->comm, &rank_id);
+    MPI_Comm_size(outp->comm, &n_ranks);
+  }
+#endif
+
+  cs_gnum_t c_size = _compress_chunks(outp,
+                                      elt_type,
+                                      stride,
+                                      global_num_end - global_num_start,
+                                      elts,
+                                      &n_l_chunks,
+                                      &l_dir,
+                                      &c_buf);
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1)
+    MPI_Exscan(&c_size, &c_start, 1, CS_MPI_GNUM, MPI_SUM, outp->comm);
+  if (rank_id == 0)
+    c_start = 0;
+#endif
+
+  /* Convert local chunk sizes to past-the-end global values */
+
+  {
+    cs_gnum_t loc_end = global_num_start, byte_end = c_start;
+    for (size_t c = 0; c < n_l_chunks; c++) {
+      loc_end += l_dir[c*2];
+      byte_end += l_dir[c*2 + 1];
+      l_dir[c*2] = loc_end;
+      l_dir[c*2 + 1] = byte_end;
+    }
+  }
+
+  n_g_chunks = n_l_chunks;
+  g_dir = l_dir;
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1) {
+
+    int l_count = 2*n_l_chunks;
+    int *count = NULL, *shift = NULL;
+
+    BFT_MALLOC(count, n_ranks, int);
+    BFT_MALLOC(shift, n_ranks, int);
+
+    MPI_Allgather(&l_count, 1, MPI_INT, count, 1, MPI_INT, outp->comm);
+
+    shift[0] = 0;
+    for (int i = 1; i < n_ranks; i++)
+      shift[i] = shift[i-1] + count[i-1];
+
+    n_g_chunks = (shift[n_ranks-1] + count[n_ranks-1]) / 2;
+
+    g_dir = NULL;
+    if (rank_id == 0)
+      BFT_MALLOC(g_dir, 2*n_g_chunks, cs_gnum_t);
+
+    MPI_Gatherv(l_dir, l_count, CS_MPI_GNUM,
+                g_dir, count, shift, CS_MPI_GNUM,
+                0, outp->comm);
+
+    BFT_FREE(shift);
+    BFT_FREE(count);
+    BFT_FREE(l_dir);
+  }
+#endif
+
+  if (g_dir != NULL) {
+    BFT_MALLOC(c_dir, 2*n_g_chunks, cs_file_off_t);
+    for (size_t i = 0; i < 2*n_g_chunks; i++)
+      c_dir[i] = g_dir[i];
+    BFT_FREE(g_dir);
+  }
+
+  _write_header(sec_name,
+                n_g_elts*stride,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                n_g_chunks,
+                c_dir,
+                outp);
+
+  BFT_FREE(c_dir);
+
+  double t_start = 0.;
+  cs_io_log_t  *log = NULL;
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  _write_padding(outp->body_align, outp);
+
+  size_t n_written = cs_file_write_block_buffer(outp->f,
+                                                c_buf,
+                                                1,
+                                                1,
+                                                c_start + 1,
+                                                c_start + c_size + 1);
+
+  if (c_size != (cs_gnum_t)n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)c_size, cs_file_get_name(outp->f));
+
+  BFT_FREE(c_buf);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += c_size;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -1762,23 +2550,25 @@ _dump_index(const cs_io_sec_index_t  *idx)
 
   bft_printf(_(" %llu indexed records:\n"
                "   (name, n_vals, location_id, index_id, n_loc_vals, type, "
-               "embed, file_id, offset)\n\n"),
+               "embed, compressed, offset)\n\n"),
              (unsigned long long)(idx->size));
 
   for (ii = 0; ii < idx->size; ii++) {
 
-    char embed = 'n';
-    cs_file_off_t *h_vals = idx->h_vals + ii*7;
+    char embed = 'n', compressed = 'n';
+    cs_file_off_t *h_vals = idx->h_vals + ii*8;
     const char *name = idx->names + h_vals[4];
 
     if (h_vals[5] > 0)
       embed = 'y';
+    if (h_vals[7] > 0)
+      compressed = 'y';
 
-    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %2u %ld\n"),
+    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %c %ld\n"),
                name, (unsigned long long)(h_vals[0]),
                (unsigned)(h_vals[1]), (unsigned)(h_vals[2]),
                (unsigned)(h_vals[3]), cs_datatype_name[h_vals[6]],
-               embed, (unsigned)(h_vals[7]),
+               embed, compressed,
                (long)(idx->offset[ii]));
 
   }
@@ -1977,6 +2767,8 @@ cs_io_finalize(cs_io_t **cs_io)
   _cs_io->buffer_size = 0;
   BFT_FREE(_cs_io->buffer);
 
+  BFT_FREE(_cs_io->c_dir);
+
   BFT_FREE(*cs_io);
 }
 
@@ -2035,7 +2827,7 @@ cs_io_get_indexed_sec_name(const cs_io_t  *inp,
 
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[8*id + 4];
       retval = inp->index->names + name_id;
     }
   }
@@ -2065,15 +2857,15 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
 
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[8*id + 4];
 
       h.sec_name = inp->index->names + name_id;
 
-      h.n_vals          = inp->index->h_vals[7*id];
-      h.location_id     = inp->index->h_vals[7*id + 1];
-      h.index_id        = inp->index->h_vals[7*id + 2];
-      h.n_location_vals = inp->index->h_vals[7*id + 3];
-      h.type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+      h.n_vals          = inp->index->h_vals[8*id];
+      h.location_id     = inp->index->h_vals[8*id + 1];
+      h.index_id        = inp->index->h_vals[8*id + 2];
+      h.n_location_vals = inp->index->h_vals[8*id + 3];
+      h.type_read       = (cs_datatype_t)(inp->index->h_vals[8*id + 6]);
       h.elt_type        = _type_read_to_elt_type(h.type_read);
     }
   }
@@ -2105,6 +2897,35 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Set compression options for sections written to a kernel IO structure.
+ *
+ * Compression applies to sections of numerical data written using
+ * cs_io_write_global(), cs_io_write_block(), or cs_io_write_block_buffer(),
+ * except for small sections. Sections are split into chunks which are
+ * compressed independently, and decompression is handled transparently
+ * by the matching read functions.
+ *
+ * Quantization only applies to floating-point data, so it should only
+ * be used for data which does not need to be restored exactly.
+ *
+ * parameters:
+ *   outp        <-> output kernel IO structure
+ *   type        <-- compression type
+ *   error_bound <-- absolute error bound for quantization
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_compression(cs_io_t             *outp,
+                      cs_compress_type_t   type,
+                      double               error_bound)
+{
+  assert(outp != NULL);
+
+  outp->compression = type;
+  outp->error_bound = error_bound;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section header.
  *
@@ -2156,6 +2977,7 @@ cs_io_read_header(cs_io_t             *inp,
   }
 
   inp->n_vals = 0;
+  inp->n_c_chunks = 0;
 
   /* Read header */
   /*-------------*/
@@ -2203,6 +3025,20 @@ cs_io_read_header(cs_io_t             *inp,
   if (header_vals[1] > 0 && inp->type_name[7] == 'e')
     inp->data = inp->buffer + 56 + header_vals[5];
 
+  /* Compressed chunk directory follows section name if present */
+
+  if (header_vals[1] > 0 && inp->type_name[6] == 'z') {
+    unsigned char *c_dir = inp->buffer + 56 + header_vals[5];
+    cs_file_off_t n_c_chunks = 0;
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(c_dir, 8, 1);
+    _convert_to_offset(c_dir, &n_c_chunks, 1);
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(c_dir + 8, 8, 2*n_c_chunks);
+    _set_c_dir_size(inp, n_c_chunks);
+    _convert_to_offset(c_dir + 8, inp->c_dir, 2*n_c_chunks);
+  }
+
   inp->type_size = 0;
 
   /* Return immediately if we have an end-of file marker */
@@ -2344,13 +3180,13 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   if (id >= inp->index->size)
     return 1;
 
-  header->sec_name = inp->index->names + inp->index->h_vals[7*id + 4];
+  header->sec_name = inp->index->names + inp->index->h_vals[8*id + 4];
 
-  header->n_vals          = inp->index->h_vals[7*id];
-  header->location_id     = inp->index->h_vals[7*id + 1];
-  header->index_id        = inp->index->h_vals[7*id + 2];
-  header->n_location_vals = inp->index->h_vals[7*id + 3];
-  header->type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+  header->n_vals          = inp->index->h_vals[8*id];
+  header->location_id     = inp->index->h_vals[8*id + 1];
+  header->index_id        = inp->index->h_vals[8*id + 2];
+  header->n_location_vals = inp->index->h_vals[8*id + 3];
+  header->type_read       = (cs_datatype_t)(inp->index->h_vals[8*id + 6]);
   header->elt_type        = _type_read_to_elt_type(header->type_read);
 
   inp->n_vals      = header->n_vals;
@@ -2366,9 +3202,24 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   inp->sec_name = (char *)(inp->buffer + 56);
   inp->type_name = NULL; /* should not be needed now that datatype is known */
 
+  /* Compressed chunk directory */
+
+  if (inp->index->h_vals[8*id + 7] > 0) {
+    const unsigned char *c_dir
+      = inp->index->data + inp->index->h_vals[8*id + 7] - 1;
+    cs_file_off_t n_c_chunks = 0;
+    memcpy(&n_c_chunks, c_dir, sizeof(cs_file_off_t));
+    _set_c_dir_size(inp, n_c_chunks);
+    memcpy(inp->c_dir,
+           c_dir + sizeof(cs_file_off_t),
+           2*n_c_chunks*sizeof(cs_file_off_t));
+  }
+  else
+    inp->n_c_chunks = 0;
+
   /* Non-embedded values */
 
-  if (inp->index->h_vals[7*id + 5] == 0) {
+  if (inp->index->h_vals[8*id + 5] == 0) {
     cs_file_off_t offset = inp->index->offset[id];
     retval = cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
   }
@@ -2376,7 +3227,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   /* Embedded values */
 
   else {
-    size_t data_id = inp->index->h_vals[7*id + 5] - 1;
+    size_t data_id = inp->index->h_vals[8*id + 5] - 1;
     unsigned char *_data = inp->index->data + data_id;
     inp->data = _data;
   }
@@ -2791,20 +3642,34 @@ cs_io_write_global(const char     *sec_name,
                    cs_io_t        *outp)
 {
   bool embed = false;
+  size_t stride = (n_location_vals > 1) ? n_location_vals : 1;
+  bool compress = _compress_section(outp, n_vals, stride, elt_type);
 
   if (outp->echo >= CS_IO_ECHO_HEADERS)
     _echo_header(sec_name, n_vals, elt_type);
 
-  embed = _write_header(sec_name,
-                        n_vals,
-                        location_id,
-                        index_id,
-                        n_location_vals,
-                        elt_type,
-                        elts,
-                        outp);
+  if (compress)
+    _write_global_compressed(sec_name,
+                             n_vals,
+                             location_id,
+                             index_id,
+                             n_location_vals,
+                             elt_type,
+                             elts,
+                             outp);
+  else
+    embed = _write_header(sec_name,
+                          n_vals,
+                          location_id,
+                          index_id,
+                          n_location_vals,
+                          elt_type,
+                          elts,
+                          0,
+                          NULL,
+                          outp);
 
-  if (n_vals > 0 && embed == false) {
+  if (n_vals > 0 && embed == false && compress == false) {
 
     double t_start = 0.;
     cs_io_log_t  *log = NULL;
@@ -2896,6 +3761,28 @@ cs_io_write_block(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  if (_compress_section(outp, n_g_vals, stride, elt_type)) {
+
+    _write_block_compressed(sec_name,
+                            n_g_elts,
+                            global_num_start,
+                            global_num_end,
+                            location_id,
+                            index_id,
+                            n_location_vals,
+                            elt_type,
+                            elts,
+                            outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+
+    return;
+  }
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -2903,6 +3790,8 @@ cs_io_write_block(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                0,
+                NULL,
                 outp);
 
   if (outp->log_id > -1) {
@@ -2997,6 +3886,28 @@ cs_io_write_block_buffer(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+  if (_compress_section(outp, n_g_vals, stride, elt_type)) {
+
+    _write_block_compressed(sec_name,
+                            n_g_elts,
+                            global_num_start,
+                            global_num_end,
+                            location_id,
+                            index_id,
+                            n_location_vals,
+                            elt_type,
+                            elts,
+                            outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+
+    return;
+  }
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -3004,6 +3915,8 @@ cs_io_write_block_buffer(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                0,
+                NULL,
                 outp);
 
   if (outp->log_id > -1) {
@@ -3077,7 +3990,10 @@ cs_io_skip(const cs_io_sec_header_t  *header,
       cs_file_off_t offset = cs_file_tell(pp_io->f);
       size_t ba = pp_io->body_align;
       offset += (ba - (offset % ba)) % ba;
-      offset += n_vals*type_size;
+      if (pp_io->n_c_chunks > 0)
+        offset += _c_byte_start(pp_io, pp_io->n_c_chunks);
+      else
+        offset += n_vals*type_size;
       cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
     }
 
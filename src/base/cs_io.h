@@ -34,6 +34,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_base.h"
+#include "cs_compress.h"
 #include "cs_file.h"
 
 /*----------------------------------------------------------------------------*/
@@ -259,6 +260,29 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Set compression options for sections written to a kernel IO structure.
+ *
+ * Compression applies to sections of numerical data written using
+ * cs_io_write_global(), cs_io_write_block(), or cs_io_write_block_buffer(),
+ * except for small sections. Sections are split into chunks which are
+ * compressed independently, and decompression is handled transparently
+ * by the matching read functions.
+ *
+ * Quantization only applies to floating-point data, so it should only
+ * be used for data which does not need to be restored exactly.
+ *
+ * parameters:
+ *   outp        <-> output kernel IO structure
+ *   type        <-- compression type
+ *   error_bound <-- absolute error bound for quantization
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_compression(cs_io_t             *outp,
+                      cs_compress_type_t   type,
+                      double               error_bound);
+
 /*----------------------------------------------------------------------------
  * Read a message header.
  *
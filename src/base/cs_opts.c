@@ -125,6 +125,11 @@ _arg_env_help(const char  *name)
     (e, _(" --mpi             force use of MPI for parallelism or coupling\n"
           "                   (usually automatic, only required for\n"
           "                   undetermined MPI libraries)\n"));
+#if defined(HAVE_MPI)
+  fprintf
+    (e, _(" --io-servers      <n> reserve the last n ranks as dedicated\n"
+          "                   I/O servers for post-processing output\n"));
+#endif
   fprintf
     (e, _(" --trace           trace progress in standard output\n"));
   fprintf
@@ -263,6 +268,14 @@ cs_opts_define(int         argc,
       /* Handled in pre-reading stage */
     }
 
+    else if (strcmp(s, "--io-servers") == 0) {
+      /* Handled in pre-reading stage */
+      if (arg_id + 1 < argc)
+        arg_id++;
+      else
+        argerr = 1;
+    }
+
 #else /* !defined(HAVE_MPI) */
 
     else if (strcmp(s, "--mpi") == 0) {
@@ -0,0 +1,934 @@
+/*============================================================================
+ * Adaptive tables for properties depending on two variables.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_log.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_phys_prop_table.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_phys_prop_table.c
+        Adaptive tables for properties depending on two variables.
+
+  Tables are quadtrees over a regular grid of root tiles. Each leaf tile
+  holds values on a regular grid of CS_PHYS_PROP_TABLE_N_TILE intervals
+  per axis, with one layer of ghost values on each side, so that bicubic
+  (Catmull-Rom) interpolation is local to a tile.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of root tiles per axis */
+
+#define CS_PHYS_PROP_TABLE_N_ROOT 16
+
+/* Number of grid intervals per tile and axis */
+
+#define CS_PHYS_PROP_TABLE_N_TILE 8
+
+/* Number of values per tile row, including ghosts */
+
+#define CS_PHYS_PROP_TABLE_S (CS_PHYS_PROP_TABLE_N_TILE + 3)
+
+/* Node status for tiles which are not interpolated */
+
+#define CS_PHYS_PROP_TABLE_EXACT -1
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Property table structure */
+
+struct _cs_phys_prop_table_t {
+
+  cs_real_t    x0[2];                /* lower bounds */
+  cs_real_t    x1[2];                /* upper bounds */
+  cs_real_t    inv_dx[2];            /* inverse of root tile size */
+
+  cs_lnum_t    n_nodes;              /* number of quadtree nodes */
+  cs_lnum_t    n_tiles;              /* number of interpolated tiles */
+  cs_lnum_t    n_exact;              /* number of tiles not interpolated */
+
+  cs_real_t    err;                  /* estimated max. relative error */
+
+  cs_lnum_t   *node;                 /* for each node, id of first of 4
+                                        children if > 0, -2 - tile id for
+                                        interpolated leaves, or
+                                        CS_PHYS_PROP_TABLE_EXACT */
+  cs_real_t   *val;                  /* tile values, with ghosts */
+
+};
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char _table_header[] = "Code_Saturne property table 2.0\n";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create an empty property table structure.
+ *
+ * parameters:
+ *   bounds  <-- x_min, x_max, y_min, y_max
+ *
+ * returns:
+ *   pointer to new table structure
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_create(const cs_real_t  bounds[4])
+{
+  cs_phys_prop_table_t *t;
+  BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+
+  for (int i = 0; i < 2; i++) {
+    t->x0[i] = bounds[2*i];
+    t->x1[i] = bounds[2*i + 1];
+    t->inv_dx[i] = CS_PHYS_PROP_TABLE_N_ROOT / (t->x1[i] - t->x0[i]);
+  }
+
+  t->n_nodes = 0;
+  t->n_tiles = 0;
+  t->n_exact = 0;
+  t->err = 0;
+
+  t->node = NULL;
+  t->val = NULL;
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Interpolate a value inside a tile.
+ *
+ * parameters:
+ *   v  <-- tile values (with ghosts)
+ *   u  <-- local coordinate on first axis, in [0, N_TILE]
+ *   w  <-- local coordinate on second axis, in [0, N_TILE]
+ *
+ * returns:
+ *   interpolated value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_tile_interpolate(const cs_real_t  v[],
+                  cs_real_t        u,
+                  cs_real_t        w)
+{
+  const int s = CS_PHYS_PROP_TABLE_S;
+
+  int i = CS_MIN((int)u, CS_PHYS_PROP_TABLE_N_TILE - 1);
+  int j = CS_MIN((int)w, CS_PHYS_PROP_TABLE_N_TILE - 1);
+
+  cs_real_t a = u - i, b = w - j;
+
+  cs_real_t wa[4] = {((-a + 2)*a - 1)*a*0.5,
+                     ((3*a - 5)*a*a + 2)*0.5,
+                     ((-3*a + 4)*a + 1)*a*0.5,
+                     (a - 1)*a*a*0.5};
+  cs_real_t wb[4] = {((-b + 2)*b - 1)*b*0.5,
+                     ((3*b - 5)*b*b + 2)*0.5,
+                     ((-3*b + 4)*b + 1)*b*0.5,
+                     (b - 1)*b*b*0.5};
+
+  /* Stencil starts at point (i-1, j-1), which is at (i, j) with ghosts */
+
+  const cs_real_t *_v = v + i*s + j;
+
+  cs_real_t r = 0;
+  for (int k = 0; k < 4; k++) {
+    r += wa[k] * (  wb[0]*_v[k*s]     + wb[1]*_v[k*s + 1]
+                  + wb[2]*_v[k*s + 2] + wb[3]*_v[k*s + 3]);
+  }
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------
+ * Locate the tile containing a given point.
+ *
+ * parameters:
+ *   t  <-- pointer to table structure
+ *   x  <-- value on first axis
+ *   y  <-- value on second axis
+ *   u  --> local coordinate in tile on first axis
+ *   w  --> local coordinate in tile on second axis
+ *
+ * returns:
+ *   id of interpolated tile, or -1 if the point is outside the table
+ *   bounds or in a tile which is not interpolated
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_locate(const cs_phys_prop_table_t  *t,
+        cs_real_t                    x,
+        cs_real_t                    y,
+        cs_real_t                   *u,
+        cs_real_t                   *w)
+{
+  if (! (   x >= t->x0[0] && x <= t->x1[0]
+         && y >= t->x0[1] && y <= t->x1[1]))
+    return -1;
+
+  cs_real_t a = (x - t->x0[0]) * t->inv_dx[0];
+  cs_real_t b = (y - t->x0[1]) * t->inv_dx[1];
+
+  int i = CS_MIN((int)a, CS_PHYS_PROP_TABLE_N_ROOT - 1);
+  int j = CS_MIN((int)b, CS_PHYS_PROP_TABLE_N_ROOT - 1);
+
+  a -= i;
+  b -= j;
+
+  cs_lnum_t n = t->node[i*CS_PHYS_PROP_TABLE_N_ROOT + j];
+
+  while (n > 0) {
+    a *= 2;
+    b *= 2;
+    int qa = (a < 1) ? 0 : 1;
+    int qb = (b < 1) ? 0 : 1;
+    a -= qa;
+    b -= qb;
+    n = t->node[n + 2*qa + qb];
+  }
+
+  *u = a * CS_PHYS_PROP_TABLE_N_TILE;
+  *w = b * CS_PHYS_PROP_TABLE_N_TILE;
+
+  return (n < -1) ? -2 - n : -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a property, sharing evaluations among ranks.
+ *
+ * All ranks must provide the same points, and obtain all values.
+ *
+ * parameters:
+ *   eval   <-- property evaluation function
+ *   input  <-- input passed to evaluation function
+ *   n      <-- number of values
+ *   x      <-- values on first axis
+ *   y      <-- values on second axis
+ *   val    --> property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_eval_shared(cs_phys_prop_table_eval_t  *eval,
+             void                       *input,
+             cs_lnum_t                   n,
+             const cs_real_t             x[],
+             const cs_real_t             y[],
+             cs_real_t                   val[])
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const int n_ranks = cs_glob_n_ranks;
+
+    int *count, *displ;
+    BFT_MALLOC(count, n_ranks, int);
+    BFT_MALLOC(displ, n_ranks, int);
+
+    for (int i = 0; i < n_ranks; i++)
+      displ[i] = ((long long)n * i) / n_ranks;
+    for (int i = 0; i < n_ranks - 1; i++)
+      count[i] = displ[i+1] - displ[i];
+    count[n_ranks - 1] = n - displ[n_ranks - 1];
+
+    const int s_id = displ[cs_glob_rank_id];
+    const int n_l = count[cs_glob_rank_id];
+
+    cs_real_t *val_l;
+    BFT_MALLOC(val_l, n_l, cs_real_t);
+
+    eval(input, n_l, x + s_id, y + s_id, val_l);
+
+    MPI_Allgatherv(val_l, n_l, CS_MPI_REAL,
+                   val, count, displ, CS_MPI_REAL,
+                   cs_glob_mpi_comm);
+
+    BFT_FREE(val_l);
+    BFT_FREE(displ);
+    BFT_FREE(count);
+
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  eval(input, n, x, y, val);
+}
+
+/*----------------------------------------------------------------------------
+ * Fill ghost values of a tile on the table boundary using quadratic
+ * extrapolation. Ghost values inside the table bounds are exact.
+ *
+ * parameters:
+ *   v      <-> tile values (with ghosts)
+ *   outer  <-- is each side (x low, x high, y low, y high) on the table
+ *              boundary ?
+ *----------------------------------------------------------------------------*/
+
+static void
+_tile_fill_ghosts(cs_real_t   v[],
+                  const bool  outer[4])
+{
+  const int s = CS_PHYS_PROP_TABLE_S;
+
+  for (int i = 0; i < s; i++) {
+    cs_real_t *r = v + i*s;
+    if (outer[2])
+      r[0] = 3*(r[1] - r[2]) + r[3];
+    if (outer[3])
+      r[s-1] = 3*(r[s-2] - r[s-3]) + r[s-4];
+  }
+
+  for (int j = 0; j < s; j++) {
+    if (outer[0])
+      v[j] = 3*(v[s + j] - v[2*s + j]) + v[3*s + j];
+    if (outer[1])
+      v[(s-1)*s + j] = 3*(v[(s-2)*s + j] - v[(s-3)*s + j]) + v[(s-4)*s + j];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read a property table from a cache file on rank 0 and broadcast it.
+ *
+ * parameters:
+ *   bounds  <-- x_min, x_max, y_min, y_max
+ *   path    <-- path to cache file
+ *   key     <-- key identifying table settings
+ *
+ * returns:
+ *   pointer to table structure, or NULL if not available
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_cache_read(const cs_real_t   bounds[4],
+                  const char       *path,
+                  const char       *key)
+{
+  cs_phys_prop_table_t *t = _table_create(bounds);
+
+  /* Sizes: n_nodes (0 if not available), n_tiles, n_exact */
+
+  int n[3] = {0, 0, 0};
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(path, "rb");
+
+    if (f != NULL) {
+
+      char line[512];
+      int n_root = 0, n_tile = 0;
+      double err = -1;
+
+      size_t l = strlen(key);
+
+      bool ok = false;
+      if (fgets(line, 512, f) != NULL && strcmp(line, _table_header) == 0) {
+        if (   fgets(line, 512, f) != NULL
+            && strncmp(line, key, l) == 0 && strcmp(line + l, "\n") == 0) {
+          if (fgets(line, 512, f) != NULL) {
+            if (sscanf(line, "%d %d %d %d %d %la", &n_root, &n_tile,
+                       n, n+1, n+2, &err) == 6)
+              ok = (   n_root == CS_PHYS_PROP_TABLE_N_ROOT
+                    && n_tile == CS_PHYS_PROP_TABLE_N_TILE
+                    && n[0] >= n_root*n_root && n[1] >= 0 && n[2] >= 0);
+          }
+        }
+      }
+
+      if (ok) {
+        const size_t n_vals =   (size_t)n[1]
+                              * CS_PHYS_PROP_TABLE_S*CS_PHYS_PROP_TABLE_S;
+        t->n_nodes = n[0];
+        t->n_tiles = n[1];
+        t->n_exact = n[2];
+        t->err = err;
+        BFT_MALLOC(t->node, t->n_nodes, cs_lnum_t);
+        BFT_MALLOC(t->val, n_vals, cs_real_t);
+        if (   fread(t->node, sizeof(cs_lnum_t), n[0], f) != (size_t)n[0]
+            || fread(t->val, sizeof(cs_real_t), n_vals, f) != n_vals)
+          ok = false;
+      }
+
+      /* Check node consistency so that lookups remain in bounds */
+
+      for (cs_lnum_t i = 0; ok && i < t->n_nodes; i++) {
+        cs_lnum_t c = t->node[i];
+        if (c > 0)
+          ok = (c + 3 < t->n_nodes);
+        else if (c < -1)
+          ok = (-2 - c < t->n_tiles);
+        else
+          ok = (c == CS_PHYS_PROP_TABLE_EXACT);
+      }
+
+      if (!ok)
+        n[0] = 0;
+
+      fclose(f);
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    MPI_Bcast(n, 3, MPI_INT, 0, cs_glob_mpi_comm);
+    if (n[0] > 0) {
+      const size_t n_vals =   (size_t)n[1]
+                            * CS_PHYS_PROP_TABLE_S*CS_PHYS_PROP_TABLE_S;
+      if (cs_glob_rank_id > 0) {
+        t->n_nodes = n[0];
+        t->n_tiles = n[1];
+        t->n_exact = n[2];
+        BFT_MALLOC(t->node, t->n_nodes, cs_lnum_t);
+        BFT_MALLOC(t->val, n_vals, cs_real_t);
+      }
+      MPI_Bcast(&(t->err), 1, CS_MPI_REAL, 0, cs_glob_mpi_comm);
+      MPI_Bcast(t->node, t->n_nodes, CS_MPI_LNUM, 0, cs_glob_mpi_comm);
+      MPI_Bcast(t->val, n_vals, CS_MPI_REAL, 0, cs_glob_mpi_comm);
+    }
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (n[0] == 0)
+    cs_phys_prop_table_destroy(&t);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a property table to a cache file (on rank 0 only).
+ *
+ * parameters:
+ *   t     <-- pointer to table structure
+ *   path  <-- path to cache file
+ *   key   <-- key identifying table settings
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_cache_write(const cs_phys_prop_table_t  *t,
+                   const char                  *path,
+                   const char                  *key)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  /* Write to a temporary file and rename it so that concurrent
+     readers never see a partially written table */
+
+  size_t l = strlen(path) + 5;
+  char *tmp_path;
+  BFT_MALLOC(tmp_path, l, char);
+  snprintf(tmp_path, l, "%s.tmp", path);
+
+  FILE *f = fopen(tmp_path, "wb");
+
+  if (f != NULL) {
+    size_t n_vals =   (size_t)(t->n_tiles)
+                    * CS_PHYS_PROP_TABLE_S*CS_PHYS_PROP_TABLE_S;
+
+    fputs(_table_header, f);
+    fprintf(f, "%s\n", key);
+    fprintf(f, "%d %d %d %d %d %a\n",
+            CS_PHYS_PROP_TABLE_N_ROOT, CS_PHYS_PROP_TABLE_N_TILE,
+            (int)(t->n_nodes), (int)(t->n_tiles), (int)(t->n_exact),
+            t->err);
+    size_t n_w = fwrite(t->node, sizeof(cs_lnum_t), t->n_nodes, f);
+    n_w += fwrite(t->val, sizeof(cs_real_t), n_vals, f);
+
+    if (fclose(f) == 0 && n_w == (size_t)(t->n_nodes) + n_vals)
+      rename(tmp_path, path);
+    else
+      remove(tmp_path);
+  }
+
+  BFT_FREE(tmp_path);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a property table.
+ *
+ * The domain is split into a quadtree of tiles, each holding values on
+ * a small regular grid. A tile is accepted when the relative difference
+ * between interpolated and exact values at the midpoints of its grid is
+ * lower than the given tolerance, and otherwise split in 4, so that only
+ * regions where the property varies sharply (such as near saturation)
+ * are refined. Tiles which still do not reach the tolerance at the
+ * finest level, or in which the evaluation function returns non-finite
+ * values, are not interpolated: the function is called for values
+ * in those tiles.
+ *
+ * Evaluations are shared among ranks, so this is a collective operation,
+ * and the resulting table is identical on all ranks.
+ *
+ * If a cache file path is given, the table is read from that file when
+ * its key matches, and written to it otherwise.
+ *
+ * \param[in]  name        property name (for logging)
+ * \param[in]  bounds      x_min, x_max, y_min, y_max
+ * \param[in]  rtol        target relative interpolation error
+ * \param[in]  n_max       maximum equivalent number of points per axis
+ * \param[in]  cache_path  path to cache file, or NULL
+ * \param[in]  cache_key   key identifying table settings in cache, or NULL
+ * \param[in]  eval        property evaluation function
+ * \param[in]  input       input passed to evaluation function, or NULL
+ *
+ * \return  pointer to new table structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_phys_prop_table_t *
+cs_phys_prop_table_build(const char                 *name,
+                         const cs_real_t             bounds[4],
+                         cs_real_t                   rtol,
+                         int                         n_max,
+                         const char                 *cache_path,
+                         const char                 *cache_key,
+                         cs_phys_prop_table_eval_t  *eval,
+                         void                       *input)
+{
+  const int n_root = CS_PHYS_PROP_TABLE_N_ROOT;
+  const int n_t = CS_PHYS_PROP_TABLE_N_TILE;
+  const int s = CS_PHYS_PROP_TABLE_S;
+
+  /* Values on the tile grid (with ghosts), then at the midpoints of
+     that grid, which are used to estimate the interpolation error */
+
+  const int n_t2 = 2*n_t + 1;
+  const cs_lnum_t n_samples = s*s + n_t2*n_t2 - (n_t + 1)*(n_t + 1);
+
+  cs_timer_t t0 = cs_timer_time();
+
+  const char *_cache_key = (cache_key != NULL) ? cache_key : "";
+
+  cs_phys_prop_table_t *t = NULL;
+
+  if (cache_path != NULL) {
+    t = _table_cache_read(bounds, cache_path, _cache_key);
+    if (t != NULL) {
+      cs_log_printf
+        (CS_LOG_DEFAULT,
+         _("\n  Property table for %s read from cache:\n"
+           "    %ld tiles (%ld not interpolated), "
+           "estimated max. relative error: %8.2e\n"),
+         name, (long)(t->n_tiles), (long)(t->n_exact), t->err);
+      return t;
+    }
+  }
+
+  t = _table_create(bounds);
+
+  int depth_max = 0;
+  while (((n_root*n_t) << (depth_max + 1)) + 1 <= n_max)
+    depth_max++;
+
+  const cs_real_t dx_root[2] = {(t->x1[0] - t->x0[0]) / n_root,
+                                (t->x1[1] - t->x0[1]) / n_root};
+
+  /* Root nodes are all candidates for the first level */
+
+  cs_lnum_t n_nodes_max = n_root*n_root*2;
+  cs_lnum_t n_tiles_max = n_root*n_root;
+
+  t->n_nodes = n_root*n_root;
+  BFT_MALLOC(t->node, n_nodes_max, cs_lnum_t);
+  BFT_MALLOC(t->val, n_tiles_max*s*s, cs_real_t);
+
+  cs_lnum_t n_cand = n_root*n_root;
+  cs_lnum_t *cand, *cand_n;
+  BFT_MALLOC(cand, n_cand*3, cs_lnum_t);
+
+  for (int i = 0; i < n_root; i++) {
+    for (int j = 0; j < n_root; j++) {
+      cs_lnum_t k = i*n_root + j;
+      cand[k*3] = k;
+      cand[k*3 + 1] = i;
+      cand[k*3 + 2] = j;
+    }
+  }
+
+  cs_real_t *x = NULL, *y = NULL, *v = NULL;
+  cs_real_t v_ref = 1;
+  unsigned long long n_evals = 0;
+
+  for (int depth = 0; n_cand > 0; depth++) {
+
+    const cs_lnum_t n_lev = n_root << depth;
+    const cs_real_t h[2] = {dx_root[0] / (n_t << depth),
+                            dx_root[1] / (n_t << depth)};
+
+    const cs_lnum_t n = n_cand * n_samples;
+
+    BFT_REALLOC(x, n, cs_real_t);
+    BFT_REALLOC(y, n, cs_real_t);
+    BFT_REALLOC(v, n, cs_real_t);
+
+    /* Sample coordinates; ghost points outside the table bounds
+       are clamped, and replaced later by extrapolated values */
+
+    for (cs_lnum_t c = 0; c < n_cand; c++) {
+      const cs_lnum_t o[2] = {cand[c*3 + 1]*n_t, cand[c*3 + 2]*n_t};
+      cs_real_t *_x = x + c*n_samples, *_y = y + c*n_samples;
+      cs_lnum_t p = 0;
+      for (int k = 0; k < s; k++) {
+        for (int l = 0; l < s; l++) {
+          _x[p] = t->x0[0] + (o[0] + k - 1)*h[0];
+          _y[p] = t->x0[1] + (o[1] + l - 1)*h[1];
+          p++;
+        }
+      }
+      for (int k = 0; k < n_t2; k++) {
+        for (int l = 0; l < n_t2; l++) {
+          if (k%2 == 0 && l%2 == 0)
+            continue;
+          _x[p] = t->x0[0] + (o[0] + k*0.5)*h[0];
+          _y[p] = t->x0[1] + (o[1] + l*0.5)*h[1];
+          p++;
+        }
+      }
+      for (p = 0; p < n_samples; p++) {
+        _x[p] = CS_MIN(CS_MAX(_x[p], t->x0[0]), t->x1[0]);
+        _y[p] = CS_MIN(CS_MAX(_y[p], t->x0[1]), t->x1[1]);
+      }
+    }
+
+    _eval_shared(eval, input, n, x, y, v);
+    n_evals += n;
+
+    /* Scale for relative errors, based on the first level */
+
+    if (depth == 0) {
+      cs_real_t v_max = 0;
+      for (cs_lnum_t i = 0; i < n; i++) {
+        if (isfinite(v[i]))
+          v_max = CS_MAX(v_max, CS_ABS(v[i]));
+      }
+      if (v_max > 0)
+        v_ref = 1e-6*v_max;
+    }
+
+    /* Accept, split, or mark tiles as not interpolated */
+
+    if (n_nodes_max < t->n_nodes + 4*n_cand) {
+      n_nodes_max = CS_MAX(2*n_nodes_max, t->n_nodes + 4*n_cand);
+      BFT_REALLOC(t->node, n_nodes_max, cs_lnum_t);
+    }
+
+    cs_lnum_t n_cand_n = 0;
+    BFT_MALLOC(cand_n, 4*n_cand*3, cs_lnum_t);
+
+    for (cs_lnum_t c = 0; c < n_cand; c++) {
+
+      const cs_lnum_t node_id = cand[c*3];
+      const cs_lnum_t ij[2] = {cand[c*3 + 1], cand[c*3 + 2]};
+      const bool outer[4] = {ij[0] == 0, ij[0] == n_lev - 1,
+                             ij[1] == 0, ij[1] == n_lev - 1};
+
+      cs_real_t *_v = v + c*n_samples;
+
+      /* Reject non-finite samples; ghost values outside the table
+         bounds are not checked, as they are extrapolated */
+
+      bool ok = true;
+
+      for (int k = 0; k < s; k++) {
+        if ((k == 0 && outer[0]) || (k == s-1 && outer[1]))
+          continue;
+        for (int l = 0; l < s; l++) {
+          if ((l == 0 && outer[2]) || (l == s-1 && outer[3]))
+            continue;
+          if (! isfinite(_v[k*s + l]))
+            ok = false;
+        }
+      }
+
+      cs_real_t err = 0;
+
+      if (ok) {
+        _tile_fill_ghosts(_v, outer);
+        cs_lnum_t p = s*s;
+        for (int k = 0; k < n_t2; k++) {
+          for (int l = 0; l < n_t2; l++) {
+            if (k%2 == 0 && l%2 == 0)
+              continue;
+            cs_real_t v_e = _v[p++];
+            if (! isfinite(v_e)) {
+              ok = false;
+              continue;
+            }
+            cs_real_t v_i = _tile_interpolate(_v, k*0.5, l*0.5);
+            err = CS_MAX(err, CS_ABS(v_i - v_e) / (CS_ABS(v_e) + v_ref));
+          }
+        }
+      }
+
+      if (ok && err <= rtol) {
+        if (t->n_tiles >= n_tiles_max) {
+          n_tiles_max *= 2;
+          BFT_REALLOC(t->val, n_tiles_max*s*s, cs_real_t);
+        }
+        memcpy(t->val + t->n_tiles*s*s, _v, s*s*sizeof(cs_real_t));
+        t->node[node_id] = -2 - t->n_tiles;
+        t->n_tiles += 1;
+        t->err = CS_MAX(t->err, err);
+      }
+      else if (depth < depth_max) {
+        t->node[node_id] = t->n_nodes;
+        for (int qa = 0; qa < 2; qa++) {
+          for (int qb = 0; qb < 2; qb++) {
+            cs_lnum_t *_c = cand_n + n_cand_n*3;
+            _c[0] = t->n_nodes++;
+            _c[1] = 2*ij[0] + qa;
+            _c[2] = 2*ij[1] + qb;
+            n_cand_n++;
+          }
+        }
+      }
+      else {
+        t->node[node_id] = CS_PHYS_PROP_TABLE_EXACT;
+        t->n_exact += 1;
+      }
+
+    }
+
+    BFT_FREE(cand);
+    cand = cand_n;
+    n_cand = n_cand_n;
+
+  }
+
+  BFT_FREE(cand);
+  BFT_FREE(v);
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  BFT_REALLOC(t->node, t->n_nodes, cs_lnum_t);
+  BFT_REALLOC(t->val, t->n_tiles*s*s, cs_real_t);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t tc;
+  CS_TIMER_COUNTER_INIT(tc);
+  cs_timer_counter_add_diff(&tc, &t0, &t1);
+
+  cs_log_printf
+    (CS_LOG_DEFAULT,
+     _("\n  Property table for %s built in %.3g s (%llu evaluations):\n"
+       "    %ld tiles (%ld not interpolated), "
+       "estimated max. relative error: %8.2e\n"),
+     name, tc.nsec*1e-9, n_evals,
+     (long)(t->n_tiles), (long)(t->n_exact), t->err);
+
+  if (t->n_exact > 0)
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("    (tolerance %8.2e not reached with %d points per axis,\n"
+         "     or property not defined, in %ld tiles, which are computed\n"
+         "     exactly)\n"),
+       rtol, ((n_root*n_t) << depth_max) + 1, (long)(t->n_exact));
+
+  if (cache_path != NULL)
+    _table_cache_write(t, cache_path, _cache_key);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a property table.
+ *
+ * \param[in, out]  t  pointer to table structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_destroy(cs_phys_prop_table_t  **t)
+{
+  if (*t != NULL) {
+    BFT_FREE((*t)->node);
+    BFT_FREE((*t)->val);
+    BFT_FREE(*t);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute property values using a table.
+ *
+ * Values outside the table bounds or in tiles which are not interpolated
+ * are computed using the evaluation function.
+ *
+ * \param[in]   t         pointer to table structure
+ * \param[in]   n_vals    number of values
+ * \param[in]   x_stride  stride between successive values of x
+ * \param[in]   y_stride  stride between successive values of y
+ * \param[in]   x         values on first axis
+ * \param[in]   y         values on second axis
+ * \param[in]   eval      property evaluation function
+ * \param[in]   input     input passed to evaluation function, or NULL
+ * \param[out]  val       resulting property values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_compute(const cs_phys_prop_table_t  *t,
+                           cs_lnum_t                    n_vals,
+                           cs_lnum_t                    x_stride,
+                           cs_lnum_t                    y_stride,
+                           const cs_real_t              x[],
+                           const cs_real_t              y[],
+                           cs_phys_prop_table_eval_t   *eval,
+                           void                        *input,
+                           cs_real_t                    val[])
+{
+  const cs_lnum_t s2 = CS_PHYS_PROP_TABLE_S*CS_PHYS_PROP_TABLE_S;
+
+  cs_lnum_t n_out = 0;
+
+# pragma omp parallel for reduction(+:n_out) if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+    cs_real_t u, w;
+    cs_lnum_t tile_id = _locate(t, x[ii*x_stride], y[ii*y_stride], &u, &w);
+    if (tile_id > -1)
+      val[ii] = _tile_interpolate(t->val + tile_id*s2, u, w);
+    else
+      n_out++;
+  }
+
+  if (n_out == 0)
+    return;
+
+  /* Fallback to exact values */
+
+  cs_lnum_t *out_ids;
+  cs_real_t *v1, *v2, *v_out;
+  BFT_MALLOC(out_ids, n_out, cs_lnum_t);
+  BFT_MALLOC(v1, n_out, cs_real_t);
+  BFT_MALLOC(v2, n_out, cs_real_t);
+  BFT_MALLOC(v_out, n_out, cs_real_t);
+
+  cs_lnum_t k = 0;
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+    cs_real_t u, w;
+    cs_real_t _x = x[ii*x_stride], _y = y[ii*y_stride];
+    if (_locate(t, _x, _y, &u, &w) < 0) {
+      out_ids[k] = ii;
+      v1[k] = _x;
+      v2[k] = _y;
+      k++;
+    }
+  }
+
+  eval(input, n_out, v1, v2, v_out);
+
+  for (k = 0; k < n_out; k++)
+    val[out_ids[k]] = v_out[k];
+
+  BFT_FREE(v_out);
+  BFT_FREE(v2);
+  BFT_FREE(v1);
+  BFT_FREE(out_ids);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the size and estimated error of a property table.
+ *
+ * \param[in]   t        pointer to table structure
+ * \param[out]  n_tiles  number of interpolated tiles, or NULL
+ * \param[out]  n_exact  number of tiles not interpolated, or NULL
+ * \param[out]  err      estimated max. relative error, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_get_info(const cs_phys_prop_table_t  *t,
+                            cs_lnum_t                   *n_tiles,
+                            cs_lnum_t                   *n_exact,
+                            cs_real_t                   *err)
+{
+  if (n_tiles != NULL)
+    *n_tiles = t->n_tiles;
+  if (n_exact != NULL)
+    *n_exact = t->n_exact;
+  if (err != NULL)
+    *err = t->err;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
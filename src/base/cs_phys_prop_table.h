@@ -0,0 +1,178 @@
+#ifndef __CS_PHYS_PROP_TABLE_H__
+#define __CS_PHYS_PROP_TABLE_H__
+
+/*============================================================================
+ * Adaptive tables for properties depending on two variables.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function evaluating a property at given points.
+ *
+ * Non-finite values may be returned where the property is not defined.
+ *
+ * \param[in]       input   pointer to optional (untyped) value or structure
+ * \param[in]       n_vals  number of values
+ * \param[in]       x       values on first axis
+ * \param[in]       y       values on second axis
+ * \param[out]      val     resulting property values
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_phys_prop_table_eval_t)(void             *input,
+                            cs_lnum_t         n_vals,
+                            const cs_real_t   x[],
+                            const cs_real_t   y[],
+                            cs_real_t         val[]);
+
+/* Opaque property table structure */
+
+typedef struct _cs_phys_prop_table_t  cs_phys_prop_table_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a property table.
+ *
+ * The domain is split into a quadtree of tiles, each holding values on
+ * a small regular grid. A tile is accepted when the relative difference
+ * between interpolated and exact values at the midpoints of its grid is
+ * lower than the given tolerance, and otherwise split in 4, so that only
+ * regions where the property varies sharply (such as near saturation)
+ * are refined. Tiles which still do not reach the tolerance at the
+ * finest level, or in which the evaluation function returns non-finite
+ * values, are not interpolated: the function is called for values
+ * in those tiles.
+ *
+ * Evaluations are shared among ranks, so this is a collective operation,
+ * and the resulting table is identical on all ranks.
+ *
+ * If a cache file path is given, the table is read from that file when
+ * its key matches, and written to it otherwise.
+ *
+ * \param[in]  name        property name (for logging)
+ * \param[in]  bounds      x_min, x_max, y_min, y_max
+ * \param[in]  rtol        target relative interpolation error
+ * \param[in]  n_max       maximum equivalent number of points per axis
+ * \param[in]  cache_path  path to cache file, or NULL
+ * \param[in]  cache_key   key identifying table settings in cache, or NULL
+ * \param[in]  eval        property evaluation function
+ * \param[in]  input       input passed to evaluation function, or NULL
+ *
+ * \return  pointer to new table structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_phys_prop_table_t *
+cs_phys_prop_table_build(const char                 *name,
+                         const cs_real_t             bounds[4],
+                         cs_real_t                   rtol,
+                         int                         n_max,
+                         const char                 *cache_path,
+                         const char                 *cache_key,
+                         cs_phys_prop_table_eval_t  *eval,
+                         void                       *input);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a property table.
+ *
+ * \param[in, out]  t  pointer to table structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_destroy(cs_phys_prop_table_t  **t);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute property values using a table.
+ *
+ * Values outside the table bounds or in tiles which are not interpolated
+ * are computed using the evaluation function.
+ *
+ * \param[in]   t         pointer to table structure
+ * \param[in]   n_vals    number of values
+ * \param[in]   x_stride  stride between successive values of x
+ * \param[in]   y_stride  stride between successive values of y
+ * \param[in]   x         values on first axis
+ * \param[in]   y         values on second axis
+ * \param[in]   eval      property evaluation function
+ * \param[in]   input     input passed to evaluation function, or NULL
+ * \param[out]  val       resulting property values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_compute(const cs_phys_prop_table_t  *t,
+                           cs_lnum_t                    n_vals,
+                           cs_lnum_t                    x_stride,
+                           cs_lnum_t                    y_stride,
+                           const cs_real_t              x[],
+                           const cs_real_t              y[],
+                           cs_phys_prop_table_eval_t   *eval,
+                           void                        *input,
+                           cs_real_t                    val[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the size and estimated error of a property table.
+ *
+ * \param[in]   t        pointer to table structure
+ * \param[out]  n_tiles  number of interpolated tiles, or NULL
+ * \param[out]  n_exact  number of tiles not interpolated, or NULL
+ * \param[out]  err      estimated max. relative error, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_get_info(const cs_phys_prop_table_t  *t,
+                            cs_lnum_t                   *n_tiles,
+                            cs_lnum_t                   *n_exact,
+                            cs_real_t                   *err);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PHYS_PROP_TABLE_H__ */
@@ -45,6 +45,9 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_phys_prop_table.h"
 #include "cs_property.h"
 
 /*----------------------------------------------------------------------------
@@ -91,6 +94,10 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Number of tabulated properties */
+
+#define CS_PHYS_PROP_N_TYPES (CS_PHYS_PROP_SPEED_OF_SOUND + 1)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -116,6 +123,26 @@ typedef struct {
 
 } cs_thermal_table_t;
 
+/* Tabulation options */
+
+typedef struct {
+
+  bool         active;               /* use tabulated properties ? */
+
+  cs_real_t    var1_min;             /* bounds on first plane axis */
+  cs_real_t    var1_max;
+  cs_real_t    var2_min;             /* bounds on second plane axis */
+  cs_real_t    var2_max;
+
+  cs_real_t    rtol;                 /* target relative error */
+  int          n_max;                /* maximum number of points per axis */
+
+  bool         tabulate[CS_PHYS_PROP_N_TYPES];  /* tabulated properties */
+
+  char        *cache_dir;            /* directory for disk cache, or NULL */
+
+} cs_phys_prop_tab_options_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer types
  *----------------------------------------------------------------------------*/
@@ -151,6 +178,32 @@ typedef void
 
 cs_thermal_table_t *cs_glob_thermal_table = NULL;
 
+static cs_phys_prop_tab_options_t  _tab_opts = {.active = false,
+                                                .var1_min = 0,
+                                                .var1_max = 0,
+                                                .var2_min = 0,
+                                                .var2_max = 0,
+                                                .rtol = 1e-5,
+                                                .n_max = 1025,
+                                                .tabulate = {false},
+                                                .cache_dir = NULL};
+
+static cs_phys_prop_table_t  *_tables[CS_PHYS_PROP_N_TYPES];
+
+static const char *_phys_prop_name[] = {"pressure",
+                                        "temperature",
+                                        "enthalpy",
+                                        "entropy",
+                                        "isobaric_heat_capacity",
+                                        "isochoric_heat_capacity",
+                                        "specific_volume",
+                                        "density",
+                                        "internal_energy",
+                                        "quality",
+                                        "thermal_conductivity",
+                                        "dynamic_viscosity",
+                                        "speed_of_sound"};
+
 #if defined(HAVE_DLOPEN) && defined(HAVE_EOS)
 
 static void                     *_cs_eos_dl_lib = NULL;
@@ -285,6 +338,257 @@ _physical_property_create(const char      *name,
   return pty;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a physical property using the selected thermodynamic library.
+ *
+ * parameters:
+ *   property     <-- property queried
+ *   n_vals       <-- number of values
+ *   var1_stride  <-- stride between successive values of var1
+ *   var2_stride  <-- stride between successive values of var2
+ *   var1         <-- values on first plane axis
+ *   var2         <-- values on second plane axis
+ *   val          --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_compute_exact(cs_phys_prop_type_t          property,
+                         cs_lnum_t                    n_vals,
+                         cs_lnum_t                    var1_stride,
+                         cs_lnum_t                    var2_stride,
+                         const cs_real_t              var1[],
+                         const cs_real_t              var2[],
+                         cs_real_t                    val[])
+{
+  cs_lnum_t        _n_vals = n_vals;
+  cs_real_t         _var2_c_single[1];
+  cs_real_t        *_var1_c = NULL, *_var2_c = NULL;
+  const cs_real_t  *var1_c = var1, *var2_c = var2;
+
+  if (n_vals < 1)
+    return;
+
+  /* Adapt to different strides to optimize for constant arrays */
+
+  if (var1_stride == 0 && var2_stride == 0)
+    _n_vals = 1;
+
+  if (var1_stride == 0 && n_vals > 1) {
+    BFT_MALLOC(_var1_c, n_vals, cs_real_t);
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      _var1_c[ii] = var1[0];
+    var1_c = _var1_c;
+  }
+
+  if (cs_glob_thermal_table->temp_scale == 2) {
+    if (_n_vals == 1) {
+      _var2_c_single[0] = var2[0] + 273.15;
+      var2_c = _var2_c_single;
+    }
+    else {
+      BFT_MALLOC(_var2_c, n_vals, cs_real_t);
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        _var2_c[ii] = var2[ii*var2_stride] + 273.15;
+      var2_c = _var2_c;
+    }
+  }
+  else {
+    if (var2_stride == 0 && n_vals > 1) {
+      BFT_MALLOC(_var2_c, n_vals, cs_real_t);
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        _var2_c[ii] = var2[0];
+      var2_c = _var2_c;
+    }
+  }
+
+  /* Compute proper */
+
+  if (cs_glob_thermal_table->type == 1) {
+    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
+                           property,
+                           _n_vals,
+                           var1_c,
+                           var2_c,
+                           val);
+  }
+#if defined(HAVE_EOS)
+  else if (cs_glob_thermal_table->type == 2) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      _n_vals,
+                      var1_c,
+                      var2_c,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  else if (cs_glob_thermal_table->type == 3) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           "HEOS",
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           _n_vals,
+                           var1_c,
+                           var2_c,
+                           val);
+  }
+#endif
+  BFT_FREE(_var1_c);
+  BFT_FREE(_var2_c);
+
+  /* In case of single value, apply to all */
+
+  if (_n_vals == 1) {
+    cs_real_t val_const = val[0];
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      val[ii] = val_const;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build a file name for the disk cache of a property table.
+ *
+ * The returned string is allocated, and should be freed by the caller.
+ *
+ * parameters:
+ *   property <-- property queried
+ *
+ * returns:
+ *   pointer to allocated file name, or NULL if no cache is used
+ *----------------------------------------------------------------------------*/
+
+static char *
+_tab_cache_path(cs_phys_prop_type_t  property)
+{
+  if (_tab_opts.cache_dir == NULL)
+    return NULL;
+
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+
+  const char *material = (tt->material != NULL) ? tt->material : "";
+  const char *method = (tt->method != NULL) ? tt->method : "";
+  const char *p_name = _phys_prop_name[property];
+
+  size_t l_dir = strlen(_tab_opts.cache_dir);
+  size_t l = l_dir + strlen(material) + strlen(method) + strlen(p_name) + 32;
+
+  char *path;
+  BFT_MALLOC(path, l, char);
+
+  snprintf(path, l, "%s%c%s_%s_%d_%s.tab",
+           _tab_opts.cache_dir, DIR_SEPARATOR,
+           material, method, (int)(tt->thermo_plane), p_name);
+  path[l-1] = '\0';
+
+  /* Replace characters which are not safe in file names */
+
+  for (size_t i = l_dir + 1; path[i] != '\0'; i++) {
+    char c = path[i];
+    if (! (   (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+           || (c >= '0' && c <= '9') || c == '_' || c == '.' || c == '-'))
+      path[i] = '_';
+  }
+
+  return path;
+}
+
+/*----------------------------------------------------------------------------
+ * Build key identifying table settings in the disk cache.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   key      --> key string
+ *   l        <-- key string buffer size
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_cache_key(cs_phys_prop_type_t   property,
+               char                  key[],
+               size_t                l)
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+
+  snprintf(key, l, "%s %s %d %d %d %a %a %a %a %a %d",
+           (tt->material != NULL) ? tt->material : "",
+           (tt->method != NULL) ? tt->method : "",
+           (int)(tt->thermo_plane), tt->temp_scale, (int)property,
+           _tab_opts.var1_min, _tab_opts.var1_max,
+           _tab_opts.var2_min, _tab_opts.var2_max,
+           _tab_opts.rtol, _tab_opts.n_max);
+  key[l-1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a property for a table, using the selected thermodynamic
+ * library.
+ *
+ * This function matches the cs_phys_prop_table_eval_t function type.
+ *
+ * parameters:
+ *   input  <-- pointer to property queried
+ *   n_vals <-- number of values
+ *   var1   <-- values on first plane axis
+ *   var2   <-- values on second plane axis
+ *   val    --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_eval(void             *input,
+          cs_lnum_t         n_vals,
+          const cs_real_t   var1[],
+          const cs_real_t   var2[],
+          cs_real_t         val[])
+{
+  const cs_phys_prop_type_t *property = input;
+
+  _phys_prop_compute_exact(*property, n_vals, 1, 1, var1, var2, val);
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether a property is one of the variables defining the
+ * thermodynamic plane (and may thus not be computed).
+ *
+ * parameters:
+ *   property <-- property queried
+ *
+ * returns:
+ *   true if the property is a plane variable, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_plane_variable(cs_phys_prop_type_t  property)
+{
+  cs_phys_prop_type_t v[2] = {CS_PHYS_PROP_PRESSURE,
+                              CS_PHYS_PROP_ENTHALPY};
+
+  switch (cs_glob_thermal_table->thermo_plane) {
+  case CS_PHYS_PROP_PLANE_PH:
+    break;
+  case CS_PHYS_PROP_PLANE_PT:
+    v[1] = CS_PHYS_PROP_TEMPERATURE;
+    break;
+  case CS_PHYS_PROP_PLANE_PS:
+    v[1] = CS_PHYS_PROP_ENTROPY;
+    break;
+  case CS_PHYS_PROP_PLANE_PU:
+    v[1] = CS_PHYS_PROP_INTERNAL_ENERGY;
+    break;
+  case CS_PHYS_PROP_PLANE_PV:
+    v[1] = CS_PHYS_PROP_SPECIFIC_VOLUME;
+    break;
+  case CS_PHYS_PROP_PLANE_TS:
+    v[0] = CS_PHYS_PROP_TEMPERATURE;
+    v[1] = CS_PHYS_PROP_ENTROPY;
+    break;
+  case CS_PHYS_PROP_PLANE_TX:
+    v[0] = CS_PHYS_PROP_TEMPERATURE;
+    v[1] = CS_PHYS_PROP_QUALITY;
+    break;
+  }
+
+  return (property == v[0] || property == v[1]);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -313,6 +617,7 @@ cs_thermal_table_set(const char                        *material,
   if (strcmp(method, "freesteam") == 0 ||
       strcmp(material, "user_material") == 0) {
     BFT_MALLOC(cs_glob_thermal_table->method,    strlen(method) +1,    char);
+    strcpy(cs_glob_thermal_table->method, method);
     if (strcmp(method, "freesteam") == 0)
       cs_glob_thermal_table->type = 1;
     else
@@ -320,6 +625,7 @@ cs_thermal_table_set(const char                        *material,
   }
   else if (strcmp(method, "CoolProp") == 0) {
     BFT_MALLOC(cs_glob_thermal_table->method,    strlen(method) +1,    char);
+    strcpy(cs_glob_thermal_table->method, method);
     cs_glob_thermal_table->type = 3;
 #if defined(HAVE_COOLPROP)
 #if defined(HAVE_PLUGINS)
@@ -408,6 +714,166 @@ cs_thermal_table_finalize(void)
     BFT_FREE(cs_glob_thermal_table->method);
     BFT_FREE(cs_glob_thermal_table);
   }
+
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++) {
+    cs_phys_prop_table_destroy(_tables + i);
+    _tab_opts.tabulate[i] = false;
+  }
+
+  BFT_FREE(_tab_opts.cache_dir);
+  _tab_opts.active = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of properties computed with the thermal table.
+ *
+ * Tables are built by \ref cs_thermal_table_build_tabulation, using
+ * tiles of the thermodynamic plane which are refined locally until the
+ * relative difference between interpolated and exact values is lower than
+ * the given tolerance (with a resolution of at most 1025 points per axis).
+ * Values outside the table bounds, or in tiles where the tolerance is not
+ * reached (typically across saturation) or where the library does not
+ * return finite values, are computed using the thermodynamic library.
+ *
+ * Density, dynamic viscosity, isobaric heat capacity, thermal conductivity
+ * and temperature (when not a plane variable) are tabulated, unless
+ * properties are selected with \ref cs_thermal_table_tabulate_property.
+ *
+ * Bounds are given in the units of values passed to
+ * \ref cs_phys_prop_compute (i.e. Celsius if the temperature scale is
+ * Celsius).
+ *
+ * If a cache directory is given, tables are saved in that directory,
+ * and reused by later computations using the same settings.
+ *
+ * \param[in]  var1_min   minimum value on first plane axis
+ * \param[in]  var1_max   maximum value on first plane axis
+ * \param[in]  var2_min   minimum value on second plane axis
+ * \param[in]  var2_max   maximum value on second plane axis
+ * \param[in]  rtol       target relative interpolation error
+ * \param[in]  cache_dir  directory for table cache, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_set_tabulation(cs_real_t    var1_min,
+                                cs_real_t    var1_max,
+                                cs_real_t    var2_min,
+                                cs_real_t    var2_max,
+                                cs_real_t    rtol,
+                                const char  *cache_dir)
+{
+  if (! (var1_max > var1_min && var2_max > var2_min && rtol > 0))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid bounds or tolerance for thermal tables\n"
+                "  (var1: [%g, %g], var2: [%g, %g], rtol: %g)."),
+              __func__, var1_min, var1_max, var2_min, var2_max, rtol);
+
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++)
+    cs_phys_prop_table_destroy(_tables + i);
+
+  _tab_opts.active = true;
+
+  _tab_opts.var1_min = var1_min;
+  _tab_opts.var1_max = var1_max;
+  _tab_opts.var2_min = var2_min;
+  _tab_opts.var2_max = var2_max;
+  _tab_opts.rtol = rtol;
+
+  BFT_FREE(_tab_opts.cache_dir);
+  if (cache_dir != NULL) {
+    BFT_MALLOC(_tab_opts.cache_dir, strlen(cache_dir) + 1, char);
+    strcpy(_tab_opts.cache_dir, cache_dir);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select a property to tabulate.
+ *
+ * If this function is not called, a default set of properties is tabulated
+ * (see \ref cs_thermal_table_set_tabulation).
+ *
+ * \param[in]  property  property to tabulate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_tabulate_property(cs_phys_prop_type_t  property)
+{
+  _tab_opts.tabulate[property] = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build tables of properties computed with the thermal table,
+ *        if tabulation is active.
+ *
+ * Tables are read from the cache directory if available. Otherwise,
+ * library evaluations are shared among ranks, and the resulting tables
+ * are identical on all ranks.
+ *
+ * This is a collective operation, which should be called once the
+ * thermal table and tabulation options are defined, before the time loop.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_build_tabulation(void)
+{
+  if (   _tab_opts.active == false
+      || cs_glob_thermal_table == NULL
+      || cs_glob_thermal_table->type < 1)
+    return;
+
+  bool tabulate[CS_PHYS_PROP_N_TYPES];
+
+  bool user_select = false;
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++) {
+    tabulate[i] = _tab_opts.tabulate[i];
+    if (tabulate[i])
+      user_select = true;
+  }
+
+  if (user_select == false) {
+    tabulate[CS_PHYS_PROP_TEMPERATURE] = true;
+    tabulate[CS_PHYS_PROP_ISOBARIC_HEAT_CAPACITY] = true;
+    tabulate[CS_PHYS_PROP_DENSITY] = true;
+    tabulate[CS_PHYS_PROP_THERMAL_CONDUCTIVITY] = true;
+    tabulate[CS_PHYS_PROP_DYNAMIC_VISCOSITY] = true;
+  }
+
+  if (_tab_opts.cache_dir != NULL && cs_glob_rank_id < 1)
+    cs_file_mkdir_default(_tab_opts.cache_dir);
+
+  const cs_real_t bounds[4] = {_tab_opts.var1_min, _tab_opts.var1_max,
+                               _tab_opts.var2_min, _tab_opts.var2_max};
+
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++) {
+
+    cs_phys_prop_type_t property = i;
+
+    cs_phys_prop_table_destroy(_tables + i);
+
+    if (tabulate[i] == false || _is_plane_variable(property))
+      continue;
+
+    char key[512];
+    _tab_cache_key(property, key, 512);
+    char *path = _tab_cache_path(property);
+
+    _tables[i] = cs_phys_prop_table_build(_phys_prop_name[i],
+                                          bounds,
+                                          _tab_opts.rtol,
+                                          _tab_opts.n_max,
+                                          path,
+                                          key,
+                                          _tab_eval,
+                                          &property);
+
+    BFT_FREE(path);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -438,89 +904,35 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
                      const cs_real_t              var2[],
                      cs_real_t                    val[])
 {
-  cs_lnum_t        _n_vals = n_vals;
-  cs_real_t         _var2_c_single[1];
-  cs_real_t        *_var1_c = NULL, *_var2_c = NULL;
-  const cs_real_t  *var1_c = var1, *var2_c = var2;
-
   if (n_vals < 1)
     return;
 
-  /* Adapt to different strides to optimize for constant arrays */
+  /* Use tabulated values when possible */
 
-  if (var1_stride == 0 && var2_stride == 0)
-    _n_vals = 1;
+  if (   _tables[property] != NULL
+      && (var1_stride != 0 || var2_stride != 0)
+      && n_vals > 1) {
 
-  if (var1_stride == 0 && n_vals > 1) {
-    BFT_MALLOC(_var1_c, n_vals, cs_real_t);
-    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
-      _var1_c[ii] = var1[0];
-    var1_c = _var1_c;
-  }
+    cs_phys_prop_table_compute(_tables[property],
+                               n_vals,
+                               var1_stride,
+                               var2_stride,
+                               var1,
+                               var2,
+                               _tab_eval,
+                               &property,
+                               val);
 
-  if (cs_glob_thermal_table->temp_scale == 2) {
-    if (_n_vals == 1) {
-      _var2_c_single[0] = var2[0] + 273.15;
-      var2_c = _var2_c_single;
-    }
-    else {
-      BFT_MALLOC(_var2_c, n_vals, cs_real_t);
-      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
-        _var2_c[ii] = var2[ii*var2_stride] + 273.15;
-      var2_c = _var2_c;
-    }
-  }
-  else {
-    if (var2_stride == 0 && n_vals > 1) {
-      BFT_MALLOC(_var2_c, n_vals, cs_real_t);
-      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
-        _var2_c[ii] = var2[0];
-      var2_c = _var2_c;
-    }
+    return;
   }
 
-  /* Compute proper */
-
-  if (cs_glob_thermal_table->type == 1) {
-    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
+  _phys_prop_compute_exact(property,
+                           n_vals,
+                           var1_stride,
+                           var2_stride,
+                           var1,
+                           var2,
                            val);
-  }
-#if defined(HAVE_EOS)
-  else if (cs_glob_thermal_table->type == 2) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  else if (cs_glob_thermal_table->type == 3) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           "HEOS",
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#endif
-  BFT_FREE(_var1_c);
-  BFT_FREE(_var2_c);
-
-  /* In case of single value, apply to all */
-
-  if (_n_vals == 1) {
-    cs_real_t val_const = val[0];
-    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
-      val[ii] = val_const;
-  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -89,6 +89,61 @@ cs_thermal_table_set(const char                        *material,
 void
 cs_thermal_table_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Activate tabulation of properties computed with the thermal table.
+ *
+ * Tables are built by cs_thermal_table_build_tabulation, using tiles of
+ * the thermodynamic plane which are refined locally until the relative
+ * difference between interpolated and exact values is lower than the
+ * given tolerance. Values outside the table bounds, or in tiles where the
+ * tolerance is not reached or the library does not return finite values,
+ * are computed using the thermodynamic library.
+ *
+ * Bounds are given in the units of values passed to cs_phys_prop_compute.
+ *
+ * If a cache directory is given, tables are saved in that directory,
+ * and reused by later computations using the same settings.
+ *
+ * parameters:
+ *   var1_min  <-- minimum value on first plane axis
+ *   var1_max  <-- maximum value on first plane axis
+ *   var2_min  <-- minimum value on second plane axis
+ *   var2_max  <-- maximum value on second plane axis
+ *   rtol      <-- target relative interpolation error
+ *   cache_dir <-- directory for table cache, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_set_tabulation(cs_real_t    var1_min,
+                                cs_real_t    var1_max,
+                                cs_real_t    var2_min,
+                                cs_real_t    var2_max,
+                                cs_real_t    rtol,
+                                const char  *cache_dir);
+
+/*----------------------------------------------------------------------------
+ * Select a property to tabulate.
+ *
+ * If this function is not called, a default set of properties is tabulated.
+ *
+ * parameters:
+ *   property <-- property to tabulate
+ *----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_tabulate_property(cs_phys_prop_type_t  property);
+
+/*----------------------------------------------------------------------------
+ * Build tables of properties computed with the thermal table,
+ * if tabulation is active.
+ *
+ * This is a collective operation, which should be called once the
+ * thermal table and tabulation options are defined, before the time loop.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_build_tabulation(void);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
@@ -57,8 +57,11 @@
 #include "cs_interface.h"
 #include "cs_mesh.h"
 #include "cs_mesh_cartesian.h"
+#include "cs_mesh_cgns.h"
+#include "cs_mesh_gmsh.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
+#include "cs_mesh_med.h"
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_io.h"
@@ -113,6 +116,9 @@ typedef struct {
 
   int         *gc_id_shift;
 
+  bool         direct_import;  /* true if mesh data was imported directly
+                                 to the builder when reading headers */
+
   int          n_perio_read;
   cs_lnum_t    n_cells_read;
   cs_lnum_t    n_faces_read;
@@ -261,6 +267,8 @@ _mesh_reader_create(int                 *n_mesh_files,
   for (i = 0; i < mr->n_files; i++)
     mr->gc_id_shift[i] = 0;
 
+  mr->direct_import = false;
+
   mr->n_perio_read = 0;
   mr->n_cells_read = 0;
   mr->n_faces_read = 0;
@@ -568,6 +576,66 @@ _colors_to_groups(cs_mesh_t  *mesh,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a mesh file may be imported directly, bypassing the Preprocessor.
+ *
+ * parameters
+ *   filename <-- file name
+ *
+ * returns:
+ *   true if the file is handled by a direct import reader
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_direct_import_file(const char  *filename)
+{
+  if (cs_mesh_gmsh_is_gmsh_file(filename))
+    return true;
+
+#if defined(HAVE_CGNS)
+  if (cs_mesh_cgns_is_cgns_file(filename))
+    return true;
+#endif
+
+#if defined(HAVE_MED)
+  if (cs_mesh_med_is_med_file(filename))
+    return true;
+#endif
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a mesh file directly to the mesh builder, bypassing the Preprocessor.
+ *
+ * parameters
+ *   filename     <-- file name
+ *   mesh         <-> pointer to mesh structure
+ *   mesh_builder <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_direct_import(const char         *filename,
+               cs_mesh_t          *mesh,
+               cs_mesh_builder_t  *mesh_builder)
+{
+#if defined(HAVE_CGNS)
+  if (cs_mesh_cgns_is_cgns_file(filename)) {
+    cs_mesh_cgns_read(filename, mesh, mesh_builder);
+    return;
+  }
+#endif
+
+#if defined(HAVE_MED)
+  if (cs_mesh_med_is_med_file(filename)) {
+    cs_mesh_med_read(filename, mesh, mesh_builder);
+    return;
+  }
+#endif
+
+  cs_mesh_gmsh_read(filename, mesh, mesh_builder);
+}
+
 /*----------------------------------------------------------------------------
  * Read sections from the pre-processor about the dimensions of mesh
  *
@@ -2128,7 +2196,10 @@ cs_preprocessor_check_perio(void)
   _n_max_mesh_files = 0;
 
   for (int i = 0; i < _n_mesh_files; i++) {
-    retval = _read_perio_info((_mesh_file_info + i)->filename);
+    const char *filename = (_mesh_file_info + i)->filename;
+    if (_is_direct_import_file(filename))
+      continue;
+    retval = _read_perio_info(filename);
     perio_flag = CS_MAX(retval, perio_flag);
   }
 
@@ -2173,8 +2244,19 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
     mr = _cs_glob_mesh_reader;
 
-    for (file_id = 0; file_id < mr->n_files; file_id++)
-      _read_dimensions(mesh, mesh_builder, mr, file_id);
+    /* Direct import of a single Gmsh, CGNS or MED file: data is read and
+       distributed to the builder immediately, bypassing the Preprocessor */
+
+    if (   mr->n_files == 1
+        && _is_direct_import_file(mr->file_info[0].filename)) {
+      _direct_import(mr->file_info[0].filename, mesh, mesh_builder);
+      mr->direct_import = true;
+    }
+
+    else {
+      for (file_id = 0; file_id < mr->n_files; file_id++)
+        _read_dimensions(mesh, mesh_builder, mr, file_id);
+    }
   }
 
   /* Return values */
@@ -2229,13 +2311,18 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   _mesh_reader_t  *mr = _cs_glob_mesh_reader;
 
   bool pre_partitioned = false;
+  bool direct_import = (mr != NULL && mr->direct_import);
 
   /* Check for existing partitioning and cell block info (set by
      cs_mesh_to_builder_partition and valid if the global number of
      cells has not changed), in which case the existing
-     partitioning may be used */
+     partitioning may be used; with direct import, block info
+     is already defined */
 
-  if (mesh_builder->have_cell_rank) {
+  if (direct_import)
+    mesh_builder->have_cell_rank = false;
+
+  else if (mesh_builder->have_cell_rank) {
 
     cs_block_dist_info_t cell_bi_ref;
     memcpy(&cell_bi_ref,
@@ -2268,6 +2355,8 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
     cs_mesh_cartesian_connectivity(mesh, mesh_builder, echo);
     mesh->modified |= CS_MESH_MODIFIED;
   }
+  else if (direct_import)
+    mesh->modified |= CS_MESH_MODIFIED;
   else {
     for (file_id = 0; file_id < mr->n_files; file_id++)
       _read_data(file_id, mesh, mesh_builder, mr, echo);
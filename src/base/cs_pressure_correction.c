@@ -2544,6 +2544,8 @@ cs_pressure_correction(int        iterns,
     }
   }
 
+  cs_field_increment_version(f_p);
+
   /* Transformation of volume fluxes into mass fluxes */
 
   if (idilat == 4) {
@@ -197,6 +197,7 @@ static int _restart_present = -1;
 /* Restart time steps and frequency */
 
 static int    _checkpoint_mesh = 1;          /* checkpoint mesh if possible */
+static bool   _checkpoint_compress = false;  /* compress checkpoint data */
 /* time step interval */
 static int    _checkpoint_nt_interval = CS_RESTART_INTERVAL_ONLY_AT_END;
 static int    _checkpoint_nt_next = -1;      /* next forced time step */
@@ -376,6 +377,8 @@ _add_file(cs_restart_t  *r)
                                hints,
                                block_comm,
                                comm);
+      if (_checkpoint_compress)
+        cs_io_set_compression(r->fh, CS_COMPRESS_LOSSLESS, 0.);
     }
   }
 #else
@@ -395,6 +398,8 @@ _add_file(cs_restart_t  *r)
                                CS_IO_MODE_WRITE,
                                method,
                                echo);
+      if (_checkpoint_compress)
+        cs_io_set_compression(r->fh, CS_COMPRESS_LOSSLESS, 0.);
     }
   }
 #endif
@@ -1913,6 +1918,24 @@ cs_restart_checkpoint_set_mesh_mode(int  mode)
   _checkpoint_mesh = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define whether checkpoint data should be compressed.
+ *
+ * Compression is lossless, and decompression is handled transparently
+ * when reading, so restarting from compressed checkpoint files does not
+ * require any specific setting.
+ *
+ * \param[in]  compress  true if checkpoint data should be compressed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(bool  compress)
+{
+  _checkpoint_compress = compress;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
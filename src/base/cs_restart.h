@@ -320,6 +320,21 @@ cs_restart_checkpoint_set_defaults(int     nt_interval,
 void
 cs_restart_checkpoint_set_mesh_mode(int  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define whether checkpoint data should be compressed.
+ *
+ * Compression is lossless, and decompression is handled transparently
+ * when reading, so restarting from compressed checkpoint files does not
+ * require any specific setting.
+ *
+ * \param[in]  compress  true if checkpoint data should be compressed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(bool  compress);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
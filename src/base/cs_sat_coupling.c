@@ -976,7 +976,10 @@ void CS_PROCF (defloc, DEFLOC)
   if (coupl->cell_loc_sel != NULL) BFT_FREE(c_elt_list);
   if (coupl->face_loc_sel != NULL) BFT_FREE(f_elt_list);
 
-  /* Build and initialize associated locator */
+  /* Build and initialize associated locator; if already present,
+     the coupled meshes have moved, so only update the location */
+
+  bool relocate = (coupl->localis_cel != NULL && coupl->localis_fbr != NULL);
 
 #if defined(PLE_HAVE_MPI)
 
@@ -1022,19 +1025,33 @@ void CS_PROCF (defloc, DEFLOC)
                     point_tag);
   }
 
-  ple_locator_set_mesh(coupl->localis_cel,
-                       coupl->cells_sup,
-                       locator_options,
-                       0.,
-                       coupl->tolerance,
-                       3,
-                       nbr_cel_cpl,
-                       c_elt_list,
-                       point_tag,
-                       mesh_quantities->cell_cen,
-                       NULL,
-                       cs_coupling_mesh_extents,
-                       cs_coupling_point_in_mesh_p);
+  if (relocate)
+    ple_locator_relocate(coupl->localis_cel,
+                         coupl->cells_sup,
+                         0.,
+                         coupl->tolerance,
+                         1,
+                         nbr_cel_cpl,
+                         c_elt_list,
+                         point_tag,
+                         mesh_quantities->cell_cen,
+                         NULL,
+                         cs_coupling_mesh_extents,
+                         cs_coupling_point_in_mesh_p);
+  else
+    ple_locator_set_mesh(coupl->localis_cel,
+                         coupl->cells_sup,
+                         locator_options,
+                         0.,
+                         coupl->tolerance,
+                         3,
+                         nbr_cel_cpl,
+                         c_elt_list,
+                         point_tag,
+                         mesh_quantities->cell_cen,
+                         NULL,
+                         cs_coupling_mesh_extents,
+                         cs_coupling_point_in_mesh_p);
 
   BFT_FREE(point_tag);
 
@@ -1065,19 +1082,33 @@ void CS_PROCF (defloc, DEFLOC)
                     point_tag);
   }
 
-  ple_locator_set_mesh(coupl->localis_fbr,
-                       support_fbr,
-                       locator_options,
-                       0.,
-                       coupl->tolerance,
-                       3,
-                       nbr_fbr_cpl,
-                       f_elt_list,
-                       point_tag,
-                       mesh_quantities->b_face_cog,
-                       NULL,
-                       cs_coupling_mesh_extents,
-                       cs_coupling_point_in_mesh_p);
+  if (relocate)
+    ple_locator_relocate(coupl->localis_fbr,
+                         support_fbr,
+                         0.,
+                         coupl->tolerance,
+                         (support_fbr == coupl->cells_sup) ? 1 : 0,
+                         nbr_fbr_cpl,
+                         f_elt_list,
+                         point_tag,
+                         mesh_quantities->b_face_cog,
+                         NULL,
+                         cs_coupling_mesh_extents,
+                         cs_coupling_point_in_mesh_p);
+  else
+    ple_locator_set_mesh(coupl->localis_fbr,
+                         support_fbr,
+                         locator_options,
+                         0.,
+                         coupl->tolerance,
+                         3,
+                         nbr_fbr_cpl,
+                         f_elt_list,
+                         point_tag,
+                         mesh_quantities->b_face_cog,
+                         NULL,
+                         cs_coupling_mesh_extents,
+                         cs_coupling_point_in_mesh_p);
 
   BFT_FREE(point_tag);
 
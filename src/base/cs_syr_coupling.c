@@ -132,6 +132,16 @@ typedef struct {
 
   double            *hvol;           /* Volumetric exchange coefficient. */
 
+  /* Saved arrays for relaxation and lagged exchange (surface coupling) */
+
+  cs_real_t         *tsolid_relax;   /* Wall temperature applied at previous
+                                        exchange (relaxation), or NULL */
+  cs_real_t         *tf_hf_lag;      /* Fluid temperature and exchange
+                                        coefficient saved for lagged
+                                        exchange, or NULL */
+  bool               lag_saved;      /* true if tf_hf_lag values are
+                                        to be sent at next exchange */
+
 } cs_syr_coupling_ent_t ;
 
 /* Structure associated with Syrthes coupling */
@@ -187,6 +197,9 @@ static int  _syr_post_mesh_ext[2] = {0, 1};
 
 static int  _syr_coupling_conservativity = 0; /* No forcing by default */
 static int  _syr_coupling_implicit = 1;
+static int  _syr_coupling_lagged = 0;   /* Synchronous exchange by default */
+
+static double  _syr_coupling_relax = 1.; /* No wall temperature relaxation */
 
 /*============================================================================
  * Private function definitions
@@ -566,6 +579,10 @@ _create_coupled_ent(cs_syr_coupling_t  *syr_coupling,
 
   coupling_ent->hvol = NULL;
 
+  coupling_ent->tsolid_relax = NULL;
+  coupling_ent->tf_hf_lag = NULL;
+  coupling_ent->lag_saved = false;
+
   if (syr_coupling->verbosity > 0) {
     bft_printf(_("\nExtracting coupled mesh             ..."));
     bft_printf_flush();
@@ -1118,6 +1135,9 @@ _destroy_coupled_ent(cs_syr_coupling_ent_t  **coupling_ent)
   if (ce->hvol != NULL)
     BFT_FREE(ce->hvol);
 
+  BFT_FREE(ce->tsolid_relax);
+  BFT_FREE(ce->tf_hf_lag);
+
   if (ce->elts != NULL)
     ce->elts = fvm_nodal_destroy(ce->elts);
 
@@ -1732,8 +1752,29 @@ _syr_coupling_recv_tsolid(cs_syr_coupling_t  *syr_coupling,
       for (i = 0; i < coupling_ent->n_elts; i++)
         coupling_ent->solid_temp[i] = tsolid[i];
     }
-    else
+    else {
+
+      /* Relaxation of the applied wall temperature (the first received
+         values are used as is) */
+
+      if (_syr_coupling_relax < 1.) {
+        const cs_real_t r = _syr_coupling_relax;
+        cs_real_t *t_prev = coupling_ent->tsolid_relax;
+        if (t_prev == NULL) {
+          BFT_MALLOC(coupling_ent->tsolid_relax, coupling_ent->n_elts,
+                     cs_real_t);
+          t_prev = coupling_ent->tsolid_relax;
+        }
+        else {
+          for (cs_lnum_t i = 0; i < coupling_ent->n_elts; i++)
+            tsolid[i] = r*tsolid[i] + (1. - r)*t_prev[i];
+        }
+        for (cs_lnum_t i = 0; i < coupling_ent->n_elts; i++)
+          t_prev[i] = tsolid[i];
+      }
+
       _post_var_update(coupling_ent, 0, tsolid);
+    }
   }
 }
 
@@ -2323,6 +2364,52 @@ cs_syr_coupling_set_explicit_treatment(void)
   _syr_coupling_implicit = 0;
 }
 
+/*----------------------------------------------------------------------------
+ * Set lagged (staggered) exchange flag to True (1) or False (0) for
+ * SYRTHES surface couplings.
+ *
+ * With lagged exchange, the fluid temperature and exchange coefficient
+ * computed at the end of a time step are sent to SYRTHES at the beginning
+ * of the next time step, right after the solid temperature is received,
+ * so that SYRTHES solves concurrently with the fluid time step instead of
+ * both codes waiting for each other. The solid temperature used at a
+ * given time step is thus lagged by one time step.
+ *
+ * The exchange sequence seen by SYRTHES is unchanged.
+ *
+ * parameter:
+ *   flag     <--  Lagged exchange flag to set
+ *----------------------------------------------------------------------------*/
+
+void
+cs_syr_coupling_set_lagged_exchange(int  flag)
+{
+  assert(flag == 0 || flag == 1);
+  _syr_coupling_lagged = flag;
+}
+
+/*----------------------------------------------------------------------------
+ * Set relaxation factor for the wall temperature received from SYRTHES
+ * in surface couplings.
+ *
+ * The applied wall temperature is r.T_solid + (1-r).T_previous; values
+ * lower than 1 help stabilize lagged exchanges.
+ *
+ * parameter:
+ *   relax    <--  Relaxation factor, in ]0, 1] (1: no relaxation)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_syr_coupling_set_relaxation(double  relax)
+{
+  if (relax <= 0. || relax > 1.)
+    bft_error(__FILE__, __LINE__, 0,
+              _("SYRTHES coupling relaxation factor must be in ]0, 1],\n"
+                "not %g."), relax);
+
+  _syr_coupling_relax = relax;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log SYRTHES coupling setup information.
@@ -2367,6 +2454,15 @@ cs_syr_coupling_log_setup(void)
          "    with             %d volume coupling(s)\n"),
          n_surf_coupl, n_vol_coupl);
 
+    if (n_surf_coupl > 0)
+      cs_log_printf
+        (CS_LOG_SETUP,
+         _("    surface exchange:    %s\n"
+           "    wall temperature\n"
+           "      relaxation:        %g\n"),
+         (_syr_coupling_lagged) ? _("lagged") : _("synchronous"),
+         _syr_coupling_relax);
+
     cs_log_printf
       (CS_LOG_SETUP,
        _("\n"
@@ -2511,6 +2607,17 @@ cs_syr_coupling_recv_boundary(int        nvar,
       BFT_MALLOC(t_solid, n_cpl_faces, cs_real_t);
       _syr_coupling_recv_tsolid(syr_coupling, t_solid, 0);
 
+      /* With lagged exchange, send values saved at the end of the
+         previous time step right away, so that SYRTHES solves
+         concurrently with the current fluid time step. */
+
+      if (coupling_ent->lag_saved)
+        _syr_coupling_send_tf_hf(syr_coupling,
+                                 f_ids,
+                                 coupling_ent->tf_hf_lag,
+                                 coupling_ent->tf_hf_lag + n_cpl_faces,
+                                 0);
+
       /*  For scalars coupled with SYRTHES, prescribe a Dirichlet
           condition at coupled faces.
           For the time being, pass here only once, as only one scalar is
@@ -2768,7 +2875,30 @@ cs_syr_coupling_send_boundary(const cs_real_t  h_wall[],
 
     }
 
-    _syr_coupling_send_tf_hf(syr_coupling, f_ids, t_fluid, h_cpl, 0);
+    /* With lagged exchange, values are saved and sent at the beginning
+       of the next time step; they are sent immediately for the first
+       exchange only, as the solid temperature was not lagged yet. */
+
+    if (_syr_coupling_lagged) {
+
+      if (coupling_ent->tf_hf_lag == NULL)
+        BFT_MALLOC(coupling_ent->tf_hf_lag, n_cpl_faces*2, cs_real_t);
+
+      cs_real_t *tf_lag = coupling_ent->tf_hf_lag;
+      cs_real_t *hf_lag = coupling_ent->tf_hf_lag + n_cpl_faces;
+      for (cs_lnum_t i = 0; i < n_cpl_faces; i++) {
+        tf_lag[i] = t_fluid[i];
+        hf_lag[i] = h_cpl[i];
+      }
+
+      if (coupling_ent->lag_saved == false) {
+        _syr_coupling_send_tf_hf(syr_coupling, f_ids, t_fluid, h_cpl, 0);
+        coupling_ent->lag_saved = true;
+      }
+
+    }
+    else
+      _syr_coupling_send_tf_hf(syr_coupling, f_ids, t_fluid, h_cpl, 0);
 
   } /* End loop on couplings */
 
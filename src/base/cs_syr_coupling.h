@@ -152,6 +152,32 @@ cs_syr_coupling_set_conservativity(int  flag);
 void
 cs_syr_coupling_set_explicit_treatment(void);
 
+/*----------------------------------------------------------------------------
+ * Set lagged (staggered) exchange flag to True (1) or False (0) for
+ * SYRTHES surface couplings.
+ *
+ * With lagged exchange, the fluid temperature and exchange coefficient
+ * computed at the end of a time step are sent to SYRTHES at the beginning
+ * of the next time step, so that both codes solve concurrently.
+ *
+ * parameter:
+ *   flag     <--  Lagged exchange flag to set
+ *----------------------------------------------------------------------------*/
+
+void
+cs_syr_coupling_set_lagged_exchange(int  flag);
+
+/*----------------------------------------------------------------------------
+ * Set relaxation factor for the wall temperature received from SYRTHES
+ * in surface couplings.
+ *
+ * parameter:
+ *   relax    <--  Relaxation factor, in ]0, 1] (1: no relaxation)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_syr_coupling_set_relaxation(double  relax);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log SYRTHES coupling setup information.
@@ -49,6 +49,7 @@
 #include "cs_coupling.h"
 #include "cs_cell_to_vertex.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_field_operator.h"
 #include "cs_gradient.h"
 #include "cs_gui.h"
 #include "cs_gui_mesh.h"
@@ -57,6 +58,7 @@
 #include "cs_join.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
+#include "cs_les_filter.h"
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
@@ -1122,7 +1124,9 @@ _update_mesh(bool     restart_mode,
   }
 
   cs_gradient_free_quantities();
+  cs_field_gradient_cache_clear();
   cs_cell_to_vertex_free();
+  cs_les_filter_free();
   cs_mesh_adjacencies_update_mesh();
 
   /* Update linear algebra APIs relative to mesh */
@@ -199,6 +199,7 @@ if (ndircp.eq.0) then
   do iel = 1, ncel
     cvar_var(iel) = grand
   enddo
+  call field_increment_version(f_id)
   return
 endif
 
@@ -291,6 +292,7 @@ do iel = 1, ncel
     cvar_var(iel) = epzero*(cell_f_vol(iel))**(1.d0/3.d0)
   endif
 enddo
+call field_increment_version(f_id)
 
 if (irangp.ge.0) then
   call parcpt(mmprpl)
@@ -349,6 +351,7 @@ do iel = 1, ncel
     counter = counter + 1
   endif
 enddo
+call field_increment_version(f_id)
 
 if (irangp.ge.0) then
   call parcpt(counter)
@@ -223,6 +223,7 @@ if (infpar.eq.0) then
   do iel = 1, ncelet
     cvar_var(iel) = grand
   enddo
+  call field_increment_version(f_id_yplus)
 
   return
 endif
@@ -242,6 +243,7 @@ if (ntcabs.eq.1) then
   do iel = 1, ncel
     cvar_var(iel) = grand
   enddo
+  call field_increment_version(f_id_yplus)
 
   if (vcopt%iwarni.ge.1) then
     write(nfecra,7000)
@@ -534,6 +536,7 @@ enddo
 do iel = 1, ncel
   cvar_var(iel) = dvarp(iel)*w_dist(iel)
 enddo
+call field_increment_version(f_id_yplus)
 
 dismax = -grand
 dismin =  grand
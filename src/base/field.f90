@@ -387,6 +387,17 @@ module field
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function indicating field values have been modified
+
+    subroutine cs_field_increment_version(f)  &
+      bind(C, name='cs_field_increment_version')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      type(c_ptr), value :: f
+    end subroutine cs_field_increment_version
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function returning field's value pointer and dimensions.
 
     ! If the field id is not valid, a fatal error is provoked.
@@ -1256,6 +1267,38 @@ contains
 
   !=============================================================================
 
+  !> \brief  Indicate that field values have been modified
+
+  !> This increments the field's modification counter, so that cached
+  !> derived quantities (such as gradients) are recomputed.
+
+  !> \param[in]  id  field id
+
+  subroutine field_increment_version(id)
+
+    use, intrinsic :: iso_c_binding
+    implicit none
+
+    ! Arguments
+
+    integer, intent(in) :: id
+
+    ! Local variables
+
+    integer(c_int) :: c_id
+    type(c_ptr)    :: f
+
+    c_id = id
+
+    f = cs_field_by_id(c_id)
+    call cs_field_increment_version(f)
+
+    return
+
+  end subroutine field_increment_version
+
+  !=============================================================================
+
   !> \brief  Query if a given key has been set for a field.
 
   !> If the key id is not valid, or the field category is not
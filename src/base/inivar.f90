@@ -642,6 +642,12 @@ endif
 
 call user_extra_operations_initialize()
 
+! Variable values may have been modified in place above
+
+do ivar = 1, nvar
+  call field_increment_version(ivarfl(ivar))
+enddo
+
 !===============================================================================
 ! 5.  IMPRESSIONS DE CONTROLE POUR LES INCONNUES, LE PAS DE TEMPS
 !        LE CUMUL DES DUREE POUR LES MOYENNES
@@ -1188,6 +1188,9 @@ endif
 ! Bad cells regularisation
 call cs_bad_cells_regularisation_vector(vel, 1)
 
+! Velocity values have been updated
+call field_increment_version(ivarfl(iu))
+
 ! Mass flux initialization for VOF algorithm
 if (ivofmt.gt.0) then
   do ifac = 1, nfac
@@ -392,6 +392,9 @@ if ((i_mass_transfer.ne.0.and.dt(1).gt.dtmaxg).or.i_mass_transfer.eq.0) then
 
 endif
 
+! Values may have been clipped
+call field_increment_version(ivarfl(ivar))
+
 call log_iteration_clipping_field(ivarfl(ivar), iclmin(1), iclmax(1), &
                                   vmin, vmax, iclmin(1), iclmax(1))
 
@@ -80,9 +80,13 @@ double precision dt(ncelet)
 integer          iscal, ivar, iel, isou
 integer          ii, iisc, itspdv, icalc, iappel
 integer          ispecf, scal_id, f_id, f_dim
+integer          ipotcp, isolve, f_id_pr, f_id_pi
+integer          iuts, jj, jscal
+integer, save :: iutspt = -1
 
 double precision, allocatable, dimension(:) :: dtr
 double precision, allocatable, dimension(:) :: viscf, viscb
+double precision, allocatable, dimension(:) :: smbrs, rovsdt
 
 double precision, dimension(:), pointer :: cvar_var, cvara_var
 double precision, dimension(:,:), pointer :: cvar_vav, cvara_vav
@@ -187,6 +191,49 @@ if (nscapp.gt.0) then
 !      On peut imaginer a la place des resolutions couplees.
 !      Ici, on ne donne qu'un exemple.
 
+  ! Joule effect with imaginary potential: the real and imaginary
+  ! potentials may be solved together, sharing the same operator
+
+  ipotcp = 0
+  if ((ippmod(ieljou).eq.2 .or. ippmod(ieljou).eq.4)              &
+      .and. iterns.eq.-1) then
+    call elcpot(ipotcp)
+    call field_get_id('elec_pot_r', f_id_pr)
+    call field_get_id('elec_pot_i', f_id_pi)
+
+    ! GUI and Fortran user source terms are not handled by the coupled
+    ! solver; check once at the first time step that none are defined
+    if (ipotcp.eq.1 .and. iutspt.lt.0) then
+      allocate(smbrs(ncelet), rovsdt(ncelet))
+      iuts = 0
+      do jj = 1, nscapp
+        jscal = iscapp(jj)
+        f_id = ivarfl(isca(jscal))
+        if (f_id.ne.f_id_pr .and. f_id.ne.f_id_pi) cycle
+        call field_get_val_s(f_id, cvar_var)
+        do iel = 1, ncel
+          smbrs(iel) = 0.d0
+          rovsdt(iel) = 0.d0
+        enddo
+        call uitssc(ippmod(idarcy), f_id, cvar_var, smbrs, rovsdt)
+        call ustssc                                             &
+        ( nvar   , nscal  , ncepdc , ncetsm ,                   &
+          jscal  ,                                              &
+          icepdc , icetsm , itypsm ,                            &
+          dt     ,                                              &
+          ckupdc , smacel , smbrs  , rovsdt )
+        do iel = 1, ncel
+          if (abs(smbrs(iel)).gt.0.d0 .or. abs(rovsdt(iel)).gt.0.d0) then
+            iuts = 1
+          endif
+        enddo
+      enddo
+      deallocate(smbrs, rovsdt)
+      if (irangp.ge.0) call parcmx(iuts)
+      iutspt = iuts
+    endif
+  endif
+
   do ii = 1, nscapp
 
     iscal = iscapp(ii)
@@ -281,7 +328,24 @@ if (nscapp.gt.0) then
 
       call field_get_dim(ivarfl(isca(iscal)), f_dim)
 
-      if (f_dim.eq.1) then
+      ! Coupled potentials: both are solved when reaching PotR,
+      ! PotI only needs clipping when reached
+
+      isolve = 1
+      if (ipotcp.eq.1) then
+        if (ivarfl(isca(iscal)).eq.f_id_pr) then
+          call elsolp(iterns, iutspt)
+          isolve = 0
+        else if (ivarfl(isca(iscal)).eq.f_id_pi) then
+          isolve = 0
+        endif
+      endif
+
+      if (isolve.eq.0) then
+
+        call clpsca(iscal)
+
+      else if (f_dim.eq.1) then
 
 ! ---> Appel a covofi pour la resolution
 
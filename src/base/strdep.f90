@@ -339,6 +339,7 @@ if (itrfin.ne.-1) then
     else
       call csexit(1)
     endif
+    call field_increment_version(ivarfl(ii))
   enddo
   do ifac = 1, nfac
     imasfl(ifac) = imasfl_pre(ifac)
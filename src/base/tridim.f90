@@ -399,6 +399,7 @@ if (ippmod(idarcy).eq.-1) then
                                   + gy*(xyzcen(2,iel)-xyp0)   &
                                   + gz*(xyzcen(3,iel)-xzp0))
     enddo
+    call field_increment_version(ivarfl(ipr))
   endif
 
 endif
@@ -1122,6 +1123,7 @@ do while (iterns.le.nterup)
             do iel = 1, ncel
               cvar_sca(iel) = cvar_sca(iel)*cpro_rho_mass(iel)/crom(iel)
             enddo
+            call field_increment_version(ivarfl(ivar))
           endif
         enddo
       endif
@@ -1354,6 +1356,8 @@ if (iccvfg.eq.0) then
         cvar_k(iel) = relaxk*cvar_k(iel) + (1.d0-relaxk)*cvara_k(iel)
         cvar_ep(iel) = relaxe*cvar_ep(iel) + (1.d0-relaxe)*cvara_ep(iel)
       enddo
+      call field_increment_version(ivarfl(ik))
+      call field_increment_version(ivarfl(iep))
     endif
 
   else if(itytur.eq.3) then
@@ -1392,6 +1396,8 @@ if (iccvfg.eq.0) then
         cvar_k(iel)   = relaxk*cvar_k(iel)   + (1.d0-relaxk)*cvara_k(iel)
         cvar_omg(iel) = relaxw*cvar_omg(iel) + (1.d0-relaxw)*cvara_omg(iel)
       enddo
+      call field_increment_version(ivarfl(ik))
+      call field_increment_version(ivarfl(iomg))
     end if
 
   else if (iturb.eq.70) then
@@ -1408,6 +1414,7 @@ if (iccvfg.eq.0) then
       do iel = 1,ncel
         cvar_nusa(iel) = relaxn*cvar_nusa(iel)+(1.d0-relaxn)*cvara_nusa(iel)
       enddo
+      call field_increment_version(ivarfl(inusa))
     endif
 
   endif
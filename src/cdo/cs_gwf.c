@@ -45,6 +45,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <bft_mem.h>
+#include <bft_printf.h>
 
 #include "cs_boundary_zone.h"
 #include "cs_cdovb_scaleq.h"
@@ -804,6 +805,20 @@ _uspf_init_context(cs_property_type_t           pty_type)
   mc->pressure_head = NULL;
   mc->head_in_law = NULL;
 
+  /* Default: soil properties are lagged (no non-linear iteration) */
+
+  mc->nl_algo_type = CS_GWF_NL_ALGO_NONE;
+  mc->nl_algo = cs_iter_algo_define(0,     /* verbosity */
+                                    50,    /* n_max_iter */
+                                    1e-6,  /* atol */
+                                    1e-4,  /* rtol */
+                                    1e3);  /* dtol */
+
+  mc->aa_param.n_max_dir = 5;
+  mc->aa_param.starting_iter = 2;
+  mc->aa_param.beta = 0.;
+  mc->aa = NULL;
+
   /* Create a new equation structure for Richards' equation */
 
   mc->richards = cs_equation_add("Richards",       /* equation name */
@@ -871,6 +886,9 @@ _uspf_free_context(cs_gwf_unsaturated_single_phase_t   **p_mc)
 
   cs_gwf_darcy_flux_free(&(mc->darcy));
 
+  BFT_FREE(mc->nl_algo);
+  cs_iter_algo_aa_free(&(mc->aa));
+
   BFT_FREE(mc);
   *p_mc = NULL;
 }
@@ -891,6 +909,34 @@ _uspf_log_context(cs_gwf_unsaturated_single_phase_t   *mc)
     return;
 
   cs_gwf_darcy_flux_log(mc->darcy);
+
+  switch (mc->nl_algo_type) {
+
+  case CS_GWF_NL_ALGO_PICARD:
+  case CS_GWF_NL_ALGO_ANDERSON:
+    cs_log_printf(CS_LOG_SETUP,
+                  "  * GWF | Non-linear algorithm: %s\n"
+                  "  * GWF | Non-linear algorithm: n_max_iter %d;"
+                  " rtol %5.3e; atol %5.3e\n",
+                  (mc->nl_algo_type == CS_GWF_NL_ALGO_PICARD) ?
+                  "Picard" : "Anderson-accelerated Picard",
+                  mc->nl_algo->n_max_algo_iter,
+                  mc->nl_algo->rtol, mc->nl_algo->atol);
+    if (mc->nl_algo_type == CS_GWF_NL_ALGO_ANDERSON)
+      cs_log_printf(CS_LOG_SETUP,
+                    "  * GWF | Anderson acceleration: n_max_dir %d;"
+                    " starting_iter %d; beta %5.3e\n",
+                    mc->aa_param.n_max_dir, mc->aa_param.starting_iter,
+                    mc->aa_param.beta);
+    break;
+
+  default:
+    cs_log_printf(CS_LOG_SETUP,
+                  "  * GWF | Non-linear algorithm: None (lagged soil"
+                  " properties)\n");
+    break;
+
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1065,6 +1111,21 @@ _uspf_finalize_setup(const cs_cdo_connect_t              *connect,
 
   cs_property_def_by_field(mc->soil_capacity, mc->capacity_field);
 
+  /* Non-linear iterations rely on the Richards equation reading its values
+     at the previous time step from the variable field (CDO-Vb schemes) */
+
+  if (mc->nl_algo_type != CS_GWF_NL_ALGO_NONE) {
+
+    if (richards_scheme != CS_SPACE_SCHEME_CDOVB)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: Non-linear iterations on the Richards equation are only"
+                " available with a CDO vertex-based scheme.", __func__);
+
+    if (mc->nl_algo_type == CS_GWF_NL_ALGO_ANDERSON)
+      mc->aa = cs_iter_algo_aa_create(mc->aa_param, n_cells);
+
+  }
+
   /* Set soil context with array */
 
   cs_gwf_soil_uspf_set_arrays(mc->head_in_law,
@@ -1132,6 +1193,131 @@ _uspf_updates(const cs_mesh_t                    *mesh,
   return time_eval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the new state for the groundwater flows module.
+ *         Case of unstaturated single-phase flows in porous media.
+ *         According to the settings, the non-linearity due to the soil laws
+ *         is either lagged (one solve per time step) or handled with a
+ *         Picard algorithm possibly accelerated with an Anderson technique.
+ *
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      time_step  pointer to a cs_time_step_t structure
+ * \param[in]      connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]      cdoq       pointer to a cs_cdo_quantities_t structure
+ * \param[in, out] mc         pointer to the casted model context
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_uspf_compute(const cs_mesh_t                    *mesh,
+              const cs_time_step_t               *time_step,
+              const cs_cdo_connect_t             *connect,
+              const cs_cdo_quantities_t          *cdoq,
+              cs_gwf_unsaturated_single_phase_t  *mc)
+{
+  cs_gwf_t  *gw = cs_gwf_main_structure;
+  cs_equation_t  *richards = mc->richards;
+
+  assert(gw != NULL && richards != NULL);
+
+  /* First resolution: soil properties evaluated with the head at the
+     previous time step. A current to previous operation is performed */
+
+  _spf_compute(mesh, time_step, connect, cdoq, richards);
+
+  if (mc->nl_algo_type == CS_GWF_NL_ALGO_NONE ||
+      cs_equation_is_steady(richards))
+    return;
+
+  const cs_lnum_t  n_cells = cdoq->n_cells;
+  const cs_real_t  time_eval = _get_time_eval(time_step, richards);
+
+  cs_field_t  *hydraulic_head = cs_equation_get_field(richards);
+  cs_iter_algo_info_t  *algo = mc->nl_algo;
+
+  cs_iter_algo_reset(algo);
+  if (mc->aa != NULL)
+    cs_iter_algo_aa_reset(mc->aa);
+
+  cs_real_t  *head_prev = NULL;
+  BFT_MALLOC(head_prev, n_cells, cs_real_t);
+
+  do {
+
+    /* Restart from the head at the previous time step which is used in the
+       time discretization of the Richards equation. The matrix structure is
+       shared so that only the matrix coefficients are re-assembled. */
+
+    memcpy(hydraulic_head->val, hydraulic_head->val_pre,
+           connect->n_vertices*sizeof(cs_real_t));
+
+    cs_equation_solve(false, mesh, richards);
+
+    /* Update the head used in the soil laws and measure its variation */
+
+    memcpy(head_prev, mc->head_in_law, n_cells*sizeof(cs_real_t));
+
+    _spf_update_head(cdoq, connect, richards,
+                     mc->pressure_head,
+                     mc->head_in_law,
+                     false);
+
+    double  res = 0.;
+#   pragma omp parallel for reduction(+:res) if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      const double  dh = mc->head_in_law[c_id] - head_prev[c_id];
+      res += cdoq->cell_vol[c_id] * dh*dh;
+    }
+
+    cs_parall_sum(1, CS_DOUBLE, &res);
+    res = sqrt(res/cdoq->vol_tot);
+
+    cs_iter_algo_update_cvg(res, algo);
+
+    /* Anderson acceleration on the head values used in the soil laws */
+
+    if (mc->aa != NULL && algo->cvg == CS_SLES_ITERATING)
+      cs_iter_algo_aa_update(mc->aa, cdoq->cell_vol, head_prev,
+                             mc->head_in_law);
+
+    /* Update the Darcy flux and the soil properties */
+
+    cs_gwf_darcy_flux_update(time_eval, richards, false, mc->darcy);
+
+    cs_gwf_soil_update(time_eval, mesh, connect, cdoq);
+
+    if (algo->verbosity > 0)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    "### GWF.Richards | it: %3d | res: %5.3e | tol: %5.3e\n",
+                    algo->n_algo_iter, algo->res, algo->tol);
+
+  } while (algo->cvg == CS_SLES_ITERATING);
+
+  if (algo->cvg != CS_SLES_CONVERGED) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(" %s: Non-linear algorithm for the Richards equation %s"
+               " (res: %5.3e after %d iterations)\n",
+               __func__,
+               (algo->cvg == CS_SLES_DIVERGED) ? "has diverged" :
+               "has not converged",
+               algo->res, algo->n_algo_iter);
+  }
+
+  BFT_FREE(head_prev);
+
+  /* Update the diffusivity tensor associated to each tracer equation since the
+     Darcy velocity has changed */
+
+  for (int i = 0; i < gw->n_tracers; i++) {
+
+    cs_gwf_tracer_t  *tracer = gw->tracers[i];
+    if (tracer->update_diff_tensor != NULL)
+      tracer->update_diff_tensor(tracer, time_eval, mesh, connect, cdoq);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Predefined extra-operations for the groundwater flow module in case
@@ -2090,6 +2276,85 @@ cs_gwf_set_post_options(cs_flag_t       post_flag,
   } /* Darcy flux at boundary */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the algorithm used to handle the non-linearity of the Richards
+ *         equation (unsaturated single-phase flows only)
+ *
+ * \param[in] algo         type of algorithm
+ * \param[in] n_max_iter   maximal number of non-linear iterations
+ * \param[in] rtol         relative tolerance on the head increment
+ * \param[in] atol         absolute tolerance on the head increment
+ * \param[in] verbosity    level of information printed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gwf_set_nl_algo(cs_gwf_nl_algo_t    algo,
+                   int                 n_max_iter,
+                   double              rtol,
+                   double              atol,
+                   int                 verbosity)
+{
+  cs_gwf_t  *gw = cs_gwf_main_structure;
+
+  /* Sanity checks */
+  if (gw == NULL) bft_error(__FILE__, __LINE__, 0, _(_err_empty_gw));
+  if (gw->model != CS_GWF_MODEL_UNSATURATED_SINGLE_PHASE)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: Invalid model. One expects an unsaturated single-phase"
+              " flow model.\n", __func__);
+
+  cs_gwf_unsaturated_single_phase_t  *mc = gw->model_context;
+
+  assert(mc != NULL && mc->nl_algo != NULL);
+  assert(n_max_iter > 0);
+
+  mc->nl_algo_type = algo;
+  mc->nl_algo->n_max_algo_iter = n_max_iter;
+  mc->nl_algo->rtol = rtol;
+  mc->nl_algo->atol = atol;
+  mc->nl_algo->verbosity = verbosity;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the parameters of the Anderson acceleration used when the
+ *         non-linear algorithm is \ref CS_GWF_NL_ALGO_ANDERSON
+ *
+ * \param[in] n_max_dir       maximum number of directions in the history
+ * \param[in] starting_iter   iteration from which the acceleration starts
+ * \param[in] beta            relaxation coefficient (no relaxation if <= 0
+ *                            or >= 1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gwf_set_anderson_param(int        n_max_dir,
+                          int        starting_iter,
+                          double     beta)
+{
+  cs_gwf_t  *gw = cs_gwf_main_structure;
+
+  /* Sanity checks */
+  if (gw == NULL) bft_error(__FILE__, __LINE__, 0, _(_err_empty_gw));
+  if (gw->model != CS_GWF_MODEL_UNSATURATED_SINGLE_PHASE)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: Invalid model. One expects an unsaturated single-phase"
+              " flow model.\n", __func__);
+
+  cs_gwf_unsaturated_single_phase_t  *mc = gw->model_context;
+
+  assert(mc != NULL);
+  if (n_max_dir < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: Invalid number of directions (%d).\n", __func__, n_max_dir);
+
+  mc->aa_param.n_max_dir = n_max_dir;
+  mc->aa_param.starting_iter = starting_iter;
+  mc->aa_param.beta = beta;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve the advection field related to the Darcy flux in the liquid
@@ -2607,11 +2872,7 @@ cs_gwf_compute(const cs_mesh_t              *mesh,
     break;
 
   case CS_GWF_MODEL_UNSATURATED_SINGLE_PHASE:
-    {
-      cs_gwf_unsaturated_single_phase_t  *mc = gw->model_context;
-
-      _spf_compute(mesh, time_step, connect, cdoq, mc->richards);
-    }
+    _uspf_compute(mesh, time_step, connect, cdoq, gw->model_context);
     break;
 
   case CS_GWF_MODEL_TWO_PHASE:
@@ -182,6 +182,40 @@ typedef enum {
  * Type definitions
  *============================================================================*/
 
+/*!
+ * \enum cs_gwf_nl_algo_t
+ * \brief Algorithm used to handle the non-linearity of the Richards equation
+ *        in the case of unsaturated single-phase flows
+ */
+
+typedef enum {
+
+  /*!
+   * \brief Soil properties are updated once per time step with the new head
+   *        (lagged treatment). This is the default.
+   */
+
+  CS_GWF_NL_ALGO_NONE,
+
+  /*!
+   * \brief Picard (fixed-point) iterations on the head used in soil laws.
+   *        The Richards system is re-assembled (values only) and solved at
+   *        each iteration until the increment on the head is small enough.
+   */
+
+  CS_GWF_NL_ALGO_PICARD,
+
+  /*!
+   * \brief Picard iterations accelerated with an Anderson acceleration on
+   *        the head used in soil laws
+   */
+
+  CS_GWF_NL_ALGO_ANDERSON,
+
+  CS_GWF_N_NL_ALGOS      /*!< Number of algorithms (not an algorithm) */
+
+} cs_gwf_nl_algo_t;
+
 typedef struct _gwf_t  cs_gwf_t;
 
 /*============================================================================
@@ -276,6 +310,43 @@ void
 cs_gwf_set_post_options(cs_flag_t       post_flag,
                         bool            reset);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the algorithm used to handle the non-linearity of the Richards
+ *         equation (unsaturated single-phase flows only)
+ *
+ * \param[in] algo         type of algorithm
+ * \param[in] n_max_iter   maximal number of non-linear iterations
+ * \param[in] rtol         relative tolerance on the head increment
+ * \param[in] atol         absolute tolerance on the head increment
+ * \param[in] verbosity    level of information printed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gwf_set_nl_algo(cs_gwf_nl_algo_t    algo,
+                   int                 n_max_iter,
+                   double              rtol,
+                   double              atol,
+                   int                 verbosity);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the parameters of the Anderson acceleration used when the
+ *         non-linear algorithm is \ref CS_GWF_NL_ALGO_ANDERSON
+ *
+ * \param[in] n_max_dir       maximum number of directions in the history
+ * \param[in] starting_iter   iteration from which the acceleration starts
+ * \param[in] beta            relaxation coefficient (no relaxation if <= 0
+ *                            or >= 1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gwf_set_anderson_param(int        n_max_dir,
+                          int        starting_iter,
+                          double     beta);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve the advection field related to the Darcy flux in the liquid
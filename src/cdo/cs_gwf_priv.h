@@ -31,6 +31,7 @@
 
 #include "cs_advection_field.h"
 #include "cs_gwf.h"
+#include "cs_iter_algo.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -244,6 +245,29 @@ typedef struct {
 
   cs_real_t                    *head_in_law;
 
+  /*!
+   * @}
+   * @name Non-linear algorithm
+   * @{
+   *
+   * \var nl_algo_type
+   * Algorithm used to handle the non-linearity stemming from the soil laws
+   *
+   * \var nl_algo
+   * Convergence information for the non-linear iterations
+   *
+   * \var aa_param
+   * Parameters of the Anderson acceleration
+   *
+   * \var aa
+   * History of the Anderson acceleration on head_in_law (NULL if not used)
+   */
+
+  cs_gwf_nl_algo_t              nl_algo_type;
+  cs_iter_algo_info_t          *nl_algo;
+  cs_iter_algo_aa_param_t       aa_param;
+  cs_iter_algo_aa_t            *aa;
+
   /*!
    * @}
    */
@@ -162,15 +162,21 @@ _update_soil_genuchten_iso(const cs_real_t              t_eval,
 
     if (h < 0) { /* S_e(h) = [1 + |alpha*h|^n]^(-m) */
 
-      const double  coef = pow(fabs(sc->scale * h), sc->n);
-      const double  se = pow(1 + coef, -sc->m);
-      const double  se_pow_overm = pow(se, 1/sc->m);
-      const double  coef_base = 1 - pow(1 - se_pow_overm, sc->m);
+      /* Work with logarithms to share the transcendental evaluations:
+         coef = |alpha*h|^n, se = (1+coef)^(-m) and, since
+         1 - se^(1/m) = coef/(1+coef), (1 - se^(1/m))^m is also an
+         exponential of already computed quantities */
+
+      const double  l_ah = log(fabs(sc->scale * h));
+      const double  coef = exp(sc->n * l_ah);
+      const double  l_1pc = log1p(coef);
+      const double  se = exp(-sc->m * l_1pc);
+      const double  coef_base = 1 - exp(sc->m * (sc->n * l_ah - l_1pc));
 
       /* Set the permeability value */
 
-      permeability[c_id] =
-        iso_satval* pow(se, sc->tortuosity) * coef_base*coef_base;
+      permeability[c_id] = iso_satval
+        * exp(-sc->m * sc->tortuosity * l_1pc) * coef_base*coef_base;
 
       /* Set the moisture content */
 
@@ -32,14 +32,17 @@
 
 #include <float.h>
 #include <assert.h>
+#include <math.h>
 
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
 
 #include <bft_mem.h>
+#include <bft_error.h>
 
 #include "cs_evaluate.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -76,6 +79,27 @@ BEGIN_C_DECLS
 
 #define CS_ITER_ALGO_DBG      0
 
+/* Anderson acceleration: the history is stored in a circular way since the
+   order of the directions does not matter in the least-squares problem */
+
+struct _cs_iter_algo_aa_t {
+
+  cs_iter_algo_aa_param_t   param;
+
+  cs_lnum_t                 n_elts;
+  int                       n_dir;     /* current number of directions */
+  int                       head;      /* slot of the next direction */
+  int                       n_calls;   /* number of updates since reset */
+
+  cs_real_t                *fold;      /* previous residual g(x) - x */
+  cs_real_t                *gold;      /* previous image g(x) */
+  cs_real_t                *df;        /* differences of residuals */
+  cs_real_t                *dg;        /* differences of images */
+
+  double                   *gram;      /* normal equations (+ rhs) */
+
+};
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -201,6 +225,337 @@ cs_iter_algo_navsto_fb_picard_cvg(const cs_cdo_connect_t      *connect,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update the convergence status of an iterative algorithm given the
+ *         norm of the last increment. The first call sets the reference
+ *         residual used to build the tolerance.
+ *
+ * \param[in]      res       norm of the increment between two iterates
+ * \param[in, out] a_info    pointer to a cs_iter_algo_info_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_update_cvg(double                  res,
+                        cs_iter_algo_info_t    *a_info)
+{
+  const double  pre_res = a_info->res;
+
+  a_info->res = res;
+
+  /* Storage of the initial residual to build a relative tolerance */
+  if (a_info->n_algo_iter == 0) {
+    a_info->res0 = res;
+    a_info->tol = fmax(a_info->rtol*a_info->res0, a_info->atol);
+  }
+
+  a_info->n_algo_iter += 1;
+
+  /* Set the convergence status */
+  if (a_info->res < a_info->tol)
+    a_info->cvg = CS_SLES_CONVERGED;
+
+  else if (a_info->n_algo_iter >= a_info->n_max_algo_iter)
+    a_info->cvg = CS_SLES_MAX_ITERATION;
+
+  else if (a_info->dtol > 0 &&
+           (a_info->res > a_info->dtol * pre_res ||
+            a_info->res > a_info->dtol * a_info->res0))
+    a_info->cvg = CS_SLES_DIVERGED;
+
+  else
+    a_info->cvg = CS_SLES_ITERATING;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a new structure to perform an Anderson acceleration on
+ *         arrays of n_elts values
+ *
+ * \param[in] aap      set of parameters for the Anderson acceleration
+ * \param[in] n_elts   number of elements in the iterates
+ *
+ * \return a pointer to the new allocated structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_iter_algo_aa_t *
+cs_iter_algo_aa_create(cs_iter_algo_aa_param_t    aap,
+                       cs_lnum_t                  n_elts)
+{
+  cs_iter_algo_aa_t  *aa = NULL;
+
+  if (aap.n_max_dir < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: Invalid number of directions (%d) for the Anderson"
+              " acceleration.\n", __func__, aap.n_max_dir);
+
+  const int  m = aap.n_max_dir;
+
+  BFT_MALLOC(aa, 1, cs_iter_algo_aa_t);
+
+  aa->param = aap;
+  aa->n_elts = n_elts;
+
+  BFT_MALLOC(aa->fold, n_elts, cs_real_t);
+  BFT_MALLOC(aa->gold, n_elts, cs_real_t);
+  BFT_MALLOC(aa->df, m*n_elts, cs_real_t);
+  BFT_MALLOC(aa->dg, m*n_elts, cs_real_t);
+  BFT_MALLOC(aa->gram, m*m + 2*m, double);
+
+  cs_iter_algo_aa_reset(aa);
+
+  return aa;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Reset the history of an Anderson acceleration (for instance at the
+ *         beginning of a new time step)
+ *
+ * \param[in, out] aa     pointer to a cs_iter_algo_aa_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_aa_reset(cs_iter_algo_aa_t    *aa)
+{
+  if (aa == NULL)
+    return;
+
+  aa->n_dir = 0;
+  aa->head = 0;
+  aa->n_calls = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_iter_algo_aa_t structure
+ *
+ * \param[in, out] p_aa   pointer of pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_aa_free(cs_iter_algo_aa_t    **p_aa)
+{
+  if (p_aa == NULL)
+    return;
+  if (*p_aa == NULL)
+    return;
+
+  cs_iter_algo_aa_t  *aa = *p_aa;
+
+  BFT_FREE(aa->fold);
+  BFT_FREE(aa->gold);
+  BFT_FREE(aa->df);
+  BFT_FREE(aa->dg);
+  BFT_FREE(aa->gram);
+
+  BFT_FREE(aa);
+  *p_aa = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply one step of Anderson acceleration. On input, cur_iterate is
+ *         the image of pre_iterate by the fixed-point map. On output, it is
+ *         replaced by the accelerated iterate. The least-squares problem is
+ *         solved with the (weighted) normal equations, using a single global
+ *         reduction.
+ *
+ * \param[in, out] aa            pointer to a cs_iter_algo_aa_t structure
+ * \param[in]      weights       weights for the scalar products (or NULL)
+ * \param[in]      pre_iterate   previous iterate x_k
+ * \param[in, out] cur_iterate   g(x_k) in, x_{k+1} out
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_aa_update(cs_iter_algo_aa_t    *aa,
+                       const cs_real_t      *weights,
+                       const cs_real_t      *pre_iterate,
+                       cs_real_t            *cur_iterate)
+{
+  if (aa == NULL)
+    return;
+
+  const cs_lnum_t  n = aa->n_elts;
+  const int  m = aa->param.n_max_dir;
+
+  /* Add the new direction (replacing the oldest one if the history is full)
+     and store the current residual and image */
+
+  if (aa->n_calls > 0) {
+
+    /* Slots 0 to n_dir-1 are in use, since head is reset with n_dir */
+
+    cs_real_t  *df = aa->df + aa->head*n;
+    cs_real_t  *dg = aa->dg + aa->head*n;
+
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++) {
+      const cs_real_t  fk = cur_iterate[i] - pre_iterate[i];
+      df[i] = fk - aa->fold[i];
+      dg[i] = cur_iterate[i] - aa->gold[i];
+      aa->fold[i] = fk;
+      aa->gold[i] = cur_iterate[i];
+    }
+
+    aa->n_dir = CS_MIN(aa->n_dir + 1, m);
+    aa->head = (aa->head + 1) % m;
+
+  }
+  else {
+
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++) {
+      aa->fold[i] = cur_iterate[i] - pre_iterate[i];
+      aa->gold[i] = cur_iterate[i];
+    }
+
+  }
+
+  aa->n_calls += 1;
+
+  const int  n_dir = aa->n_dir;
+
+  if (n_dir == 0 || aa->n_calls < aa->param.starting_iter)
+    return; /* Plain fixed-point iteration */
+
+  /* Normal equations: (dF^t W dF) gamma = dF^t W f_k
+     Lower part of the matrix, then the rhs, are gathered to perform only
+     one reduction */
+
+  double  *gram = aa->gram;
+  double  *rhs = aa->gram + n_dir*n_dir;
+  double  *gamma = rhs + n_dir;
+
+  int  n_dots = 0;
+  for (int j = 0; j < n_dir; j++) {
+
+    const cs_real_t  *dfj = aa->df + j*n;
+
+    for (int k = 0; k <= j; k++) {
+
+      const cs_real_t  *dfk = aa->df + k*n;
+      double  s = 0;
+
+#     pragma omp parallel for reduction(+:s) if (n > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n; i++) {
+        const cs_real_t  w = (weights == NULL) ? 1. : weights[i];
+        s += w * dfj[i] * dfk[i];
+      }
+
+      gram[n_dots++] = s;
+
+    }
+
+  }
+
+  for (int j = 0; j < n_dir; j++) {
+
+    const cs_real_t  *dfj = aa->df + j*n;
+    double  s = 0;
+
+#   pragma omp parallel for reduction(+:s) if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++) {
+      const cs_real_t  w = (weights == NULL) ? 1. : weights[i];
+      s += w * dfj[i] * aa->fold[i];
+    }
+
+    gram[n_dots++] = s;
+
+  }
+
+  cs_parall_sum(n_dots, CS_DOUBLE, gram);
+
+  /* Unpack into a dense lower matrix (in place, from the end) and the rhs */
+
+  for (int j = n_dir - 1; j > -1; j--)
+    gamma[j] = gram[n_dir*(n_dir+1)/2 + j];
+  for (int j = 0; j < n_dir; j++)
+    rhs[j] = gamma[j];
+
+  {
+    int  shift = n_dir*(n_dir+1)/2 - 1;
+    for (int j = n_dir - 1; j > -1; j--) {
+      for (int k = j; k > -1; k--)
+        gram[j*n_dir + k] = gram[shift--];
+    }
+  }
+
+  /* Cholesky factorization with a small regularization. If the history is
+     (numerically) rank-deficient, restart from a plain fixed-point step */
+
+  double  diag_max = 0;
+  for (int j = 0; j < n_dir; j++)
+    diag_max = fmax(diag_max, gram[j*n_dir + j]);
+
+  const double  eps = 1e-12*diag_max;
+
+  for (int j = 0; j < n_dir; j++) {
+
+    double  d = gram[j*n_dir + j] + eps;
+    for (int k = 0; k < j; k++)
+      d -= gram[j*n_dir + k]*gram[j*n_dir + k];
+
+    if (!(d > eps)) {
+      aa->n_dir = 0;
+      aa->head = 0;
+      return;
+    }
+
+    d = sqrt(d);
+    gram[j*n_dir + j] = d;
+
+    for (int i = j + 1; i < n_dir; i++) {
+      double  v = gram[i*n_dir + j];
+      for (int k = 0; k < j; k++)
+        v -= gram[i*n_dir + k]*gram[j*n_dir + k];
+      gram[i*n_dir + j] = v/d;
+    }
+
+  }
+
+  /* Forward and backward substitutions */
+
+  for (int j = 0; j < n_dir; j++) {
+    double  v = rhs[j];
+    for (int k = 0; k < j; k++)
+      v -= gram[j*n_dir + k]*gamma[k];
+    gamma[j] = v/gram[j*n_dir + j];
+  }
+
+  for (int j = n_dir - 1; j > -1; j--) {
+    double  v = gamma[j];
+    for (int k = j + 1; k < n_dir; k++)
+      v -= gram[k*n_dir + j]*gamma[k];
+    gamma[j] = v/gram[j*n_dir + j];
+  }
+
+  /* Accelerated iterate: x_{k+1} = g_k - dG.gamma
+     - (1-beta)*(f_k - dF.gamma) with a relaxation */
+
+  const double  beta = aa->param.beta;
+  const double  omb = (beta > 0 && beta < 1) ? 1 - beta : 0;
+
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++) {
+
+    cs_real_t  g = aa->gold[i], f = aa->fold[i];
+    for (int j = 0; j < n_dir; j++) {
+      g -= gamma[j]*aa->dg[j*n + i];
+      f -= gamma[j]*aa->df[j*n + i];
+    }
+
+    cur_iterate[i] = g - omb*f;
+
+  }
+
+}
+
 /*----------------------------------------------------------------------------*/
 
 
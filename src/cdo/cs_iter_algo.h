@@ -111,6 +111,36 @@ typedef struct {
 
 } cs_iter_algo_info_t;
 
+/*! \struct cs_iter_algo_aa_param_t
+ *  \brief Set of parameters driving an Anderson acceleration of a fixed-point
+ *         (Picard) algorithm
+ *
+ * \var n_max_dir
+ * maximum number of directions kept in the history (depth of the
+ * acceleration)
+ *
+ * \var starting_iter
+ * the acceleration is applied from this iteration (counted from 1 since the
+ * last reset)
+ *
+ * \var beta
+ * relaxation coefficient. No relaxation if beta <= 0 or beta >= 1
+ */
+
+typedef struct {
+
+  int                              n_max_dir;
+  int                              starting_iter;
+  double                           beta;
+
+} cs_iter_algo_aa_param_t;
+
+/*! \struct cs_iter_algo_aa_t
+ *  \brief Opaque structure storing the history of an Anderson acceleration
+ */
+
+typedef struct _cs_iter_algo_aa_t  cs_iter_algo_aa_t;
+
 /*============================================================================
  * Inline static public function prototypes
  *============================================================================*/
@@ -226,6 +256,81 @@ cs_iter_algo_navsto_fb_picard_cvg(const cs_cdo_connect_t      *connect,
                                   cs_real_t                    div_l2_norm,
                                   cs_iter_algo_info_t         *a_info);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update the convergence status of an iterative algorithm given the
+ *         norm of the last increment. The first call sets the reference
+ *         residual used to build the tolerance.
+ *
+ * \param[in]      res       norm of the increment between two iterates
+ * \param[in, out] a_info    pointer to a cs_iter_algo_info_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_update_cvg(double                  res,
+                        cs_iter_algo_info_t    *a_info);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a new structure to perform an Anderson acceleration on
+ *         arrays of n_elts values
+ *
+ * \param[in] aap      set of parameters for the Anderson acceleration
+ * \param[in] n_elts   number of elements in the iterates
+ *
+ * \return a pointer to the new allocated structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_iter_algo_aa_t *
+cs_iter_algo_aa_create(cs_iter_algo_aa_param_t    aap,
+                       cs_lnum_t                  n_elts);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Reset the history of an Anderson acceleration (for instance at the
+ *         beginning of a new time step)
+ *
+ * \param[in, out] aa     pointer to a cs_iter_algo_aa_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_aa_reset(cs_iter_algo_aa_t    *aa);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_iter_algo_aa_t structure
+ *
+ * \param[in, out] p_aa   pointer of pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_aa_free(cs_iter_algo_aa_t    **p_aa);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply one step of Anderson acceleration. On input, cur_iterate is
+ *         the image of pre_iterate by the fixed-point map. On output, it is
+ *         replaced by the accelerated iterate. The least-squares problem is
+ *         solved with the (weighted) normal equations, using a single global
+ *         reduction.
+ *
+ * \param[in, out] aa            pointer to a cs_iter_algo_aa_t structure
+ * \param[in]      weights       weights for the scalar products (or NULL)
+ * \param[in]      pre_iterate   previous iterate x_k
+ * \param[in, out] cur_iterate   g(x_k) in, x_{k+1} out
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_iter_algo_aa_update(cs_iter_algo_aa_t    *aa,
+                       const cs_real_t      *weights,
+                       const cs_real_t      *pre_iterate,
+                       cs_real_t            *cur_iterate);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -847,6 +847,10 @@ if (irangp.ge.0.or.iperio.eq.1) then
   !==========
 endif
 
+call field_increment_version(ivarfl(ipr))
+call field_increment_version(ivarfl(ivar))
+call field_increment_version(ivarfl(isca(itempk)))
+
 ! Free memory
 if (allocated(wb)) deallocate(wb)
 if (allocated(smbrs)) deallocate(smbrs, rovsdt)
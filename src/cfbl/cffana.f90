@@ -35,6 +35,8 @@
 !> \\ \der{E}{t} + \divs \left(\rho\vect{u} E\right) &=&0
 !> \f}
 !>
+!> The flux is computed for a list of boundary faces at once.
+!>
 !-------------------------------------------------------------------------------
 
 !-------------------------------------------------------------------------------
@@ -42,7 +44,8 @@
 !______________________________________________________________________________.
 !  mode           name          role                                           !
 !______________________________________________________________________________!
-!> \param[in]     imodif        indicator of what is computed
+!> \param[in]     nfbana        number of faces with analytical flux
+!> \param[in]     lstfba        list of faces with analytical flux
 !> \param[in,out] bc_en         dirichlet value for the total energy
 !> \param[in,out] bc_pr         dirichlet value for the pressure
 !> \param[in,out] bc_vel        dirichlet value for the velocity
@@ -50,7 +53,8 @@
 
 
 subroutine cffana &
- ( imodif , bc_en  , bc_pr  , bc_vel )
+ ( nfbana , lstfba ,                                              &
+   bc_en  , bc_pr  , bc_vel )
 
 !===============================================================================
 
@@ -79,13 +83,14 @@ implicit none
 
 ! Arguments
 
-integer          imodif
+integer          nfbana
+integer          lstfba(nfbana)
 
 double precision bc_en(nfabor), bc_pr(nfabor), bc_vel(3,nfabor)
 
 ! Local variables
 
-integer          iel    , ifac
+integer          ii     , ifac
 integer          ien
 double precision und    , rund
 double precision, dimension(:,:), pointer :: cofacv
@@ -94,6 +99,8 @@ double precision, dimension(:), pointer :: brom
 
 !===============================================================================
 
+if (nfbana.lt.1) return
+
 !===============================================================================
 ! 0. INITIALISATION
 !===============================================================================
@@ -105,38 +112,42 @@ call field_get_coefac_s(ivarfl(ien), coface)
 
 call field_get_val_s(ibrom, brom)
 
-ifac  = imodif
-iel   = ifabor(ifac)
+!$omp parallel do private(ifac, und, rund) if(nfbana > thr_n_min)
+do ii = 1, nfbana
 
-!===============================================================================
-! 1. COMPUTE VALUES NEEDED FOR ANALYTICAL FLUX
-!===============================================================================
+  ifac = lstfba(ii)
 
-und   = (bc_vel(1,ifac)*surfbo(1,ifac)                          &
-       + bc_vel(2,ifac)*surfbo(2,ifac)                          &
-       + bc_vel(3,ifac)*surfbo(3,ifac))/surfbn(ifac)
-rund  = brom(ifac)*und
+  !=============================================================================
+  ! 1. COMPUTE VALUES NEEDED FOR ANALYTICAL FLUX
+  !=============================================================================
 
-!===============================================================================
-! 2. CONVECTIVE ANALYTICAL FLUX
-!===============================================================================
+  und   = (bc_vel(1,ifac)*surfbo(1,ifac)                          &
+         + bc_vel(2,ifac)*surfbo(2,ifac)                          &
+         + bc_vel(3,ifac)*surfbo(3,ifac))/surfbn(ifac)
+  rund  = brom(ifac)*und
+
+  !=============================================================================
+  ! 2. CONVECTIVE ANALYTICAL FLUX
+  !=============================================================================
+
+  ! Tag the faces where an analytical flux is computed
+  ! The tag will be used in bilsc2 to retrieve the faces where an analytical
+  ! flux has to be imposed
+  icvfli(ifac) = 1
 
-! Tag the faces where an analytical flux is computed
-! The tag will be used in bilsc2 to retrieve the faces where an analytical flux
-! has to be imposed
-icvfli(ifac) = 1
+  ! Momentum flux (the centered pressure contribution is directly taken into
+  ! account in the pressure BC)
+  cofacv(1,ifac) = suffbn(ifac) * rund * bc_vel(1,ifac)
 
-! Momentum flux (the centered pressure contribution is directly taken into account
-! in the pressure BC)
-cofacv(1,ifac) = suffbn(ifac) * rund * bc_vel(1,ifac)
+  cofacv(2,ifac) = suffbn(ifac) * rund * bc_vel(2,ifac)
 
-cofacv(2,ifac) = suffbn(ifac) * rund * bc_vel(2,ifac)
+  cofacv(3,ifac) = suffbn(ifac) * rund * bc_vel(3,ifac)
 
-cofacv(3,ifac) = suffbn(ifac) * rund * bc_vel(3,ifac)
+  ! Total energy flux
+  coface(ifac) = suffbn(ifac) * (rund * bc_en(ifac) +  &
+                                 und  * bc_pr(ifac))
 
-! Total energy flux
-coface(ifac) = suffbn(ifac) * (rund * bc_en(ifac) +  &
-                               und  * bc_pr(ifac))
+enddo
 
 return
 
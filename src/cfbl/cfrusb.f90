@@ -23,7 +23,7 @@
 subroutine cfrusb &
 !================
 
- ( ifac   ,                                                       &
+ ( nfbrus , lstfbr ,                                              &
    bc_en  , bc_pr  , bc_vel    )
 
 !===============================================================================
@@ -36,12 +36,17 @@ subroutine cfrusb &
 ! d rho u /dt + div rho u u + grad  P = 0
 ! d E     /dt + div rho u E + div u P = 0
 
+! The flux is computed for a list of boundary faces at once, so that
+! field values are mapped once, sound speeds are evaluated by a single
+! (threaded) thermodynamic call, and faces are processed in parallel.
+
 !-------------------------------------------------------------------------------
 ! Arguments
 !__________________.____._____.________________________________________________.
 ! name             !type!mode ! role                                           !
 !__________________!____!_____!________________________________________________!
-! ifac             ! i  ! <-- ! face number                                    !
+! nfbrus           ! i  ! <-- ! number of faces with Rusanov flux              !
+! lstfbr           ! i  ! <-- ! list of faces with Rusanov flux                !
 !__________________!____!_____!________________________________________________!
 
 !     TYPE : E (ENTIER), R (REEL), A (ALPHANUMERIQUE), T (TABLEAU)
@@ -76,17 +81,18 @@ implicit none
 
 ! Arguments
 
-integer          ifac
+integer          nfbrus
+integer          lstfbr(nfbrus)
 
 double precision bc_en(nfabor), bc_pr(nfabor), bc_vel(3,nfabor)
 
 ! Local variables
 
-integer          iel, l_size
+integer          ii, ifac, iel
 integer          ien
 
 double precision inv_surfbn, rnx, rny, rnz
-double precision b_vel_n, c_vel_n, b_masfl, c_masfl, b_c, c_c, b_c2(1), c_c2(1)
+double precision b_vel_n, c_vel_n, b_masfl, c_masfl, b_c, c_c
 double precision rrus, r_b_masfl, r_b_vel_n
 double precision, dimension(:,:), pointer :: cofacv
 double precision, dimension(:), pointer :: coface
@@ -95,12 +101,16 @@ double precision, dimension(:,:), pointer :: vel
 double precision, dimension(:), pointer :: cvar_pr, cvar_en, cpro_cp, cpro_cv
 double precision, dimension(:), pointer :: rvoid
 
-double precision c_cp(1), c_cv(1)
+double precision, allocatable, dimension(:) :: w_cp, w_cv
+double precision, allocatable, dimension(:) :: b_pr, b_rho, c_pr, c_rho
+double precision, allocatable, dimension(:) :: b_c2, c_c2
 
 !===============================================================================
 
 rvoid => null()
 
+if (nfbrus.lt.1) return
+
 !===============================================================================
 ! 0. INITIALISATION
 !===============================================================================
@@ -119,99 +129,130 @@ call field_get_val_s(ivarfl(ien), cvar_en)
 call field_get_coefac_v(ivarfl(iu), cofacv)
 call field_get_coefac_s(ivarfl(ien), coface)
 
-iel   = ifabor(ifac)
-
-! Initialize local specific heat values and handle uniform cases
+! Handle uniform specific heat cases
 
 if (icp.ge.0) then
   call field_get_val_s(icp, cpro_cp)
-  c_cp(1) = cpro_cp(iel)
 else
   cpro_cp => rvoid1
-  c_cp(1) = 0.d0
 endif
 
 if (icv.ge.0) then
   call field_get_val_s(icv, cpro_cv)
-  c_cv(1) = cpro_cv(iel)
 else
   cpro_cv => rvoid1
-  c_cv(1) = 0.d0
 endif
 
+allocate(w_cp(nfbrus), w_cv(nfbrus))
+allocate(b_pr(nfbrus), b_rho(nfbrus), c_pr(nfbrus), c_rho(nfbrus))
+allocate(b_c2(nfbrus), c_c2(nfbrus))
+
 !===============================================================================
-! 1. COMPUTE VALUES NEEDED FOR RUSANOV SCHEME
+! 1. COMPUTE SOUND SPEEDS NEEDED FOR RUSANOV SCHEME
 !===============================================================================
 
-inv_surfbn = 1. / surfbn(ifac)
-rnx = surfbo(1,ifac) * inv_surfbn
-rny = surfbo(2,ifac) * inv_surfbn
-rnz = surfbo(3,ifac) * inv_surfbn
-
-b_vel_n = bc_vel(1,ifac)*rnx + bc_vel(2,ifac)*rny + bc_vel(3,ifac)*rnz
-c_vel_n = vel(1,iel)*rnx + vel(2,iel)*rny + vel(3,iel)*rnz
-b_masfl  = brom(ifac)*b_vel_n
-c_masfl  = crom(iel)*c_vel_n
-
-l_size = 1
-
-call cs_cf_thermo_c_square(c_cp, c_cv, &
-                           bc_pr(ifac:ifac), brom(ifac:ifac), &
-                           rvoid, rvoid, rvoid, b_c2, l_size)
-call cs_cf_thermo_c_square(c_cp, c_cv, &
-                           cvar_pr(iel:iel), crom(iel:iel), &
-                           rvoid, rvoid, rvoid, c_c2, l_size)
-
-b_c    = sqrt(b_c2(1))
-c_c    = sqrt(c_c2(1))
-rrus  = max(abs(b_vel_n)+b_c, abs(c_vel_n)+c_c)
-
-! boundary mass flux computed with Rusanov scheme
-r_b_masfl  = 0.5d0*(b_masfl+c_masfl) - 0.5d0*rrus*(brom(ifac)-crom(iel))
-
-! Rusanov normal velocity (computed using boundary density)
-r_b_vel_n = r_b_masfl / brom(ifac)
-
-! Update velocity boundary condition
-bc_vel(1,ifac) = bc_vel(1,ifac) + (r_b_vel_n - b_vel_n)*rnx
-bc_vel(2,ifac) = bc_vel(2,ifac) + (r_b_vel_n - b_vel_n)*rny
-bc_vel(3,ifac) = bc_vel(3,ifac) + (r_b_vel_n - b_vel_n)*rnz
+! Gather local values so that sound speeds are computed by batch
+
+!$omp parallel do private(ifac, iel) if(nfbrus > thr_n_min)
+do ii = 1, nfbrus
+  ifac = lstfbr(ii)
+  iel  = ifabor(ifac)
+  if (icp.ge.0) then
+    w_cp(ii) = cpro_cp(iel)
+  else
+    w_cp(ii) = 0.d0
+  endif
+  if (icv.ge.0) then
+    w_cv(ii) = cpro_cv(iel)
+  else
+    w_cv(ii) = 0.d0
+  endif
+  b_pr(ii)  = bc_pr(ifac)
+  b_rho(ii) = brom(ifac)
+  c_pr(ii)  = cvar_pr(iel)
+  c_rho(ii) = crom(iel)
+enddo
+
+call cs_cf_thermo_c_square(w_cp, w_cv, b_pr, b_rho,                     &
+                           rvoid, rvoid, rvoid, b_c2, nfbrus)
+call cs_cf_thermo_c_square(w_cp, w_cv, c_pr, c_rho,                     &
+                           rvoid, rvoid, rvoid, c_c2, nfbrus)
 
 !===============================================================================
 ! 2. CONVECTIVE RUSANOV FLUX
 !===============================================================================
 
-! Tag the faces where a Rusanov flux is computed
-! The tag will be used in bilsc2 to retrieve the faces where a Rusanov flux
-! has to be imposed
-icvfli(ifac) = 1
-
-! Momentum flux (the centered pressure contribution is directly taken into account
-! in the pressure BC)
-cofacv(1,ifac) = suffbn(ifac)*                                                  &
-                 0.5d0*( b_masfl*bc_vel(1,ifac) + c_masfl*vel(1,iel)            &
-                        -rrus*(brom(ifac)*bc_vel(1,ifac)                        &
-                        -crom(iel)*vel(1,iel)) )
-
-cofacv(2,ifac) = suffbn(ifac)*                                                  &
-                 0.5d0*( b_masfl*bc_vel(2,ifac) + c_masfl*vel(2,iel)            &
-                        -rrus*( brom(ifac)*bc_vel(2,ifac)                       &
-                        -crom(iel)*vel(2,iel)) )
-
-cofacv(3,ifac) = suffbn(ifac)*                                                  &
-                 0.5d0*( b_masfl*bc_vel(3,ifac) + c_masfl*vel(3,iel)            &
-                        -rrus*(brom(ifac)*bc_vel(3,ifac)                        &
-                        -crom(iel)*vel(3,iel)) )
-
-! BC for the pressure gradient in the momentum balance
-bc_pr(ifac) = 0.5d0 * (bc_pr(ifac) + cvar_pr(iel))
-
-! Total energy flux
-coface(ifac) = suffbn(ifac)*                                                    &
-               0.5d0*( b_masfl*bc_en(ifac) + c_masfl*cvar_en(iel)               &
-                      +b_vel_n*bc_pr(ifac) + c_vel_n*cvar_pr(iel)               &
-                      -rrus*(brom(ifac)*bc_en(ifac)                             &
-                      -crom(iel)*cvar_en(iel)) )
+!$omp parallel do private(ifac, iel, inv_surfbn, rnx, rny, rnz,            &
+!$omp                     b_vel_n, c_vel_n, b_masfl, c_masfl, b_c, c_c,    &
+!$omp                     rrus, r_b_masfl, r_b_vel_n)                      &
+!$omp             if(nfbrus > thr_n_min)
+do ii = 1, nfbrus
+
+  ifac = lstfbr(ii)
+  iel  = ifabor(ifac)
+
+  inv_surfbn = 1. / surfbn(ifac)
+  rnx = surfbo(1,ifac) * inv_surfbn
+  rny = surfbo(2,ifac) * inv_surfbn
+  rnz = surfbo(3,ifac) * inv_surfbn
+
+  b_vel_n = bc_vel(1,ifac)*rnx + bc_vel(2,ifac)*rny + bc_vel(3,ifac)*rnz
+  c_vel_n = vel(1,iel)*rnx + vel(2,iel)*rny + vel(3,iel)*rnz
+  b_masfl  = brom(ifac)*b_vel_n
+  c_masfl  = crom(iel)*c_vel_n
+
+  b_c    = sqrt(b_c2(ii))
+  c_c    = sqrt(c_c2(ii))
+  rrus  = max(abs(b_vel_n)+b_c, abs(c_vel_n)+c_c)
+
+  ! boundary mass flux computed with Rusanov scheme
+  r_b_masfl  = 0.5d0*(b_masfl+c_masfl) - 0.5d0*rrus*(brom(ifac)-crom(iel))
+
+  ! Rusanov normal velocity (computed using boundary density)
+  r_b_vel_n = r_b_masfl / brom(ifac)
+
+  ! Update velocity boundary condition
+  bc_vel(1,ifac) = bc_vel(1,ifac) + (r_b_vel_n - b_vel_n)*rnx
+  bc_vel(2,ifac) = bc_vel(2,ifac) + (r_b_vel_n - b_vel_n)*rny
+  bc_vel(3,ifac) = bc_vel(3,ifac) + (r_b_vel_n - b_vel_n)*rnz
+
+  ! Tag the faces where a Rusanov flux is computed
+  ! The tag will be used in bilsc2 to retrieve the faces where a Rusanov flux
+  ! has to be imposed
+  icvfli(ifac) = 1
+
+  ! Momentum flux (the centered pressure contribution is directly taken into
+  ! account in the pressure BC)
+  cofacv(1,ifac) = suffbn(ifac)*                                              &
+                   0.5d0*( b_masfl*bc_vel(1,ifac) + c_masfl*vel(1,iel)        &
+                          -rrus*(brom(ifac)*bc_vel(1,ifac)                    &
+                          -crom(iel)*vel(1,iel)) )
+
+  cofacv(2,ifac) = suffbn(ifac)*                                              &
+                   0.5d0*( b_masfl*bc_vel(2,ifac) + c_masfl*vel(2,iel)        &
+                          -rrus*( brom(ifac)*bc_vel(2,ifac)                   &
+                          -crom(iel)*vel(2,iel)) )
+
+  cofacv(3,ifac) = suffbn(ifac)*                                              &
+                   0.5d0*( b_masfl*bc_vel(3,ifac) + c_masfl*vel(3,iel)        &
+                          -rrus*(brom(ifac)*bc_vel(3,ifac)                    &
+                          -crom(iel)*vel(3,iel)) )
+
+  ! BC for the pressure gradient in the momentum balance
+  bc_pr(ifac) = 0.5d0 * (bc_pr(ifac) + cvar_pr(iel))
+
+  ! Total energy flux
+  coface(ifac) = suffbn(ifac)*                                                &
+                 0.5d0*( b_masfl*bc_en(ifac) + c_masfl*cvar_en(iel)           &
+                        +b_vel_n*bc_pr(ifac) + c_vel_n*cvar_pr(iel)           &
+                        -rrus*(brom(ifac)*bc_en(ifac)                         &
+                        -crom(iel)*cvar_en(iel)) )
+
+enddo
+
+deallocate(w_cp, w_cv)
+deallocate(b_pr, b_rho, c_pr, c_rho)
+deallocate(b_c2, c_c2)
 
 return
 
@@ -111,6 +111,7 @@ integer          ii    , iccfth
 integer          icalep
 integer          ien   , itk, niv
 integer          nvarcf
+integer          nfbrus, nfbana
 
 integer          nvcfmx
 parameter       (nvcfmx=6)
@@ -124,6 +125,7 @@ double precision, allocatable, dimension(:) :: wbfb, wbfa
 double precision, allocatable, dimension(:) :: bc_en, bc_pr, bc_tk
 double precision, allocatable, dimension(:) :: bc_fracv, bc_fracm, bc_frace
 double precision, allocatable, dimension(:,:) :: bc_vel
+integer, allocatable, dimension(:) :: lstfbr, lstfba
 
 double precision, dimension(:), pointer :: coefbp
 double precision, dimension(:), pointer :: crom, brom, cpro_cv, cvar_en
@@ -149,6 +151,7 @@ allocate(bc_fracv(nfabor))
 allocate(bc_fracm(nfabor))
 allocate(bc_frace(nfabor))
 allocate(bc_vel(3,nfabor))
+allocate(lstfbr(nfabor), lstfba(nfabor))
 
 ien = isca(ienerg)
 itk = isca(itempk)
@@ -441,6 +444,8 @@ do ifac = 1, nfabor
 
   endif ! end of test on boundary condition types
 
+enddo ! end of loop on boundary faces
+
 !===============================================================================
 ! 4. Complete the treatment for inlets and outlets:
 !    - boundary convective fluxes computation (analytical or Rusanov) if needed
@@ -448,34 +453,52 @@ do ifac = 1, nfabor
 !    - Dirichlet values
 !===============================================================================
 
-  if (itypfb(ifac).eq.iesicf.or.                    &
-      itypfb(ifac).eq.isspcf.or.                    &
-      itypfb(ifac).eq.iephcf.or.                    &
-      itypfb(ifac).eq.isopcf.or.                    &
-      itypfb(ifac).eq.ieqhcf) then
-
 !===============================================================================
 ! 4.1 Boundary convective fluxes computation (analytical or Rusanov) if needed
 !     (gamma should already have been computed if Rusanov fluxes are computed)
+!     Fluxes are computed by batches of faces.
 !===============================================================================
 
-    ! Rusanov fluxes are computed only for the imposed inlet for stability
-    ! reasons.
-    if (itypfb(ifac).eq.iesicf) then
+nfbrus = 0
+nfbana = 0
+
+do ifac = 1, nfabor
+
+  ! Rusanov fluxes are computed only for the imposed inlet for stability
+  ! reasons.
+  if (itypfb(ifac).eq.iesicf) then
+    nfbrus = nfbrus + 1
+    lstfbr(nfbrus) = ifac
+
+  ! For the other types of inlets/outlets (subsonic outlet, QH inlet,
+  ! PH inlet), analytical fluxes are computed
+  elseif (itypfb(ifac).eq.iephcf.or.                &
+          itypfb(ifac).eq.isopcf.or.                &
+          itypfb(ifac).eq.ieqhcf) then
+    nfbana = nfbana + 1
+    lstfba(nfbana) = ifac
+  endif
 
-    ! Dirichlet for velocity and pressure are computed in order to
-    ! impose the Rusanov fluxes in mass, momentum and energy balance.
-      call cfrusb(ifac, bc_en, bc_pr, bc_vel)
+enddo
 
-    ! For the other types of inlets/outlets (subsonic outlet, QH inlet,
-    ! PH inlet), analytical fluxes are computed
-    elseif (itypfb(ifac).ne.isspcf) then
+! Dirichlet for velocity and pressure are computed in order to
+! impose the Rusanov fluxes in mass, momentum and energy balance.
+call cfrusb(nfbrus, lstfbr, bc_en, bc_pr, bc_vel)
 
-      ! the pressure part of the boundary analytical flux is not added here,
-      ! but set through the pressure gradient boundary conditions (Dirichlet)
-      call cffana(ifac, bc_en, bc_pr, bc_vel)
+! the pressure part of the boundary analytical flux is not added here,
+! but set through the pressure gradient boundary conditions (Dirichlet)
+call cffana(nfbana, lstfba, bc_en, bc_pr, bc_vel)
 
-    endif
+! Boundary condition codes and values are set independently for each face
+
+!$omp parallel do private(ii, bmasfl) if(nfabor > thr_n_min)
+do ifac = 1, nfabor
+
+  if (itypfb(ifac).eq.iesicf.or.                    &
+      itypfb(ifac).eq.isspcf.or.                    &
+      itypfb(ifac).eq.iephcf.or.                    &
+      itypfb(ifac).eq.isopcf.or.                    &
+      itypfb(ifac).eq.ieqhcf) then
 
 !===============================================================================
 ! 4.2 Copy of boundary values into the Dirichlet values array
@@ -689,6 +712,7 @@ enddo ! end of loop on boundary faces
 deallocate(w5)
 deallocate(w7, wbfb, wbfa)
 deallocate(bc_en, bc_pr, bc_tk, bc_fracv, bc_fracm, bc_frace, bc_vel)
+deallocate(lstfbr, lstfba)
 
 !----
 ! FORMATS
@@ -165,6 +165,7 @@ cs_cf_thermo_default_init(void)
     e0 = 0;
   }
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
     crom[cell_id] = *ro0;
     cvar_en[cell_id] = e0;
@@ -194,6 +195,7 @@ cs_cf_check_pressure(cs_real_t *pres,
      Indeed, if this is the case, the thermodynamic computations will most
      probably fail. This call is done at the end of the density calculation */
   ierr = 0;
+# pragma omp parallel for reduction(+:ierr) if (l_size > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < l_size; ii++)
     if (pres[ii] <= -psginf+cs_math_epzero)
       ierr = ierr + 1;
@@ -227,15 +229,15 @@ cs_cf_check_internal_energy(cs_real_t   *ener,
 {
   /* Local variables */
   cs_gnum_t ierr;
-  cs_real_t enint;
 
   /* If the internal energy <= zero: stop the computation.
      Indeed, if this is the case, the thermodynamic computations will
      most probably fail. */
   ierr = 0;
+# pragma omp parallel for reduction(+:ierr) if (l_size > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < l_size; ii++) {
     cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-    enint = ener[ii] - 0.5*v2;
+    cs_real_t enint = ener[ii] - 0.5*v2;
 
     if (enint <= cs_math_epzero)
       ierr++;
@@ -273,6 +275,7 @@ cs_cf_check_density(cs_real_t *dens,
      provided by the user, one potential cause is a wrong user
      initialization). */
   ierr = 0;
+# pragma omp parallel for reduction(+:ierr) if (l_size > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < l_size; ii++)
     if (dens[ii] <= cs_math_epzero)
       ierr = ierr + 1;
@@ -308,6 +311,7 @@ cs_cf_check_temperature(cs_real_t *temp,
      provided by the user, one potential cause is a wrong user
      initialization). */
   ierr = 0;
+# pragma omp parallel for reduction(+:ierr) if (l_size > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < l_size; ii++)
     if (temp[ii] <= cs_math_epzero)
       ierr++;
@@ -362,6 +366,7 @@ cs_cf_thermo_te_from_dp(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  temperature */
       temp[ii] = (pres[ii]+psginf) / ((gamma0-1.)*dens[ii]*cv0);
@@ -379,6 +384,7 @@ cs_cf_thermo_te_from_dp(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  temperature */
       temp[ii] = (pres[ii]+psginf) / ((gamma[ii]-1.)*dens[ii]*cv[ii]);
@@ -430,6 +436,7 @@ cs_cf_thermo_de_from_pt(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Density */
       dens[ii] = (pres[ii]+psginf) / ((gamma0-1.)*temp[ii]*cv0);
@@ -447,6 +454,7 @@ cs_cf_thermo_de_from_pt(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Density */
       dens[ii] = (pres[ii]+psginf) / ((gamma[ii]-1.)*temp[ii]*cv[ii]);
@@ -486,7 +494,6 @@ cs_cf_thermo_dt_from_pe(cs_real_t   *cp,
                         cs_lnum_t    l_size)
 {
   /* Local variables */
-  cs_real_t enint;
   int ieos = cs_glob_cf_model->ieos;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
@@ -499,11 +506,12 @@ cs_cf_thermo_dt_from_pe(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Density */
       dens[ii] = (pres[ii]+gamma0*psginf) / ((gamma0-1.)*enint);
@@ -520,11 +528,12 @@ cs_cf_thermo_dt_from_pe(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Density */
       dens[ii] = (pres[ii]+gamma[ii]*psginf) / ((gamma[ii]-1.)*enint);
@@ -574,6 +583,7 @@ cs_cf_thermo_pe_from_dt(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Pressure */
       pres[ii] = (gamma0-1.)*cv0*dens[ii]*temp[ii] - psginf;
@@ -590,6 +600,7 @@ cs_cf_thermo_pe_from_dt(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Pressure */
       pres[ii] = (gamma[ii]-1.)*cv[ii]*dens[ii]*temp[ii] - psginf;
@@ -634,7 +645,6 @@ cs_cf_thermo_pt_from_de(cs_real_t   *cp,
                         cs_lnum_t    l_size)
 {
   /*  Local variables */
-  cs_real_t enint;
   int ieos = cs_glob_cf_model->ieos;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
@@ -647,11 +657,12 @@ cs_cf_thermo_pt_from_de(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Pressure */
       pres[ii] = (gamma0-1.)*dens[ii]*enint - gamma0*psginf;
@@ -667,11 +678,12 @@ cs_cf_thermo_pt_from_de(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Pressure */
       pres[ii] = (gamma[ii]-1.)*dens[ii]*enint - gamma[ii]*psginf;
@@ -683,10 +695,11 @@ cs_cf_thermo_pt_from_de(cs_real_t   *cp,
   }
   /* homogeneous two phase */
   else if (ieos == CS_EOS_HOMOGENEOUS_TWO_PHASE) {
+#   pragma omp parallel for schedule(dynamic, 64) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
 
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       cs_real_t tau = 1./dens[ii];
 
@@ -747,6 +760,7 @@ cs_cf_thermo_c_square(cs_real_t *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       c2[ii] = gamma0 * (pres[ii]+psginf) / dens[ii];
   }
@@ -758,12 +772,14 @@ cs_cf_thermo_c_square(cs_real_t *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       c2[ii] = gamma[ii] * (pres[ii]+psginf) / dens[ii];
 
     BFT_FREE(gamma);
   }
   else if (ieos == CS_EOS_HOMOGENEOUS_TWO_PHASE){
+#   pragma omp parallel for schedule(dynamic, 64) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       cs_real_t tau = 1./dens[ii];
 
@@ -813,6 +829,7 @@ cs_cf_thermo_beta(cs_real_t *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       beta[ii] = pow(dens[ii],gamma0);
   }
@@ -823,6 +840,7 @@ cs_cf_thermo_beta(cs_real_t *cp,
 
     cs_cf_thermo_gamma(cp, cv, gamma, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       beta[ii] = pow(dens[ii],gamma[ii]);
 
@@ -854,11 +872,13 @@ cs_cf_thermo_cv(cs_real_t *cp,
   /* Cv for a single ideal gas  or a mixture of ideal gas */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_GAS_MIX) {
     cs_real_t r_pg = cs_physical_constants_r;
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       cv[ii] = cp[ii]-r_pg/xmasml[ii];
   }
   /* Cv for a stiffened gas */
   else if (ieos == CS_EOS_STIFFENED_GAS) {
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       cv[ii] = cs_glob_fluid_properties->cv0;
   }
@@ -902,6 +922,7 @@ cs_cf_thermo_s_from_dp(cs_real_t *cp,
 
     cs_cf_check_density(dens, l_size0);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       entr[ii] = (pres[ii]+psginf) / pow(dens[ii],gamma0);
   }
@@ -916,6 +937,7 @@ cs_cf_thermo_s_from_dp(cs_real_t *cp,
 
     cs_cf_check_density(dens, l_size);
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       entr[ii] = (pres[ii]+psginf) / pow(dens[ii],gamma[ii]);
 
@@ -1622,15 +1644,18 @@ cs_cf_thermo_eps_sup(const cs_real_t  *dens,
       || ieos == CS_EOS_GAS_MIX) {
     cs_real_t psginf = cs_glob_cf_model->psginf;
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       eps_sup[ii] = psginf / dens[ii];
   }
   /* TODO diffusion to be investigated for 2-phase homogeneous model */
   else if (ieos == CS_EOS_HOMOGENEOUS_TWO_PHASE) {
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       eps_sup[ii] = 0.;
   }
   else {
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       eps_sup[ii] = 0.;
   }
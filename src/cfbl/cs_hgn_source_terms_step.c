@@ -165,6 +165,10 @@ cs_hgn_source_terms_step(const cs_mesh_t *m)
   cs_real_t *relax_tau;
   BFT_MALLOC(relax_tau, m->n_cells_with_ghosts, cs_real_t);
 
+  /* Equilibrium computations are local to each cell, but their iteration
+     count varies, so cells are dynamically distributed among threads. */
+
+# pragma omp parallel for schedule(dynamic, 64) if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
     cs_real_t u2 = cs_math_3_norm(vel[cell_id]);
     ei[cell_id] = cvar_energ[cell_id] - 0.5*u2;
@@ -192,6 +196,7 @@ cs_hgn_source_terms_step(const cs_mesh_t *m)
 
   /* Update the volume fraction, mass fraction and energy fraction using the
    * equilibrium fractions alpha_eq, y_eq, z_eq computed above. */
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
     cs_real_t exp_tau = exp(-dt[cell_id]/relax_tau[cell_id]);
 
@@ -206,6 +211,7 @@ cs_hgn_source_terms_step(const cs_mesh_t *m)
   }
 
   /* Update pressure and temperature */
+# pragma omp parallel for schedule(dynamic, 64) if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
     cs_hgn_thermo_pt(cvar_fracv[cell_id],
                      cvar_fracm[cell_id],
@@ -78,6 +78,7 @@ use radiat
 use mesh
 use field
 use pointe
+use parall
 
 !===============================================================================
 
@@ -155,6 +156,8 @@ fsir = fs(1)
 fmini = zero
 fmaxi = 1.d0
 
+!$omp parallel do private(fm, fp2m, icg, aa1, bb1, aa2, bb2, f1, f2) &
+!$omp             if(ncel > thr_n_min)
 do iel = 1, ncel
 
   fm   = cvar_fm(iel)
@@ -240,6 +243,7 @@ enddo
 
 ! ---- Initialisation
 
+!$omp parallel do if(ncel > thr_n_min)
 do iel = 1, ncel
   w1(iel) = hstoea
 enddo
@@ -286,6 +290,13 @@ if ( iirayo.gt.0 ) then
   call field_get_val_s(it3m, cpro_t3m)
 endif
 
+!$omp parallel do private(fm, fp2m, ih, jh, if, jf, f1, f2,                 &
+!$omp                     aa1, bb1, aa2, bb2, a, b, c, d, u, v, temsmm,      &
+!$omp                     dtsmdf, dd1df, dd2df, df1df, df2df, dhrecdf,       &
+!$omp                     dtsmdfp2, dd1dfp2, dd2dfp2, df1dfp2, df2dfp2,      &
+!$omp                     dhrecdfp2, dtsmdd1, dtsmdd2, dtsmdf1, dtsmdf2,     &
+!$omp                     dtsmdhrec, dtsmdhs, dadhs, dbdhs, yprod)           &
+!$omp             if(ncel > thr_n_min)
 do iel = 1, ncel
 
   fm   = cvar_fm(iel)
@@ -236,6 +236,16 @@ real(c_double), pointer, save :: xashch(:)
                             a2(ncharm), b2(ncharm),c2(ncharm),d2(ncharm),    &
                             e2(ncharm), f2(ncharm)
 
+  !--> Donnees precalculees pour les conversions enthalpie-temperature
+  !    du melange gazeux
+
+  !        xmchx1(ch)  --> Fraction massique de CHx1 dans les produits
+  !                        de la reaction de devolatilisation a basses T
+  !        xmchx2(ch)  --> Fraction massique de CHx2 dans les produits
+  !                        de la reaction de devolatilisation a hautes T
+
+  double precision, save :: xmchx1(ncharm), xmchx2(ncharm)
+
   !--> Donnees complementaires relatives au calcul de rho
   !    sur les facettes de bord
 
@@ -80,510 +80,112 @@ double precision f1mc(ncharm),f2mc(ncharm)
 
 integer          i , icha
 
-double precision ychx10 , ychx20 , ehchx1 , ehchx2
-double precision den1   , den2
+double precision ychx10 , ychx20
 double precision eh0 , eh1
+double precision w1(ncharm), w2(ncharm)
 
 !===============================================================================
-! 1. Calculation of temperature from enthalpy
+! 0. Mass fractions of the CHx1 and CHx2 species of each coal
+!    in the CHx1m and CHx2m mean species
 !===============================================================================
 
-if (mode .eq. 1) then
-
-  i = npo
+! These do not depend on the temperature, so they are computed once
+! instead of at each tabulation point.
 
-  ! Calculation of enthalpy of the gaseous species CHx1m
-  !                                            and CHx2m at TH(NPO)
-
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
+ychx10 = zero
+ychx20 = zero
+do icha = 1, ncharb
+  w1(icha) = f1mc(icha)*xmchx1(icha)
+  w2(icha) = f2mc(icha)*xmchx2(icha)
+  ychx10 = ychx10 + w1(icha)
+  ychx20 = ychx20 + w2(icha)
+enddo
 
+if (ychx10.gt.epzero) then
+  do icha = 1, ncharb
+    w1(icha) = w1(icha) / ychx10
+  enddo
+endif
+if (ychx20.gt.epzero) then
   do icha = 1, ncharb
-    den1   = 1.d0                                                 &
-         / ( a1(icha)*wmole(ichx1c(icha))                         &
-            +b1(icha)*wmole(ico )                                 &
-            +c1(icha)*wmole(ih2o)                                 &
-            +d1(icha)*wmole(ih2s)                                 &
-            +e1(icha)*wmole(ihcn)                                 &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10 + den1 *                                      &
-         ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1 + den1 *                                      &
-         ( ehgaze(ichx1c(icha),i)*                                &
-         f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                 &
-         / ( a2(icha)*wmole(ichx2c(icha))                         &
-            +b2(icha)*wmole(ico )                                 &
-            +c2(icha)*wmole(ih2o)                                 &
-            +d2(icha)*wmole(ih2s)                                 &
-            +e2(icha)*wmole(ihcn)                                 &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20 + den2 *                                      &
-         ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                      &
-         ( ehgaze(ichx2c(icha),i)*                                &
-         f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+    w2(icha) = w2(icha) / ychx20
   enddo
+endif
 
-  if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
+!===============================================================================
+! 1. Calculation of temperature from enthalpy
+!===============================================================================
 
-! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
-  eh1 = xesp(ichx1)*ehchx1                                         &
-       + xesp(ichx2)*ehchx2                                        &
-       + xesp(ico  )*ehgaze(ico  ,i)                               &
-       + xesp(ih2s )*ehgaze(ih2s ,i)                               &
-       + xesp(ihy  )*ehgaze(ihy  ,i)                               &
-       + xesp(ihcn )*ehgaze(ihcn ,i)                               &
-       + xesp(io2  )*ehgaze(io2  ,i)                               &
-       + xesp(ico2 )*ehgaze(ico2 ,i)                               &
-       + xesp(ih2o )*ehgaze(ih2o ,i)                               &
-       + xesp(iso2 )*ehgaze(iso2 ,i)                               &
-       + xesp(inh3 )*ehgaze(inh3 ,i)                               &
-       + xesp(in2  )*ehgaze(in2  ,i)
+if (mode .eq. 1) then
 
-  if (eh .ge. eh1) then
-    tp = th(i)
-    goto 501
-  endif
+  ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
 
-  i = 1
+  eh1 = gas_enthalpy(npo)
 
-  ! Calculation of enthalpy of the gaseous species CHx1m
-  !                                             and CHx2m at TH(1)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
+  if (eh .ge. eh1) then
+    tp = th(npo)
 
-  do icha = 1, ncharb
-    den1   = 1.d0                                                      &
-         / ( a1(icha)*wmole(ichx1c(icha))                              &
-            +b1(icha)*wmole(ico )                                      &
-            +c1(icha)*wmole(ih2o)                                      &
-            +d1(icha)*wmole(ih2s)                                      &
-            +e1(icha)*wmole(ihcn)                                      &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10 + den1*(f1mc(icha)*a1(icha)*wmole(ichx1c(icha)))
-    ehchx1 = ehchx1 + den1*(   ehgaze(ichx1c(icha),i)                  &
-                            * f1mc(icha)*a1(icha)*wmole(ichx1c(icha)))
-    den2   = 1.d0                                                      &
-         / ( a2(icha)*wmole(ichx2c(icha))                         &
-            +b2(icha)*wmole(ico )                                 &
-            +c2(icha)*wmole(ih2o)                                 &
-            +d2(icha)*wmole(ih2s)                                 &
-            +e2(icha)*wmole(ihcn)                                 &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20 + den2*(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)))
-    ehchx2 = ehchx2 + den2*(  ehgaze(ichx2c(icha),i)                   &
-                            * f2mc(icha)*a2(icha)*wmole(ichx2c(icha)))
-  enddo
-  if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
   else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
 
-  ! --- Eventual clipping of temperature at TH(1) if EH < EH0
-  eh0 = xesp(ichx1)*ehchx1                                        &
-      + xesp(ichx2)*ehchx2                                        &
-      + xesp(ico  )*ehgaze(ico  ,i)                               &
-      + xesp(ih2s )*ehgaze(ih2s ,i)                               &
-      + xesp(ihy  )*ehgaze(ihy  ,i)                               &
-      + xesp(ihcn )*ehgaze(ihcn ,i)                               &
-      + xesp(io2  )*ehgaze(io2  ,i)                               &
-      + xesp(ico2 )*ehgaze(ico2 ,i)                               &
-      + xesp(ih2o )*ehgaze(ih2o ,i)                               &
-      + xesp(iso2 )*ehgaze(iso2 ,i)                               &
-      + xesp(inh3 )*ehgaze(inh3 ,i)                               &
-      + xesp(in2  )*ehgaze(in2  ,i)
-
-  if ( eh .le. eh0 ) then
-    tp= th(i)
-    goto 501
-  endif
+    ! --- Eventual clipping of temperature at TH(1) if EH < EH0
 
- 500    continue
-  i = i + 1
+    eh0 = gas_enthalpy(1)
 
-! --- Calculation of enthalpy of the gaseous species CHx1m
-!                                            and CHx2m for TH(I-1)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
+    if (eh .le. eh0) then
+      tp = th(1)
 
-  do icha = 1, ncharb
-    den1   = 1.d0                                                       &
-         / ( a1(icha)*wmole(ichx1c(icha))                               &
-            +b1(icha)*wmole(ico )                                       &
-            +c1(icha)*wmole(ih2o)                                       &
-            +d1(icha)*wmole(ih2s)                                       &
-            +e1(icha)*wmole(ihcn)                                       &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10 + den1*(f1mc(icha)*a1(icha)*wmole(ichx1c(icha)))
-    ehchx1 = ehchx1 + den1*(   ehgaze(ichx1c(icha),i-1)                 &
-                            * f1mc(icha)*a1(icha)*wmole(ichx1c(icha)))
-    den2   = 1.d0                                                       &
-          / ( a2(icha)*wmole(ichx2c(icha))                              &
-             +b2(icha)*wmole(ico )                                      &
-             +c2(icha)*wmole(ih2o)                                      &
-             +d2(icha)*wmole(ih2s)                                      &
-             +e2(icha)*wmole(ihcn)                                      &
-             +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20 + den2*(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)))
-    ehchx2 = ehchx2 + den2*(  ehgaze(ichx2c(icha),i-1)                  &
-                            * f2mc(icha)*a2(icha)*wmole(ichx2c(icha)))
-  enddo
+    else
 
-  if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i-1)
-  endif
-  if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i-1)
-  endif
+      ! The mixture enthalpy increases with temperature, so the first
+      ! tabulation point with a higher enthalpy bounds the interval;
+      ! the search always ends at i <= npo given the clipping above.
 
-  eh0 = xesp(ichx1)*ehchx1                                          &
-      + xesp(ichx2)*ehchx2                                          &
-      + xesp(ico  )*ehgaze(ico  ,i-1)                               &
-      + xesp(ih2s )*ehgaze(ih2s ,i-1)                               &
-      + xesp(ihy  )*ehgaze(ihy  ,i-1)                               &
-      + xesp(ihcn )*ehgaze(ihcn ,i-1)                               &
-      + xesp(io2  )*ehgaze(io2  ,i-1)                               &
-      + xesp(ico2 )*ehgaze(ico2 ,i-1)                               &
-      + xesp(ih2o )*ehgaze(ih2o ,i-1)                               &
-      + xesp(iso2 )*ehgaze(iso2 ,i-1)                               &
-      + xesp(inh3 )*ehgaze(inh3 ,i-1)                               &
-      + xesp(in2  )*ehgaze(in2  ,i-1)
-
-  ! Calculation of the enthalpy of the gaseous species CHx1m
-  !                                                and CHx2m at TH(I)
-
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-    den1   = 1.d0                                                 &
-         / ( a1(icha)*wmole(ichx1c(icha))                         &
-            +b1(icha)*wmole(ico )                                 &
-            +c1(icha)*wmole(ih2o)                                 &
-            +d1(icha)*wmole(ih2s)                                 &
-            +e1(icha)*wmole(ihcn)                                 &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10 + den1 *                                      &
-      ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1 + den1 *                                      &
-      ( ehgaze(ichx1c(icha),i)*                                   &
-        f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                 &
-         / ( a2(icha)*wmole(ichx2c(icha))                         &
-            +b2(icha)*wmole(ico )                                 &
-            +c2(icha)*wmole(ih2o)                                 &
-            +d2(icha)*wmole(ih2s)                                 &
-            +e2(icha)*wmole(ihcn)                                 &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20 + den2 *                                      &
-       ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                      &
-       ( ehgaze(ichx2c(icha),i)*                                  &
-         f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-  enddo
-  if ( ychx10.gt.epzero ) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if ( ychx20.gt.epzero ) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
+      do i = 2, npo
+        eh1 = gas_enthalpy(i)
+        if (eh .le. eh1) exit
+        eh0 = eh1
+      enddo
 
-  eh1 = xesp(ichx1)*ehchx1                                        &
-      + xesp(ichx2)*ehchx2                                        &
-      + xesp(ico  )*ehgaze(ico  ,i)                               &
-      + xesp(ih2s )*ehgaze(ih2s ,i)                               &
-      + xesp(ihy  )*ehgaze(ihy  ,i)                               &
-      + xesp(ihcn )*ehgaze(ihcn ,i)                               &
-      + xesp(io2  )*ehgaze(io2  ,i)                               &
-      + xesp(ico2 )*ehgaze(ico2 ,i)                               &
-      + xesp(ih2o )*ehgaze(ih2o ,i)                               &
-      + xesp(iso2 )*ehgaze(iso2 ,i)                               &
-      + xesp(inh3 )*ehgaze(inh3 ,i)                               &
-      + xesp(in2  )*ehgaze(in2  ,i)
-
-  if ( eh .ge. eh0  .and. eh .le. eh1  ) then
-    tp = th(i-1) + (eh-eh0) *                                     &
-                 (th(i)-th(i-1))/(eh1-eh0)
-    goto 501
-  endif
-  goto 500
+      tp = th(i-1) + (eh-eh0) * (th(i)-th(i-1))/(eh1-eh0)
 
- 501    continue
+    endif
+
+  endif
 
 !===============================================================================
 ! 2. Calculation of the enthalpy from temperature
 !===============================================================================
 
-else if ( mode .eq. -1 ) then
-
-  i = npo
-  ! --- Calculation at Max
-  if ( tp .ge. th(i) ) then
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-           / ( a1(icha)*wmole(ichx1c(icha))                       &
-              +b1(icha)*wmole(ico)                                &
-              +c1(icha)*wmole(ih2o)                               &
-              +d1(icha)*wmole(ih2s)                               &
-              +e1(icha)*wmole(ihcn)                               &
-              +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10 + den1 *                                    &
-           ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-           ( ehgaze(ichx1c(icha),i)*                              &
-           f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-           / ( a2(icha)*wmole(ichx2c(icha))                       &
-              +b2(icha)*wmole(ico)                                &
-              +c2(icha)*wmole(ih2o)                               &
-              +d2(icha)*wmole(ih2s)                               &
-              +e2(icha)*wmole(ihcn)                               &
-              +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20 + den2 *                                    &
-           ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-           ( ehgaze(ichx2c(icha),i)*                              &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-    eh = xesp(ichx1)*ehchx1                                       &
-       + xesp(ichx2)*ehchx2                                       &
-       + xesp(ico  )*ehgaze(ico  ,i)                               &
-       + xesp(ih2s )*ehgaze(ih2s ,i)                               &
-       + xesp(ihy  )*ehgaze(ihy  ,i)                               &
-       + xesp(ihcn )*ehgaze(ihcn ,i)                               &
-       + xesp(io2  )*ehgaze(io2  ,i)                               &
-       + xesp(ico2 )*ehgaze(ico2 ,i)                               &
-       + xesp(ih2o )*ehgaze(ih2o ,i)                               &
-       + xesp(iso2 )*ehgaze(iso2 ,i)                               &
-       + xesp(inh3 )*ehgaze(inh3 ,i)                               &
-       + xesp(in2  )*ehgaze(in2  ,i)
-    goto 601
-  endif
-  ! Clipping at Min
-  i = 1
-  if ( tp .le. th(i) ) then
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-           / ( a1(icha)*wmole(ichx1c(icha))                       &
-              +b1(icha)*wmole(ico )                               &
-              +c1(icha)*wmole(ih2o)                               &
-              +d1(icha)*wmole(ih2s)                               &
-              +e1(icha)*wmole(ihcn)                               &
-              +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10 + den1 *                                    &
-           ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-           ( ehgaze(ichx1c(icha),i)*                              &
-           f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-           / ( a2(icha)*wmole(ichx2c(icha))                       &
-              +b2(icha)*wmole(ico )                               &
-              +c2(icha)*wmole(ih2o)                               &
-              +d2(icha)*wmole(ih2s)                               &
-              +e2(icha)*wmole(ihcn)                               &
-              +f2(icha)*wmole(inh3 ) )
-      ychx20 = ychx20 + den2 *                                    &
-           ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-           ( ehgaze(ichx2c(icha),i)*                              &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+else if (mode .eq. -1) then
+
+  if (tp .ge. th(npo)) then
+    eh = gas_enthalpy(npo)
+
+  else if (tp .le. th(1)) then
+    eh = gas_enthalpy(1)
+
+  else
+
+    ! Interpolation in the table: the temperature tabulation is uniform,
+    ! so the interval is obtained directly (the following loops only
+    ! correct truncation effects, so that i is the first index such
+    ! that tp <= th(i)).
+
+    i = 2 + int((tp-th(1)) / (th(2)-th(1)))
+    i = min(max(i, 2), npo)
+    do while (i .lt. npo .and. tp .gt. th(i))
+      i = i + 1
     enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-    ! --- Eventual clipping of temperature at TH(1) if EH < EH0
-    eh = xesp(ichx1)*ehchx1                                       &
-       + xesp(ichx2)*ehchx2                                       &
-       + xesp(ico  )*ehgaze(ico  ,i)                               &
-       + xesp(ih2s )*ehgaze(ih2s ,i)                               &
-       + xesp(ihy  )*ehgaze(ihy  ,i)                               &
-       + xesp(ihcn )*ehgaze(ihcn ,i)                               &
-       + xesp(io2  )*ehgaze(io2  ,i)                               &
-       + xesp(ico2 )*ehgaze(ico2 ,i)                               &
-       + xesp(ih2o )*ehgaze(ih2o ,i)                               &
-       + xesp(iso2 )*ehgaze(iso2 ,i)                               &
-       + xesp(inh3 )*ehgaze(inh3 ,i)                               &
-       + xesp(in2  )*ehgaze(in2  ,i)
-    goto 601
-  endif
- ! Interpolation in the table
-  i = 1
- 600    continue
-
-  i = i + 1
-  if ( tp .le. th(i) ) then
-    ! --- Calculation of the enthalpy of the gaseous species TH(I-1)
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                               &
-             / ( a1(icha)*wmole(ichx1c(icha))                     &
-              +b1(icha)*wmole(ico)                                &
-              +c1(icha)*wmole(ih2o)                               &
-              +d1(icha)*wmole(ih2s)                               &
-              +e1(icha)*wmole(ihcn)                               &
-              +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10 + den1 *                                    &
-        ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                    &
-        ( ehgaze(ichx1c(icha),i-1)*                               &
-          f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                               &
-             / ( a2(icha)*wmole(ichx2c(icha))                     &
-                +b2(icha)*wmole(ico)                              &
-                +c2(icha)*wmole(ih2o)                             &
-                +d2(icha)*wmole(ih2s)                             &
-                +e2(icha)*wmole(ihcn)                             &
-                +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20 + den2 *                                    &
-         ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                    &
-         ( ehgaze(ichx2c(icha),i-1)*                              &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
+    do while (i .gt. 2 .and. tp .le. th(i-1))
+      i = i - 1
     enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i-1)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i-1)
-    endif
 
-    eh0 = xesp(ichx1)*ehchx1                                      &
-        + xesp(ichx2)*ehchx2                                      &
-        + xesp(ico  )*ehgaze(ico  ,i-1)                           &
-        + xesp(ih2s )*ehgaze(ih2s ,i-1)                           &
-        + xesp(ihy  )*ehgaze(ihy  ,i-1)                           &
-        + xesp(ihcn )*ehgaze(ihcn ,i-1)                           &
-        + xesp(io2  )*ehgaze(io2  ,i-1)                           &
-        + xesp(ico2 )*ehgaze(ico2 ,i-1)                           &
-        + xesp(ih2o )*ehgaze(ih2o ,i-1)                           &
-        + xesp(iso2 )*ehgaze(iso2 ,i-1)                           &
-        + xesp(inh3 )*ehgaze(inh3 ,i-1)                           &
-        + xesp(in2  )*ehgaze(in2  ,i-1)
-    ! --- Calculation of the enthalpy of the gaseous species TH(I)
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                              &
-             / ( a1(icha)*wmole(ichx1c(icha))                    &
-                +b1(icha)*wmole(ico)                             &
-                +c1(icha)*wmole(ih2o)                            &
-                +d1(icha)*wmole(ih2s)                            &
-                +e1(icha)*wmole(ihcn)                            &
-                +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10 + den1 *                                   &
-        ( f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      ehchx1 = ehchx1 + den1 *                                   &
-        ( ehgaze(ichx1c(icha),i)*                                &
-          f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                              &
-             / ( a2(icha)*wmole(ichx2c(icha))                    &
-                +b2(icha)*wmole(ico)                             &
-                +c2(icha)*wmole(ih2o)                            &
-                +d2(icha)*wmole(ih2s)                            &
-                +e2(icha)*wmole(ihcn)                            &
-                +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20 + den2 *                                   &
-         ( f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2 + den2 *                                   &
-         ( ehgaze(ichx2c(icha),i)*                               &
-           f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    enddo
-    if ( ychx10.gt.epzero ) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if ( ychx20.gt.epzero ) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
+    eh0 = gas_enthalpy(i-1)
+    eh1 = gas_enthalpy(i)
 
-    eh1 = xesp(ichx1)*ehchx1                                     &
-        + xesp(ichx2)*ehchx2                                     &
-        + xesp(ico  )*ehgaze(ico  ,i)                            &
-        + xesp(ih2s )*ehgaze(ih2s ,i)                            &
-        + xesp(ihy  )*ehgaze(ihy  ,i)                            &
-        + xesp(ihcn )*ehgaze(ihcn ,i)                            &
-        + xesp(io2  )*ehgaze(io2  ,i)                            &
-        + xesp(ico2 )*ehgaze(ico2 ,i)                            &
-        + xesp(ih2o )*ehgaze(ih2o ,i)                            &
-        + xesp(iso2 )*ehgaze(iso2 ,i)                            &
-        + xesp(inh3 )*ehgaze(inh3 ,i)                            &
-        + xesp(in2  )*ehgaze(in2  ,i)
-
-    eh =  eh0                                                    &
-           + (eh1-eh0)*(tp-th(i-1))/(th(i)-th(i-1))
-    goto 601
-  endif
-  goto 600
+    eh = eh0 + (eh1-eh0)*(tp-th(i-1))/(th(i)-th(i-1))
 
- 601    continue
+  endif
 
 else
   write(nfecra,1000) mode
@@ -612,4 +214,56 @@ endif
 !----
 
 return
+
+contains
+
+  !-----------------------------------------------------------------------------
+
+  !> \brief Enthalpy of the gas mixture at tabulation point it.
+
+  !> \param[in]  it   tabulation point index
+
+  function gas_enthalpy(it) result(ehmix)
+
+    integer, intent(in) :: it
+
+    double precision :: ehmix
+
+    integer          jcha
+    double precision ehchx1, ehchx2
+
+    if (ychx10.gt.epzero) then
+      ehchx1 = zero
+      do jcha = 1, ncharb
+        ehchx1 = ehchx1 + w1(jcha)*ehgaze(ichx1c(jcha),it)
+      enddo
+    else
+      ehchx1 = ehgaze(ichx1,it)
+    endif
+    if (ychx20.gt.epzero) then
+      ehchx2 = zero
+      do jcha = 1, ncharb
+        ehchx2 = ehchx2 + w2(jcha)*ehgaze(ichx2c(jcha),it)
+      enddo
+    else
+      ehchx2 = ehgaze(ichx2,it)
+    endif
+
+    ehmix = xesp(ichx1)*ehchx1                                      &
+          + xesp(ichx2)*ehchx2                                      &
+          + xesp(ico  )*ehgaze(ico  ,it)                            &
+          + xesp(ih2s )*ehgaze(ih2s ,it)                            &
+          + xesp(ihy  )*ehgaze(ihy  ,it)                            &
+          + xesp(ihcn )*ehgaze(ihcn ,it)                            &
+          + xesp(io2  )*ehgaze(io2  ,it)                            &
+          + xesp(ico2 )*ehgaze(ico2 ,it)                            &
+          + xesp(ih2o )*ehgaze(ih2o ,it)                            &
+          + xesp(iso2 )*ehgaze(iso2 ,it)                            &
+          + xesp(inh3 )*ehgaze(inh3 ,it)                            &
+          + xesp(in2  )*ehgaze(in2  ,it)
+
+  end function gas_enthalpy
+
+  !-----------------------------------------------------------------------------
+
 end subroutine
@@ -141,23 +141,31 @@ elseif( ihflt2.ne.0 ) then
       enddo
       go to 11
     endif
-    it = 1
- 10       continue
 
-    it = it + 1
-    if ( temper.le.thc(it) ) then
-      eh0 = zero
-      eh1 = zero
-      do isol = 1, nsolid
-        eh0 = eh0 + xsolid(isol)*ehsoli(isol,it-1)
-        eh1 = eh1 + xsolid(isol)*ehsoli(isol,it  )
-      enddo
-      enthal = eh0                                                &
-             + (eh1-eh0)*(temper-thc(it-1))                       &
-                        /(thc(it)-thc(it-1))
-      goto 11
-    endif
-    goto 10
+    ! Interpolation in the table: the temperature tabulation is uniform,
+    ! so the interval is obtained directly (the following loops only
+    ! correct truncation effects, so that it is the first index such
+    ! that temper <= thc(it)).
+
+    it = 2 + int((temper-thc(1)) / (thc(2)-thc(1)))
+    it = min(max(it, 2), npoc)
+    do while (it .lt. npoc .and. temper .gt. thc(it))
+      it = it + 1
+    enddo
+    do while (it .gt. 2 .and. temper .le. thc(it-1))
+      it = it - 1
+    enddo
+
+    eh0 = zero
+    eh1 = zero
+    do isol = 1, nsolid
+      eh0 = eh0 + xsolid(isol)*ehsoli(isol,it-1)
+      eh1 = eh1 + xsolid(isol)*ehsoli(isol,it  )
+    enddo
+    enthal = eh0                                                  &
+           + (eh1-eh0)*(temper-thc(it-1))                         &
+                      /(thc(it)-thc(it-1))
+
  11       continue
 
   elseif ( mode.eq.1 ) then
@@ -125,6 +125,7 @@ do icla = 1, nclacp
   call field_get_val_s(igmdv2(icla),cpro_cgd2)
   call field_get_val_s(igmdch(icla),cpro_cgch)
   call field_get_val_s(igmhet(icla),cpro_cght)
+  !$omp parallel do if(ncel > thr_n_min)
   do iel = 1, ncel
     cpro_cgd1(iel) = zero
     cpro_cgd2(iel) = zero
@@ -150,6 +151,7 @@ do icla = 1, nclacp
     call field_get_val_prev_s(ivarfl(isca(ixwt(icla))), cvara_xwtcl)
   endif
 
+  !$omp parallel do private(xch, xck, xash, xx2) if(ncel > thr_n_min)
   do iel = 1, ncel
     xch  = cvara_xchcl(iel)
     xck  = cvara_xckcl(iel)
@@ -169,6 +171,7 @@ enddo
 
 ! ---- Rho 1
 
+!$omp parallel do if(ncel > thr_n_min)
 do iel = 1, ncel
   rho1(iel) = (1.d0-x2(iel)) / (1.d0/crom(iel)-x2srho2(iel))
 enddo
@@ -184,6 +187,7 @@ do icla = 1, nclacp
   call field_get_val_s(igmdch(icla),cpro_cgch)
   call field_get_val_s(itemp2(icla),cpro_temp2)
 
+  !$omp parallel do if(ncel > thr_n_min)
   do iel = 1, ncel
 
   ! --- Mass transfert due to degagement of light mass density (s-1) < 0
@@ -270,6 +274,8 @@ do icla = 1, nclacp
 
   icha = ichcor(icla)
 
+  !$omp parallel do private(xnp, xuash, pparo2, xdfchi, diacka, xdfext,  &
+  !$omp                     xdftot1, xdftot0, coxck) if(ncel > thr_n_min)
   do iel = 1, ncel
 
     xnp   = cvara_xnpcl(iel)
@@ -347,6 +353,8 @@ if ( ihtco2 .eq. 1) then
 
     icha = ichcor(icla)
 
+    !$omp parallel do private(xnp, xuash, pprco2, xdfchi, diacka, xdfext, &
+    !$omp                     xdftot1, xdftot0, coxck) if(ncel > thr_n_min)
     do iel = 1, ncel
 
       xnp   = cvara_xnpcl(iel)
@@ -426,6 +434,8 @@ if ( ihth2o .eq. 1) then
 
     icha = ichcor(icla)
 
+    !$omp parallel do private(xnp, xuash, pprh2o, xdfchi, diacka, xdfext, &
+    !$omp                     xdftot1, xdftot0, coxck) if(ncel > thr_n_min)
     do iel = 1, ncel
 
       xnp   = cvara_xnpcl(iel)
@@ -514,6 +524,7 @@ if ( ippmod(iccoal) .ge. 1 ) then
 
   call field_get_key_double(ivarfl(isca(iscalt)), kvisl0, visls_0)
 
+  !$omp parallel do if(ncel > thr_n_min)
   do iel = 1, ncel
     if (ifcvsl.ge.0) then
       if (icp.ge.0) then
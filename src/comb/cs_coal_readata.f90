@@ -1203,6 +1203,26 @@ do icha = 1, ncharb
   endif
 enddo
 
+! ---- Fractions massiques de CH(CHX1) et CH(CHX2) dans les produits
+!      de devolatilisation (conversions enthalpie-temperature)
+
+do icha = 1, ncharb
+  den1   = a1(icha)*wmole(ichx1c(icha))                             &
+          +b1(icha)*wmole(ico)                                      &
+          +c1(icha)*wmole(ih2o)                                     &
+          +d1(icha)*wmole(ih2s)                                     &
+          +e1(icha)*wmole(ihcn)                                     &
+          +f1(icha)*wmole(inh3)
+  xmchx1(icha) = a1(icha)*wmole(ichx1c(icha)) / den1
+  den2   = a2(icha)*wmole(ichx2c(icha))                             &
+          +b2(icha)*wmole(ico)                                      &
+          +c2(icha)*wmole(ih2o)                                     &
+          +d2(icha)*wmole(ih2s)                                     &
+          +e2(icha)*wmole(ihcn)                                     &
+          +f2(icha)*wmole(inh3)
+  xmchx2(icha) = a2(icha)*wmole(ichx2c(icha)) / den2
+enddo
+
 
 ! --> Calcul pour les differentes classes
 
@@ -63,6 +63,7 @@ use cpincl
 use ppincl
 use ppcpfu
 use mesh
+use parall
 use field
 use cs_c_bindings
 use pointe
@@ -78,10 +79,9 @@ real(kind=c_double), dimension(*) :: eh, tp
 
 ! Local variables
 
-integer          i, iel, ielt, nelt, icha
+integer          iel, ielt, nelt, icha
 
-double precision ychx10 , ychx20 , ehchx1 , ehchx2
-double precision den1   , den2 , eh0 , eh1
+double precision xesp(ngazem)
 double precision f1mc(ncharm), f2mc(ncharm)
 
 double precision, dimension(:), pointer :: x1
@@ -114,6 +114,7 @@ else if (location_id .eq. MESH_LOCATION_BOUNDARY_FACES) then
   nelt = nfabor
 else
   call csexit(1)
+  return
 endif
 
 !===============================================================================
@@ -125,8 +126,10 @@ do icha = 1, ncharb
   call field_get_val_s(ivarfl(isca(if2m(icha))), cvar_f2m(icha)%p)
 enddo
 
-i = npo-1
+! Each element is handled independently, with the enthalpy of the
+! mixture computed once per tabulation point (see cs_coal_htconvers1).
 
+!$omp parallel do private(iel, icha, xesp, f1mc, f2mc) if(nelt > thr_n_min)
 do ielt = 1, nelt
 
   if (location_id .eq. MESH_LOCATION_CELLS) then
@@ -135,277 +138,29 @@ do ielt = 1, nelt
     iel = ifabor(ielt)
   endif
 
-! --- Calculation of enthalpy of the gaseous species CHx1m
-!                                            and CHx2m at TH(NPO)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
   do icha = 1, ncharb
-
     f1mc(icha) = cvar_f1m(icha)%p(iel) / x1(iel)
     f2mc(icha) = cvar_f2m(icha)%p(iel) / x1(iel)
-
-    den1   = 1.d0                                                  &
-         / ( a1(icha)*wmole(ichx1c(icha))                          &
-            +b1(icha)*wmole(ico)                                   &
-            +c1(icha)*wmole(ih2o)                                  &
-            +d1(icha)*wmole(ih2s)                                  &
-            +e1(icha)*wmole(ihcn)                                  &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10                                                &
-            +den1*(f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1                                                &
-            +den1*( ehgaze(ichx1c(icha),i+1)                       &
-                   *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                  &
-         / ( a2(icha)*wmole(ichx2c(icha))                          &
-            +b2(icha)*wmole(ico)                                   &
-            +c2(icha)*wmole(ih2o)                                  &
-            +d2(icha)*wmole(ih2s)                                  &
-            +e2(icha)*wmole(ihcn)                                  &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20                                                &
-            +den2 *(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2 + den2 *                                       &
-         ( ehgaze(ichx2c(icha),i+1)                                &
-          *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
   enddo
-  if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i+1)
-  endif
-  if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i+1)
-  endif
-
-  ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
-
-  eh1 = fuel1(iel)*ehchx1                                  &
-       +fuel2(iel)*ehchx2                                  &
-       +fuel3(iel)*ehgaze(ico ,i+1)                        &
-       +fuel4(iel)*ehgaze(ih2s,i+1)                        &
-       +fuel5(iel)*ehgaze(ihy ,i+1)                        &
-       +fuel6(iel)*ehgaze(ihcn,i+1)                        &
-       +fuel7(iel)*ehgaze(inh3,i+1)                        &
-       +oxyd(iel) *ehgaze(io2 ,i+1)                        &
-       +prod1(iel)*ehgaze(ico2,i+1)                        &
-       +prod2(iel)*ehgaze(ih2o,i+1)                        &
-       +prod3(iel)*ehgaze(iso2,i+1)                        &
-       +xiner(iel)*ehgaze(in2 ,i+1)
-
-  if (eh(ielt).ge.eh1) tp(ielt) = th(i+1)
-enddo
 
-i = 1
-
-do ielt = 1, nelt
-
-  if (location_id .eq. MESH_LOCATION_CELLS) then
-    iel = ielt
-  else
-    iel = ifabor(ielt)
-  endif
-
-  ! --- Calculation of enthalpy of the gaseous species CHx1m
-  !                                            and CHx2m at TH(1)
-  ehchx1 = zero
-  ehchx2 = zero
-  ychx10 = zero
-  ychx20 = zero
-  do icha = 1, ncharb
-    f1mc(icha) = cvar_f1m(icha)%p(iel) / x1(iel)
-    f2mc(icha) = cvar_f2m(icha)%p(iel) / x1(iel)
-    den1   = 1.d0                                                    &
-         / ( a1(icha)*wmole(ichx1c(icha))                            &
-            +b1(icha)*wmole(ico)                                     &
-            +c1(icha)*wmole(ih2o)                                    &
-            +d1(icha)*wmole(ih2s)                                    &
-            +e1(icha)*wmole(ihcn)                                    &
-            +f1(icha)*wmole(inh3) )
-    ychx10 = ychx10                                                  &
-            +den1*(f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    ehchx1 = ehchx1                                                  &
-            +den1*( ehgaze(ichx1c(icha),i)                           &
-                   *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-    den2   = 1.d0                                                     &
-         / ( a2(icha)*wmole(ichx2c(icha))                             &
-            +b2(icha)*wmole(ico)                                      &
-            +c2(icha)*wmole(ih2o)                                     &
-            +d2(icha)*wmole(ih2s)                                     &
-            +e2(icha)*wmole(ihcn)                                     &
-            +f2(icha)*wmole(inh3) )
-    ychx20 = ychx20                                                   &
-            +den2*(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    ehchx2 = ehchx2                                                   &
-            +den2*( ehgaze(ichx2c(icha),i)                            &
-                   *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-  enddo
-  if (ychx10.gt.epzero) then
-    ehchx1 = ehchx1 / ychx10
-  else
-    ehchx1 = ehgaze(ichx1,i)
-  endif
-  if (ychx20.gt.epzero) then
-    ehchx2 = ehchx2 / ychx20
-  else
-    ehchx2 = ehgaze(ichx2,i)
-  endif
-
-  ! --- Eventual clipping of temperature at TH(1) if EH < EH0
-
-  eh0  = fuel1(iel)*ehchx1                                  &
-        +fuel2(iel)*ehchx2                                  &
-        +fuel3(iel)*ehgaze(ico ,i)                          &
-        +fuel4(iel)*ehgaze(ih2s,i)                          &
-        +fuel5(iel)*ehgaze(ihy ,i)                          &
-        +fuel6(iel)*ehgaze(ihcn,i)                          &
-        +fuel7(iel)*ehgaze(inh3,i)                          &
-        +oxyd(iel) *ehgaze(io2 ,i)                          &
-        +prod1(iel)*ehgaze(ico2,i)                          &
-        +prod2(iel)*ehgaze(ih2o,i)                          &
-        +prod3(iel)*ehgaze(iso2,i)                          &
-        +xiner(iel)*ehgaze(in2 ,i)
-
-  if (eh(ielt) .le. eh0 ) tp(ielt)= th(i)
+  xesp(ichx1) = fuel1(iel)
+  xesp(ichx2) = fuel2(iel)
+  xesp(ico  ) = fuel3(iel)
+  xesp(ih2s ) = fuel4(iel)
+  xesp(ihy  ) = fuel5(iel)
+  xesp(ihcn ) = fuel6(iel)
+  xesp(inh3 ) = fuel7(iel)
+  xesp(io2  ) = oxyd(iel)
+  xesp(ico2 ) = prod1(iel)
+  xesp(ih2o ) = prod2(iel)
+  xesp(iso2 ) = prod3(iel)
+  xesp(in2  ) = xiner(iel)
+
+  call cs_coal_htconvers1(1, eh(ielt), xesp, f1mc, f2mc, tp(ielt))
 
 enddo
 
-
-do i = 1, npo-1
-
-  do ielt = 1, nelt
-
-    if (location_id .eq. MESH_LOCATION_CELLS) then
-      iel = ielt
-    else
-      iel = ifabor(ielt)
-    endif
-
-    ! --- Calculation of enthalpy of the gaseous species CHx1m
-    !                                            and CHx2m for TH(I)
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      f1mc(icha) = cvar_f1m(icha)%p(iel) / x1(iel)
-      f2mc(icha) = cvar_f2m(icha)%p(iel) / x1(iel)
-    enddo
-    do icha = 1, ncharb
-      den1   = 1.d0                                                 &
-             / ( a1(icha)*wmole(ichx1c(icha))                       &
-                +b1(icha)*wmole(ico)                                &
-                +c1(icha)*wmole(ih2o)                               &
-                +d1(icha)*wmole(ih2s)                               &
-                +e1(icha)*wmole(ihcn)                               &
-                +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10                                               &
-              +den1*f1mc(icha)*a1(icha)*wmole(ichx1c(icha))
-      ehchx1 = ehchx1                                               &
-              +den1*( ehgaze(ichx1c(icha),i)                        &
-                     *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                                 &
-             / ( a2(icha)*wmole(ichx2c(icha))                       &
-                +b2(icha)*wmole(ico)                                &
-                +c2(icha)*wmole(ih2o)                               &
-                +d2(icha)*wmole(ih2s)                               &
-                +e2(icha)*wmole(ihcn)                               &
-                +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20                                               &
-              +den2*(f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-      ehchx2 = ehchx2                                               &
-              +den2*( ehgaze(ichx2c(icha),i)                        &
-                     *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    enddo
-    if (ychx10.gt.epzero) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i)
-    endif
-    if (ychx20.gt.epzero) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i)
-    endif
-    eh0 = fuel1(iel)*ehchx1                                  &
-         +fuel2(iel)*ehchx2                                  &
-         +fuel3(iel)*ehgaze(ico ,i)                          &
-         +fuel4(iel)*ehgaze(ih2s,i)                          &
-         +fuel5(iel)*ehgaze(ihy ,i)                          &
-         +fuel6(iel)*ehgaze(ihcn,i)                          &
-         +fuel7(iel)*ehgaze(inh3,i)                          &
-         +oxyd(iel) *ehgaze(io2 ,i)                          &
-         +prod1(iel)*ehgaze(ico2,i)                          &
-         +prod2(iel)*ehgaze(ih2o,i)                          &
-         +prod3(iel)*ehgaze(iso2,i)                          &
-         +xiner(iel)*ehgaze(in2 ,i)
-
-    ! --- Calculation of enthalpy of the gaseous species CHx1m
-    !                                            and CHx2m for TH(I+1)
-    ehchx1 = zero
-    ehchx2 = zero
-    ychx10 = zero
-    ychx20 = zero
-    do icha = 1, ncharb
-      den1   = 1.d0                                                   &
-           / ( a1(icha)*wmole(ichx1c(icha))                           &
-              +b1(icha)*wmole(ico)                                    &
-              +c1(icha)*wmole(ih2o)                                   &
-              +d1(icha)*wmole(ih2s)                                   &
-              +e1(icha)*wmole(ihcn)                                   &
-              +f1(icha)*wmole(inh3) )
-      ychx10 = ychx10                                                 &
-              +den1*f1mc(icha)*a1(icha)*wmole(ichx1c(icha))
-      ehchx1 = ehchx1                                                 &
-              +den1*( ehgaze(ichx1c(icha),i+1)                        &
-                     *f1mc(icha)*a1(icha)*wmole(ichx1c(icha)) )
-      den2   = 1.d0                                                   &
-             / ( a2(icha)*wmole(ichx2c(icha))                         &
-                +b2(icha)*wmole(ico)                                  &
-                +c2(icha)*wmole(ih2o)                                 &
-                +d2(icha)*wmole(ih2s)                                 &
-                +e2(icha)*wmole(ihcn)                                 &
-                +f2(icha)*wmole(inh3) )
-      ychx20 = ychx20                                                 &
-              +den2*f2mc(icha)*a2(icha)*wmole(ichx2c(icha))
-      ehchx2 = ehchx2                                                 &
-              +den2*( ehgaze(ichx2c(icha),i+1)                        &
-                     *f2mc(icha)*a2(icha)*wmole(ichx2c(icha)) )
-    enddo
-    if (ychx10.gt.epzero) then
-      ehchx1 = ehchx1 / ychx10
-    else
-      ehchx1 = ehgaze(ichx1,i+1)
-    endif
-    if (ychx20.gt.epzero) then
-      ehchx2 = ehchx2 / ychx20
-    else
-      ehchx2 = ehgaze(ichx2,i+1)
-    endif
-
-    eh1 = fuel1(iel)*ehchx1                                    &
-         +fuel2(iel)*ehchx2                                    &
-         +fuel3(iel)*ehgaze(ico ,i+1)                          &
-         +fuel4(iel)*ehgaze(ih2s,i+1)                          &
-         +fuel5(iel)*ehgaze(ihy ,i+1)                          &
-         +fuel6(iel)*ehgaze(ihcn,i+1)                          &
-         +fuel7(iel)*ehgaze(inh3,i+1)                          &
-         +oxyd(iel) *ehgaze(io2 ,i+1)                          &
-         +prod1(iel)*ehgaze(ico2,i+1)                          &
-         +prod2(iel)*ehgaze(ih2o,i+1)                          &
-         +prod3(iel)*ehgaze(iso2,i+1)                          &
-         +xiner(iel)*ehgaze(in2 ,i+1)
-
-    if (eh(ielt).ge.eh0 .and. eh(ielt).le.eh1) then
-      tp(ielt)= th(i) + (  eh(ielt)-eh0)                       &
-                         * (th(i+1)-th(i))/(eh1-eh0)
-    endif
-  enddo
-enddo
+deallocate(cvar_f1m, cvar_f2m)
 
 !----
 ! End
@@ -53,6 +53,7 @@ use ppthch
 use coincl
 use cpincl
 use ppincl
+use parall
 use field
 
 !===============================================================================
@@ -66,12 +67,10 @@ integer          ncel
 ! Local variables
 
 integer          i      , icla   , icha   , iel
-integer          ihflt2
+integer          ihflt2 , isch   , isck   , isash  , iswat
 double precision h2     , x2     , xch    , xck
 double precision xash   , xnp    , xtes   , xwat
-
-integer          iok1
-double precision , dimension ( : )     , allocatable :: eh0,eh1
+double precision eh0    , eh1
 
 double precision, dimension(:), pointer :: cvar_xchcl, cvar_xckcl, cvar_xnpcl
 double precision, dimension(:), pointer :: cvar_xwtcl
@@ -87,27 +86,12 @@ ihflt2 = 1
 ! 1. Preliminary calculations
 !===============================================================================
 
-!===============================================================================
-! Deallocation dynamic arrays
-!----
-allocate(eh0(1:ncel),eh1(1:ncel),STAT=iok1)
-!----
-if ( iok1 > 0 ) THEN
-  write(nfecra,*) ' Memory allocation error inside: '
-  write(nfecra,*) '    cs_coal_thfieldconv2         '
-  call csexit(1)
-endif
-!===============================================================================
-
-! --- Tables initialization
-eh0( : ) = zero
-eh1( : ) = zero
-
 ! --- Initialization of T2 from gas mix T
 
 call field_get_val_s(itemp, cpro_temp)
 do icla = 1, nclacp
   call field_get_val_s(itemp2(icla), cpro_temp2)
+  !$omp parallel do if(ncel > thr_n_min)
   do iel = 1, ncel
     cpro_temp2(iel) = cpro_temp(iel)
   enddo
@@ -125,6 +109,7 @@ if ( ihflt2.eq.0 ) then
     call field_get_val_s(ivarfl(isca(ih2(icla))), cvar_h2cl)
     call field_get_val_s(itemp2(icla),cpro_temp2)
     icha = ichcor(icla)
+    !$omp parallel do if(ncel > thr_n_min)
     do iel = 1, ncel
       cpro_temp2(iel) =                                       &
             (cvar_h2cl(iel)-h02ch(icha))                         &!FIXME divide by x2
@@ -147,40 +132,17 @@ else
     call field_get_val_s(ivarfl(isca(ih2(icla))), cvar_h2cl)
     call field_get_val_s(itemp2(icla),cpro_temp2)
 
-    i = npoc-1
-    do iel = 1, ncel
-      xch  = cvar_xchcl(iel)
-      xck  = cvar_xckcl(iel)
-      xnp  = cvar_xnpcl(iel)
-      xash = xmash(icla)*xnp
-      if ( ippmod(iccoal) .eq. 1 ) then
-        xwat = cvar_xwtcl(iel)
-      else
-        xwat = 0.d0
-      endif
-
-      x2   = xch + xck + xash + xwat
-
-      xtes = xmp0(icla)*xnp
+    isch  = ich(ichcor(icla))
+    isck  = ick(ichcor(icla))
+    isash = iash(ichcor(icla))
+    iswat = iwat(ichcor(icla))
 
-      if ( xtes.gt.epsicp .and. x2.gt.epsicp*100.d0 ) then
+    ! Each cell is handled independently; the enthalpy of the solid
+    ! increases with temperature, so the first tabulation point with
+    ! a higher enthalpy bounds the interpolation interval.
 
-        h2   = cvar_h2cl(iel)/x2
-
-        eh1(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i+1)    &
-                  + xck /x2 * ehsoli(ick(ichcor(icla) ),i+1)    &
-                  + xash/x2 * ehsoli(iash(ichcor(icla)),i+1)    &
-                  + xwat/x2 * ehsoli(iwat(ichcor(icla)),i+1)
-        if ( h2.ge.eh1(iel) ) then
-          cpro_temp2(iel) = thc(i+1)
-
-        endif
-
-      endif
-
-    enddo
-
-    i = 1
+    !$omp parallel do private(xch, xck, xnp, xash, xwat, x2, xtes, h2,  &
+    !$omp                     eh0, eh1, i) if(ncel > thr_n_min)
     do iel = 1, ncel
       xch  = cvar_xchcl(iel)
       xck  = cvar_xckcl(iel)
@@ -193,80 +155,59 @@ else
       endif
 
       x2   = xch + xck + xash + xwat
+
       xtes = xmp0(icla)*xnp
 
       if ( xtes.gt.epsicp .and. x2.gt.epsicp*100.d0 ) then
 
         h2   = cvar_h2cl(iel)/x2
 
+        ! --- Eventual clipping of temperature at THC(NPOC)
 
-        eh0(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i)      &
-                  + xck /x2 * ehsoli(ick(ichcor(icla) ),i)      &
-                  + xash/x2 * ehsoli(iash(ichcor(icla)),i)      &
-                  + xwat/x2 * ehsoli(iwat(ichcor(icla)),i)
-        if ( h2.le.eh0(iel) ) then
-          cpro_temp2(iel) = thc(i)
-        endif
-
-      endif
+        eh1 = xch /x2 * ehsoli(isch ,npoc)                    &
+            + xck /x2 * ehsoli(isck ,npoc)                    &
+            + xash/x2 * ehsoli(isash,npoc)                    &
+            + xwat/x2 * ehsoli(iswat,npoc)
 
-    enddo
-
-    do i = 1, npoc-1
-      do iel = 1, ncel
-        xch  = cvar_xchcl(iel)
-        xck  = cvar_xckcl(iel)
-        xnp  = cvar_xnpcl(iel)
-        xash = xmash(icla)*xnp
-        if ( ippmod(iccoal) .eq. 1 ) then
-          xwat = cvar_xwtcl(iel)
-        else
-          xwat = 0.d0
+        if ( h2.ge.eh1 ) then
+          cpro_temp2(iel) = thc(npoc)
+          cycle
         endif
 
-        x2   = xch + xck + xash + xwat
-        xtes = xmp0(icla)*xnp
+        ! --- Eventual clipping of temperature at THC(1)
 
-        if ( xtes.gt.epsicp .and. x2.gt.epsicp*100.d0 ) then
+        eh0 = xch /x2 * ehsoli(isch ,1)                       &
+            + xck /x2 * ehsoli(isck ,1)                       &
+            + xash/x2 * ehsoli(isash,1)                       &
+            + xwat/x2 * ehsoli(iswat,1)
 
-          h2   = cvar_h2cl(iel)/x2
+        if ( h2.le.eh0 ) then
+          cpro_temp2(iel) = thc(1)
+          cycle
+        endif
 
-          eh0(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i  )  &
-                    + xck /x2 * ehsoli(ick(ichcor(icla) ),i  )  &
-                    + xash/x2 * ehsoli(iash(ichcor(icla)),i  )  &
-                    + xwat/x2 * ehsoli(iwat(ichcor(icla)),i  )
+        ! --- Interpolation (h2 < eh(npoc), so i <= npoc)
 
-          eh1(iel) = xch /x2 * ehsoli(ich(ichcor(icla) ),i+1)  &
-                    + xck /x2 * ehsoli(ick(ichcor(icla) ),i+1)  &
-                    + xash/x2 * ehsoli(iash(ichcor(icla)),i+1)  &
-                    + xwat/x2 * ehsoli(iwat(ichcor(icla)),i+1)
+        do i = 2, npoc
+          eh1 = xch /x2 * ehsoli(isch ,i)                     &
+              + xck /x2 * ehsoli(isck ,i)                     &
+              + xash/x2 * ehsoli(isash,i)                     &
+              + xwat/x2 * ehsoli(iswat,i)
+          if ( h2.le.eh1 ) exit
+          eh0 = eh1
+        enddo
 
-          if ( h2.ge.eh0(iel) .and. h2.le.eh1(iel) ) then
-            cpro_temp2(iel) = thc(i) + (h2-eh0(iel)) *     &
-                  (thc(i+1)-thc(i))/(eh1(iel)-eh0(iel))
-          endif
+        cpro_temp2(iel) = thc(i-1) + (h2-eh0) *                &
+              (thc(i)-thc(i-1))/(eh1-eh0)
 
-        endif
+      endif
 
-      enddo
     enddo
 
   enddo
 
 endif
 
-!===============================================================================
-! Deallocation dynamic arrays
-!----
-deallocate(eh0,eh1,STAT=iok1)
-!----
-if ( iok1 > 0 ) then
-  write(nfecra,*) ' Memory deallocation error inside: '
-  write(nfecra,*) '    cs_coal_thfieldconv2           '
-  call csexit(1)
-endif
-!===============================================================================
-
 !----
 ! End
 !----
@@ -64,6 +64,7 @@ use cs_fuel_incl
 use ppincl
 use ppcpfu
 use mesh
+use parall
 use field
 use cs_c_bindings
 
@@ -78,7 +79,7 @@ real(kind=c_double), dimension(*) :: eh, tp
 
 ! Local variables
 
-integer          ii, icel, ifac
+integer          ii, iel, ielt, nelt
 double precision eh0, eh1
 
 double precision, dimension(:), pointer :: fuel1, fuel2, fuel3, fuel4, fuel5
@@ -101,186 +102,90 @@ call field_get_val_s(iym1(iso2), prod3)
 call field_get_val_s(iym1(in2 ), xiner)
 
 if (location_id .eq. MESH_LOCATION_CELLS) then
+  nelt = ncel
+else if (location_id .eq. MESH_LOCATION_BOUNDARY_FACES) then
+  nelt = nfabor
+else
+  return
+endif
 
-  ii = npo-1
-  do icel = 1, ncel
-
-    ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
-
-    eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                       &
-         +fuel2(icel)*ehgaze(ifov,ii+1)                       &
-         +fuel3(icel)*ehgaze(ico ,ii+1)                       &
-         +fuel4(icel)*ehgaze(ih2s,ii+1)                       &
-         +fuel5(icel)*ehgaze(ihy ,ii+1)                       &
-         +fuel6(icel)*ehgaze(ihcn,ii+1)                       &
-         +fuel7(icel)*ehgaze(inh3,ii+1)                       &
-         +oxyd(icel) *ehgaze(io2 ,ii+1)                       &
-         +prod1(icel)*ehgaze(ico2,ii+1)                       &
-         +prod2(icel)*ehgaze(ih2o,ii+1)                       &
-         +prod3(icel)*ehgaze(iso2,ii+1)                       &
-         +xiner(icel)*ehgaze(in2 ,ii+1)
-    if (eh(icel) .ge. eh1) tp(icel) = th(ii+1)
+! Each element is handled independently; the enthalpy of the mixture
+! increases with temperature, so the first tabulation point with a
+! higher enthalpy bounds the interpolation interval.
 
-  enddo
+!$omp parallel do private(iel, ii, eh0, eh1) if(nelt > thr_n_min)
+do ielt = 1, nelt
 
-  ii = 1
-  do icel = 1, ncel
+  if (location_id .eq. MESH_LOCATION_CELLS) then
+    iel = ielt
+  else
+    iel = ifabor(ielt)
+  endif
 
-    ! --- Eventual clipping of temperature at TH(1) if EH < EH0
+  ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
 
-    eh0 = fuel1(icel)*ehgaze(ifo0,ii)                         &
-         +fuel2(icel)*ehgaze(ifov,ii)                         &
-         +fuel3(icel)*ehgaze(ico ,ii)                         &
-         +fuel4(icel)*ehgaze(ih2s,ii)                         &
-         +fuel5(icel)*ehgaze(ihy ,ii)                         &
-         +fuel6(icel)*ehgaze(ihcn,ii)                         &
-         +fuel7(icel)*ehgaze(inh3,ii)                         &
-         +oxyd(icel) *ehgaze(io2 ,ii)                         &
-         +prod1(icel)*ehgaze(ico2,ii)                         &
-         +prod2(icel)*ehgaze(ih2o,ii)                         &
-         +prod3(icel)*ehgaze(iso2,ii)                         &
-         +xiner(icel)*ehgaze(in2 ,ii)
+  eh1 = gas_enthalpy(iel, npo)
+  if (eh(ielt) .ge. eh1) then
+    tp(ielt) = th(npo)
+    cycle
+  endif
 
-    if (eh(icel) .le. eh0) then
-      tp(icel) = th(1)
-    endif
+  ! --- Eventual clipping of temperature at TH(1) if EH < EH0
 
-  enddo
+  eh0 = gas_enthalpy(iel, 1)
+  if (eh(ielt) .le. eh0) then
+    tp(ielt) = th(1)
+    cycle
+  endif
 
-  do ii = 1, npo-1
-
-    do icel = 1, ncel
-
-      eh0 = fuel1(icel)*ehgaze(ifo0,ii)                       &
-           +fuel2(icel)*ehgaze(ifov,ii)                       &
-           +fuel3(icel)*ehgaze(ico ,ii)                       &
-           +fuel4(icel)*ehgaze(ih2s,ii)                       &
-           +fuel5(icel)*ehgaze(ihy ,ii)                       &
-           +fuel6(icel)*ehgaze(ihcn,ii)                       &
-           +fuel7(icel)*ehgaze(inh3,ii)                       &
-           +oxyd(icel) *ehgaze(io2 ,ii)                       &
-           +prod1(icel)*ehgaze(ico2,ii)                       &
-           +prod2(icel)*ehgaze(ih2o,ii)                       &
-           +prod3(icel)*ehgaze(iso2,ii)                       &
-           +xiner(icel)*ehgaze(in2 ,ii)
-
-      eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                     &
-           +fuel2(icel)*ehgaze(ifov,ii+1)                     &
-           +fuel3(icel)*ehgaze(ico ,ii+1)                     &
-           +fuel4(icel)*ehgaze(ih2s,ii+1)                     &
-           +fuel5(icel)*ehgaze(ihy ,ii+1)                     &
-           +fuel6(icel)*ehgaze(ihcn,ii+1)                     &
-           +fuel7(icel)*ehgaze(inh3,ii+1)                     &
-           +oxyd(icel) *ehgaze(io2 ,ii+1)                     &
-           +prod1(icel)*ehgaze(ico2,ii+1)                     &
-           +prod2(icel)*ehgaze(ih2o,ii+1)                     &
-           +prod3(icel)*ehgaze(iso2,ii+1)                     &
-           +xiner(icel)*ehgaze(in2 ,ii+1)
-
-      if (eh(icel) .ge. eh0 .and. eh(icel) .le. eh1) then
-        tp(icel) = th(ii) + (eh(icel)-eh0) * (th(ii+1)-th(ii)) / (eh1-eh0)
-      endif
-
-    enddo
+  ! --- Interpolation (eh < eh1(npo), so ii <= npo)
 
+  do ii = 2, npo
+    eh1 = gas_enthalpy(iel, ii)
+    if (eh(ielt) .le. eh1) exit
+    eh0 = eh1
   enddo
 
-else if (location_id .eq. MESH_LOCATION_BOUNDARY_FACES) then
-
-  ii = npo-1
-  do ifac = 1, nfabor
-
-    icel = ifabor(ifac)
+  tp(ielt) = th(ii-1) + (eh(ielt)-eh0) * (th(ii)-th(ii-1)) / (eh1-eh0)
 
-    ! --- Eventual clipping of temperature at TH(NPO) if EH > EH1
+enddo
 
-    eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                       &
-         +fuel2(icel)*ehgaze(ifov,ii+1)                       &
-         +fuel3(icel)*ehgaze(ico ,ii+1)                       &
-         +fuel4(icel)*ehgaze(ih2s,ii+1)                       &
-         +fuel5(icel)*ehgaze(ihy ,ii+1)                       &
-         +fuel6(icel)*ehgaze(ihcn,ii+1)                       &
-         +fuel7(icel)*ehgaze(inh3,ii+1)                       &
-         +oxyd(icel) *ehgaze(io2 ,ii+1)                       &
-         +prod1(icel)*ehgaze(ico2,ii+1)                       &
-         +prod2(icel)*ehgaze(ih2o,ii+1)                       &
-         +prod3(icel)*ehgaze(iso2,ii+1)                       &
-         +xiner(icel)*ehgaze(in2 ,ii+1)
-    if (eh(ifac) .ge. eh1) tp(ifac) = th(ii+1)
+!----
+! End
+!----
 
-  enddo
+return
 
-  ii = 1
-  do ifac = 1, nfabor
+contains
 
-    icel = ifabor(ifac)
+  !-----------------------------------------------------------------------------
 
-    ! --- Eventual clipping of temperature at TH(1) if EH < EH0
+  !> \brief Enthalpy of the gas mixture in a given cell at tabulation point it.
 
-    eh0 = fuel1(icel)*ehgaze(ifo0,ii)                         &
-         +fuel2(icel)*ehgaze(ifov,ii)                         &
-         +fuel3(icel)*ehgaze(ico ,ii)                         &
-         +fuel4(icel)*ehgaze(ih2s,ii)                         &
-         +fuel5(icel)*ehgaze(ihy ,ii)                         &
-         +fuel6(icel)*ehgaze(ihcn,ii)                         &
-         +fuel7(icel)*ehgaze(inh3,ii)                         &
-         +oxyd(icel) *ehgaze(io2 ,ii)                         &
-         +prod1(icel)*ehgaze(ico2,ii)                         &
-         +prod2(icel)*ehgaze(ih2o,ii)                         &
-         +prod3(icel)*ehgaze(iso2,ii)                         &
-         +xiner(icel)*ehgaze(in2 ,ii)
+  !> \param[in]  c_id  cell id
+  !> \param[in]  it    tabulation point index
 
-    if (eh(ifac) .le. eh0) then
-      tp(ifac) = th(1)
-    endif
+  function gas_enthalpy(c_id, it) result(ehmix)
 
-  enddo
+    integer, intent(in) :: c_id, it
 
-  do ii = 1, npo-1
-
-    do ifac = 1, nfabor
-
-      icel = ifabor(ifac)
-
-      eh0 = fuel1(icel)*ehgaze(ifo0,ii)                       &
-           +fuel2(icel)*ehgaze(ifov,ii)                       &
-           +fuel3(icel)*ehgaze(ico ,ii)                       &
-           +fuel4(icel)*ehgaze(ih2s,ii)                       &
-           +fuel5(icel)*ehgaze(ihy ,ii)                       &
-           +fuel6(icel)*ehgaze(ihcn,ii)                       &
-           +fuel7(icel)*ehgaze(inh3,ii)                       &
-           +oxyd(icel) *ehgaze(io2 ,ii)                       &
-           +prod1(icel)*ehgaze(ico2,ii)                       &
-           +prod2(icel)*ehgaze(ih2o,ii)                       &
-           +prod3(icel)*ehgaze(iso2,ii)                       &
-           +xiner(icel)*ehgaze(in2 ,ii)
-
-      eh1 = fuel1(icel)*ehgaze(ifo0,ii+1)                     &
-           +fuel2(icel)*ehgaze(ifov,ii+1)                     &
-           +fuel3(icel)*ehgaze(ico ,ii+1)                     &
-           +fuel4(icel)*ehgaze(ih2s,ii+1)                     &
-           +fuel5(icel)*ehgaze(ihy ,ii+1)                     &
-           +fuel6(icel)*ehgaze(ihcn,ii+1)                     &
-           +fuel7(icel)*ehgaze(inh3,ii+1)                     &
-           +oxyd(icel) *ehgaze(io2 ,ii+1)                     &
-           +prod1(icel)*ehgaze(ico2,ii+1)                     &
-           +prod2(icel)*ehgaze(ih2o,ii+1)                     &
-           +prod3(icel)*ehgaze(iso2,ii+1)                     &
-           +xiner(icel)*ehgaze(in2 ,ii+1)
-
-      if (eh(ifac) .ge. eh0 .and. eh(ifac) .le. eh1) then
-        tp(ifac) = th(ii) + (eh(ifac)-eh0) * (th(ii+1)-th(ii)) / (eh1-eh0)
-      endif
-
-    enddo
+    double precision :: ehmix
 
-  enddo
+    ehmix = fuel1(c_id)*ehgaze(ifo0,it)                           &
+           +fuel2(c_id)*ehgaze(ifov,it)                           &
+           +fuel3(c_id)*ehgaze(ico ,it)                           &
+           +fuel4(c_id)*ehgaze(ih2s,it)                           &
+           +fuel5(c_id)*ehgaze(ihy ,it)                           &
+           +fuel6(c_id)*ehgaze(ihcn,it)                           &
+           +fuel7(c_id)*ehgaze(inh3,it)                           &
+           +oxyd(c_id) *ehgaze(io2 ,it)                           &
+           +prod1(c_id)*ehgaze(ico2,it)                           &
+           +prod2(c_id)*ehgaze(ih2o,it)                           &
+           +prod3(c_id)*ehgaze(iso2,it)                           &
+           +xiner(c_id)*ehgaze(in2 ,it)
 
-endif
+  end function gas_enthalpy
 
-!----
-! End
-!----
+  !-----------------------------------------------------------------------------
 
-return
 end subroutine
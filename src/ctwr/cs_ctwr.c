@@ -926,6 +926,7 @@ cs_ctwr_init_field_vars(cs_real_t  rho0,
                          cs_glob_physical_constants->gravity[1],
                          cs_glob_physical_constants->gravity[2]};
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
     /* Update humidity field in case users have updated the initial
@@ -955,23 +956,13 @@ cs_ctwr_init_field_vars(cs_real_t  rho0,
                                          molmassrat,
                                          t_h[cell_id]);
 
-    /* Update the humid air enthalpy */
-    x_s[cell_id] = cs_air_x_sat(t_h[cell_id],p0);
-
-    cs_real_t cp_h = cs_air_cp_humidair(x[cell_id], x_s[cell_id]);
-
-    h_h[cell_id] = cs_air_h_humidair(cp_h,
-                                      x[cell_id],
-                                      x_s[cell_id],
-                                      t_h[cell_id]);
-
     /* Initialise the liquid vertical velocity component
      * this is correct for droplet and extended for other packing zones
      * NB: this value is derived from the drag coef:
      * C_D = 24 / Re * (1 + 0.15 * Re^0.687)
      * See ZOPLU HT-31-08-06 */
 
-    cs_real_t v_lim = pow(droplet_diam, 2.) * rho_l / (18. * visc)
+    cs_real_t v_lim = cs_math_pow2(droplet_diam) * rho_l / (18. * visc)
                     * cs_math_3_norm(gravity);
 
     cs_real_t reynolds_old = 0.;
@@ -979,7 +970,7 @@ cs_ctwr_init_field_vars(cs_real_t  rho0,
 
     for (int sweep = 0; sweep < 100 && CS_ABS(reynolds - reynolds_old) > 0.001; sweep++) {
       reynolds_old = reynolds;
-      v_lim = pow(droplet_diam, 2.) * rho_l / (18. * visc * (1 + 0.15 * pow(reynolds, 0.687)))
+      v_lim = cs_math_pow2(droplet_diam) * rho_l / (18. * visc * (1 + 0.15 * pow(reynolds, 0.687)))
             * cs_math_3_norm(gravity);
       reynolds = rho_h[cell_id] * v_lim * droplet_diam / visc;
     }
@@ -996,6 +987,9 @@ cs_ctwr_init_field_vars(cs_real_t  rho0,
 
   }
 
+  /* Update the humid air enthalpy */
+  cs_air_humidair_props(n_cells, p0, t_h, x, x_s, NULL, h_h);
+
   /* Loop over exchange zones */
   for (int ict = 0; ict < _n_ct_zones; ict++) {
 
@@ -1356,6 +1350,7 @@ cs_ctwr_restart_field_vars(cs_real_t  rho0,
 
   /* Initialise the cooling towers variables */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
     /* Update humidity field */
@@ -1376,18 +1371,6 @@ cs_ctwr_restart_field_vars(cs_real_t  rho0,
        the present value of the temperatur0 */
     t_h_a[cell_id] = t_h[cell_id];
 
-    /* Update the humid air enthalpy based on the solved value of T_h */
-    //FIXME Need to use the method of 'cs_ctwr_phyvar_update'
-
-    x_s[cell_id] = cs_air_x_sat(t_h[cell_id],p0);
-
-    cp_h[cell_id] = cs_air_cp_humidair(x[cell_id], x_s[cell_id]);
-
-    h_h[cell_id] = cs_air_h_humidair(cp_h[cell_id],
-                                      x[cell_id],
-                                      x_s[cell_id],
-                                      t_h[cell_id]);
-
     /* Update the liquidus temperature based on the solved liquidus enthalpy
      * NB: May not be required as it is also done in 'cs_ctwr_phyvar_update'?
      * No, it must be done here because here we sweep over the entire computational
@@ -1404,7 +1387,7 @@ cs_ctwr_restart_field_vars(cs_real_t  rho0,
      * C_D = 24 / Re * (1 + 0.15 * Re^0.687)
      * See ZOPLU HT-31-08-06 */
 
-    cs_real_t v_lim = pow(droplet_diam, 2.) * rho_l / (18. * visc)
+    cs_real_t v_lim = cs_math_pow2(droplet_diam) * rho_l / (18. * visc)
                     * cs_math_3_norm(gravity);
 
     cs_real_t reynolds_old = 0.;
@@ -1419,7 +1402,7 @@ cs_ctwr_restart_field_vars(cs_real_t  rho0,
 
     for (int sweep = 0; sweep < 100 && CS_ABS(reynolds - reynolds_old) > 0.001; sweep++) {
       reynolds_old = reynolds;
-      v_lim = pow(droplet_diam, 2.) * rho_l / (18. * visc * (1 + 0.15 * pow(reynolds, 0.687)))
+      v_lim = cs_math_pow2(droplet_diam) * rho_l / (18. * visc * (1 + 0.15 * pow(reynolds, 0.687)))
             * cs_math_3_norm(gravity);
       //      reynolds = rho_h[cell_id] * v_lim * droplet_diam / visc;
       reynolds = rho_h_ini * v_lim * droplet_diam / visc;
@@ -1437,6 +1420,11 @@ cs_ctwr_restart_field_vars(cs_real_t  rho0,
 
   }
 
+  /* Update the humid air enthalpy based on the solved value of T_h */
+  //FIXME Need to use the method of 'cs_ctwr_phyvar_update'
+
+  cs_air_humidair_props(n_cells, p0, t_h, x, x_s, cp_h, h_h);
+
   /* Loop over exchange zones */
   for (int ict = 0; ict < _n_ct_zones; ict++) {
 
@@ -1559,6 +1547,7 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
 
   cs_real_t lambda_h = cs_glob_air_props->lambda_h;
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
     /* Clippings of water mass fraction */
@@ -1592,14 +1581,17 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
     //   humid air must be solved for.
     // Here, the approximation is that Y(drops) is negligible
 
-    /* Saturated humidity */
-    x_s[cell_id] = cs_air_x_sat(t_h[cell_id], p0);
+  }
+
+  /* Saturated humidity and specific heat */
+  cs_air_humidair_props(n_cells, p0, t_h, x, x_s, cp_h, NULL);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
     /* Update the humid air temperature using new enthalpy but old
      * Specific heat */
 
-    cp_h[cell_id] = cs_air_cp_humidair(x[cell_id], x_s[cell_id]);
-
     //FIXME - What is the formula below - Inconsistent with taking into
     //account the saturated phase in the enthalpy in 'cs_air_h_humidair'
     h_h[cell_id] += (t_h[cell_id] - t_h_a[cell_id]) * cp_h[cell_id];
@@ -1626,6 +1618,7 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
     const cs_lnum_t *ze_cell_ids = cs_volume_zone_by_name(ct->name)->elt_ids;
 
     /* Packing zone */
+#   pragma omp parallel for if (ct->n_cells > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < ct->n_cells; i++) {
       cs_lnum_t cell_id = ze_cell_ids[i];
 
@@ -1694,6 +1687,7 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
     cs_halo_sync_var(halo, CS_HALO_STANDARD, t_l);
   }
 
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
     bpro_x1[face_id] = cpro_x1[b_face_cells[face_id]];
   }
@@ -1755,10 +1749,6 @@ cs_ctwr_source_term(int              f_id,
 
   cs_air_fluid_props_t *air_prop = cs_glob_air_props;
 
-  cs_real_t v_air = 0.;
-
-  cs_real_t mass_flux_h = 0.; // Highly suspicious for rain zones - not recomputed
-
   /* Identify the source term formulation for the required field */
 
   const cs_field_t *f = cs_field_by_id(f_id);
@@ -1807,6 +1797,10 @@ cs_ctwr_source_term(int              f_id,
 
       const cs_lnum_t *ze_cell_ids = cs_volume_zone_by_name(ct->name)->elt_ids;
 
+      /* Cells of a given zone are distinct, so the exchange terms
+         may be computed independently */
+
+#     pragma omp parallel for if (ct->n_cells > CS_THR_MIN)
       for (cs_lnum_t j = 0; j < ct->n_cells; j++) {
 
         cs_lnum_t cell_id = ze_cell_ids[j];
@@ -1824,6 +1818,8 @@ cs_ctwr_source_term(int              f_id,
          * Counter or cross flow packing zone         *
          *--------------------------------------------*/
 
+        cs_real_t v_air = 0.;
+
         if (zone_type == CS_CTWR_COUNTER_CURRENT) {
           /* Counter flow packing */
           v_air = CS_ABS(cs_math_3_dot_product(vel_h[cell_id], vertical));
@@ -1834,7 +1830,7 @@ cs_ctwr_source_term(int              f_id,
         }
 
         /* Dry air flux */
-        mass_flux_h = rho_h[cell_id] * v_air * (1. - y_w[cell_id]);
+        cs_real_t mass_flux_h = rho_h[cell_id] * v_air * (1. - y_w[cell_id]);
 
         /* Liquid mass flux */
         cs_real_t mass_flux_l = rho_h[cell_id] * y_l[cell_id] * vel_l[cell_id];
@@ -1941,7 +1937,10 @@ cs_ctwr_source_term(int              f_id,
     if (cfld_yp != NULL) {
       cs_real_t *y_rain = (cs_real_t *)cfld_yp->val;
       cs_real_t *temp_rain = (cs_real_t *)cfld_tp->val;
+      const cs_real_3_t *drift_vel_rain
+        = (const cs_real_3_t *restrict)(cfld_drift_vel->val);
 
+#     pragma omp parallel for if (m->n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id++) {
 
         if (y_rain[cell_id] > 0.) {
@@ -1955,7 +1954,6 @@ cs_ctwr_source_term(int              f_id,
           /* saturation humidity at the temperature of the rain drop  */
           cs_real_t x_s_tl = cs_air_x_sat(temp_rain[cell_id], p0);
 
-          cs_real_3_t *drift_vel_rain = (cs_real_3_t *restrict)(cfld_drift_vel->val);
           cs_real_t drift_vel_mag = cs_math_3_norm(drift_vel_rain[cell_id]);
           cs_real_t xlew = _lewis_factor(evap_model, molmassrat, x[cell_id], x_s_tl);
           cs_real_t cp_h = cs_air_cp_humidair(x[cell_id], x_s[cell_id]);
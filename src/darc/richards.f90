@@ -473,6 +473,7 @@ do while ( (isweep.le.nswmpr.and.residu.gt.vcopt_p%epsrsm*rnormp) &
       cvar_pr(iel) = presa(iel) + dpvar(iel)
     enddo
   endif
+  call field_increment_version(ivarfl(ipr))
 
   iccocg = 1
   init = 1
@@ -688,6 +689,8 @@ else
 
 endif
 
+call field_increment_version(ivarfl(iu))
+
 ! update pressure head (h = H - z) for post-processing
 ! Only used when gravity is taken into account
 if (darcy_gravity.ge.1) then
@@ -59,6 +59,13 @@
 #include "cs_field_pointer.h"
 #include "cs_gradient.h"
 #include "cs_field_operator.h"
+#include "cs_balance.h"
+#include "cs_blas.h"
+#include "cs_face_viscosity.h"
+#include "cs_matrix_building.h"
+#include "cs_matrix_default.h"
+#include "cs_mesh.h"
+#include "cs_sles_default.h"
 #include "cs_physical_constants.h"
 #include "cs_physical_model.h"
 #include "cs_thermal_model.h"
@@ -167,6 +174,13 @@ BEGIN_C_DECLS
         coefficient for scaling
   \var  cs_elec_option_t::elcou
         current in scaling plane
+  \var  cs_elec_option_t::pot_coupling
+        Resolution of the real and imaginary potentials
+        (Joule effect with imaginary potential only)
+        - 0: solved separately, as other scalars (default)
+        - 1: solved together, sharing the matrix and linear solver setup
+             when their operators match. Source terms may then only be
+             defined using \ref cs_user_source_terms.
 */
 
 /*! \struct cs_data_joule_effect_t
@@ -241,7 +255,8 @@ static cs_elec_option_t  _elec_option = {.ixkabe = -1,
                                          .puisim = 0.,
                                          .coejou = 0.,
                                          .elcou = 0.,
-                                         .srrom = 0.};
+                                         .srrom = 0.,
+                                         .pot_coupling = 0};
 
 static cs_data_elec_t  _elec_properties = {.ngaz = 0,
                                            .npoint = 0,
@@ -555,6 +570,233 @@ _cs_elec_convert_h_to_t(const cs_real_t  ym[],
   return 0;
 }
 
+/*----------------------------------------------------------------------------
+ * Solve one electric potential equation using a given matrix.
+ *
+ * The linear solver is named after sles_f_id, so that its setup may be
+ * shared by successive potentials using the same matrix.
+ *
+ * parameters:
+ *   f         <-> potential field
+ *   sles_f_id <-- field id associated with the linear solver
+ *   iterns    <-- inner iteration number
+ *   da        <-- matrix diagonal
+ *   xa        <-- matrix extra-diagonal terms
+ *   i_visc    <-- face viscosity at interior faces
+ *   b_visc    <-- face viscosity at boundary faces
+ *   rovsdt    <-- implicit source terms (matrix diagonal part)
+ *   smbr      <-- explicit source terms
+ *   smbini    --- work array
+ *   smbrp     --- work array
+ *   dpvar     --- work array
+ *----------------------------------------------------------------------------*/
+
+static void
+_solve_potential(cs_field_t       *f,
+                 int               sles_f_id,
+                 int               iterns,
+                 const cs_real_t   da[],
+                 const cs_real_t   xa[],
+                 const cs_real_t   i_visc[],
+                 const cs_real_t   b_visc[],
+                 const cs_real_t   rovsdt[],
+                 cs_real_t         smbr[],
+                 cs_real_t         smbini[],
+                 cs_real_t         smbrp[],
+                 cs_real_t         dpvar[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int idtvar = cs_glob_time_step_options->idtvar;
+
+  const cs_lnum_t db_size[4] = {1, 1, 1, 1};
+  const cs_lnum_t eb_size[4] = {1, 1, 1, 1};
+
+  const int key_cal_opt_id = cs_field_key_id("var_cal_opt");
+  const int key_sinfo_id = cs_field_key_id("solving_info");
+  const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+
+  const cs_real_t *i_massflux
+    = cs_field_by_id(cs_field_get_key_int(f, kimasf))->val;
+  const cs_real_t *b_massflux
+    = cs_field_by_id(cs_field_get_key_int(f, kbmasf))->val;
+
+  const cs_real_t *coefap = f->bc_coeffs->a;
+  const cs_real_t *coefbp = f->bc_coeffs->b;
+  const cs_real_t *cofafp = f->bc_coeffs->af;
+  const cs_real_t *cofbfp = f->bc_coeffs->bf;
+
+  cs_real_t *pvar = f->val;
+  const cs_real_t *pvara = f->val_pre;
+
+  /* Options as used for scalars (see covofi) */
+
+  cs_var_cal_opt_t vcopt;
+  cs_field_get_key_struct(f, key_cal_opt_id, &vcopt);
+  vcopt.istat  = -1;
+  vcopt.icoupl = -1;
+  vcopt.idifft = -1;
+  vcopt.iwgrec = 0;
+  vcopt.blend_st = 0;
+
+  const int iwarnp = vcopt.verbosity;
+  const double epsrsp = vcopt.epsrsm;
+  const double epsilp = vcopt.epsilo;
+  const double thetap = vcopt.thetav;
+  const double thetex = 1. - thetap;
+
+  cs_solving_info_t sinfo;
+  cs_field_get_key_struct(f, key_sinfo_id, &sinfo);
+
+  /* Explicit part of the theta-scheme */
+
+  if (fabs(thetex) > cs_math_epzero) {
+    vcopt.thetav = thetex;
+    cs_balance_scalar(idtvar, f->id, 0, 0, 1, 1, &vcopt,
+                      NULL, pvara, coefap, coefbp, cofafp, cofbfp,
+                      i_massflux, b_massflux, i_visc, b_visc,
+                      NULL, NULL, NULL, NULL, 0, NULL,
+                      smbr);
+    vcopt.thetav = thetap;
+  }
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+    smbini[iel] = smbr[iel] - rovsdt[iel]*(pvar[iel] - pvara[iel]);
+    smbrp[iel] = 0.;
+  }
+
+  cs_balance_scalar(idtvar, f->id, 0, 1, 1, 1, &vcopt,
+                    pvar, pvara, coefap, coefbp, cofafp, cofbfp,
+                    i_massflux, b_massflux, i_visc, b_visc,
+                    NULL, NULL, NULL, NULL, 0, NULL,
+                    smbrp);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+    smbrp[iel] += smbini[iel];
+
+  double residu = sqrt(cs_gdot(n_cells, smbrp, smbrp));
+
+  /* Normalization residual (L2-norm of B.C. + source terms
+     + non-orthogonality terms) */
+
+  double rnorm = 0.;
+  {
+    cs_real_t *w1, *w2;
+    BFT_MALLOC(w1, n_cells_ext, cs_real_t);
+    BFT_MALLOC(w2, n_cells_ext, cs_real_t);
+
+    cs_real_t p_mean = sqrt(cs_gres(n_cells, mq->cell_vol, pvar, pvar));
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      w2[iel] = pvar[iel] - p_mean;
+
+    cs_matrix_vector_native_multiply(true, db_size, eb_size, sles_f_id,
+                                     da, xa, w2, w1);
+
+    const cs_lnum_t has_dc = mq->has_disable_flag;
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+      w1[iel] += smbrp[iel];
+      /* Remove contributions from penalized cells */
+      if (has_dc * mq->c_disable_flag[has_dc * iel] != 0)
+        w1[iel] = 0.;
+    }
+
+    rnorm = sqrt(cs_gdot(n_cells, w1, w1));
+
+    BFT_FREE(w2);
+    BFT_FREE(w1);
+  }
+
+  sinfo.rhs_norm = rnorm;
+
+  /* Reconstruction loop */
+
+  const int nswmod = CS_MAX(vcopt.nswrsm, 1);
+
+  if (iterns <= 1)
+    sinfo.n_it = 0;
+
+  int isweep = 1;
+
+  while ((isweep <= nswmod && residu > epsrsp*rnorm) || isweep == 1) {
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      dpvar[iel] = 0.;
+
+    int niterf = 0;
+    double ressol = residu;
+
+    cs_sles_solve_native(sles_f_id,
+                         NULL,
+                         true, /* symmetric */
+                         db_size,
+                         eb_size,
+                         da,
+                         xa,
+                         epsilp,
+                         rnorm,
+                         &niterf,
+                         &ressol,
+                         smbrp,
+                         dpvar);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+      pvar[iel] += dpvar[iel];
+      smbini[iel] -= rovsdt[iel]*dpvar[iel];
+      smbrp[iel] = smbini[iel];
+    }
+
+    if (cs_glob_rank_id >= 0 || m->n_init_perio > 0)
+      cs_mesh_sync_var_scal(pvar);
+
+    cs_balance_scalar(idtvar, f->id, 0, 1, 1, 0, &vcopt,
+                      pvar, pvara, coefap, coefbp, cofafp, cofbfp,
+                      i_massflux, b_massflux, i_visc, b_visc,
+                      NULL, NULL, NULL, NULL, 0, NULL,
+                      smbrp);
+
+    residu = sqrt(cs_gdot(n_cells, smbrp, smbrp));
+
+    sinfo.n_it += niterf;
+
+    if (iwarnp >= 2) {
+      bft_printf("%s: CV_DIF_TS, IT: %d, Res: %12.5e, Norm: %12.5e\n",
+                 f->name, isweep, residu, rnorm);
+      bft_printf("%s: Current reconstruction sweep: %d, "
+                 "Iterations for solver: %d\n", f->name, isweep, niterf);
+    }
+
+    isweep++;
+  }
+
+  if (fabs(rnorm) > cs_math_epzero)
+    sinfo.res_norm = residu/rnorm;
+  else
+    sinfo.res_norm = 0.;
+
+  cs_field_set_key_struct(f, key_sinfo_id, &sinfo);
+  cs_field_increment_version(f);
+
+  if (iwarnp >= 1) {
+    if (residu <= epsrsp*rnorm)
+      bft_printf("%s: CV_DIF_TS, IT : %d, Res : %12.5e, Norm : %12.5e\n",
+                 f->name, isweep-1, residu, rnorm);
+    else if (isweep > nswmod)
+      bft_printf("@\n@ @@ WARNING: %s CONVECTION-DIFFUSION-SOURCE-TERMS\n@"
+                 "=========\n@  Maximum number of iterations %d reached\n@",
+                 f->name, nswmod);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -643,6 +885,28 @@ CS_PROCF (elreca, ELRECA) (cs_real_t *dt)
   cs_elec_scaling_function(cs_glob_mesh, cs_glob_mesh_quantities, dt);
 }
 
+void
+CS_PROCF (elcpot, ELCPOT) (int       *ipotcp)
+{
+  *ipotcp = cs_glob_elec_option->pot_coupling;
+}
+
+void
+CS_PROCF (elsolp, ELSOLP) (const int  *iterns,
+                           const int  *iuts)
+{
+  if (*iuts > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Source terms are defined for the electric potentials\n"
+                "through the GUI or ustssc, which are not handled when\n"
+                "the real and imaginary potentials are solved together\n"
+                "(pot_coupling = 1).\n"
+                "Define them with cs_user_source_terms, or set\n"
+                "pot_coupling to 0."));
+
+  cs_elec_solve_potentials(*iterns);
+}
+
 /*=============================================================================
  * Public function definitions
  *============================================================================*/
@@ -694,6 +958,7 @@ cs_electrical_model_initialize(void)
   _elec_option.modrec    = 1;    /* standard model */
   _elec_option.idreca    = 3;
   _elec_option.srrom     = 0.;
+  _elec_option.pot_coupling = 0;
 
   for (int i = 0; i < 3; i++)
     _elec_option.crit_reca[i] = 0.;
@@ -1357,6 +1622,203 @@ cs_elec_physical_properties(cs_domain_t  *domain)
   cs_user_physical_properties(domain);
 }
 
+/*----------------------------------------------------------------------------
+ * Solve the real and imaginary potentials with a shared operator.
+ *
+ * Both potentials use the same conductivity; when their face diffusivities,
+ * implicit boundary coefficients and implicit source terms also match,
+ * the matrix is assembled once and the linear solver setup (such as a
+ * multigrid hierarchy) built for the real potential is reused for the
+ * imaginary one. Otherwise, the imaginary potential matrix is rebuilt.
+ *
+ * Only source terms defined through cs_user_source_terms are handled here
+ * (the caller checks that no GUI or ustssc source terms are defined).
+ *
+ * parameters:
+ *   iterns <-- inner iteration number
+ *----------------------------------------------------------------------------*/
+
+void
+cs_elec_solve_potentials(int  iterns)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const int idtvar = cs_glob_time_step_options->idtvar;
+
+  const int key_cal_opt_id = cs_field_key_id("var_cal_opt");
+  const int kivisl = cs_field_key_id("diffusivity_id");
+  const int kvisl0 = cs_field_key_id("diffusivity_ref");
+  const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+
+  cs_field_t *f_pot[2] = {CS_F_(potr), CS_F_(poti)};
+  cs_var_cal_opt_t vcopt[2];
+
+  cs_real_t *w1, *da, *xa, *smbr, *smbini, *smbrp, *dpvar;
+  cs_real_t *i_visc, *b_visc, *rovsdt;
+
+  BFT_MALLOC(w1, n_cells_ext, cs_real_t);
+  BFT_MALLOC(da, n_cells_ext, cs_real_t);
+  BFT_MALLOC(xa, n_i_faces, cs_real_t);
+  BFT_MALLOC(smbr, n_cells_ext, cs_real_t);
+  BFT_MALLOC(smbini, n_cells_ext, cs_real_t);
+  BFT_MALLOC(smbrp, n_cells_ext, cs_real_t);
+  BFT_MALLOC(dpvar, n_cells_ext, cs_real_t);
+  BFT_MALLOC(i_visc, 2*n_i_faces, cs_real_t);
+  BFT_MALLOC(b_visc, 2*n_b_faces, cs_real_t);
+  BFT_MALLOC(rovsdt, 2*n_cells_ext, cs_real_t);
+
+  int sles_f_id = f_pot[0]->id;
+
+  for (int p = 0; p < 2; p++) {
+
+    cs_field_t *f = f_pot[p];
+    cs_field_get_key_struct(f, key_cal_opt_id, &(vcopt[p]));
+
+    cs_real_t *_i_visc = i_visc + p*n_i_faces;
+    cs_real_t *_b_visc = b_visc + p*n_b_faces;
+    cs_real_t *_rovsdt = rovsdt + p*n_cells_ext;
+
+    const cs_real_t *pvara = f->val_pre;
+
+    /* User source terms, the implicit part being only added to
+       the diagonal when positive */
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+      smbr[iel] = 0.;
+      w1[iel] = 0.;
+    }
+
+    cs_user_source_terms(cs_glob_domain, f->id, smbr, w1);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+      smbr[iel] += w1[iel]*pvara[iel];
+      _rovsdt[iel] = CS_MAX(-w1[iel], 0.);
+    }
+
+    /* Face diffusivity */
+
+    if (vcopt[p].idiff >= 1) {
+      int diff_id = cs_field_get_key_int(f, kivisl);
+      if (diff_id > -1) {
+        const cs_real_t *sigma = cs_field_by_id(diff_id)->val;
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
+        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+          w1[iel] = sigma[iel];
+      }
+      else {
+        const cs_real_t sigma0 = cs_field_get_key_double(f, kvisl0);
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
+        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+          w1[iel] = sigma0;
+      }
+
+      cs_face_viscosity(m, fvq, vcopt[p].imvisf, w1, _i_visc, _b_visc);
+    }
+    else {
+      for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+        _i_visc[face_id] = 0.;
+      for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+        _b_visc[face_id] = 0.;
+    }
+
+    /* The matrix of the real potential is reused when identical */
+
+    bool build_matrix = true;
+
+    if (p == 1) {
+      const cs_field_t *f_r = f_pot[0];
+      int shared
+        = (   vcopt[1].ndircl == vcopt[0].ndircl
+           && vcopt[1].idiff == vcopt[0].idiff
+           && !(vcopt[1].thetav < vcopt[0].thetav)
+           && !(vcopt[1].thetav > vcopt[0].thetav)
+           && !(vcopt[1].relaxv < vcopt[0].relaxv)
+           && !(vcopt[1].relaxv > vcopt[0].relaxv)
+           && memcmp(i_visc, _i_visc, n_i_faces*sizeof(cs_real_t)) == 0
+           && memcmp(b_visc, _b_visc, n_b_faces*sizeof(cs_real_t)) == 0
+           && memcmp(rovsdt, _rovsdt, n_cells*sizeof(cs_real_t)) == 0
+           && memcmp(f_r->bc_coeffs->b, f->bc_coeffs->b,
+                     n_b_faces*sizeof(cs_real_t)) == 0
+           && memcmp(f_r->bc_coeffs->bf, f->bc_coeffs->bf,
+                     n_b_faces*sizeof(cs_real_t)) == 0) ? 1 : 0;
+
+      cs_parall_min(1, CS_INT_TYPE, &shared);
+
+      if (shared)
+        build_matrix = false;
+      else {
+        cs_sles_free_native(sles_f_id, NULL);
+        sles_f_id = f->id;
+      }
+    }
+
+    if (build_matrix) {
+      const cs_real_t *i_massflux
+        = cs_field_by_id(cs_field_get_key_int(f, kimasf))->val;
+      const cs_real_t *b_massflux
+        = cs_field_by_id(cs_field_get_key_int(f, kbmasf))->val;
+
+      cs_matrix_wrapper_scalar(0, /* iconvp */
+                               vcopt[p].idiff,
+                               vcopt[p].ndircl,
+                               1, /* isym */
+                               vcopt[p].thetav,
+                               0, /* imucpp */
+                               f->bc_coeffs->b,
+                               f->bc_coeffs->bf,
+                               _rovsdt,
+                               i_massflux,
+                               b_massflux,
+                               _i_visc,
+                               _b_visc,
+                               NULL,
+                               da,
+                               xa);
+
+      /* For steady computations, the diagonal is relaxed */
+      if (idtvar < 0) {
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
+        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+          da[iel] /= vcopt[p].relaxv;
+      }
+    }
+
+    _solve_potential(f,
+                     sles_f_id,
+                     iterns,
+                     da,
+                     xa,
+                     _i_visc,
+                     _b_visc,
+                     _rovsdt,
+                     smbr,
+                     smbini,
+                     smbrp,
+                     dpvar);
+
+  }
+
+  cs_sles_free_native(sles_f_id, NULL);
+
+  BFT_FREE(w1);
+  BFT_FREE(da);
+  BFT_FREE(xa);
+  BFT_FREE(smbr);
+  BFT_FREE(smbini);
+  BFT_FREE(smbrp);
+  BFT_FREE(dpvar);
+  BFT_FREE(i_visc);
+  BFT_FREE(b_visc);
+  BFT_FREE(rovsdt);
+}
+
 /*----------------------------------------------------------------------------
  * compute specific electric arc fields
  *----------------------------------------------------------------------------*/
@@ -1388,40 +1850,76 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
     /* Get the calculation option from the field */
     cs_real_3_t *cpro_elefl = (cs_real_3_t *)(CS_F_(elefl)->val);
 
-    cs_field_gradient_scalar(CS_F_(potr),
-                             false, /* use_previous_t */
-                             1,    /* inc */
-                             true, /* recompute_cocg */
-                             grad);
+    /* with an imaginary potential, grad(potI) is computed in the same
+       pass, sharing halo exchanges and face loops */
 
-    /* compute electric field E = - grad (potR) */
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      cpro_elefl[iel][0] = grad[iel][0];
-      cpro_elefl[iel][1] = grad[iel][1];
-      cpro_elefl[iel][2] = grad[iel][2];
+    cs_real_3_t *grad_i = NULL;
+    cs_field_t *c_propi = NULL;
+
+    if (ieljou == 2 || ieljou == 4) {
+      BFT_MALLOC(grad_i, n_cells_ext, cs_real_3_t);
+
+      const cs_field_t *f_pot[2] = {CS_F_(potr), CS_F_(poti)};
+      cs_real_3_t *grad_pot[2] = {grad, grad_i};
+
+      cs_field_gradient_scalar_multi(2,
+                                     f_pot,
+                                     false, /* use_previous_t */
+                                     1,    /* inc */
+                                     true, /* recompute_cocg */
+                                     grad_pot);
+
+      int diff_id_i = cs_field_get_key_int(CS_F_(poti), keysca);
+      if (diff_id_i > -1)
+        c_propi = cs_field_by_id(diff_id_i);
     }
+    else
+      cs_field_gradient_scalar(CS_F_(potr),
+                               false, /* use_previous_t */
+                               1,    /* inc */
+                               true, /* recompute_cocg */
+                               grad);
 
-    /* compute current density j = sig E */
     int diff_id = cs_field_get_key_int(CS_F_(potr), keysca);
     cs_field_t *c_prop = NULL;
     if (diff_id > -1)
       c_prop = cs_field_by_id(diff_id);
 
-    if (ieljou > 0 || ielarc > 0) {
-      cs_real_3_t *cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        cpro_curre[iel][0] = -c_prop->val[iel] * grad[iel][0];
-        cpro_curre[iel][1] = -c_prop->val[iel] * grad[iel][1];
-        cpro_curre[iel][2] = -c_prop->val[iel] * grad[iel][2];
-      }
-    }
+    /* compute electric field E = - grad (potR), current density j = sig E
+       and joule effect j . E, adding the imaginary part when present */
 
-    /* compute joule effect : j . E */
+    cs_real_3_t *cpro_curre = NULL, *cpro_curim = NULL;
+    if (ieljou > 0 || ielarc > 0)
+      cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
+    if (ieljou == 4)
+      cpro_curim = (cs_real_3_t *)(CS_F_(curim)->val);
+
+    cs_real_t *cpro_joulp = CS_F_(joulp)->val;
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      CS_F_(joulp)->val[iel] =  c_prop->val[iel] *
-                               (grad[iel][0] * grad[iel][0] +
-                                grad[iel][1] * grad[iel][1] +
-                                grad[iel][2] * grad[iel][2]);
+      const cs_real_t sig = c_prop->val[iel];
+
+      for (int i = 0; i < 3; i++)
+        cpro_elefl[iel][i] = grad[iel][i];
+
+      if (cpro_curre != NULL) {
+        for (int i = 0; i < 3; i++)
+          cpro_curre[iel][i] = -sig * grad[iel][i];
+      }
+
+      cpro_joulp[iel] = sig * cs_math_3_square_norm(grad[iel]);
+
+      if (grad_i != NULL) {
+        const cs_real_t sig_i = c_propi->val[iel];
+
+        if (cpro_curim != NULL) {
+          for (int i = 0; i < 3; i++)
+            cpro_curim[iel][i] = -sig_i * grad_i[iel][i];
+        }
+
+        cpro_joulp[iel] += sig_i * cs_math_3_square_norm(grad_i[iel]);
+      }
     }
 
     /* compute min max for E and J */
@@ -1478,44 +1976,14 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
       bft_printf("-----------------------------------------\n");
     }
 
-    if (ieljou == 2 || ieljou == 4) {
-      /* compute grad(potI) */
-
-      cs_field_gradient_scalar(CS_F_(poti),
-                               false, /* use_previous_t */
-                               1,    /* inc */
-                               true, /* recompute_cocg */
-                               grad);
-
-      /* compute electric field E = - grad (potI) */
-
-      /* compute current density j = sig E */
-      int diff_id_i = cs_field_get_key_int(CS_F_(poti), keysca);
-      cs_field_t *c_propi = NULL;
-      if (diff_id_i > -1)
-        c_propi = cs_field_by_id(diff_id_i);
-
-      if (ieljou == 4) {
-        cs_real_3_t *cpro_curim = (cs_real_3_t *)(CS_F_(curim)->val);
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          cpro_curim[iel][0] = -c_propi->val[iel] * grad[iel][0];
-          cpro_curim[iel][1] = -c_propi->val[iel] * grad[iel][1];
-          cpro_curim[iel][2] = -c_propi->val[iel] * grad[iel][2];
-        }
-      }
-
-      /* compute joule effect : j . E */
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        CS_F_(joulp)->val[iel] +=   c_propi->val[iel]
-                                  * cs_math_3_square_norm(grad[iel]);
-      }
+    if (grad_i != NULL) {
 
       /* compute min max for E and J */
       if (log_active) {
 
         double vrmin[3], vrmax[3];
 
-        /* Grad PotR = -Ei */
+        /* Grad PotI = -Ei */
 
         for (int i = 0; i < 3; i++) {
           vrmin[i] = HUGE_VAL;
@@ -1524,8 +1992,8 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
 
         for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
           for (int i = 0; i < 3; i++) {
-            vrmin[i] = CS_MIN(vrmin[i], grad[iel][0]);
-            vrmax[i] = CS_MAX(vrmax[i], grad[iel][0]);
+            vrmin[i] = CS_MIN(vrmin[i], grad_i[iel][i]);
+            vrmax[i] = CS_MAX(vrmax[i], grad_i[iel][i]);
           }
         }
 
@@ -1547,8 +2015,8 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
 
         for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
           for (int i = 0; i < 3; i++) {
-            vrmin[i] = CS_MIN(vrmin[i], -c_propi->val[iel] * grad[iel][i]);
-            vrmax[i] = CS_MAX(vrmax[i], -c_propi->val[iel] * grad[iel][i]);
+            vrmin[i] = CS_MIN(vrmin[i], -c_propi->val[iel] * grad_i[iel][i]);
+            vrmax[i] = CS_MAX(vrmax[i], -c_propi->val[iel] * grad_i[iel][i]);
           }
         }
 
@@ -1561,6 +2029,8 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                      vrmin[i], vrmax[i]);
         }
       }
+
+      BFT_FREE(grad_i);
     }
   }
 
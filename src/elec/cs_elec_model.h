@@ -112,6 +112,7 @@ typedef struct {
   cs_real_t   coejou;
   cs_real_t   elcou;
   cs_real_t   srrom;
+  int         pot_coupling;
 
 } cs_elec_option_t;
 
@@ -166,6 +167,13 @@ CS_PROCF (eliniv, ELINIV) (int      *isuite);
 void
 CS_PROCF (elreca, ELRECA) (cs_real_t *dt);
 
+void
+CS_PROCF (elcpot, ELCPOT) (int       *ipotcp);
+
+void
+CS_PROCF (elsolp, ELSOLP) (const int  *iterns,
+                           const int  *iuts);
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -212,6 +220,16 @@ cs_electrical_model_specific_initialization(cs_real_t  *diftl0);
 void
 cs_electrical_properties_read(void);
 
+/*----------------------------------------------------------------------------
+ * Solve the real and imaginary potentials with a shared operator.
+ *
+ * parameters:
+ *   iterns <-- inner iteration number
+ *----------------------------------------------------------------------------*/
+
+void
+cs_elec_solve_potentials(int  iterns);
+
 /*----------------------------------------------------------------------------
  * compute specific electric arc fields
  *----------------------------------------------------------------------------*/
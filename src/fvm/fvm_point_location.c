@@ -36,6 +36,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -50,6 +54,7 @@
 #include "fvm_triangulate.h"
 
 #include "cs_math.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -148,6 +153,34 @@ typedef struct {
 
 } _quadtree_t;
 
+/*----------------------------------------------------------------------------
+ * Structure defining thread-local location work arrays
+ *
+ * When elements are distributed over threads, location and distance
+ * values of points in each element's extents are copied to local arrays
+ * before location, and updated values are appended to a list of
+ * candidates, which are merged once all elements are handled.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t    *points_in_extents;  /* Ids of points in element extents
+                                       (size: n_points, less usually needed) */
+
+  cs_lnum_t     n_local_max;        /* Allocated size of local arrays */
+  cs_lnum_t    *local_ids;          /* Local point ids (0 to n-1) */
+  cs_coord_t   *local_coords;       /* Local point coordinates */
+  cs_lnum_t    *local_location;     /* Local copy of location[] */
+  float        *local_distance;     /* Local copy of distance[] */
+
+  cs_lnum_t     n_cand;             /* Number of location candidates */
+  cs_lnum_t     n_cand_max;         /* Allocated number of candidates */
+  cs_lnum_t    *cand_point_id;      /* Point id of candidates */
+  cs_lnum_t    *cand_location;      /* Element number of candidates */
+  float        *cand_distance;      /* Distance of candidates */
+
+} _loc_work_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -1288,6 +1321,269 @@ _ignore_same_tag(int                tag,
   *n_loc_points = j;
 }
 
+/*----------------------------------------------------------------------------
+ * Create thread-local location work arrays.
+ *
+ * Arrays are allocated when first needed by each thread.
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *
+ * returns:
+ *   array of location work structures (size: n_threads)
+ *----------------------------------------------------------------------------*/
+
+static _loc_work_t *
+_loc_work_create(int  n_threads)
+{
+  _loc_work_t *work;
+  BFT_MALLOC(work, n_threads, _loc_work_t);
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    _loc_work_t *w = work + t_id;
+    w->points_in_extents = NULL;
+    w->n_local_max = 0;
+    w->local_ids = NULL;
+    w->local_coords = NULL;
+    w->local_location = NULL;
+    w->local_distance = NULL;
+    w->n_cand = 0;
+    w->n_cand_max = 0;
+    w->cand_point_id = NULL;
+    w->cand_location = NULL;
+    w->cand_distance = NULL;
+  }
+
+  return work;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy thread-local location work arrays.
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *   work      <-> pointer to array of location work structures
+ *----------------------------------------------------------------------------*/
+
+static void
+_loc_work_destroy(int            n_threads,
+                  _loc_work_t  **work)
+{
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    _loc_work_t *w = *work + t_id;
+    BFT_FREE(w->points_in_extents);
+    BFT_FREE(w->local_ids);
+    BFT_FREE(w->local_coords);
+    BFT_FREE(w->local_location);
+    BFT_FREE(w->local_distance);
+    BFT_FREE(w->cand_point_id);
+    BFT_FREE(w->cand_location);
+    BFT_FREE(w->cand_distance);
+  }
+
+  BFT_FREE(*work);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of threads used to locate points on a section.
+ *
+ * parameters:
+ *   n_elements <-- number of elements in section
+ *   n_max      <-- maximum number of threads
+ *
+ * returns:
+ *   number of threads
+ *----------------------------------------------------------------------------*/
+
+static int
+_n_location_threads(cs_lnum_t  n_elements,
+                    int        n_max)
+{
+  int n_threads = 1;
+
+#if defined(HAVE_OPENMP)
+  if (n_elements > CS_THR_MIN && omp_in_parallel() == 0)
+    n_threads = CS_MIN(n_max, (n_elements + CS_THR_MIN - 1) / CS_THR_MIN);
+#else
+  CS_UNUSED(n_elements);
+  CS_UNUSED(n_max);
+#endif
+
+  return n_threads;
+}
+
+/*----------------------------------------------------------------------------
+ * Get the current thread's element range and location work structure.
+ *
+ * parameters:
+ *   n_elements <-- number of elements in section
+ *   n_threads  <-- number of threads
+ *   work       <-- array of location work structures
+ *   n_points   <-- number of points to locate
+ *   s_id       --> start id of elements for the current thread
+ *   e_id       --> past-the-end id of elements for the current thread
+ *
+ * returns:
+ *   pointer to location work structure for current thread
+ *----------------------------------------------------------------------------*/
+
+static _loc_work_t *
+_loc_work_thread_range(cs_lnum_t     n_elements,
+                       int           n_threads,
+                       _loc_work_t  *work,
+                       cs_lnum_t     n_points,
+                       cs_lnum_t    *s_id,
+                       cs_lnum_t    *e_id)
+{
+  int t_id = 0;
+
+  *s_id = 0;
+  *e_id = n_elements;
+
+#if defined(HAVE_OPENMP)
+  if (n_threads > 1) {
+    t_id = omp_get_thread_num();
+    cs_parall_thread_range(n_elements, sizeof(cs_lnum_t), s_id, e_id);
+  }
+#else
+  CS_UNUSED(n_threads);
+#endif
+
+  _loc_work_t *w = work + t_id;
+
+  if (w->points_in_extents == NULL)
+    BFT_MALLOC(w->points_in_extents, CS_MAX(n_points, 1), cs_lnum_t);
+
+  w->n_cand = 0;
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Copy location data of points in extents to local arrays.
+ *
+ * Location functions may then be called with the local arrays, using
+ * local ids as points in extents.
+ *
+ * parameters:
+ *   w                   <-> location work structure
+ *   dim                 <-- spatial dimension
+ *   n_points_in_extents <-- number of points in extents
+ *   point_coords        <-- point coordinates
+ *   location            <-- number of element containing or closest to
+ *                           each point
+ *   distance            <-- distance from point to element indicated by
+ *                           location[]
+ *----------------------------------------------------------------------------*/
+
+static void
+_loc_work_gather(_loc_work_t       *w,
+                 int                dim,
+                 cs_lnum_t          n_points_in_extents,
+                 const cs_coord_t   point_coords[],
+                 const cs_lnum_t    location[],
+                 const float        distance[])
+{
+  if (n_points_in_extents > w->n_local_max) {
+    w->n_local_max = CS_MAX(n_points_in_extents, w->n_local_max*2);
+    BFT_REALLOC(w->local_ids, w->n_local_max, cs_lnum_t);
+    BFT_REALLOC(w->local_coords, w->n_local_max*3, cs_coord_t);
+    BFT_REALLOC(w->local_location, w->n_local_max, cs_lnum_t);
+    BFT_REALLOC(w->local_distance, w->n_local_max, float);
+  }
+
+  for (cs_lnum_t i = 0; i < n_points_in_extents; i++) {
+    cs_lnum_t j = w->points_in_extents[i];
+    w->local_ids[i] = i;
+    for (int k = 0; k < dim; k++)
+      w->local_coords[i*dim + k] = point_coords[j*dim + k];
+    w->local_location[i] = location[j];
+    w->local_distance[i] = distance[j];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Append local location data modified by an element to the list of
+ * candidates.
+ *
+ * parameters:
+ *   w                   <-> location work structure
+ *   n_points_in_extents <-- number of points in extents
+ *   location            <-- number of element containing or closest to
+ *                           each point
+ *   distance            <-- distance from point to element indicated by
+ *                           location[]
+ *----------------------------------------------------------------------------*/
+
+static void
+_loc_work_add_candidates(_loc_work_t      *w,
+                         cs_lnum_t         n_points_in_extents,
+                         const cs_lnum_t   location[],
+                         const float       distance[])
+{
+  for (cs_lnum_t i = 0; i < n_points_in_extents; i++) {
+
+    cs_lnum_t j = w->points_in_extents[i];
+
+    if (   w->local_location[i] == location[j]
+        && !(w->local_distance[i] < distance[j])
+        && !(w->local_distance[i] > distance[j]))
+      continue;
+
+    if (w->n_cand >= w->n_cand_max) {
+      w->n_cand_max = CS_MAX(w->n_cand_max*2, 64);
+      BFT_REALLOC(w->cand_point_id, w->n_cand_max, cs_lnum_t);
+      BFT_REALLOC(w->cand_location, w->n_cand_max, cs_lnum_t);
+      BFT_REALLOC(w->cand_distance, w->n_cand_max, float);
+    }
+
+    w->cand_point_id[w->n_cand] = j;
+    w->cand_location[w->n_cand] = w->local_location[i];
+    w->cand_distance[w->n_cand] = w->local_distance[i];
+    w->n_cand += 1;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Merge location candidates from all threads.
+ *
+ * Threads handle contiguous element ranges in increasing order, so
+ * candidates are merged in element order, keeping for each point the
+ * first closest element. As each candidate is determined relative to
+ * the location data at section start, the result does not depend on
+ * the number of threads.
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *   work      <-> array of location work structures
+ *   location  <-> number of element containing or closest to each point
+ *   distance  <-> distance from point to element indicated by location[]
+ *----------------------------------------------------------------------------*/
+
+static void
+_loc_work_merge(int            n_threads,
+                _loc_work_t    work[],
+                cs_lnum_t      location[],
+                float          distance[])
+{
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+
+    _loc_work_t *w = work + t_id;
+
+    for (cs_lnum_t i = 0; i < w->n_cand; i++) {
+      cs_lnum_t j = w->cand_point_id[i];
+      if (distance[j] < 0 || w->cand_distance[i] < distance[j]) {
+        location[j] = w->cand_location[i];
+        distance[j] = w->cand_distance[i];
+      }
+    }
+
+    w->n_cand = 0;
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Locate points on a 3d edge, and update the location[] and distance[]
  * arrays associated with the point set.
@@ -2307,8 +2603,9 @@ _locate_in_cell_3d(cs_lnum_t          elt_num,
  *   point_tag         <-- optional point tag (size: n_points)
  *   point_coords      <-- point coordinates
  *   octree            <-- point octree
- *   points_in_extents <-> array for query of ids of points in extents
- *                         (size: n_points, less usually needed)
+ *   n_threads_max     <-- maximum number of threads
+ *   work              <-> thread-local location work arrays
+ *                         (size: n_threads_max)
  *   location          <-> number of element containing or closest to each
  *                         point (size: n_points)
  *   distance          <-> distance from point to element indicated by
@@ -2325,22 +2622,18 @@ _polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
                           const int                  *point_tag,
                           const cs_coord_t            point_coords[],
                           _octree_t                  *octree,
-                          cs_lnum_t                   points_in_extents[],
+                          int                         n_threads_max,
+                          _loc_work_t                 work[],
                           cs_lnum_t                   location[],
                           float                       distance[])
 {
-  cs_lnum_t   i, j, k, n_vertices, face_id, vertex_id, elt_num;
-  cs_coord_t  center[3];
-  double elt_extents[6];
+  cs_lnum_t   i;
 
   /* double tolerance, as polyhedra is split into tetrahedra,
      whose extents are approximately 1/2 the polyhedron extents */
   double _tolerance[2] = {tolerance[0], tolerance[1] * 2};
 
   cs_lnum_t n_vertices_max = 0;
-  cs_lnum_t n_points_in_extents = 0;
-  cs_lnum_t *triangle_vertices = NULL;
-  fvm_triangulate_state_t *state = NULL;
 
   assert(this_section->face_index != NULL);
 
@@ -2352,8 +2645,8 @@ _polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
   /* Counting loop on faces */
 
   for (i = 0; i < this_section->n_faces; i++) {
-    n_vertices =   this_section->vertex_index[i + 1]
-                 - this_section->vertex_index[i];
+    cs_lnum_t n_vertices =   this_section->vertex_index[i + 1]
+                           - this_section->vertex_index[i];
     if (n_vertices > n_vertices_max)
       n_vertices_max = n_vertices;
   }
@@ -2361,166 +2654,204 @@ _polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
   if (n_vertices_max < 3)
     return;
 
-  BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, cs_lnum_t);
-  state = fvm_triangulate_state_create(n_vertices_max);
+  const int n_threads = _n_location_threads(this_section->n_elements,
+                                            n_threads_max);
 
   /* Loop on elements */
 
-  for (i = 0; i < this_section->n_elements; i++) {
+# pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+  {
+    cs_lnum_t s_id, e_id;
+    _loc_work_t *w = _loc_work_thread_range(this_section->n_elements,
+                                            n_threads,
+                                            work,
+                                            octree->n_points,
+                                            &s_id,
+                                            &e_id);
+
+    cs_lnum_t *triangle_vertices = NULL;
+    BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, cs_lnum_t);
+    fvm_triangulate_state_t *state
+      = fvm_triangulate_state_create(n_vertices_max);
 
-    bool elt_initialized = false;
+    for (cs_lnum_t elt_id = s_id; elt_id < e_id; elt_id++) {
 
-    /* Compute extents */
+      cs_lnum_t j, k, face_id, vertex_id, elt_num;
+      cs_coord_t  center[3];
+      double elt_extents[6];
 
-    for (j = this_section->face_index[i];
-         j < this_section->face_index[i + 1];
-         j++) {
-      face_id = CS_ABS(this_section->face_num[j]) - 1;
-      for (k = this_section->vertex_index[face_id];
-           k < this_section->vertex_index[face_id + 1];
-           k++) {
-        vertex_id = this_section->vertex_num[k] - 1;
+      bool elt_initialized = false;
+      cs_lnum_t n_points_in_extents = 0;
 
-        _update_elt_extents(3,
-                            vertex_id,
-                            parent_vertex_num,
-                            vertex_coords,
-                            elt_extents,
-                            &elt_initialized);
+      /* Compute extents */
 
+      for (j = this_section->face_index[elt_id];
+           j < this_section->face_index[elt_id + 1];
+           j++) {
+        face_id = CS_ABS(this_section->face_num[j]) - 1;
+        for (k = this_section->vertex_index[face_id];
+             k < this_section->vertex_index[face_id + 1];
+             k++) {
+          vertex_id = this_section->vertex_num[k] - 1;
+
+          _update_elt_extents(3,
+                              vertex_id,
+                              parent_vertex_num,
+                              vertex_coords,
+                              elt_extents,
+                              &elt_initialized);
+
+        }
       }
-    }
 
-    _elt_extents_finalize(3, 3, tolerance, elt_extents);
+      _elt_extents_finalize(3, 3, tolerance, elt_extents);
 
-    if (base_element_num < 0) {
-      if (this_section->parent_element_num != NULL)
-        elt_num = this_section->parent_element_num[i];
+      if (base_element_num < 0) {
+        if (this_section->parent_element_num != NULL)
+          elt_num = this_section->parent_element_num[elt_id];
+        else
+          elt_num = elt_id + 1;
+      }
       else
-        elt_num = i + 1;
-    }
-    else
-      elt_num = base_element_num + i;
-
-    _query_octree(elt_extents,
-                  point_coords,
-                  octree,
-                  &n_points_in_extents,
-                  points_in_extents);
+        elt_num = base_element_num + elt_id;
 
-    if (this_section->tag != NULL && point_tag != NULL)
-      _ignore_same_tag(this_section->tag[i],
-                       point_tag,
-                       &n_points_in_extents,
-                       points_in_extents);
+      _query_octree(elt_extents,
+                    point_coords,
+                    octree,
+                    &n_points_in_extents,
+                    w->points_in_extents);
 
-    if (n_points_in_extents < 1)
-      continue;
+      if (this_section->tag != NULL && point_tag != NULL)
+        _ignore_same_tag(this_section->tag[elt_id],
+                         point_tag,
+                         &n_points_in_extents,
+                         w->points_in_extents);
 
-    /* Compute psuedo-element center */
+      if (n_points_in_extents < 1)
+        continue;
 
-    for (j = 0; j < 3; j++)
-      center[j] = (elt_extents[j] + elt_extents[j + 3]) * 0.5;
+      /* Work on local copies of location data, so that candidates are
+         relative to the data at section start whatever the number of
+         threads */
 
-    /* Loop on element faces */
+      _loc_work_gather(w, 3, n_points_in_extents,
+                       point_coords, location, distance);
 
-    for (j = this_section->face_index[i];
-         j < this_section->face_index[i + 1];
-         j++) {
+      const cs_coord_t *_point_coords = w->local_coords;
+      const cs_lnum_t *_points_in_extents = w->local_ids;
+      cs_lnum_t *_location = w->local_location;
+      float *_distance = w->local_distance;
 
-      cs_lnum_t n_triangles;
+      /* Compute psuedo-element center */
 
-      const cs_lnum_t *_vertex_num;
+      for (j = 0; j < 3; j++)
+        center[j] = (elt_extents[j] + elt_extents[j + 3]) * 0.5;
 
-      face_id = CS_ABS(this_section->face_num[j]) - 1;
+      /* Loop on element faces */
 
-      n_vertices = (  this_section->vertex_index[face_id + 1]
-                    - this_section->vertex_index[face_id]);
+      for (j = this_section->face_index[elt_id];
+           j < this_section->face_index[elt_id + 1];
+           j++) {
 
-      _vertex_num = (  this_section->vertex_num
-                     + this_section->vertex_index[face_id]);
+        cs_lnum_t n_triangles;
 
-      if (n_vertices == 4)
+        const cs_lnum_t *_vertex_num;
 
-        n_triangles = fvm_triangulate_quadrangle(3,
-                                                 1,
-                                                 vertex_coords,
-                                                 parent_vertex_num,
-                                                 _vertex_num,
-                                                 triangle_vertices);
+        face_id = CS_ABS(this_section->face_num[j]) - 1;
 
-      else if (n_vertices > 4)
+        const cs_lnum_t n_vertices
+          = (  this_section->vertex_index[face_id + 1]
+             - this_section->vertex_index[face_id]);
 
-        n_triangles = fvm_triangulate_polygon(3,
-                                              1,
-                                              n_vertices,
-                                              vertex_coords,
-                                              parent_vertex_num,
-                                              _vertex_num,
-                                              FVM_TRIANGULATE_MESH_DEF,
-                                              triangle_vertices,
-                                              state);
+        _vertex_num = (  this_section->vertex_num
+                       + this_section->vertex_index[face_id]);
 
-      else { /* n_vertices == 3 */
+        if (n_vertices == 4)
 
-        n_triangles = 1;
-        for (k = 0; k < 3; k++)
-          triangle_vertices[k] = _vertex_num[k];
+          n_triangles = fvm_triangulate_quadrangle(3,
+                                                   1,
+                                                   vertex_coords,
+                                                   parent_vertex_num,
+                                                   _vertex_num,
+                                                   triangle_vertices);
 
-      }
+        else if (n_vertices > 4)
 
-      /* Loop on face triangles so as to loop on tetrahedra
-         built by joining face triangles and psuedo-center */
+          n_triangles = fvm_triangulate_polygon(3,
+                                                1,
+                                                n_vertices,
+                                                vertex_coords,
+                                                parent_vertex_num,
+                                                _vertex_num,
+                                                FVM_TRIANGULATE_MESH_DEF,
+                                                triangle_vertices,
+                                                state);
 
-      for (k = 0; k < n_triangles; k++) {
+        else { /* n_vertices == 3 */
 
-        cs_lnum_t l, coord_id[3];
-        cs_coord_t tetra_coords[4][3];
+          n_triangles = 1;
+          for (k = 0; k < 3; k++)
+            triangle_vertices[k] = _vertex_num[k];
 
-        if (parent_vertex_num == NULL) {
-          coord_id[0] = triangle_vertices[k*3    ] - 1;
-          coord_id[1] = triangle_vertices[k*3 + 2] - 1;
-          coord_id[2] = triangle_vertices[k*3 + 1] - 1;
-        }
-        else {
-          coord_id[0] = parent_vertex_num[triangle_vertices[k*3    ] - 1] - 1;
-          coord_id[1] = parent_vertex_num[triangle_vertices[k*3 + 2] - 1] - 1;
-          coord_id[2] = parent_vertex_num[triangle_vertices[k*3 + 1] - 1] - 1;
         }
 
-        for (l = 0; l < 3; l++) {
-          tetra_coords[0][l] = vertex_coords[3*coord_id[0] + l];
-          tetra_coords[1][l] = vertex_coords[3*coord_id[1] + l];
-          tetra_coords[2][l] = vertex_coords[3*coord_id[2] + l];
-          tetra_coords[3][l] = center[l];
-        }
+        /* Loop on face triangles so as to loop on tetrahedra
+           built by joining face triangles and psuedo-center */
 
-        _locate_in_tetra(elt_num,
-                         tetra_coords,
-                         point_coords,
-                         n_points_in_extents,
-                         points_in_extents,
-                         _tolerance[1],
-                         location,
-                         distance);
+        for (k = 0; k < n_triangles; k++) {
 
-      } /* End of loop on face triangles */
+          cs_lnum_t l, coord_id[3];
+          cs_coord_t tetra_coords[4][3];
 
-    } /* End of loop on element faces */
+          if (parent_vertex_num == NULL) {
+            coord_id[0] = triangle_vertices[k*3    ] - 1;
+            coord_id[1] = triangle_vertices[k*3 + 2] - 1;
+            coord_id[2] = triangle_vertices[k*3 + 1] - 1;
+          }
+          else {
+            coord_id[0] = parent_vertex_num[triangle_vertices[k*3    ] - 1] - 1;
+            coord_id[1] = parent_vertex_num[triangle_vertices[k*3 + 2] - 1] - 1;
+            coord_id[2] = parent_vertex_num[triangle_vertices[k*3 + 1] - 1] - 1;
+          }
 
-    _locate_in_extents(elt_num,
-                       3,
-                       elt_extents,
-                       point_coords,
-                       n_points_in_extents,
-                       points_in_extents,
-                       location,
-                       distance);
+          for (l = 0; l < 3; l++) {
+            tetra_coords[0][l] = vertex_coords[3*coord_id[0] + l];
+            tetra_coords[1][l] = vertex_coords[3*coord_id[1] + l];
+            tetra_coords[2][l] = vertex_coords[3*coord_id[2] + l];
+            tetra_coords[3][l] = center[l];
+          }
+
+          _locate_in_tetra(elt_num,
+                           tetra_coords,
+                           _point_coords,
+                           n_points_in_extents,
+                           _points_in_extents,
+                           _tolerance[1],
+                           _location,
+                           _distance);
 
-  } /* End of loop on elements */
+        } /* End of loop on face triangles */
 
-  BFT_FREE(triangle_vertices);
-  state = fvm_triangulate_state_destroy(state);
+      } /* End of loop on element faces */
+
+      _locate_in_extents(elt_num,
+                         3,
+                         elt_extents,
+                         _point_coords,
+                         n_points_in_extents,
+                         _points_in_extents,
+                         _location,
+                         _distance);
+
+      _loc_work_add_candidates(w, n_points_in_extents, location, distance);
+
+    } /* End of loop on elements */
+
+    BFT_FREE(triangle_vertices);
+    state = fvm_triangulate_state_destroy(state);
+  }
+
+  _loc_work_merge(n_threads, work, location, distance);
 }
 
 /*----------------------------------------------------------------------------
@@ -2543,8 +2874,9 @@ _polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
  *   point_tag         <-- optional point tag (size: n_points)
  *   point_coords      <-- point coordinates
  *   octree            <-- point octree
- *   points_in_extents <-- array for query of ids of points in extents
- *                         (size: n_points, less usually needed)
+ *   n_threads_max     <-- maximum number of threads
+ *   work              <-> thread-local location work arrays
+ *                         (size: n_threads_max)
  *   location          <-> number of element containing or closest to each
  *                         point (size: n_points)
  *   distance          <-> distance from point to element indicated by
@@ -2561,19 +2893,14 @@ _polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
                             const int                   *point_tag,
                             const cs_coord_t             point_coords[],
                             _octree_t                   *octree,
-                            cs_lnum_t                    points_in_extents[],
+                            int                          n_threads_max,
+                            _loc_work_t                  work[],
                             cs_lnum_t                    location[],
                             float                        distance[])
 {
-  cs_lnum_t   i, j, n_vertices, vertex_id, elt_num;
-  int n_triangles;
-  double elt_extents[6];
+  cs_lnum_t   i, n_vertices;
 
   int n_vertices_max = 0;
-  cs_lnum_t n_points_in_extents = 0;
-
-  cs_lnum_t *triangle_vertices = NULL;
-  fvm_triangulate_state_t *state = NULL;
 
   /* Return immediately if nothing to do for this rank */
 
@@ -2595,87 +2922,115 @@ _polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
   if (n_vertices_max < 3)
     return;
 
-  BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, cs_lnum_t);
-  state = fvm_triangulate_state_create(n_vertices_max);
+  const int n_threads = _n_location_threads(this_section->n_elements,
+                                            n_threads_max);
 
   /* Main loop on elements */
 
-  for (i = 0; i < this_section->n_elements; i++) {
+# pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+  {
+    cs_lnum_t s_id, e_id;
+    _loc_work_t *w = _loc_work_thread_range(this_section->n_elements,
+                                            n_threads,
+                                            work,
+                                            octree->n_points,
+                                            &s_id,
+                                            &e_id);
+
+    cs_lnum_t *triangle_vertices = NULL;
+    BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, cs_lnum_t);
+    fvm_triangulate_state_t *state
+      = fvm_triangulate_state_create(n_vertices_max);
 
-    bool elt_initialized = false;
+    for (cs_lnum_t elt_id = s_id; elt_id < e_id; elt_id++) {
 
-    for (j = this_section->vertex_index[i];
-         j < this_section->vertex_index[i + 1];
-         j++) {
-      vertex_id = this_section->vertex_num[j] - 1;
+      cs_lnum_t j, vertex_id, elt_num;
+      double elt_extents[6];
 
-      _update_elt_extents(3,
-                          vertex_id,
-                          parent_vertex_num,
-                          vertex_coords,
-                          elt_extents,
-                          &elt_initialized);
+      bool elt_initialized = false;
+      cs_lnum_t n_points_in_extents = 0;
 
-    }
+      for (j = this_section->vertex_index[elt_id];
+           j < this_section->vertex_index[elt_id + 1];
+           j++) {
+        vertex_id = this_section->vertex_num[j] - 1;
+
+        _update_elt_extents(3,
+                            vertex_id,
+                            parent_vertex_num,
+                            vertex_coords,
+                            elt_extents,
+                            &elt_initialized);
 
-    _elt_extents_finalize(3, 2, tolerance, elt_extents);
+      }
+
+      _elt_extents_finalize(3, 2, tolerance, elt_extents);
 
-    if (base_element_num < 0) {
-      if (this_section->parent_element_num != NULL)
-        elt_num = this_section->parent_element_num[i];
+      if (base_element_num < 0) {
+        if (this_section->parent_element_num != NULL)
+          elt_num = this_section->parent_element_num[elt_id];
+        else
+          elt_num = elt_id + 1;
+      }
       else
-        elt_num = i + 1;
-    }
-    else
-      elt_num = base_element_num + i;
+        elt_num = base_element_num + elt_id;
 
-    _query_octree(elt_extents,
-                  point_coords,
-                  octree,
-                  &n_points_in_extents,
-                  points_in_extents);
+      _query_octree(elt_extents,
+                    point_coords,
+                    octree,
+                    &n_points_in_extents,
+                    w->points_in_extents);
 
-    if (this_section->tag != NULL && point_tag != NULL)
-      _ignore_same_tag(this_section->tag[i],
-                       point_tag,
-                       &n_points_in_extents,
-                       points_in_extents);
+      if (this_section->tag != NULL && point_tag != NULL)
+        _ignore_same_tag(this_section->tag[elt_id],
+                         point_tag,
+                         &n_points_in_extents,
+                         w->points_in_extents);
 
-    /* Triangulate polygon */
+      if (n_points_in_extents < 1)
+        continue;
 
-    n_vertices = (  this_section->vertex_index[i + 1]
-                  - this_section->vertex_index[i]);
-    vertex_id = this_section->vertex_index[i];
-
-    n_triangles = fvm_triangulate_polygon(3,
-                                          1,
-                                          n_vertices,
-                                          vertex_coords,
-                                          parent_vertex_num,
-                                          (  this_section->vertex_num
-                                           + vertex_id),
-                                          FVM_TRIANGULATE_MESH_DEF,
-                                          triangle_vertices,
-                                          state);
-
-    /* Locate on triangulated polygon */
-
-    _locate_on_triangles_3d(elt_num,
-                            n_triangles,
-                            triangle_vertices,
-                            parent_vertex_num,
-                            vertex_coords,
-                            point_coords,
-                            n_points_in_extents,
-                            points_in_extents,
-                            tolerance[1],
-                            location,
-                            distance);
+      /* Triangulate polygon */
+
+      cs_lnum_t n_elt_vertices = (  this_section->vertex_index[elt_id + 1]
+                                  - this_section->vertex_index[elt_id]);
+      vertex_id = this_section->vertex_index[elt_id];
+
+      int n_triangles = fvm_triangulate_polygon(3,
+                                                1,
+                                                n_elt_vertices,
+                                                vertex_coords,
+                                                parent_vertex_num,
+                                                (  this_section->vertex_num
+                                                 + vertex_id),
+                                                FVM_TRIANGULATE_MESH_DEF,
+                                                triangle_vertices,
+                                                state);
+
+      /* Locate on triangulated polygon */
+
+      _loc_work_gather(w, 3, n_points_in_extents,
+                       point_coords, location, distance);
+      _locate_on_triangles_3d(elt_num,
+                              n_triangles,
+                              triangle_vertices,
+                              parent_vertex_num,
+                              vertex_coords,
+                              w->local_coords,
+                              n_points_in_extents,
+                              w->local_ids,
+                              tolerance[1],
+                              w->local_location,
+                              w->local_distance);
+      _loc_work_add_candidates(w, n_points_in_extents, location, distance);
 
-  } /* End of loop on elements */
+    } /* End of loop on elements */
+
+    BFT_FREE(triangle_vertices);
+    state = fvm_triangulate_state_destroy(state);
+  }
 
-  BFT_FREE(triangle_vertices);
-  state = fvm_triangulate_state_destroy(state);
+  _loc_work_merge(n_threads, work, location, distance);
 }
 
 /*----------------------------------------------------------------------------
@@ -2697,8 +3052,9 @@ _polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
  *   point_tag         <-- optional point tag (size: n_points)
  *   point_coords      <-- point coordinates
  *   octree            <-- point octree
- *   points_in_extents <-- array for query of ids of points in extents
- *                         (size: octree->n_points, less usually needed)
+ *   n_threads_max     <-- maximum number of threads
+ *   work              <-> thread-local location work arrays
+ *                         (size: n_threads_max)
  *   location          <-> number of element containing or closest to each
  *                         point (size: n_points)
  *   distance          <-> distance from point to element indicated by
@@ -2716,16 +3072,11 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
                          const int                  *point_tag,
                          const cs_coord_t            point_coords[],
                          _octree_t                  *octree,
-                         cs_lnum_t                   points_in_extents[],
+                         int                         n_threads_max,
+                         _loc_work_t                 work[],
                          cs_lnum_t                   location[],
                          float                       distance[])
 {
-  cs_lnum_t   i, j, vertex_id, elt_num, triangle_vertices[6];
-  int n_triangles;
-  double elt_extents[6];
-
-  cs_lnum_t n_points_in_extents = 0;
-
   /* If section contains polyhedra */
 
   if (this_section->type == FVM_CELL_POLY)
@@ -2738,7 +3089,8 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
                               point_tag,
                               point_coords,
                               octree,
-                              points_in_extents,
+                              n_threads_max,
+                              work,
                               location,
                               distance);
 
@@ -2754,7 +3106,8 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
                                 point_tag,
                                 point_coords,
                                 octree,
-                                points_in_extents,
+                                n_threads_max,
+                                work,
                                 location,
                                 distance);
 
@@ -2762,118 +3115,157 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
 
   else {
 
-    for (i = 0; i < this_section->n_elements; i++) {
+    const int n_threads = _n_location_threads(this_section->n_elements,
+                                              n_threads_max);
+
+#   pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+    {
+      cs_lnum_t s_id, e_id;
+      _loc_work_t *w = _loc_work_thread_range(this_section->n_elements,
+                                              n_threads,
+                                              work,
+                                              octree->n_points,
+                                              &s_id,
+                                              &e_id);
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+        cs_lnum_t j, vertex_id, elt_num, triangle_vertices[6];
+        int n_triangles;
+        double elt_extents[6];
+
+        bool elt_initialized = false;
+        cs_lnum_t n_points_in_extents = 0;
+
+        if (base_element_num < 0) {
+          if (this_section->parent_element_num != NULL)
+            elt_num = this_section->parent_element_num[i];
+          else
+            elt_num = i + 1;
+        }
+        else
+          elt_num = base_element_num + i;
 
-      bool elt_initialized = false;
+        for (j = 0; j < this_section->stride; j++) {
 
-      if (base_element_num < 0) {
-        if (this_section->parent_element_num != NULL)
-          elt_num = this_section->parent_element_num[i];
-        else
-          elt_num = i + 1;
-      }
-      else
-        elt_num = base_element_num + i;
+          vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
 
-      for (j = 0; j < this_section->stride; j++) {
+          _update_elt_extents(3,
+                              vertex_id,
+                              parent_vertex_num,
+                              vertex_coords,
+                              elt_extents,
+                              &elt_initialized);
 
-        vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+        }
 
-        _update_elt_extents(3,
-                            vertex_id,
-                            parent_vertex_num,
-                            vertex_coords,
-                            elt_extents,
-                            &elt_initialized);
+        _elt_extents_finalize(3,
+                              this_section->entity_dim,
+                              tolerance,
+                              elt_extents);
 
-      }
+        _query_octree(elt_extents,
+                      point_coords,
+                      octree,
+                      &n_points_in_extents,
+                      w->points_in_extents);
 
-      _elt_extents_finalize(3,
-                            this_section->entity_dim,
-                            tolerance,
-                            elt_extents);
+        if (this_section->tag != NULL && point_tag != NULL)
+          _ignore_same_tag(this_section->tag[i],
+                           point_tag,
+                           &n_points_in_extents,
+                           w->points_in_extents);
 
-      _query_octree(elt_extents,
-                    point_coords,
-                    octree,
-                    &n_points_in_extents,
-                    points_in_extents);
+        if (n_points_in_extents < 1)
+          continue;
 
-      if (this_section->tag != NULL && point_tag != NULL)
-        _ignore_same_tag(this_section->tag[i],
-                         point_tag,
-                         &n_points_in_extents,
-                         points_in_extents);
+        /* Work on local copies of location data, so that candidates are
+           relative to the data at section start whatever the number of
+           threads */
 
-      if (this_section->entity_dim == 3)
+        _loc_work_gather(w, 3, n_points_in_extents,
+                         point_coords, location, distance);
 
-        _locate_in_cell_3d(elt_num,
-                           this_section->type,
-                           this_section->vertex_num + i*this_section->stride,
-                           parent_vertex_num,
-                           vertex_coords,
-                           point_coords,
-                           n_points_in_extents,
-                           points_in_extents,
-                           tolerance[1],
-                           location,
-                           distance);
+        const cs_coord_t *_point_coords = w->local_coords;
+        const cs_lnum_t *_points_in_extents = w->local_ids;
+        cs_lnum_t *_location = w->local_location;
+        float *_distance = w->local_distance;
 
-      else if (this_section->entity_dim == 2) {
+        if (this_section->entity_dim == 3)
 
-        if (this_section->type == FVM_FACE_QUAD)
+          _locate_in_cell_3d(elt_num,
+                             this_section->type,
+                             this_section->vertex_num + i*this_section->stride,
+                             parent_vertex_num,
+                             vertex_coords,
+                             _point_coords,
+                             n_points_in_extents,
+                             _points_in_extents,
+                             tolerance[1],
+                             _location,
+                             _distance);
 
-          n_triangles = fvm_triangulate_quadrangle(3,
-                                                   1,
-                                                   vertex_coords,
-                                                   parent_vertex_num,
-                                                   (  this_section->vertex_num
-                                                    + i*this_section->stride),
-                                                   triangle_vertices);
+        else if (this_section->entity_dim == 2) {
 
-        else {
+          if (this_section->type == FVM_FACE_QUAD)
 
-          assert(this_section->type == FVM_FACE_TRIA);
+            n_triangles = fvm_triangulate_quadrangle(3,
+                                                     1,
+                                                     vertex_coords,
+                                                     parent_vertex_num,
+                                                     (  this_section->vertex_num
+                                                      + i*this_section->stride),
+                                                     triangle_vertices);
 
-          n_triangles = 1;
-          for (j = 0; j < 3; j++)
-            triangle_vertices[j]
-              = this_section->vertex_num[i*this_section->stride + j];
+          else {
+
+            assert(this_section->type == FVM_FACE_TRIA);
 
+            n_triangles = 1;
+            for (j = 0; j < 3; j++)
+              triangle_vertices[j]
+                = this_section->vertex_num[i*this_section->stride + j];
 
+
+          }
+
+          _locate_on_triangles_3d(elt_num,
+                                  n_triangles,
+                                  triangle_vertices,
+                                  parent_vertex_num,
+                                  vertex_coords,
+                                  _point_coords,
+                                  n_points_in_extents,
+                                  _points_in_extents,
+                                  tolerance[1],
+                                  _location,
+                                  _distance);
         }
 
-        _locate_on_triangles_3d(elt_num,
-                                n_triangles,
-                                triangle_vertices,
-                                parent_vertex_num,
-                                vertex_coords,
-                                point_coords,
-                                n_points_in_extents,
-                                points_in_extents,
-                                tolerance[1],
-                                location,
-                                distance);
-      }
+        else if (this_section->entity_dim == 1) {
 
-      else if (this_section->entity_dim == 1) {
+          assert(this_section->type == FVM_EDGE);
 
-        assert(this_section->type == FVM_EDGE);
+          _locate_on_edge_3d(elt_num,
+                             this_section->vertex_num + i*this_section->stride,
+                             parent_vertex_num,
+                             vertex_coords,
+                             _point_coords,
+                             n_points_in_extents,
+                             _points_in_extents,
+                             tolerance[1],
+                             _location,
+                             _distance);
 
-        _locate_on_edge_3d(elt_num,
-                           this_section->vertex_num + i*this_section->stride,
-                           parent_vertex_num,
-                           vertex_coords,
-                           point_coords,
-                           n_points_in_extents,
-                           points_in_extents,
-                           tolerance[1],
-                           location,
-                           distance);
+        }
+
+        _loc_work_add_candidates(w, n_points_in_extents, location, distance);
 
       }
     }
 
+    _loc_work_merge(n_threads, work, location, distance);
+
   }
 }
 
@@ -2896,8 +3288,9 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
  *   point_tag         <-- optional point tag (size: n_points)
  *   point_coords      <-- point coordinates
  *   quadtree          <-- point quadtree
- *   points_in_extents <-- array for query of ids of points in extents
- *                         (size: quadtree->n_points, less usually needed)
+ *   n_threads_max     <-- maximum number of threads
+ *   work              <-> thread-local location work arrays
+ *                         (size: n_threads_max)
  *   location          <-> number of element containing or closest to each
  *                         point (size: n_points)
  *   distance          <-> distance from point to element indicated by
@@ -2914,19 +3307,14 @@ _nodal_section_locate_2d(const fvm_nodal_section_t  *this_section,
                          const int                  *point_tag,
                          const cs_coord_t            point_coords[],
                          _quadtree_t                *quadtree,
-                         cs_lnum_t                   points_in_extents[],
+                         int                         n_threads_max,
+                         _loc_work_t                 work[],
                          cs_lnum_t                   location[],
                          float                       distance[])
 {
-  cs_lnum_t   i, j, vertex_id, elt_num, _triangle_vertices[6];
-  int n_vertices;
-  double elt_extents[4];
+  cs_lnum_t   i;
 
-  int n_triangles = 0;
   int n_vertices_max = 0;
-  cs_lnum_t n_points_in_extents = 0;
-  cs_lnum_t *triangle_vertices = _triangle_vertices;
-  fvm_triangulate_state_t *state = NULL;
 
   /* Return immediately if nothing to do for this rank */
 
@@ -2939,8 +3327,8 @@ _nodal_section_locate_2d(const fvm_nodal_section_t  *this_section,
 
     for (i = 0; i < this_section->n_elements; i++) {
 
-      n_vertices = (  this_section->vertex_index[i + 1]
-                    - this_section->vertex_index[i]);
+      int n_vertices = (  this_section->vertex_index[i + 1]
+                        - this_section->vertex_index[i]);
 
       if (n_vertices > n_vertices_max)
         n_vertices_max = n_vertices;
@@ -2950,9 +3338,6 @@ _nodal_section_locate_2d(const fvm_nodal_section_t  *this_section,
     if (n_vertices_max < 3)
       return;
 
-    BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, cs_lnum_t);
-    state = fvm_triangulate_state_create(n_vertices_max);
-
   }
 
   else if (this_section->type == FVM_FACE_QUAD)
@@ -2961,163 +3346,210 @@ _nodal_section_locate_2d(const fvm_nodal_section_t  *this_section,
   else if (this_section->type == FVM_FACE_TRIA)
     n_vertices_max = 3;
 
+  const int n_threads = _n_location_threads(this_section->n_elements,
+                                            n_threads_max);
+
   /* Main loop on elements */
 
-  for (i = 0; i < this_section->n_elements; i++) {
+# pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+  {
+    cs_lnum_t s_id, e_id;
+    _loc_work_t *w = _loc_work_thread_range(this_section->n_elements,
+                                            n_threads,
+                                            work,
+                                            quadtree->n_points,
+                                            &s_id,
+                                            &e_id);
 
-    bool elt_initialized = false;
+    cs_lnum_t _triangle_vertices[6];
+    cs_lnum_t *triangle_vertices = _triangle_vertices;
+    fvm_triangulate_state_t *state = NULL;
 
     if (this_section->type == FVM_FACE_POLY) {
+      BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, cs_lnum_t);
+      state = fvm_triangulate_state_create(n_vertices_max);
+    }
 
-      for (j = this_section->vertex_index[i];
-           j < this_section->vertex_index[i + 1];
-           j++) {
-        vertex_id = this_section->vertex_num[j] - 1;
+    for (cs_lnum_t elt_id = s_id; elt_id < e_id; elt_id++) {
 
-        _update_elt_extents(2,
-                            vertex_id,
-                            parent_vertex_num,
-                            vertex_coords,
-                            elt_extents,
-                            &elt_initialized);
+      cs_lnum_t j, vertex_id, elt_num;
+      double elt_extents[4];
 
-      }
+      int n_triangles = 0;
+      bool elt_initialized = false;
+      cs_lnum_t n_points_in_extents = 0;
 
-    }
-    else {
+      if (this_section->type == FVM_FACE_POLY) {
 
-      for (j = 0; j < this_section->stride; j++) {
+        for (j = this_section->vertex_index[elt_id];
+             j < this_section->vertex_index[elt_id + 1];
+             j++) {
+          vertex_id = this_section->vertex_num[j] - 1;
 
-        vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+          _update_elt_extents(2,
+                              vertex_id,
+                              parent_vertex_num,
+                              vertex_coords,
+                              elt_extents,
+                              &elt_initialized);
 
-        _update_elt_extents(2,
-                            vertex_id,
-                            parent_vertex_num,
-                            vertex_coords,
-                            elt_extents,
-                            &elt_initialized);
+        }
 
       }
+      else {
 
-    }
+        for (j = 0; j < this_section->stride; j++) {
+
+          vertex_id
+            = this_section->vertex_num[elt_id*this_section->stride + j] - 1;
+
+          _update_elt_extents(2,
+                              vertex_id,
+                              parent_vertex_num,
+                              vertex_coords,
+                              elt_extents,
+                              &elt_initialized);
+
+        }
 
-    _elt_extents_finalize(2,
-                          this_section->entity_dim,
-                          tolerance,
-                          elt_extents);
+      }
+
+      _elt_extents_finalize(2,
+                            this_section->entity_dim,
+                            tolerance,
+                            elt_extents);
 
-    if (base_element_num < 0) {
-      if (this_section->parent_element_num != NULL)
-        elt_num = this_section->parent_element_num[i];
+      if (base_element_num < 0) {
+        if (this_section->parent_element_num != NULL)
+          elt_num = this_section->parent_element_num[elt_id];
+        else
+          elt_num = elt_id + 1;
+      }
       else
-        elt_num = i + 1;
-    }
-    else
-      elt_num = base_element_num + i;
+        elt_num = base_element_num + elt_id;
 
-    _query_quadtree(elt_extents,
-                    point_coords,
-                    quadtree,
-                    &n_points_in_extents,
-                    points_in_extents);
+      _query_quadtree(elt_extents,
+                      point_coords,
+                      quadtree,
+                      &n_points_in_extents,
+                      w->points_in_extents);
 
-    if (this_section->tag != NULL && point_tag != NULL)
-      _ignore_same_tag(this_section->tag[i],
-                       point_tag,
-                       &n_points_in_extents,
-                       points_in_extents);
+      if (this_section->tag != NULL && point_tag != NULL)
+        _ignore_same_tag(this_section->tag[elt_id],
+                         point_tag,
+                         &n_points_in_extents,
+                         w->points_in_extents);
 
+      if (n_points_in_extents < 1)
+        continue;
 
-    /* Divide all face types into triangles */
+      /* Divide all face types into triangles */
 
-    if (this_section->type == FVM_FACE_POLY) {
+      if (this_section->type == FVM_FACE_POLY) {
 
-      /* Triangulate polygon */
+        /* Triangulate polygon */
 
-      n_vertices = (  this_section->vertex_index[i + 1]
-                    - this_section->vertex_index[i]);
-      vertex_id = this_section->vertex_index[i];
-
-      n_triangles = fvm_triangulate_polygon(2,
-                                            1,
-                                            n_vertices,
-                                            vertex_coords,
-                                            parent_vertex_num,
-                                            (  this_section->vertex_num
-                                             + vertex_id),
-                                            FVM_TRIANGULATE_MESH_DEF,
-                                            triangle_vertices,
-                                            state);
+        int n_vertices = (  this_section->vertex_index[elt_id + 1]
+                          - this_section->vertex_index[elt_id]);
+        vertex_id = this_section->vertex_index[elt_id];
 
-    }
-    else if (this_section->type == FVM_FACE_QUAD) {
+        n_triangles = fvm_triangulate_polygon(2,
+                                              1,
+                                              n_vertices,
+                                              vertex_coords,
+                                              parent_vertex_num,
+                                              (  this_section->vertex_num
+                                               + vertex_id),
+                                              FVM_TRIANGULATE_MESH_DEF,
+                                              triangle_vertices,
+                                              state);
 
-      /* Triangulate quadrangle */
+      }
+      else if (this_section->type == FVM_FACE_QUAD) {
 
-      n_triangles = fvm_triangulate_quadrangle(2,
-                                               1,
-                                               vertex_coords,
-                                               parent_vertex_num,
-                                               (  this_section->vertex_num
-                                                + i*this_section->stride),
-                                               triangle_vertices);
+        /* Triangulate quadrangle */
 
-    }
+        n_triangles = fvm_triangulate_quadrangle(2,
+                                                 1,
+                                                 vertex_coords,
+                                                 parent_vertex_num,
+                                                 (  this_section->vertex_num
+                                                  + elt_id*this_section->stride),
+                                                 triangle_vertices);
 
-    else if (this_section->type == FVM_FACE_TRIA) {
+      }
 
-      /* Already a triangle */
+      else if (this_section->type == FVM_FACE_TRIA) {
 
-      n_triangles = 1;
+        /* Already a triangle */
 
-      for (j = 0; j < 3; j++)
-        triangle_vertices[j]
-          = this_section->vertex_num[i*this_section->stride + j];
+        n_triangles = 1;
 
-    }
+        for (j = 0; j < 3; j++)
+          triangle_vertices[j]
+            = this_section->vertex_num[elt_id*this_section->stride + j];
 
-    /* Locate on triangulated face */
+      }
 
-    if (this_section->entity_dim == 2)
+      /* Work on local copies of location data, so that candidates are
+         relative to the data at section start whatever the number of
+         threads */
 
-      _locate_on_triangles_2d(elt_num,
-                              n_triangles,
-                              triangle_vertices,
-                              parent_vertex_num,
-                              vertex_coords,
-                              point_coords,
-                              n_points_in_extents,
-                              points_in_extents,
-                              tolerance[1],
-                              location,
-                              distance);
+      _loc_work_gather(w, 2, n_points_in_extents,
+                       point_coords, location, distance);
 
-    else if (this_section->entity_dim == 1) {
+      const cs_coord_t *_point_coords = w->local_coords;
+      const cs_lnum_t *_points_in_extents = w->local_ids;
+      cs_lnum_t *_location = w->local_location;
+      float *_distance = w->local_distance;
 
-      assert(this_section->type == FVM_EDGE);
+      /* Locate on triangulated face */
 
-      _locate_on_edge_2d(elt_num,
-                         this_section->vertex_num + i*this_section->stride,
-                         parent_vertex_num,
-                         vertex_coords,
-                         point_coords,
-                         n_points_in_extents,
-                         points_in_extents,
-                         tolerance[1],
-                         location,
-                         distance);
+      if (this_section->entity_dim == 2)
 
-    }
+        _locate_on_triangles_2d(elt_num,
+                                n_triangles,
+                                triangle_vertices,
+                                parent_vertex_num,
+                                vertex_coords,
+                                _point_coords,
+                                n_points_in_extents,
+                                _points_in_extents,
+                                tolerance[1],
+                                _location,
+                                _distance);
 
-  } /* End of loop on elements */
+      else if (this_section->entity_dim == 1) {
 
-  /* Free axiliary arrays and structures */
+        assert(this_section->type == FVM_EDGE);
 
-  if (triangle_vertices != _triangle_vertices)
-    BFT_FREE(triangle_vertices);
+        _locate_on_edge_2d(elt_num,
+                           this_section->vertex_num + elt_id*this_section->stride,
+                           parent_vertex_num,
+                           vertex_coords,
+                           _point_coords,
+                           n_points_in_extents,
+                           _points_in_extents,
+                           tolerance[1],
+                           _location,
+                           _distance);
 
-  if (state != NULL)
-    state = fvm_triangulate_state_destroy(state);
+      }
+
+      _loc_work_add_candidates(w, n_points_in_extents, location, distance);
+
+    } /* End of loop on elements */
+
+    /* Free axiliary arrays and structures */
+
+    if (triangle_vertices != _triangle_vertices)
+      BFT_FREE(triangle_vertices);
+
+    if (state != NULL)
+      state = fvm_triangulate_state_destroy(state);
+  }
+
+  _loc_work_merge(n_threads, work, location, distance);
 }
 
 /*----------------------------------------------------------------------------
@@ -3160,62 +3592,72 @@ _nodal_section_locate_1d(const fvm_nodal_section_t  *this_section,
                          cs_lnum_t                   location[],
                          float                       distance[])
 {
-  cs_lnum_t   i, j, vertex_id, elt_num;
-  cs_coord_t  edge_coords[2];
-  double delta, elt_extents[2];
+  /* Points are independent, so each thread handles a range of points
+     for all elements, in the same order as the serial algorithm */
 
-  int *elt_tag = NULL;
+# pragma omp parallel if (n_points > CS_THR_MIN)
+  {
+    cs_lnum_t   i, j, vertex_id, elt_num;
+    cs_coord_t  edge_coords[2];
+    double delta, elt_extents[2];
 
-  for (i = 0; i < this_section->n_elements; i++) {
+    int *elt_tag = NULL;
 
-    if (base_element_num < 0) {
-      if (this_section->parent_element_num != NULL)
-        elt_num = this_section->parent_element_num[i];
-      else
-        elt_num = i + 1;
-    }
-    else
-      elt_num = base_element_num + i;
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n_points, sizeof(cs_coord_t), &s_id, &e_id);
 
-    for (j = 0; j < 2; j++) {
+    const int *_point_tag = (point_tag != NULL) ? point_tag + s_id : NULL;
 
-      vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+    for (i = 0; i < this_section->n_elements; i++) {
 
-      if (parent_vertex_num == NULL)
-        edge_coords[j] = vertex_coords[vertex_id];
+      if (base_element_num < 0) {
+        if (this_section->parent_element_num != NULL)
+          elt_num = this_section->parent_element_num[i];
+        else
+          elt_num = i + 1;
+      }
       else
-        edge_coords[j] = vertex_coords[parent_vertex_num[vertex_id] - 1];
+        elt_num = base_element_num + i;
 
-    }
+      for (j = 0; j < 2; j++) {
 
-    if (edge_coords[0] < edge_coords[1]) {
-      elt_extents[0] = edge_coords[0];
-      elt_extents[1] = edge_coords[1];
-    }
-    else {
-      elt_extents[0] = edge_coords[1];
-      elt_extents[1] = edge_coords[0];
-    }
+        vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+
+        if (parent_vertex_num == NULL)
+          edge_coords[j] = vertex_coords[vertex_id];
+        else
+          edge_coords[j] = vertex_coords[parent_vertex_num[vertex_id] - 1];
+
+      }
 
-    delta = (elt_extents[1] - elt_extents[0]) * tolerance[1];
+      if (edge_coords[0] < edge_coords[1]) {
+        elt_extents[0] = edge_coords[0];
+        elt_extents[1] = edge_coords[1];
+      }
+      else {
+        elt_extents[0] = edge_coords[1];
+        elt_extents[1] = edge_coords[0];
+      }
 
-    elt_extents[0] -= delta;
-    elt_extents[1] += delta;
+      delta = (elt_extents[1] - elt_extents[0]) * tolerance[1];
 
-    if (this_section->tag != NULL)
-      elt_tag = this_section->tag + i;
+      elt_extents[0] -= delta;
+      elt_extents[1] += delta;
 
-    _locate_by_extents_1d(elt_num,
-                          elt_tag,
-                          elt_extents,
-                          n_points,
-                          point_tag,
-                          point_coords,
-                          location,
-                          distance);
+      if (this_section->tag != NULL)
+        elt_tag = this_section->tag + i;
 
-  }
+      _locate_by_extents_1d(elt_num,
+                            elt_tag,
+                            elt_extents,
+                            e_id - s_id,
+                            _point_tag,
+                            point_coords + s_id,
+                            location + s_id,
+                            distance + s_id);
 
+    }
+  }
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -3264,7 +3706,6 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
   int i;
   int max_entity_dim;
   cs_lnum_t    base_element_num;
-  cs_lnum_t   *points_in_extents = NULL;
 
   double tolerance[2] = {tolerance_base, tolerance_fraction};
 
@@ -3278,10 +3719,11 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
 
   max_entity_dim = fvm_nodal_get_max_entity_dim(this_nodal);
 
-  /* Build point query list
-     (max size: n_points, usually much less) */
+  /* Thread-local point query lists and location work arrays
+     (allocated when first needed) */
 
-  BFT_MALLOC(points_in_extents, n_points, cs_lnum_t);
+  const int n_threads_max = cs_glob_n_threads;
+  _loc_work_t *work = _loc_work_create(n_threads_max);
 
   /* Use octree for 3d point location */
 
@@ -3305,7 +3747,8 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
                                  point_tag,
                                  point_coords,
                                  &octree,
-                                 points_in_extents,
+                                 n_threads_max,
+                                 work,
                                  location,
                                  distance);
 
@@ -3341,7 +3784,8 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
                                  point_tag,
                                  point_coords,
                                  &quadtree,
-                                 points_in_extents,
+                                 n_threads_max,
+                                 work,
                                  location,
                                  distance);
 
@@ -3385,7 +3829,7 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
 
   }
 
-  BFT_FREE(points_in_extents);
+  _loc_work_destroy(n_threads_max, &work);
 
 }
 
@@ -3466,7 +3910,8 @@ fvm_point_location_closest_vertex(const fvm_nodal_t  *this_nodal,
   assert(shift == n_max_dim_sections); // Sanity check
 
   /* Find the closest vertex */
-  for (int p_id = 0; p_id < n_points; p_id++) {
+# pragma omp parallel for if (n_points > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
 
     /* Find the related section */
     const cs_lnum_t  num = located_ent_num[p_id];
@@ -3576,7 +4021,8 @@ fvm_point_location_closest_vertex(const fvm_nodal_t  *this_nodal,
   /* Apply parent_vertex_num if needed */
   if (locate_on_parents == 1) {
     if (this_nodal->parent_vertex_num != NULL) {
-      for (int p_id = 0; p_id < n_points; p_id++) {
+#     pragma omp parallel for if (n_points > CS_THR_MIN)
+      for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
         const cs_lnum_t  prev_id = located_vtx_num[p_id] - 1;
         if (prev_id > -1)
           located_vtx_num[p_id] = this_nodal->parent_vertex_num[prev_id];
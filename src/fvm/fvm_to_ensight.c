@@ -44,6 +44,7 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "fvm_convert_array.h"
 #include "fvm_defs.h"
 #include "fvm_io_num.h"
 #include "fvm_nodal.h"
@@ -53,7 +54,9 @@
 #include "fvm_writer_priv.h"
 
 #include "cs_block_dist.h"
+#include "cs_compress.h"
 #include "cs_file.h"
+#include "cs_file_server.h"
 #include "cs_parall.h"
 #include "cs_part_to_block.h"
 
@@ -94,6 +97,9 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  double       error_bound;        /* Absolute error bound for quantization
+                                      of field values, or 0 */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -101,6 +107,10 @@ typedef struct {
   int          min_block_size;     /* Minimum block buffer size */
   MPI_Comm     block_comm;         /* Associated MPI block communicator */
   MPI_Comm     comm;               /* Associated MPI communicator */
+  bool         io_server;          /* true if field values are shipped to
+                                      dedicated I/O server ranks */
+  bool         server_pending;     /* true if values have been shipped to
+                                      I/O servers since last sync */
 #endif
 
 } fvm_to_ensight_writer_t;
@@ -921,6 +931,12 @@ _field_output_g(void           *context,
 
   assert(datatype == CS_FLOAT);
 
+  if (w->error_bound > 0)
+    cs_compress_quantize(w->error_bound,
+                         CS_FLOAT,
+                         block_end - block_start,
+                         buffer);
+
   _write_block_floats_g(block_start,
                         block_end,
                         buffer,
@@ -2353,6 +2369,7 @@ _export_nodal_strided_g(const fvm_to_ensight_writer_t  *w,
  *                          size: n_parent_lists
  *   datatype           <-- input data type (output is real)
  *   field_values       <-- array of associated field value arrays
+ *   error_bound        <-- absolute error bound for quantization, or 0
  *   f                  <-- associated file handle
  *----------------------------------------------------------------------------*/
 
@@ -2365,6 +2382,7 @@ _export_field_values_nl(const fvm_nodal_t           *mesh,
                         const cs_lnum_t              parent_num_shift[],
                         cs_datatype_t                datatype,
                         const void            *const field_values[],
+                        double                       error_bound,
                         _ensight_file_t              f)
 {
   int  i;
@@ -2395,6 +2413,10 @@ _export_field_values_nl(const fvm_nodal_t           *mesh,
                                            output_buffer_size,
                                            &output_size) == 0) {
 
+      if (error_bound > 0)
+        cs_compress_quantize(error_bound, CS_FLOAT, output_size,
+                             output_buffer);
+
       _write_block_floats_l(output_size,
                             output_buffer,
                             f);
@@ -2425,6 +2447,7 @@ _export_field_values_nl(const fvm_nodal_t           *mesh,
  *                        size: n_parent_lists
  *   datatype         <-- indicates the data type of (source) field values
  *   field_values     <-- array of associated field value arrays
+ *   error_bound      <-- absolute error bound for quantization, or 0
  *   f                <-- associated file handle
  *
  * returns:
@@ -2440,6 +2463,7 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
                         const cs_lnum_t                  parent_num_shift[],
                         cs_datatype_t                    datatype,
                         const void                *const field_values[],
+                        double                           error_bound,
                         _ensight_file_t                  f)
 {
   int  i;
@@ -2492,6 +2516,10 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
                                              output_buffer_size,
                                              &output_size) == 0) {
 
+        if (error_bound > 0)
+          cs_compress_quantize(error_bound, CS_FLOAT, output_size,
+                               output_buffer);
+
         _write_block_floats_l(output_size,
                               output_buffer,
                               f);
@@ -2513,6 +2541,294 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
   return current_section;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Check if field values may be output through dedicated I/O servers.
+ *
+ * Tesselated sections (and associated extra vertices) are not handled
+ * by this path, and use the standard output path, once servers have
+ * completed pending writes (see cs_file_server_sync).
+ *
+ * parameters:
+ *   w           <-- pointer to writer structure
+ *   mesh        <-- pointer to nodal mesh structure
+ *   export_list <-- pointer to section helper structures list
+ *   location    <-- variable definition location (nodes or elements)
+ *   dimension   <-- input field dimension
+ *
+ * returns:
+ *   true if output through I/O servers is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_server_output_possible(const fvm_to_ensight_writer_t  *w,
+                        const fvm_nodal_t              *mesh,
+                        const fvm_writer_section_t     *export_list,
+                        fvm_writer_var_loc_t            location,
+                        int                             dimension)
+{
+  if (w->io_server == false || dimension == 2)
+    return false;
+
+  if (location == FVM_WRITER_PER_ELEMENT) {
+    for (const fvm_writer_section_t *s = export_list; s != NULL; s = s->next) {
+      if (s->type != s->section->type)
+        return false;
+    }
+  }
+  else if (location == FVM_WRITER_PER_NODE) {
+    cs_gnum_t n_g_extra_vertices = 0;
+    fvm_writer_count_extra_vertices(mesh,
+                                    w->divide_polyhedra,
+                                    &n_g_extra_vertices,
+                                    NULL);
+    if (n_g_extra_vertices > 0)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Write string to an EnSight Gold file through I/O servers.
+ *
+ * parameters:
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_write_string(const char  *s)
+{
+  size_t  i;
+  char  buf[82];
+
+  strncpy(buf, s, 80);
+  buf[80] = '\0';
+  for (i = strlen(buf); i < 80; i++)
+    buf[i] = '\0';
+
+  cs_file_server_write_global(buf, 1, 80);
+}
+
+/*----------------------------------------------------------------------------
+ * Ship local field values to I/O servers.
+ *
+ * Values are converted to (interlaced) float and reordered if necessary;
+ * the servers then handle conversion to a non-interlaced block
+ * distribution and writing.
+ *
+ * parameters:
+ *   n_g_ents         <-- global number of entities
+ *   n_ents           <-- local number of entities
+ *   gnum             <-- global numbers of local entities
+ *   input_dim        <-- input field dimension
+ *   error_bound      <-- absolute error bound for quantization, or 0
+ *   values           <-> converted local values
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_write_values(cs_gnum_t         n_g_ents,
+                     cs_lnum_t         n_ents,
+                     const cs_gnum_t   gnum[],
+                     int               input_dim,
+                     double            error_bound,
+                     float             values[])
+{
+  if (error_bound > 0)
+    cs_compress_quantize(error_bound, CS_FLOAT, n_ents*input_dim, values);
+
+  if (input_dim == 6) {
+    for (cs_lnum_t i = 0; i < n_ents; i++) {
+      float v[6];
+      for (int j = 0; j < 6; j++)
+        v[j] = values[i*6 + _ensight_c_order_6[j]];
+      for (int j = 0; j < 6; j++)
+        values[i*6 + j] = v[j];
+    }
+  }
+
+  cs_file_server_write_block(n_g_ents,
+                             sizeof(float),
+                             input_dim,
+                             CS_NO_INTERLACE,
+                             n_ents,
+                             gnum,
+                             values);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field values associated with nodal values of a nodal mesh to
+ * an EnSight Gold file through I/O servers.
+ *
+ * parameters:
+ *   mesh             <-- pointer to nodal mesh structure
+ *   input_dim        <-- input field dimension
+ *   interlace        <-- indicates if field in memory is interlaced
+ *   n_parent_lists   <-- indicates if field values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- input data type (output is real)
+ *   error_bound      <-- absolute error bound for quantization, or 0
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_server_export_field_values_n(const fvm_nodal_t   *mesh,
+                              int                  input_dim,
+                              cs_interlace_t       interlace,
+                              int                  n_parent_lists,
+                              const cs_lnum_t      parent_num_shift[],
+                              cs_datatype_t        datatype,
+                              double               error_bound,
+                              const void    *const field_values[])
+{
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+  const cs_gnum_t *g_vtx_num = NULL;
+
+  if (mesh->global_vertex_num != NULL)
+    g_vtx_num = fvm_io_num_get_global_num(mesh->global_vertex_num);
+
+  cs_gnum_t *gnum;
+  float *values;
+  BFT_MALLOC(gnum, n_vertices, cs_gnum_t);
+  BFT_MALLOC(values, n_vertices*input_dim, float);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++)
+    gnum[i] = (g_vtx_num != NULL) ? g_vtx_num[i] : (cs_gnum_t)(i+1);
+
+  fvm_convert_array(input_dim,
+                    0,
+                    input_dim,
+                    0,
+                    n_vertices,
+                    interlace,
+                    datatype,
+                    CS_FLOAT,
+                    n_parent_lists,
+                    parent_num_shift,
+                    mesh->parent_vertex_num,
+                    field_values,
+                    values);
+
+  _server_write_values(fvm_nodal_get_n_g_vertices(mesh),
+                       n_vertices,
+                       gnum,
+                       input_dim,
+                       error_bound,
+                       values);
+
+  BFT_FREE(values);
+  BFT_FREE(gnum);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field values associated with element values of a nodal mesh to
+ * an EnSight Gold file through I/O servers.
+ *
+ * Sections continuing a previous section are grouped with it.
+ *
+ * parameters:
+ *   export_section   <-- pointer to EnSight section helper structure
+ *   input_dim        <-- input field dimension
+ *   interlace        <-- indicates if field in memory is interlaced
+ *   n_parent_lists   <-- indicates if field values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   error_bound      <-- absolute error bound for quantization, or 0
+ *   field_values     <-- array of associated field value arrays
+ *
+ * returns:
+ *  pointer to next EnSight section helper structure in list
+ *----------------------------------------------------------------------------*/
+
+static const fvm_writer_section_t *
+_server_export_field_values_e(const fvm_writer_section_t  *export_section,
+                              int                          input_dim,
+                              cs_interlace_t               interlace,
+                              int                          n_parent_lists,
+                              const cs_lnum_t              parent_num_shift[],
+                              cs_datatype_t                datatype,
+                              double                       error_bound,
+                              const void            *const field_values[])
+{
+  const fvm_writer_section_t *s, *s_end;
+
+  /* Count local and global elements of grouped sections */
+
+  cs_lnum_t n_elts = 0;
+  cs_gnum_t n_g_elts = 0;
+
+  for (s = export_section; s != NULL; s = s->next) {
+    if (s != export_section && s->continues_previous == false)
+      break;
+    n_elts += s->section->n_elements;
+    n_g_elts += fvm_nodal_section_n_g_elements(s->section);
+  }
+  s_end = s;
+
+  cs_gnum_t *gnum;
+  float *values;
+  BFT_MALLOC(gnum, n_elts, cs_gnum_t);
+  BFT_MALLOC(values, n_elts*input_dim, float);
+
+  /* Extract values and global numbers */
+
+  cs_lnum_t elt_shift = 0;
+  cs_gnum_t g_elt_shift = 0;
+
+  for (s = export_section; s != s_end; s = s->next) {
+
+    const fvm_nodal_section_t *section = s->section;
+    const cs_lnum_t num_shift = (n_parent_lists == 0) ? s->num_shift : 0;
+    const cs_gnum_t *g_elt_num = NULL;
+
+    if (section->global_element_num != NULL)
+      g_elt_num = fvm_io_num_get_global_num(section->global_element_num);
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++)
+      gnum[elt_shift + i] = g_elt_shift + ((g_elt_num != NULL) ?
+                                           g_elt_num[i] : (cs_gnum_t)(i+1));
+
+    fvm_convert_array(input_dim,
+                      0,
+                      input_dim,
+                      num_shift,
+                      section->n_elements + num_shift,
+                      interlace,
+                      datatype,
+                      CS_FLOAT,
+                      n_parent_lists,
+                      parent_num_shift,
+                      section->parent_element_num,
+                      field_values,
+                      values + elt_shift*input_dim);
+
+    elt_shift += section->n_elements;
+    g_elt_shift += fvm_nodal_section_n_g_elements(section);
+
+  }
+
+  _server_write_values(n_g_elts,
+                       n_elts,
+                       gnum,
+                       input_dim,
+                       error_bound,
+                       values);
+
+  BFT_FREE(values);
+  BFT_FREE(gnum);
+
+  return s_end;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2573,6 +2889,8 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
 
+  this_writer->error_bound = 0.;
+
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
 
@@ -2584,6 +2902,8 @@ fvm_to_ensight_init_writer(const char             *name,
     this_writer->min_block_size = 0;
     this_writer->block_comm = MPI_COMM_NULL;
     this_writer->comm = MPI_COMM_NULL;
+    this_writer->io_server = false;
+    this_writer->server_pending = false;
     MPI_Initialized(&mpi_flag);
     if (mpi_flag && comm != MPI_COMM_NULL) {
       size_t min_block_size = cs_parall_get_min_coll_buf_size();
@@ -2599,6 +2919,8 @@ fvm_to_ensight_init_writer(const char             *name,
       }
       this_writer->comm = comm;
     }
+    if (comm == cs_glob_mpi_comm)
+      this_writer->io_server = cs_file_server_is_active();
   }
 #endif /* defined(HAVE_MPI) */
 
@@ -2644,12 +2966,24 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if (strncmp(options + i1, "quantize=", 9) == 0) {
+        const char *s = options + i1 + 9;
+        double eps;
+        if (sscanf(s, "%lg", &eps) == 1 && eps > 0)
+          this_writer->error_bound = eps;
+      }
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
 
   }
 
+#if defined(HAVE_MPI)
+  if (this_writer->text_mode)
+    this_writer->io_server = false;
+#endif
+
   this_writer->case_info = fvm_to_ensight_case_create(name,
                                                       path,
                                                       time_dependency);
@@ -3080,6 +3414,94 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                                                time_step,
                                                time_value);
 
+  /* Build list of sections that are used here, in order of output */
+
+  int export_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  export_list = fvm_writer_export_list(mesh,
+                                       export_dim,
+                                       export_dim,
+                                       -1,
+                                       true,
+                                       false,
+                                       w->discard_polygons,
+                                       w->discard_polyhedra,
+                                       w->divide_polygons,
+                                       w->divide_polyhedra);
+
+#if defined(HAVE_MPI)
+
+  /* Ship values to dedicated I/O servers when possible */
+
+  if (_server_output_possible(w, mesh, export_list, location, dimension)) {
+
+    cs_file_server_open(file_info.name,
+                        (file_info.queried) ?
+                        CS_FILE_MODE_APPEND : CS_FILE_MODE_WRITE,
+                        w->swap_endian);
+
+    if (file_info.queried == false) {
+      char buf[81] = "";
+      if (time_step > -1)
+        snprintf(buf, 80, "%s (time values: %d, %g)",
+                 name, time_step, time_value);
+      else
+        strncpy(buf, name, 80);
+      buf[80] = '\0';
+      _server_write_string(buf);
+    }
+
+    int32_t _part_num = part_num;
+    _server_write_string("part");
+    cs_file_server_write_global(&_part_num, sizeof(int32_t), 1);
+
+    if (location == FVM_WRITER_PER_NODE) {
+      _server_write_string("coordinates");
+      _server_export_field_values_n(mesh,
+                                    dimension,
+                                    interlace,
+                                    n_parent_lists,
+                                    parent_num_shift,
+                                    datatype,
+                                    w->error_bound,
+                                    field_values);
+    }
+    else if (location == FVM_WRITER_PER_ELEMENT) {
+      export_section = export_list;
+      while (export_section != NULL) {
+        _server_write_string(_ensight_type_name[export_section->type]);
+        export_section = _server_export_field_values_e(export_section,
+                                                       dimension,
+                                                       interlace,
+                                                       n_parent_lists,
+                                                       parent_num_shift,
+                                                       datatype,
+                                                       w->error_bound,
+                                                       field_values);
+      }
+    }
+
+    cs_file_server_close();
+
+    w->server_pending = true;
+
+    BFT_FREE(export_list);
+
+    fvm_to_ensight_case_write_case(w->case_info, rank);
+
+    return;
+  }
+
+  /* Parts of a variable are written to the same file, possibly using
+     both paths, so wait for the servers before writing directly */
+
+  if (w->server_pending) {
+    cs_file_server_sync();
+    w->server_pending = false;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
   f = _open_ensight_file(w, file_info.name, file_info.queried);
 
   if (file_info.queried == false) {
@@ -3103,21 +3525,6 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   /* Initialize writer helper */
   /*--------------------------*/
 
-  /* Build list of sections that are used here, in order of output */
-
-  int export_dim = fvm_nodal_get_max_entity_dim(mesh);
-
-  export_list = fvm_writer_export_list(mesh,
-                                       export_dim,
-                                       export_dim,
-                                       -1,
-                                       true,
-                                       false,
-                                       w->discard_polygons,
-                                       w->discard_polyhedra,
-                                       w->divide_polygons,
-                                       w->divide_polyhedra);
-
   helper = fvm_writer_field_helper_create(mesh,
                                           export_list,
                                           output_dim,
@@ -3180,6 +3587,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                               parent_num_shift,
                               datatype,
                               field_values,
+                              w->error_bound,
                               f);
   }
 
@@ -3232,6 +3640,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
                                                  parent_num_shift,
                                                  datatype,
                                                  field_values,
+                                                 w->error_bound,
                                                  f);
 
     } /* End of loop on sections */
@@ -0,0 +1,800 @@
+/*============================================================================
+ * Direct parallel import of CGNS mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_CGNS)
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * CGNS library headers
+ *----------------------------------------------------------------------------*/
+
+#include <cgnslib.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+
+#include "cs_parall.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_cells.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_cgns.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#define _CGNS_NAME_SIZE  32
+
+/* Compatibility with different CGNS library versions */
+
+#if !defined(CGNS_ENUMV)
+#define CGNS_ENUMV(e) e
+#endif
+
+#if !defined(CGNS_ENUMT)
+#define CGNS_ENUMT(e) e
+#endif
+
+#if CGNS_VERSION < 3100
+#define cgsize_t int
+#endif
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Elements read by the local rank */
+
+typedef struct {
+
+  cs_lnum_t       n_elts;     /* Number of elements */
+  cs_lnum_t       n_max;      /* Allocated number of elements */
+  cs_lnum_t       vtx_max;    /* Allocated size of vertex connectivity */
+  fvm_element_t  *type;       /* Element types */
+  int            *gc_id;      /* Group class ids */
+  cs_gnum_t      *num;        /* CGNS element numbers */
+  cs_lnum_t      *vtx_idx;    /* Element -> vertices index */
+  cs_gnum_t      *vtx;        /* Element -> vertices global numbers */
+
+} _elts_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compare global numbers (qsort function).
+ *
+ * parameters:
+ *   x <-> pointer to first value
+ *   y <-> pointer to second value
+ *
+ * returns:
+ *   -1 if x < y, 0 if x = y, or 1 if x > y
+ *----------------------------------------------------------------------------*/
+
+static int
+_cmp_gnum(const void  *x,
+          const void  *y)
+{
+  cs_gnum_t a = *((const cs_gnum_t *)x);
+  cs_gnum_t b = *((const cs_gnum_t *)y);
+
+  if (a < b)
+    return -1;
+  else if (a > b)
+    return 1;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the portion of a set of entities read by the local rank.
+ *
+ * parameters:
+ *   n     <-- global number of entities
+ *   start --> first entity read (0 to n-1)
+ *   end   --> past-the-end entity read
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_range(cs_gnum_t   n,
+             cs_gnum_t  *start,
+             cs_gnum_t  *end)
+{
+  cs_gnum_t n_ranks = cs_glob_n_ranks;
+  cs_gnum_t rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_gnum_t q = n / n_ranks, r = n % n_ranks;
+
+  *start = q*rank_id + CS_MIN(rank_id, r);
+  *end = *start + q + ((rank_id < r) ? 1 : 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the element type matching a CGNS element type.
+ *
+ * Higher order elements are reduced to their corner vertices, which
+ * come first in the CGNS numbering.
+ *
+ * parameters:
+ *   type  <-- CGNS element type
+ *   n_vtx --> number of corner vertices
+ *
+ * returns:
+ *   element type, or FVM_N_ELEMENT_TYPES for ignored elements
+ *----------------------------------------------------------------------------*/
+
+static fvm_element_t
+_element_type(CGNS_ENUMT(ElementType_t)   type,
+              int                        *n_vtx)
+{
+  fvm_element_t retval = FVM_N_ELEMENT_TYPES;
+  *n_vtx = 0;
+
+  switch(type) {
+  case CGNS_ENUMV(TRI_3):
+  case CGNS_ENUMV(TRI_6):
+    retval = FVM_FACE_TRIA;
+    *n_vtx = 3;
+    break;
+  case CGNS_ENUMV(QUAD_4):
+  case CGNS_ENUMV(QUAD_8):
+  case CGNS_ENUMV(QUAD_9):
+    retval = FVM_FACE_QUAD;
+    *n_vtx = 4;
+    break;
+  case CGNS_ENUMV(TETRA_4):
+  case CGNS_ENUMV(TETRA_10):
+    retval = FVM_CELL_TETRA;
+    *n_vtx = 4;
+    break;
+  case CGNS_ENUMV(PYRA_5):
+  case CGNS_ENUMV(PYRA_14):
+#if CGNS_VERSION >= 3100
+  case CGNS_ENUMV(PYRA_13):
+#endif
+    retval = FVM_CELL_PYRAM;
+    *n_vtx = 5;
+    break;
+  case CGNS_ENUMV(PENTA_6):
+  case CGNS_ENUMV(PENTA_15):
+  case CGNS_ENUMV(PENTA_18):
+    retval = FVM_CELL_PRISM;
+    *n_vtx = 6;
+    break;
+  case CGNS_ENUMV(HEXA_8):
+  case CGNS_ENUMV(HEXA_20):
+  case CGNS_ENUMV(HEXA_27):
+    retval = FVM_CELL_HEXA;
+    *n_vtx = 8;
+    break;
+  case CGNS_ENUMV(NODE):
+  case CGNS_ENUMV(BAR_2):
+  case CGNS_ENUMV(BAR_3):
+    break;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS element type %d not handled by direct import;\n"
+                "use the Preprocessor for this mesh."), (int)type);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Add an element to an element set.
+ *
+ * parameters:
+ *   e     <-> element set
+ *   type  <-- element type
+ *   gc_id <-- group class id
+ *   num   <-- CGNS element number
+ *   n_vtx <-- number of vertices
+ *   vtx   <-- vertex global numbers
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_elt(_elts_t          *e,
+         fvm_element_t     type,
+         int               gc_id,
+         cs_gnum_t         num,
+         int               n_vtx,
+         const cgsize_t    vtx[])
+{
+  if (e->n_elts >= e->n_max) {
+    e->n_max = CS_MAX(e->n_max*2, 16);
+    BFT_REALLOC(e->type, e->n_max, fvm_element_t);
+    BFT_REALLOC(e->gc_id, e->n_max, int);
+    BFT_REALLOC(e->num, e->n_max, cs_gnum_t);
+    BFT_REALLOC(e->vtx_idx, e->n_max + 1, cs_lnum_t);
+    if (e->n_elts == 0)
+      e->vtx_idx[0] = 0;
+  }
+
+  cs_lnum_t s_id = e->vtx_idx[e->n_elts];
+
+  if (s_id + n_vtx > e->vtx_max) {
+    e->vtx_max = CS_MAX(e->vtx_max*2, s_id + n_vtx);
+    BFT_REALLOC(e->vtx, e->vtx_max, cs_gnum_t);
+  }
+
+  e->type[e->n_elts] = type;
+  e->gc_id[e->n_elts] = gc_id;
+  e->num[e->n_elts] = num;
+  for (int i = 0; i < n_vtx; i++)
+    e->vtx[s_id + i] = vtx[i];
+  e->vtx_idx[e->n_elts + 1] = s_id + n_vtx;
+
+  e->n_elts += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Free an element set.
+ *
+ * parameters:
+ *   e <-> element set
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_elts(_elts_t  *e)
+{
+  BFT_FREE(e->type);
+  BFT_FREE(e->gc_id);
+  BFT_FREE(e->num);
+  BFT_FREE(e->vtx_idx);
+  BFT_FREE(e->vtx);
+}
+
+/*----------------------------------------------------------------------------
+ * Read the local block of an element section.
+ *
+ * parameters:
+ *   path  <-- path to mesh file
+ *   fn    <-- CGNS file index
+ *   B     <-- CGNS base index
+ *   Z     <-- CGNS zone index
+ *   S     <-- CGNS section index
+ *   gc_id <-- group class id associated with this section
+ *   name  --> section name
+ *   cells <-> cells set
+ *   faces <-> boundary elements set
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_section(const char  *path,
+              int          fn,
+              int          B,
+              int          Z,
+              int          S,
+              int          gc_id,
+              char         name[_CGNS_NAME_SIZE + 1],
+              _elts_t     *cells,
+              _elts_t     *faces)
+{
+  CGNS_ENUMT(ElementType_t) type;
+  cgsize_t start, end;
+  int n_bndry, parent_flag;
+
+  if (cg_section_read(fn, B, Z, S, name, &type, &start, &end,
+                      &n_bndry, &parent_flag) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": cg_section_read() failed:\n%s"),
+              path, cg_get_error());
+
+  if (type == CGNS_ENUMV(NGON_n) || type == CGNS_ENUMV(NFACE_n))
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": polyhedral (NGON_n/NFACE_n) sections\n"
+                "are not handled by direct import;\n"
+                "use the Preprocessor for this mesh."), path);
+
+  cs_gnum_t s0, s1;
+  _block_range(end - start + 1, &s0, &s1);
+
+  if (s1 <= s0)
+    return;
+
+  const cgsize_t e0 = start + s0, e1 = start + s1 - 1;
+  const cs_lnum_t n_elts = s1 - s0;
+
+  cgsize_t *elts = NULL;
+
+  if (type == CGNS_ENUMV(MIXED)) {
+
+    cgsize_t size = 0;
+    if (cg_ElementPartialSize(fn, B, Z, S, e0, e1, &size) != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("File \"%s\": cg_ElementPartialSize() failed:\n%s"),
+                path, cg_get_error());
+
+    BFT_MALLOC(elts, size, cgsize_t);
+
+#if CGNS_VERSION >= 4000
+    cgsize_t *offsets;
+    BFT_MALLOC(offsets, n_elts + 1, cgsize_t);
+    int retval = cg_poly_elements_partial_read(fn, B, Z, S, e0, e1,
+                                               elts, offsets, NULL);
+    BFT_FREE(offsets);
+#else
+    int retval = cg_elements_partial_read(fn, B, Z, S, e0, e1, elts, NULL);
+#endif
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("File \"%s\": reading of section \"%s\" failed:\n%s"),
+                path, name, cg_get_error());
+
+    /* Each element is defined by its type followed by its vertices */
+
+    cgsize_t p = 0;
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      CGNS_ENUMT(ElementType_t) e_type = elts[p++];
+      int n_vtx, npe;
+      cg_npe(e_type, &npe);
+      fvm_element_t fvm_type = _element_type(e_type, &n_vtx);
+      if (fvm_type == FVM_FACE_TRIA || fvm_type == FVM_FACE_QUAD)
+        _add_elt(faces, fvm_type, gc_id, e0 + i, n_vtx, elts + p);
+      else if (fvm_type != FVM_N_ELEMENT_TYPES)
+        _add_elt(cells, fvm_type, gc_id, e0 + i, n_vtx, elts + p);
+      p += npe;
+    }
+
+  }
+  else {
+
+    int n_vtx, npe;
+    cg_npe(type, &npe);
+    fvm_element_t fvm_type = _element_type(type, &n_vtx);
+
+    if (fvm_type != FVM_N_ELEMENT_TYPES) {
+
+      BFT_MALLOC(elts, (size_t)n_elts*npe, cgsize_t);
+
+      if (cg_elements_partial_read(fn, B, Z, S, e0, e1, elts, NULL) != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("File \"%s\": reading of section \"%s\" failed:\n%s"),
+                  path, name, cg_get_error());
+
+      _elts_t *e = (   fvm_type == FVM_FACE_TRIA
+                    || fvm_type == FVM_FACE_QUAD) ? faces : cells;
+
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        _add_elt(e, fvm_type, gc_id, e0 + i, n_vtx, elts + (size_t)i*npe);
+
+    }
+
+  }
+
+  BFT_FREE(elts);
+}
+
+/*----------------------------------------------------------------------------
+ * Assign group classes of boundary elements from a boundary condition.
+ *
+ * Only boundary conditions defined on elements (or faces) are handled.
+ *
+ * parameters:
+ *   path  <-- path to mesh file
+ *   fn    <-- CGNS file index
+ *   B     <-- CGNS base index
+ *   Z     <-- CGNS zone index
+ *   BC    <-- CGNS boundary condition index
+ *   gc_id <-- group class id associated with this boundary condition
+ *   name  --> boundary condition name
+ *   faces <-> boundary elements set
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_bc(const char  *path,
+         int          fn,
+         int          B,
+         int          Z,
+         int          BC,
+         int          gc_id,
+         char         name[_CGNS_NAME_SIZE + 1],
+         _elts_t     *faces)
+{
+  CGNS_ENUMT(BCType_t) bc_type;
+  CGNS_ENUMT(PointSetType_t) ptset_type;
+  CGNS_ENUMT(DataType_t) normal_type;
+  CGNS_ENUMT(GridLocation_t) location = CGNS_ENUMV(Vertex);
+  cgsize_t n_pts, normal_list_size;
+  int normal_index[3], n_datasets;
+
+  if (cg_boco_info(fn, B, Z, BC, name, &bc_type, &ptset_type, &n_pts,
+                   normal_index, &normal_list_size, &normal_type,
+                   &n_datasets) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": cg_boco_info() failed:\n%s"),
+              path, cg_get_error());
+
+  if (cg_goto(fn, B, "Zone_t", Z, "ZoneBC_t", 1, "BC_t", BC, "end") == CG_OK)
+    cg_gridlocation_read(&location);
+
+  bool is_range = false;
+
+  switch(ptset_type) {
+  case CGNS_ENUMV(ElementRange):
+    is_range = true;
+    break;
+  case CGNS_ENUMV(ElementList):
+    break;
+  case CGNS_ENUMV(PointRange):
+    is_range = true;
+    /* Fallthrough */
+  case CGNS_ENUMV(PointList):
+    if (location == CGNS_ENUMV(Vertex)) {
+      if (cs_glob_rank_id < 1)
+        bft_printf(_("   boundary condition \"%s\" is defined on vertices;\n"
+                     "   it is ignored by direct import.\n"), name);
+      return;
+    }
+    break;
+  default:
+    return;
+  }
+
+  cgsize_t *pts;
+  double *normals = NULL;
+  BFT_MALLOC(pts, n_pts, cgsize_t);
+  if (normal_list_size > 0)
+    BFT_MALLOC(normals, normal_list_size*3, double);
+
+  if (cg_boco_read(fn, B, Z, BC, pts, normals) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": cg_boco_read() failed:\n%s"),
+              path, cg_get_error());
+
+  BFT_FREE(normals);
+
+  if (is_range && n_pts >= 2) {
+    for (cs_lnum_t i = 0; i < faces->n_elts; i++) {
+      if (   faces->num[i] >= (cs_gnum_t)pts[0]
+          && faces->num[i] <= (cs_gnum_t)pts[1])
+        faces->gc_id[i] = gc_id;
+    }
+  }
+  else if (!is_range) {
+    cs_gnum_t *list;
+    BFT_MALLOC(list, n_pts, cs_gnum_t);
+    for (cgsize_t i = 0; i < n_pts; i++)
+      list[i] = pts[i];
+    qsort(list, n_pts, sizeof(cs_gnum_t), _cmp_gnum);
+    for (cs_lnum_t i = 0; i < faces->n_elts; i++) {
+      if (bsearch(faces->num + i, list, n_pts, sizeof(cs_gnum_t),
+                  _cmp_gnum) != NULL)
+        faces->gc_id[i] = gc_id;
+    }
+    BFT_FREE(list);
+  }
+
+  BFT_FREE(pts);
+}
+
+/*----------------------------------------------------------------------------
+ * Define mesh groups and families.
+ *
+ * Each group defines an associated family; an additional family
+ * is associated with no group.
+ *
+ * parameters:
+ *   mesh     <-> mesh
+ *   n_groups <-- number of groups
+ *   names    <-- group names (with _CGNS_NAME_SIZE + 1 stride)
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_groups(cs_mesh_t   *mesh,
+               int          n_groups,
+               const char   names[])
+{
+  mesh->n_groups = n_groups;
+  BFT_REALLOC(mesh->group_idx, mesh->n_groups + 1, int);
+
+  mesh->group_idx[0] = 0;
+  for (int i = 0; i < n_groups; i++)
+    mesh->group_idx[i+1] =   mesh->group_idx[i]
+                           + strlen(names + i*(_CGNS_NAME_SIZE + 1)) + 1;
+
+  BFT_REALLOC(mesh->group, mesh->group_idx[n_groups], char);
+  for (int i = 0; i < n_groups; i++)
+    strcpy(mesh->group + mesh->group_idx[i],
+           names + i*(_CGNS_NAME_SIZE + 1));
+
+  mesh->n_families = n_groups + 1;
+  mesh->n_max_family_items = 1;
+  BFT_REALLOC(mesh->family_item, mesh->n_families, int);
+  for (int i = 0; i < n_groups; i++)
+    mesh->family_item[i] = -(i+1);
+  mesh->family_item[n_groups] = 0;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be read directly as a CGNS file.
+ *
+ * \param[in]  path  path to mesh file
+ *
+ * \return  true if the file name has a ".cgns" extension, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cgns_is_cgns_file(const char  *path)
+{
+  bool retval = false;
+
+  if (path != NULL) {
+    size_t l = strlen(path);
+    if (l > 5 && strcmp(path + l - 5, ".cgns") == 0)
+      retval = true;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read a CGNS mesh file in parallel.
+ *
+ * Each rank reads a block of the vertices and of each element section,
+ * using partial reads. Faces are built from cells using
+ * \ref cs_mesh_from_cells, so the resulting builder may be directly
+ * partitioned.
+ *
+ * Only meshes with a single unstructured zone are handled. Tetrahedra,
+ * pyramids, prisms and hexahedra (higher order elements are reduced
+ * to their corner vertices) define cells, and triangles and quadrangles
+ * are used to assign groups to the matching boundary faces. Element
+ * section names and element-based boundary conditions define groups.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       path  path to mesh file
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cgns_read(const char         *path,
+                  cs_mesh_t          *mesh,
+                  cs_mesh_builder_t  *mb)
+{
+  bft_printf(_("\n Reading mesh from file \"%s\" (CGNS format):\n"), path);
+
+  int fn;
+  if (cg_open(path, CG_MODE_READ, &fn) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cg_open() failed to open file \"%s\":\n%s"),
+              path, cg_get_error());
+
+  /* Base and zone */
+
+  const int B = 1, Z = 1;
+  int n_bases = 0, n_zones = 0, cell_dim = 0, phys_dim = 0;
+  char base_name[_CGNS_NAME_SIZE + 1], zone_name[_CGNS_NAME_SIZE + 1];
+  CGNS_ENUMT(ZoneType_t) zone_type = CGNS_ENUMV(ZoneTypeNull);
+  cgsize_t zone_size[3] = {0, 0, 0};
+
+  if (cg_nbases(fn, &n_bases) == CG_OK && n_bases > 0)
+    cg_base_read(fn, B, base_name, &cell_dim, &phys_dim);
+  if (cell_dim == 3 && cg_nzones(fn, B, &n_zones) == CG_OK && n_zones == 1)
+    cg_zone_type(fn, B, Z, &zone_type);
+
+  if (zone_type != CGNS_ENUMV(Unstructured))
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": only volume meshes with a single\n"
+                "unstructured zone are handled by direct import;\n"
+                "use the Preprocessor for this mesh."), path);
+
+  if (cg_zone_read(fn, B, Z, zone_name, zone_size) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": cg_zone_read() failed:\n%s"),
+              path, cg_get_error());
+
+  const cs_gnum_t n_g_vertices = zone_size[0];
+
+  /* Element sections; each section and boundary condition defines
+     a group (with matching group class id) */
+
+  int n_sections = 0, n_bcs = 0;
+  cg_nsections(fn, B, Z, &n_sections);
+  cg_nbocos(fn, B, Z, &n_bcs);
+
+  const int n_groups = n_sections + n_bcs;
+  const size_t l_name = _CGNS_NAME_SIZE + 1;
+  char *names;
+  BFT_MALLOC(names, n_groups*l_name, char);
+
+  _elts_t cells = {0, 0, 0, NULL, NULL, NULL, NULL, NULL};
+  _elts_t faces = {0, 0, 0, NULL, NULL, NULL, NULL, NULL};
+
+  for (int S = 1; S <= n_sections; S++)
+    _read_section(path, fn, B, Z, S, S, names + (S-1)*l_name,
+                  &cells, &faces);
+
+  for (int BC = 1; BC <= n_bcs; BC++)
+    _read_bc(path, fn, B, Z, BC, n_sections + BC,
+             names + (n_sections + BC - 1)*l_name, &faces);
+
+  _define_groups(mesh, n_groups, names);
+
+  BFT_FREE(names);
+
+  /* Global cell numbering (in rank order) */
+
+  cs_gnum_t n_g_cells = cells.n_elts;
+  cs_gnum_t c_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_cells = cells.n_elts;
+    MPI_Exscan(&_n_cells, &c_shift, 1, CS_MPI_GNUM, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      c_shift = 0;
+  }
+#endif
+
+  cs_parall_counter(&n_g_cells, 1);
+
+  if (n_g_cells == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": no volume elements found."), path);
+
+  cs_gnum_t *cell_gnum;
+  BFT_MALLOC(cell_gnum, cells.n_elts, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < cells.n_elts; i++)
+    cell_gnum[i] = c_shift + i + 1;
+
+  /* Build faces */
+
+  mesh->n_g_cells = n_g_cells;
+  mesh->n_g_vertices = n_g_vertices;
+
+  cs_mesh_from_cells(mb,
+                     n_g_cells,
+                     n_g_vertices,
+                     cells.n_elts,
+                     cell_gnum,
+                     cells.type,
+                     cells.vtx_idx,
+                     cells.vtx,
+                     faces.n_elts,
+                     faces.vtx_idx,
+                     faces.vtx,
+                     faces.gc_id,
+                     n_groups + 1);
+
+  _free_elts(&faces);
+
+  cs_mesh_from_cells_set_cell_gc_id(mb, cells.n_elts, cell_gnum, cells.gc_id);
+
+  BFT_FREE(cell_gnum);
+  _free_elts(&cells);
+
+  /* Vertex coordinates, read directly on the vertex block distribution */
+
+  const cs_gnum_t v0 = mb->vertex_bi.gnum_range[0];
+  const cs_lnum_t n_vertices = mb->vertex_bi.gnum_range[1] - v0;
+
+  BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_vertices*3; i++)
+    mb->vertex_coords[i] = 0.;
+
+  if (n_vertices > 0) {
+
+    int n_coords = 0;
+    cg_ncoords(fn, B, Z, &n_coords);
+
+    double *buf;
+    BFT_MALLOC(buf, n_vertices, double);
+
+    for (int c = 1; c <= n_coords; c++) {
+
+      CGNS_ENUMT(DataType_t) data_type;
+      char coord_name[_CGNS_NAME_SIZE + 1];
+      cg_coord_info(fn, B, Z, c, &data_type, coord_name);
+
+      int j = -1;
+      if (strcmp(coord_name, "CoordinateX") == 0)
+        j = 0;
+      else if (strcmp(coord_name, "CoordinateY") == 0)
+        j = 1;
+      else if (strcmp(coord_name, "CoordinateZ") == 0)
+        j = 2;
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  _("File \"%s\": coordinates \"%s\" not handled\n"
+                    "by direct import (only Cartesian coordinates are);\n"
+                    "use the Preprocessor for this mesh."), path, coord_name);
+
+      cgsize_t r_min = v0, r_max = v0 + n_vertices - 1;
+      if (cg_coord_read(fn, B, Z, coord_name, CGNS_ENUMV(RealDouble),
+                        &r_min, &r_max, buf) != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("File \"%s\": cg_coord_read() failed:\n%s"),
+                  path, cg_get_error());
+
+      for (cs_lnum_t i = 0; i < n_vertices; i++)
+        mb->vertex_coords[i*3 + j] = buf[i];
+
+    }
+
+    BFT_FREE(buf);
+  }
+
+  cg_close(fn);
+
+  bft_printf(_("   %llu cells, %llu faces, %llu vertices, %d groups\n"),
+             (unsigned long long)(mesh->n_g_cells),
+             (unsigned long long)(mb->n_g_faces),
+             (unsigned long long)(mesh->n_g_vertices),
+             mesh->n_groups);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* HAVE_CGNS */
@@ -0,0 +1,677 @@
+/*============================================================================
+ * Build faces (descending connectivity) from cell-vertex connectivity.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_from_cells.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Face definitions of a cell type (local vertex numbers, outward normal) */
+
+typedef struct {
+
+  int  n_faces;           /* Number of faces */
+  int  n_face_vtx[6];     /* Number of vertices per face */
+  int  face_vtx[6][4];    /* Face vertices (0 to n-1) */
+
+} _cell_faces_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const _cell_faces_t  _tetra_faces
+  = {4, {3, 3, 3, 3},
+     {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}}};
+
+static const _cell_faces_t  _pyram_faces
+  = {5, {3, 3, 3, 3, 4},
+     {{0, 1, 4}, {0, 4, 3}, {1, 2, 4}, {2, 3, 4}, {0, 3, 2, 1}}};
+
+static const _cell_faces_t  _prism_faces
+  = {5, {3, 3, 4, 4, 4},
+     {{0, 2, 1}, {3, 4, 5}, {0, 1, 4, 3}, {0, 3, 5, 2}, {1, 2, 5, 4}}};
+
+static const _cell_faces_t  _hexa_faces
+  = {6, {4, 4, 4, 4, 4, 4},
+     {{0, 3, 2, 1}, {0, 1, 5, 4}, {0, 4, 7, 3},
+      {1, 2, 6, 5}, {2, 3, 7, 6}, {4, 5, 6, 7}}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return the rank associated with a global number in a block distribution.
+ *
+ * parameters:
+ *   bi   <-- block distribution info
+ *   gnum <-- global number (1 to n)
+ *
+ * returns:
+ *   associated block rank
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_block_rank(const cs_block_dist_info_t  *bi,
+            cs_gnum_t                    gnum)
+{
+  return ((gnum - 1) / (cs_gnum_t)(bi->block_size)) * bi->rank_step;
+}
+
+/*----------------------------------------------------------------------------
+ * Return face definitions associated with a cell type.
+ *
+ * parameters:
+ *   type <-- cell type
+ *
+ * returns:
+ *   pointer to matching face definitions
+ *----------------------------------------------------------------------------*/
+
+static const _cell_faces_t *
+_cell_faces(fvm_element_t  type)
+{
+  const _cell_faces_t *cf = NULL;
+
+  switch(type) {
+  case FVM_CELL_TETRA:
+    cf = &_tetra_faces;
+    break;
+  case FVM_CELL_PYRAM:
+    cf = &_pyram_faces;
+    break;
+  case FVM_CELL_PRISM:
+    cf = &_prism_faces;
+    break;
+  case FVM_CELL_HEXA:
+    cf = &_hexa_faces;
+    break;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: element type %s not handled."),
+              __func__, fvm_element_type_name[type]);
+  }
+
+  return cf;
+}
+
+/*----------------------------------------------------------------------------
+ * Sort up to 4 face vertex numbers (0 for missing vertices) in a key.
+ *
+ * parameters:
+ *   v   <-- face vertex numbers
+ *   key --> sorted vertex numbers
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_face_key(const cs_gnum_t  v[4],
+          cs_gnum_t        key[4])
+{
+  for (int i = 0; i < 4; i++) {
+    cs_gnum_t k = v[i];
+    int j = i;
+    while (j > 0 && key[j-1] > k) {
+      key[j] = key[j-1];
+      j--;
+    }
+    key[j] = k;
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build face data of a mesh builder from cell-vertex connectivity.
+ *
+ * Cells may be distributed in any manner across ranks. Their faces are
+ * generated, then sent to a rank determined by their lowest vertex global
+ * number, where matching faces are merged into interior faces. Unmatched
+ * faces are boundary faces, which take the group class of a matching
+ * boundary element when one is provided.
+ *
+ * Cell local vertex numbering follows the usual (Gmsh/EnSight-like)
+ * nodal convention, and cells are assumed to be positively oriented.
+ *
+ * The builder's block distribution is (re)defined, and face connectivity,
+ * face -> cells adjacency and face group class ids are defined on
+ * the face block distribution. Cell group classes and vertex coordinates
+ * are not handled here.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  mb             pointer to mesh builder
+ * \param[in]       n_g_cells      global number of cells
+ * \param[in]       n_g_vertices   global number of vertices
+ * \param[in]       n_cells        local number of cells
+ * \param[in]       cell_gnum      global cell numbers (1 to n)
+ * \param[in]       cell_type      cell types (tetrahedra, pyramids, prisms
+ *                                 or hexahedra)
+ * \param[in]       cell_vtx_idx   cell -> vertices index (size: n_cells + 1)
+ * \param[in]       cell_vtx       cell -> vertices global numbers
+ * \param[in]       n_b_elts       local number of boundary elements
+ * \param[in]       b_elt_vtx_idx  boundary element -> vertices index
+ * \param[in]       b_elt_vtx      boundary element -> vertices global numbers
+ * \param[in]       b_elt_gc_id    boundary element group class ids
+ * \param[in]       default_gc_id  group class id for interior faces and
+ *                                 boundary faces with no matching element
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_from_cells(cs_mesh_builder_t    *mb,
+                   cs_gnum_t             n_g_cells,
+                   cs_gnum_t             n_g_vertices,
+                   cs_lnum_t             n_cells,
+                   const cs_gnum_t       cell_gnum[],
+                   const fvm_element_t   cell_type[],
+                   const cs_lnum_t       cell_vtx_idx[],
+                   const cs_gnum_t       cell_vtx[],
+                   cs_lnum_t             n_b_elts,
+                   const cs_lnum_t       b_elt_vtx_idx[],
+                   const cs_gnum_t       b_elt_vtx[],
+                   const int             b_elt_gc_id[],
+                   int                   default_gc_id)
+{
+  /* Face entries sent to their owner rank:
+     4 vertices (0-padded, oriented), cell number (0 for boundary elements),
+     group class id + 1 (0 for cell faces) */
+
+  const int e_stride = 6;
+
+  cs_mesh_builder_define_block_dist(mb,
+                                    cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    mb->min_rank_step,
+                                    0,
+                                    n_g_cells,
+                                    0,
+                                    n_g_vertices);
+
+  cs_lnum_t n_entries = n_b_elts;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    n_entries += _cell_faces(cell_type[i])->n_faces;
+
+  cs_gnum_t *entries;
+  int *dest_rank;
+  BFT_MALLOC(entries, n_entries*e_stride, cs_gnum_t);
+  BFT_MALLOC(dest_rank, n_entries, int);
+
+  cs_lnum_t e_id = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    const _cell_faces_t *cf = _cell_faces(cell_type[i]);
+    const cs_gnum_t *c_vtx = cell_vtx + cell_vtx_idx[i];
+    for (int j = 0; j < cf->n_faces; j++) {
+      cs_gnum_t *e = entries + e_id*e_stride;
+      for (int k = 0; k < 4; k++)
+        e[k] = (k < cf->n_face_vtx[j]) ? c_vtx[cf->face_vtx[j][k]] : 0;
+      e[4] = cell_gnum[i];
+      e[5] = 0;
+      e_id++;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_b_elts; i++) {
+    cs_gnum_t *e = entries + e_id*e_stride;
+    cs_lnum_t n_vtx = b_elt_vtx_idx[i+1] - b_elt_vtx_idx[i];
+    if (n_vtx > 4)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: boundary elements with more than 4 vertices\n"
+                  "are not handled."), __func__);
+    for (cs_lnum_t k = 0; k < 4; k++)
+      e[k] = (k < n_vtx) ? b_elt_vtx[b_elt_vtx_idx[i] + k] : 0;
+    e[4] = 0;
+    e[5] = b_elt_gc_id[i] + 1;
+    e_id++;
+  }
+
+  /* Faces are handled by the block rank of their lowest vertex */
+
+  for (e_id = 0; e_id < n_entries; e_id++) {
+    const cs_gnum_t *e = entries + e_id*e_stride;
+    cs_gnum_t v_min = e[0];
+    for (int k = 1; k < 4; k++) {
+      if (e[k] > 0 && e[k] < v_min)
+        v_min = e[k];
+    }
+    dest_rank[e_id] = _block_rank(&(mb->vertex_bi), v_min);
+  }
+
+  cs_lnum_t n_recv = 0;
+  cs_gnum_t *recv = cs_mesh_from_cells_exchange(n_entries,
+                                                CS_GNUM_TYPE,
+                                                e_stride,
+                                                dest_rank,
+                                                entries,
+                                                &n_recv);
+
+  BFT_FREE(dest_rank);
+  BFT_FREE(entries);
+
+  /* Order received entries by sorted vertices, then cell number
+     (so boundary elements come first in each matching set) */
+
+  cs_gnum_t *keys;
+  cs_lnum_t *order;
+  BFT_MALLOC(keys, n_recv*5, cs_gnum_t);
+  BFT_MALLOC(order, n_recv, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    _face_key(recv + i*e_stride, keys + i*5);
+    keys[i*5 + 4] = recv[i*e_stride + 4];
+  }
+
+  cs_order_gnum_allocated_s(NULL, keys, 5, order, n_recv);
+
+  /* Merge matching faces: face data is stored as
+     face number (set later), 2 cells, group class id, 4 vertices */
+
+  const int f_stride = 8;
+
+  cs_lnum_t n_faces = 0;
+  cs_gnum_t n_unmatched_b_elts = 0;
+  cs_gnum_t *faces;
+  BFT_MALLOC(faces, n_recv*f_stride, cs_gnum_t);
+
+  cs_lnum_t s_id = 0;
+  while (s_id < n_recv) {
+
+    const cs_gnum_t *k0 = keys + order[s_id]*5;
+    cs_lnum_t e_id_end = s_id + 1;
+    while (e_id_end < n_recv) {
+      const cs_gnum_t *k1 = keys + order[e_id_end]*5;
+      if (   k1[0] != k0[0] || k1[1] != k0[1]
+          || k1[2] != k0[2] || k1[3] != k0[3])
+        break;
+      e_id_end++;
+    }
+
+    int gc_id = default_gc_id;
+    cs_lnum_t c_s_id = s_id;
+    while (c_s_id < e_id_end && recv[order[c_s_id]*e_stride + 4] == 0) {
+      gc_id = recv[order[c_s_id]*e_stride + 5] - 1;
+      c_s_id++;
+    }
+
+    cs_lnum_t n_f_cells = e_id_end - c_s_id;
+
+    if (n_f_cells > 2)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: face with vertices (%llu %llu %llu %llu)\n"
+                  "is shared by more than 2 cells (non-conforming mesh)."),
+                __func__,
+                (unsigned long long)k0[0], (unsigned long long)k0[1],
+                (unsigned long long)k0[2], (unsigned long long)k0[3]);
+
+    else if (n_f_cells == 0)
+      n_unmatched_b_elts += 1;
+
+    else {
+      const cs_gnum_t *e = recv + order[c_s_id]*e_stride;
+      cs_gnum_t *f = faces + n_faces*f_stride;
+      f[0] = 0;
+      f[1] = e[4];
+      if (n_f_cells == 2) {
+        f[2] = recv[order[c_s_id + 1]*e_stride + 4];
+        gc_id = default_gc_id;
+      }
+      else
+        f[2] = 0;
+      f[3] = gc_id;
+      for (int k = 0; k < 4; k++)
+        f[4+k] = e[k];
+      n_faces++;
+    }
+
+    s_id = e_id_end;
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(keys);
+  BFT_FREE(recv);
+
+  /* Global face numbering */
+
+  cs_gnum_t n_g_faces = n_faces;
+  cs_gnum_t f_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_faces = n_faces;
+    MPI_Exscan(&_n_faces, &f_shift, 1, CS_MPI_GNUM, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      f_shift = 0;
+  }
+#endif
+
+  cs_parall_counter(&n_g_faces, 1);
+  cs_parall_counter(&n_unmatched_b_elts, 1);
+
+  if (n_unmatched_b_elts > 0)
+    bft_printf(_("\n  %llu boundary elements not matching any cell face "
+                 "were ignored.\n"),
+               (unsigned long long)n_unmatched_b_elts);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    faces[i*f_stride] = f_shift + i + 1;
+
+  cs_mesh_builder_define_block_dist(mb,
+                                    cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    mb->min_rank_step,
+                                    0,
+                                    n_g_cells,
+                                    n_g_faces,
+                                    n_g_vertices);
+
+  /* Send faces to their block distribution */
+
+  BFT_MALLOC(dest_rank, n_faces, int);
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    dest_rank[i] = _block_rank(&(mb->face_bi), faces[i*f_stride]);
+
+  recv = cs_mesh_from_cells_exchange(n_faces,
+                                     CS_GNUM_TYPE,
+                                     f_stride,
+                                     dest_rank,
+                                     faces,
+                                     &n_recv);
+
+  BFT_FREE(dest_rank);
+  BFT_FREE(faces);
+
+  const cs_lnum_t n_b_faces
+    = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+
+  assert(n_recv == n_b_faces);
+
+  cs_lnum_t *f_n_vtx;
+  const cs_gnum_t **f_recv;
+  BFT_MALLOC(f_n_vtx, n_b_faces, cs_lnum_t);
+  BFT_MALLOC(f_recv, n_b_faces, const cs_gnum_t *);
+
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    const cs_gnum_t *f = recv + i*f_stride;
+    cs_lnum_t f_id = f[0] - mb->face_bi.gnum_range[0];
+    f_recv[f_id] = f;
+    f_n_vtx[f_id] = (f[7] > 0) ? 4 : 3;
+  }
+
+  BFT_REALLOC(mb->face_cells, n_b_faces*2, cs_gnum_t);
+  BFT_REALLOC(mb->face_gc_id, n_b_faces, int);
+  BFT_REALLOC(mb->face_vertices_idx, n_b_faces + 1, cs_lnum_t);
+
+  mb->face_vertices_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_b_faces; i++)
+    mb->face_vertices_idx[i+1] = mb->face_vertices_idx[i] + f_n_vtx[i];
+
+  BFT_REALLOC(mb->face_vertices, mb->face_vertices_idx[n_b_faces], cs_gnum_t);
+
+  cs_gnum_t n_g_face_connect_size = 0;
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    const cs_gnum_t *f = f_recv[i];
+    mb->face_cells[i*2]     = f[1];
+    mb->face_cells[i*2 + 1] = f[2];
+    mb->face_gc_id[i] = f[3];
+    cs_gnum_t *f_vtx = mb->face_vertices + mb->face_vertices_idx[i];
+    for (cs_lnum_t k = 0; k < f_n_vtx[i]; k++)
+      f_vtx[k] = f[4+k];
+    n_g_face_connect_size += f_n_vtx[i];
+  }
+
+  cs_parall_counter(&n_g_face_connect_size, 1);
+
+  mb->n_g_faces = n_g_faces;
+  mb->n_g_face_connect_size = n_g_face_connect_size;
+
+  BFT_FREE(f_recv);
+  BFT_FREE(f_n_vtx);
+  BFT_FREE(recv);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Send strided data to given ranks.
+ *
+ * Received data is ordered by source rank, then by source order.
+ * In serial mode, data is simply copied.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]   n_elts     number of local elements to send
+ * \param[in]   datatype   type of data considered
+ * \param[in]   stride     number of values per element
+ * \param[in]   dest_rank  destination rank for each element
+ * \param[in]   src        values to send (size: n_elts*stride)
+ * \param[out]  n_recv     number of elements received
+ *
+ * \return  newly allocated received values (size: n_recv*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_mesh_from_cells_exchange(cs_lnum_t         n_elts,
+                            cs_datatype_t     datatype,
+                            int               stride,
+                            const int         dest_rank[],
+                            const void       *src,
+                            cs_lnum_t        *n_recv)
+{
+  void *recv = NULL;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create(n_elts,
+                             CS_ALL_TO_ALL_ORDER_BY_SRC_RANK,
+                             NULL,
+                             dest_rank,
+                             cs_glob_mpi_comm);
+
+    recv = cs_all_to_all_copy_array(d,
+                                    datatype,
+                                    stride,
+                                    false, /* reverse */
+                                    src,
+                                    NULL);
+
+    *n_recv = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    return recv;
+  }
+
+#endif
+
+  CS_UNUSED(dest_rank);
+
+  size_t n_bytes = n_elts*stride*cs_datatype_size[datatype];
+
+  BFT_MALLOC(recv, n_bytes, unsigned char);
+  memcpy(recv, src, n_bytes);
+
+  *n_recv = n_elts;
+
+  return recv;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute cell group class ids to a mesh builder.
+ *
+ * The builder's cell block distribution must have been defined
+ * (usually by \ref cs_mesh_from_cells). Cells may be distributed
+ * in any manner across ranks.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  mb          pointer to mesh builder
+ * \param[in]       n_cells     local number of cells
+ * \param[in]       cell_gnum   global cell numbers (1 to n)
+ * \param[in]       cell_gc_id  cell group class ids
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_from_cells_set_cell_gc_id(cs_mesh_builder_t  *mb,
+                                  cs_lnum_t           n_cells,
+                                  const cs_gnum_t     cell_gnum[],
+                                  const int           cell_gc_id[])
+{
+  cs_gnum_t *send;
+  int *dest_rank;
+  BFT_MALLOC(send, n_cells*2, cs_gnum_t);
+  BFT_MALLOC(dest_rank, n_cells, int);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    send[i*2] = cell_gnum[i];
+    send[i*2 + 1] = cell_gc_id[i];
+    dest_rank[i] = _block_rank(&(mb->cell_bi), cell_gnum[i]);
+  }
+
+  cs_lnum_t n_recv = 0;
+  cs_gnum_t *recv = cs_mesh_from_cells_exchange(n_cells,
+                                                CS_GNUM_TYPE,
+                                                2,
+                                                dest_rank,
+                                                send,
+                                                &n_recv);
+
+  BFT_REALLOC(mb->cell_gc_id, n_recv, int);
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    cs_lnum_t c_id = recv[i*2] - mb->cell_bi.gnum_range[0];
+    mb->cell_gc_id[c_id] = recv[i*2 + 1];
+  }
+
+  BFT_FREE(recv);
+  BFT_FREE(dest_rank);
+  BFT_FREE(send);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute vertex coordinates to a mesh builder.
+ *
+ * The builder's vertex block distribution must have been defined
+ * (usually by \ref cs_mesh_from_cells). Vertices may be distributed
+ * in any manner across ranks.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  mb            pointer to mesh builder
+ * \param[in]       n_vertices    local number of vertices
+ * \param[in]       vtx_gnum      global vertex numbers (1 to n)
+ * \param[in]       vtx_coords    vertex coordinates (interlaced)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_from_cells_set_vertex_coords(cs_mesh_builder_t  *mb,
+                                     cs_lnum_t           n_vertices,
+                                     const cs_gnum_t     vtx_gnum[],
+                                     const cs_real_t     vtx_coords[])
+{
+  int *dest_rank;
+  BFT_MALLOC(dest_rank, n_vertices, int);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++)
+    dest_rank[i] = _block_rank(&(mb->vertex_bi), vtx_gnum[i]);
+
+  cs_lnum_t n_recv = 0;
+  cs_gnum_t *recv_gnum = cs_mesh_from_cells_exchange(n_vertices,
+                                                     CS_GNUM_TYPE,
+                                                     1,
+                                                     dest_rank,
+                                                     vtx_gnum,
+                                                     &n_recv);
+  cs_real_t *recv_coords = cs_mesh_from_cells_exchange(n_vertices,
+                                                       CS_REAL_TYPE,
+                                                       3,
+                                                       dest_rank,
+                                                       vtx_coords,
+                                                       &n_recv);
+
+  BFT_REALLOC(mb->vertex_coords, n_recv*3, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    cs_lnum_t v_id = recv_gnum[i] - mb->vertex_bi.gnum_range[0];
+    for (int j = 0; j < 3; j++)
+      mb->vertex_coords[v_id*3 + j] = recv_coords[i*3 + j];
+  }
+
+  BFT_FREE(recv_coords);
+  BFT_FREE(recv_gnum);
+  BFT_FREE(dest_rank);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
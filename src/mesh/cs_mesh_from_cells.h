@@ -0,0 +1,179 @@
+#ifndef __CS_MESH_FROM_CELLS_H__
+#define __CS_MESH_FROM_CELLS_H__
+
+/*============================================================================
+ * Build faces (descending connectivity) from cell-vertex connectivity.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "fvm_defs.h"
+
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build face data of a mesh builder from cell-vertex connectivity.
+ *
+ * Cells may be distributed in any manner across ranks. Their faces are
+ * generated, then sent to a rank determined by their lowest vertex global
+ * number, where matching faces are merged into interior faces. Unmatched
+ * faces are boundary faces, which take the group class of a matching
+ * boundary element when one is provided.
+ *
+ * Cell local vertex numbering follows the usual (Gmsh/EnSight-like)
+ * nodal convention, and cells are assumed to be positively oriented.
+ *
+ * The builder's block distribution is (re)defined, and face connectivity,
+ * face -> cells adjacency and face group class ids are defined on
+ * the face block distribution. Cell group classes and vertex coordinates
+ * are not handled here.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  mb             pointer to mesh builder
+ * \param[in]       n_g_cells      global number of cells
+ * \param[in]       n_g_vertices   global number of vertices
+ * \param[in]       n_cells        local number of cells
+ * \param[in]       cell_gnum      global cell numbers (1 to n)
+ * \param[in]       cell_type      cell types (tetrahedra, pyramids, prisms
+ *                                 or hexahedra)
+ * \param[in]       cell_vtx_idx   cell -> vertices index (size: n_cells + 1)
+ * \param[in]       cell_vtx       cell -> vertices global numbers
+ * \param[in]       n_b_elts       local number of boundary elements
+ * \param[in]       b_elt_vtx_idx  boundary element -> vertices index
+ * \param[in]       b_elt_vtx      boundary element -> vertices global numbers
+ * \param[in]       b_elt_gc_id    boundary element group class ids
+ * \param[in]       default_gc_id  group class id for interior faces and
+ *                                 boundary faces with no matching element
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_from_cells(cs_mesh_builder_t    *mb,
+                   cs_gnum_t             n_g_cells,
+                   cs_gnum_t             n_g_vertices,
+                   cs_lnum_t             n_cells,
+                   const cs_gnum_t       cell_gnum[],
+                   const fvm_element_t   cell_type[],
+                   const cs_lnum_t       cell_vtx_idx[],
+                   const cs_gnum_t       cell_vtx[],
+                   cs_lnum_t             n_b_elts,
+                   const cs_lnum_t       b_elt_vtx_idx[],
+                   const cs_gnum_t       b_elt_vtx[],
+                   const int             b_elt_gc_id[],
+                   int                   default_gc_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Send strided data to given ranks.
+ *
+ * Received data is ordered by source rank, then by source order.
+ * In serial mode, data is simply copied.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]   n_elts     number of local elements to send
+ * \param[in]   datatype   type of data considered
+ * \param[in]   stride     number of values per element
+ * \param[in]   dest_rank  destination rank for each element
+ * \param[in]   src        values to send (size: n_elts*stride)
+ * \param[out]  n_recv     number of elements received
+ *
+ * \return  newly allocated received values (size: n_recv*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_mesh_from_cells_exchange(cs_lnum_t         n_elts,
+                            cs_datatype_t     datatype,
+                            int               stride,
+                            const int         dest_rank[],
+                            const void       *src,
+                            cs_lnum_t        *n_recv);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute cell group class ids to a mesh builder.
+ *
+ * The builder's cell block distribution must have been defined
+ * (usually by \ref cs_mesh_from_cells). Cells may be distributed
+ * in any manner across ranks.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  mb          pointer to mesh builder
+ * \param[in]       n_cells     local number of cells
+ * \param[in]       cell_gnum   global cell numbers (1 to n)
+ * \param[in]       cell_gc_id  cell group class ids
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_from_cells_set_cell_gc_id(cs_mesh_builder_t  *mb,
+                                  cs_lnum_t           n_cells,
+                                  const cs_gnum_t     cell_gnum[],
+                                  const int           cell_gc_id[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute vertex coordinates to a mesh builder.
+ *
+ * The builder's vertex block distribution must have been defined
+ * (usually by \ref cs_mesh_from_cells). Vertices may be distributed
+ * in any manner across ranks.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  mb            pointer to mesh builder
+ * \param[in]       n_vertices    local number of vertices
+ * \param[in]       vtx_gnum      global vertex numbers (1 to n)
+ * \param[in]       vtx_coords    vertex coordinates (interlaced)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_from_cells_set_vertex_coords(cs_mesh_builder_t  *mb,
+                                     cs_lnum_t           n_vertices,
+                                     const cs_gnum_t     vtx_gnum[],
+                                     const cs_real_t     vtx_coords[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_FROM_CELLS_H__ */
@@ -0,0 +1,944 @@
+/*============================================================================
+ * Direct parallel import of Gmsh mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+
+#include "cs_file.h"
+#include "cs_parall.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_cells.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_gmsh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#define _READ_BLOCK_SIZE 65536
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* File sections */
+
+typedef enum {
+
+  _MESH_FORMAT,
+  _PHYSICAL_NAMES,
+  _END_PHYSICAL_NAMES,
+  _NODES,
+  _END_NODES,
+  _ELEMENTS,
+  _END_ELEMENTS,
+  _N_SECTIONS
+
+} _section_t;
+
+/* Portion of file read by the local rank */
+
+typedef struct {
+
+  cs_file_off_t   start;      /* Start of owned range (lines starting in
+                                 [start, end[ are owned by this rank) */
+  cs_file_off_t   end;        /* Past-the-end of owned range */
+  cs_file_off_t   buf_start;  /* File offset of buffer start */
+  size_t          first;      /* Position of first owned line in buffer */
+  size_t          size;       /* Buffer size */
+  char           *buf;        /* Buffer (null-terminated) */
+
+} _chunk_t;
+
+/* Elements read by the local rank */
+
+typedef struct {
+
+  cs_lnum_t       n_elts;     /* Number of elements */
+  cs_lnum_t       n_max;      /* Allocated number of elements */
+  cs_lnum_t       vtx_max;    /* Allocated size of vertex connectivity */
+  fvm_element_t  *type;       /* Element types */
+  int            *tag;        /* Physical tags */
+  cs_lnum_t      *vtx_idx;    /* Element -> vertices index */
+  cs_gnum_t      *vtx;        /* Element -> vertices global numbers */
+
+} _elts_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char *_section_name[] = {"$MeshFormat",
+                                      "$PhysicalNames",
+                                      "$EndPhysicalNames",
+                                      "$Nodes",
+                                      "$EndNodes",
+                                      "$Elements",
+                                      "$EndElements"};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compare global numbers (qsort function).
+ *
+ * parameters:
+ *   x <-> pointer to first value
+ *   y <-> pointer to second value
+ *
+ * returns:
+ *   -1 if x < y, 0 if x == y, 1 if x > y
+ *----------------------------------------------------------------------------*/
+
+static int
+_cmp_gnum(const void  *x,
+          const void  *y)
+{
+  cs_gnum_t a = *(const cs_gnum_t *)x, b = *(const cs_gnum_t *)y;
+
+  if (a < b)
+    return -1;
+  else if (a > b)
+    return 1;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Sort an array of global numbers and remove duplicates.
+ *
+ * parameters:
+ *   n    <-- number of values
+ *   vals <-> values
+ *
+ * returns:
+ *   number of unique values
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_sort_unique(cs_lnum_t   n,
+             cs_gnum_t   vals[])
+{
+  if (n < 2)
+    return n;
+
+  qsort(vals, n, sizeof(cs_gnum_t), _cmp_gnum);
+
+  cs_lnum_t j = 1;
+  for (cs_lnum_t i = 1; i < n; i++) {
+    if (vals[i] != vals[j-1])
+      vals[j++] = vals[i];
+  }
+
+  return j;
+}
+
+/*----------------------------------------------------------------------------
+ * Gather data from all ranks to all ranks.
+ *
+ * parameters:
+ *   n        <-- local number of values
+ *   datatype <-- type of data considered
+ *   vals     <-- local values
+ *   n_tot    --> total number of values
+ *
+ * returns:
+ *   newly allocated array of values from all ranks
+ *----------------------------------------------------------------------------*/
+
+static void *
+_allgather(cs_lnum_t       n,
+           cs_datatype_t   datatype,
+           const void     *vals,
+           cs_lnum_t      *n_tot)
+{
+  unsigned char *g_vals = NULL;
+  size_t d_size = cs_datatype_size[datatype];
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int *count, *displ;
+    BFT_MALLOC(count, cs_glob_n_ranks, int);
+    BFT_MALLOC(displ, cs_glob_n_ranks, int);
+
+    int _n = n*d_size;
+    MPI_Allgather(&_n, 1, MPI_INT, count, 1, MPI_INT, cs_glob_mpi_comm);
+
+    displ[0] = 0;
+    for (int i = 1; i < cs_glob_n_ranks; i++)
+      displ[i] = displ[i-1] + count[i-1];
+
+    size_t n_bytes = displ[cs_glob_n_ranks-1] + count[cs_glob_n_ranks-1];
+    BFT_MALLOC(g_vals, n_bytes, unsigned char);
+
+    MPI_Allgatherv(vals, _n, MPI_BYTE, g_vals, count, displ, MPI_BYTE,
+                   cs_glob_mpi_comm);
+
+    *n_tot = n_bytes / d_size;
+
+    BFT_FREE(displ);
+    BFT_FREE(count);
+
+    return g_vals;
+  }
+
+#endif
+
+  BFT_MALLOC(g_vals, n*d_size, unsigned char);
+  memcpy(g_vals, vals, n*d_size);
+
+  *n_tot = n;
+
+  return g_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Read the portion of a file associated with the local rank.
+ *
+ * The file is split into contiguous byte ranges; a line belongs to the
+ * rank whose range contains its first byte, and the buffer is extended
+ * so as to contain complete owned lines.
+ *
+ * parameters:
+ *   path      <-- file path
+ *   file_size <-- file size
+ *   c         --> file chunk
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_chunk(const char     *path,
+            cs_file_off_t   file_size,
+            _chunk_t       *c)
+{
+  const cs_file_off_t rank_id = CS_MAX(cs_glob_rank_id, 0);
+  const cs_file_off_t n_ranks = cs_glob_n_ranks;
+
+  c->start = (file_size * rank_id) / n_ranks;
+  c->end = (file_size * (rank_id + 1)) / n_ranks;
+  c->buf_start = (c->start > 0) ? c->start - 1 : 0;
+  c->size = c->end - c->buf_start;
+
+  size_t buf_max = c->size + 1;
+  BFT_MALLOC(c->buf, buf_max, char);
+
+#if defined(HAVE_MPI)
+  cs_file_t *f = cs_file_open(path,
+                              CS_FILE_MODE_READ,
+                              CS_FILE_STDIO_SERIAL,
+                              MPI_INFO_NULL,
+                              MPI_COMM_NULL,
+                              MPI_COMM_NULL);
+#else
+  cs_file_t *f = cs_file_open(path,
+                              CS_FILE_MODE_READ,
+                              CS_FILE_STDIO_SERIAL);
+#endif
+
+  cs_file_seek(f, c->buf_start, CS_FILE_SEEK_SET);
+
+  if (c->size > 0)
+    cs_file_read_global(f, c->buf, 1, c->size);
+
+  /* Extend buffer to the end of the last owned line */
+
+  while (   c->size > 0 && c->buf[c->size - 1] != '\n'
+         && c->buf_start + (cs_file_off_t)(c->size) < file_size) {
+    size_t n_add = CS_MIN(_READ_BLOCK_SIZE,
+                          file_size - c->buf_start - c->size);
+    if (c->size + n_add + 1 > buf_max) {
+      buf_max = CS_MAX(buf_max*2, c->size + n_add + 1);
+      BFT_REALLOC(c->buf, buf_max, char);
+    }
+    cs_file_read_global(f, c->buf + c->size, 1, n_add);
+    char *p = memchr(c->buf + c->size, '\n', n_add);
+    c->size += (p != NULL) ? (size_t)(p - (c->buf + c->size)) + 1 : n_add;
+    if (p != NULL)
+      cs_file_seek(f, c->buf_start + c->size, CS_FILE_SEEK_SET);
+  }
+
+  c->buf[c->size] = '\0';
+
+  cs_file_free(f);
+
+  /* First owned line */
+
+  c->first = c->start - c->buf_start;
+
+  if (c->start > 0 && c->buf[0] != '\n') {
+    char *p = memchr(c->buf, '\n', c->size);
+    c->first = (p != NULL) ? (size_t)(p - c->buf) + 1 : c->size;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the position of the next line in a file chunk.
+ *
+ * parameters:
+ *   c <-- file chunk
+ *   i <-- position of current line
+ *
+ * returns:
+ *   position of next line
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_next_line(const _chunk_t  *c,
+           size_t           i)
+{
+  const char *p = memchr(c->buf + i, '\n', c->size - i);
+  return (p != NULL) ? (size_t)(p - c->buf) + 1 : c->size;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a line matches a given section keyword.
+ *
+ * parameters:
+ *   line <-- line
+ *   name <-- section keyword
+ *
+ * returns:
+ *   true if line matches keyword
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_section(const char  *line,
+            const char  *name)
+{
+  size_t l = strlen(name);
+
+  if (strncmp(line, name, l) == 0) {
+    if (line[l] == '\0' || isspace(line[l]))
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a line contains a single token (element or node count line).
+ *
+ * parameters:
+ *   line <-- line
+ *
+ * returns:
+ *   true if line contains a single token
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_count_line(const char  *line)
+{
+  const char *p = line;
+
+  while (*p == ' ' || *p == '\t')
+    p++;
+  while (*p != '\0' && !isspace(*p))
+    p++;
+  while (*p == ' ' || *p == '\t' || *p == '\r')
+    p++;
+
+  return (*p == '\n' || *p == '\0');
+}
+
+/*----------------------------------------------------------------------------
+ * Add an element to an element set.
+ *
+ * parameters:
+ *   e     <-> element set
+ *   type  <-- element type
+ *   tag   <-- physical tag
+ *   n_vtx <-- number of vertices
+ *   vtx   <-- vertex global numbers
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_elt(_elts_t          *e,
+         fvm_element_t     type,
+         int               tag,
+         int               n_vtx,
+         const cs_gnum_t   vtx[])
+{
+  if (e->n_elts >= e->n_max) {
+    e->n_max = CS_MAX(e->n_max*2, 16);
+    BFT_REALLOC(e->type, e->n_max, fvm_element_t);
+    BFT_REALLOC(e->tag, e->n_max, int);
+    BFT_REALLOC(e->vtx_idx, e->n_max + 1, cs_lnum_t);
+    if (e->n_elts == 0)
+      e->vtx_idx[0] = 0;
+  }
+
+  cs_lnum_t s_id = e->vtx_idx[e->n_elts];
+
+  if (s_id + n_vtx > e->vtx_max) {
+    e->vtx_max = CS_MAX(e->vtx_max*2, s_id + n_vtx);
+    BFT_REALLOC(e->vtx, e->vtx_max, cs_gnum_t);
+  }
+
+  e->type[e->n_elts] = type;
+  e->tag[e->n_elts] = tag;
+  for (int i = 0; i < n_vtx; i++)
+    e->vtx[s_id + i] = vtx[i];
+  e->vtx_idx[e->n_elts + 1] = s_id + n_vtx;
+
+  e->n_elts += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Free an element set.
+ *
+ * parameters:
+ *   e <-> element set
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_elts(_elts_t  *e)
+{
+  BFT_FREE(e->type);
+  BFT_FREE(e->tag);
+  BFT_FREE(e->vtx_idx);
+  BFT_FREE(e->vtx);
+}
+
+/*----------------------------------------------------------------------------
+ * Parse an element line.
+ *
+ * parameters:
+ *   line  <-- line
+ *   cells <-> cells set
+ *   faces <-> boundary elements set
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_element(const char  *line,
+               _elts_t     *cells,
+               _elts_t     *faces)
+{
+  char *p;
+  cs_gnum_t vtx[8];
+
+  strtoull(line, &p, 10);
+  int type = strtol(p, &p, 10);
+  int n_tags = strtol(p, &p, 10);
+  int tag = 0;
+
+  for (int i = 0; i < n_tags; i++) {
+    int t = strtol(p, &p, 10);
+    if (i == 0)
+      tag = t;
+  }
+
+  fvm_element_t fvm_type = FVM_N_ELEMENT_TYPES;
+  int n_vtx = 0;
+
+  switch(type) {
+  case 2:
+    fvm_type = FVM_FACE_TRIA;
+    n_vtx = 3;
+    break;
+  case 3:
+    fvm_type = FVM_FACE_QUAD;
+    n_vtx = 4;
+    break;
+  case 4:
+    fvm_type = FVM_CELL_TETRA;
+    n_vtx = 4;
+    break;
+  case 5:
+    fvm_type = FVM_CELL_HEXA;
+    n_vtx = 8;
+    break;
+  case 6:
+    fvm_type = FVM_CELL_PRISM;
+    n_vtx = 6;
+    break;
+  case 7:
+    fvm_type = FVM_CELL_PYRAM;
+    n_vtx = 5;
+    break;
+  case 1:  /* 2-node line */
+  case 15: /* 1-node point */
+    return;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh element type %d not handled by direct import;\n"
+                "use the Preprocessor for this mesh."), type);
+  }
+
+  for (int i = 0; i < n_vtx; i++)
+    vtx[i] = strtoull(p, &p, 10);
+
+  if (fvm_type == FVM_FACE_TRIA || fvm_type == FVM_FACE_QUAD)
+    _add_elt(faces, fvm_type, tag, n_vtx, vtx);
+  else
+    _add_elt(cells, fvm_type, tag, n_vtx, vtx);
+}
+
+/*----------------------------------------------------------------------------
+ * Return group class id (1 to n) associated with a physical group.
+ *
+ * parameters:
+ *   n_keys <-- number of physical group keys
+ *   keys   <-- sorted physical group keys
+ *   dim    <-- dimension of physical group
+ *   tag    <-- physical tag
+ *
+ * returns:
+ *   group class id, or n_keys + 1 for elements with no group
+ *----------------------------------------------------------------------------*/
+
+static int
+_gc_id(cs_lnum_t        n_keys,
+       const cs_gnum_t  keys[],
+       int              dim,
+       int              tag)
+{
+  if (tag > 0) {
+    cs_gnum_t k = ((cs_gnum_t)tag << 2) | (cs_gnum_t)dim;
+    const cs_gnum_t *p = bsearch(&k, keys, n_keys, sizeof(cs_gnum_t),
+                                 _cmp_gnum);
+    if (p != NULL)
+      return (p - keys) + 1;
+  }
+
+  return n_keys + 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Define mesh groups and families from physical groups.
+ *
+ * Each physical group (dimension and tag) defines a group and an
+ * associated family; an additional family is associated with no group.
+ *
+ * parameters:
+ *   mesh        <-> mesh
+ *   n_keys      <-- number of physical group keys
+ *   keys        <-- sorted physical group keys
+ *   names_size  <-- size of physical names buffer
+ *   names       <-- physical names buffer ("dim tag name" lines)
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_groups(cs_mesh_t        *mesh,
+               cs_lnum_t         n_keys,
+               const cs_gnum_t   keys[],
+               cs_lnum_t         names_size,
+               const char        names[])
+{
+  mesh->n_groups = n_keys;
+  BFT_REALLOC(mesh->group_idx, mesh->n_groups + 1, int);
+  mesh->group_idx[0] = 0;
+
+  size_t group_max = 16;
+  BFT_REALLOC(mesh->group, group_max, char);
+
+  for (cs_lnum_t i = 0; i < n_keys; i++) {
+
+    int dim = keys[i] & 3;
+    int tag = keys[i] >> 2;
+
+    char name[128];
+    snprintf(name, 127, "%d", tag);
+    name[127] = '\0';
+
+    /* Search for physical name */
+
+    const char *p = names;
+    while (p < names + names_size) {
+      char *q;
+      int n_dim = strtol(p, &q, 10);
+      int n_tag = strtol(q, &q, 10);
+      while (*q == ' ')
+        q++;
+      const char *e = memchr(q, '\n', names + names_size - q);
+      if (e == NULL)
+        e = names + names_size;
+      if (n_dim == dim && n_tag == tag) {
+        size_t l = CS_MIN(e - q, 127);
+        memcpy(name, q, l);
+        name[l] = '\0';
+      }
+      p = e + 1;
+    }
+
+    size_t s_id = mesh->group_idx[i];
+    size_t l = strlen(name) + 1;
+    if (s_id + l > group_max) {
+      group_max = CS_MAX(group_max*2, s_id + l);
+      BFT_REALLOC(mesh->group, group_max, char);
+    }
+    memcpy(mesh->group + s_id, name, l);
+    mesh->group_idx[i+1] = s_id + l;
+
+  }
+
+  mesh->n_families = n_keys + 1;
+  mesh->n_max_family_items = 1;
+  BFT_REALLOC(mesh->family_item, mesh->n_families, int);
+  for (int i = 0; i < n_keys; i++)
+    mesh->family_item[i] = -(i+1);
+  mesh->family_item[n_keys] = 0;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be read directly as a Gmsh file.
+ *
+ * \param[in]  path  path to mesh file
+ *
+ * \return  true if the file name has a ".msh" extension, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_gmsh_is_gmsh_file(const char  *path)
+{
+  bool retval = false;
+
+  if (path != NULL) {
+    size_t l = strlen(path);
+    if (l > 4 && strcmp(path + l - 4, ".msh") == 0)
+      retval = true;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read a Gmsh (version 2 ASCII) mesh file in parallel.
+ *
+ * Each rank reads and parses a contiguous portion of the file, and
+ * data is then sent to the mesh builder's block distribution. Faces
+ * are built from cells using \ref cs_mesh_from_cells, so the resulting
+ * builder may be directly partitioned.
+ *
+ * Linear tetrahedra, pyramids, prisms and hexahedra are handled, and
+ * triangle and quadrangle elements are used to assign groups to the
+ * matching boundary faces. Physical entities are converted to groups.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       path  path to mesh file
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_read(const char         *path,
+                  cs_mesh_t          *mesh,
+                  cs_mesh_builder_t  *mb)
+{
+  bft_printf(_("\n Reading mesh from file \"%s\" (Gmsh format):\n"), path);
+
+  if (cs_file_isreg(path) == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh file \"%s\" not found."), path);
+
+  cs_file_off_t file_size = cs_file_size(path);
+
+  _chunk_t c;
+  _read_chunk(path, file_size, &c);
+
+  /* Locate sections */
+
+  cs_gnum_t s_off[_N_SECTIONS];
+  for (int i = 0; i < _N_SECTIONS; i++)
+    s_off[i] = 0;
+
+  for (size_t i = c.first;
+       i < c.size && c.buf_start + (cs_file_off_t)i < c.end;
+       i = _next_line(&c, i)) {
+    if (c.buf[i] == '$') {
+      for (int j = 0; j < _N_SECTIONS; j++) {
+        if (_is_section(c.buf + i, _section_name[j]))
+          s_off[j] = c.buf_start + i + 1;
+      }
+    }
+  }
+
+  cs_parall_max(_N_SECTIONS, CS_GNUM_TYPE, s_off);
+
+  if (   s_off[_MESH_FORMAT] == 0 || s_off[_NODES] == 0
+      || s_off[_END_NODES] == 0 || s_off[_ELEMENTS] == 0
+      || s_off[_END_ELEMENTS] == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\" does not seem to be a Gmsh version 2\n"
+                "mesh file (required sections not found)."), path);
+
+  /* Parse owned lines */
+
+  int version[2] = {0, -1}; /* 10*version, file type */
+
+  cs_lnum_t n_nodes = 0, n_max_nodes = 0;
+  cs_gnum_t *node_gnum = NULL;
+  cs_real_t *node_coords = NULL;
+
+  _elts_t cells = {0, 0, 0, NULL, NULL, NULL, NULL};
+  _elts_t faces = {0, 0, 0, NULL, NULL, NULL, NULL};
+
+  size_t names_size = 0;
+  char *names = NULL;
+
+  for (size_t i = c.first;
+       i < c.size && c.buf_start + (cs_file_off_t)i < c.end;
+       i = _next_line(&c, i)) {
+
+    const char *line = c.buf + i;
+    cs_gnum_t off = c.buf_start + i + 1;
+
+    if (line[0] == '$')
+      continue;
+
+    /* Format line (following "$MeshFormat") */
+
+    if (off > s_off[_MESH_FORMAT] && off < s_off[_MESH_FORMAT] + 14) {
+      char *p;
+      double v = strtod(line, &p);
+      version[0] = v*10 + 0.5;
+      version[1] = strtol(p, &p, 10);
+    }
+
+    /* Physical names */
+
+    else if (off > s_off[_PHYSICAL_NAMES] && off < s_off[_END_PHYSICAL_NAMES]) {
+      if (_is_count_line(line))
+        continue;
+      char *p;
+      int dim = strtol(line, &p, 10);
+      int tag = strtol(p, &p, 10);
+      char *q0 = strchr(p, '"');
+      char *q1 = (q0 != NULL) ? strchr(q0 + 1, '"') : NULL;
+      if (q1 == NULL)
+        continue;
+      size_t l = q1 - q0 - 1;
+      BFT_REALLOC(names, names_size + l + 32, char);
+      names_size += sprintf(names + names_size, "%d %d ", dim, tag);
+      memcpy(names + names_size, q0 + 1, l);
+      names_size += l;
+      names[names_size++] = '\n';
+    }
+
+    /* Nodes */
+
+    else if (off > s_off[_NODES] && off < s_off[_END_NODES]) {
+      if (_is_count_line(line))
+        continue;
+      if (n_nodes >= n_max_nodes) {
+        n_max_nodes = CS_MAX(n_max_nodes*2, 16);
+        BFT_REALLOC(node_gnum, n_max_nodes, cs_gnum_t);
+        BFT_REALLOC(node_coords, n_max_nodes*3, cs_real_t);
+      }
+      char *p;
+      node_gnum[n_nodes] = strtoull(line, &p, 10);
+      for (int j = 0; j < 3; j++)
+        node_coords[n_nodes*3 + j] = strtod(p, &p);
+      n_nodes++;
+    }
+
+    /* Elements */
+
+    else if (off > s_off[_ELEMENTS] && off < s_off[_END_ELEMENTS]) {
+      if (_is_count_line(line))
+        continue;
+      _parse_element(line, &cells, &faces);
+    }
+
+  }
+
+  BFT_FREE(c.buf);
+
+  cs_parall_max(2, CS_INT_TYPE, version);
+
+  if (version[0] < 20 || version[0] >= 30 || version[1] != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": only Gmsh version 2 ASCII files\n"
+                "are handled by direct import;\n"
+                "use the Preprocessor for this mesh."), path);
+
+  /* Global counts and numbering */
+
+  cs_gnum_t n_g_vertices = 0, n_g_nodes = n_nodes;
+  for (cs_lnum_t i = 0; i < n_nodes; i++)
+    n_g_vertices = CS_MAX(n_g_vertices, node_gnum[i]);
+
+  cs_parall_max(1, CS_GNUM_TYPE, &n_g_vertices);
+  cs_parall_counter(&n_g_nodes, 1);
+
+  if (n_g_nodes != n_g_vertices)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": non-contiguous node numbering\n"
+                "is not handled by direct import;\n"
+                "use the Preprocessor for this mesh."), path);
+
+  cs_gnum_t n_g_cells = cells.n_elts;
+  cs_gnum_t c_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_cells = cells.n_elts;
+    MPI_Exscan(&_n_cells, &c_shift, 1, CS_MPI_GNUM, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      c_shift = 0;
+  }
+#endif
+
+  cs_parall_counter(&n_g_cells, 1);
+
+  cs_gnum_t *cell_gnum;
+  BFT_MALLOC(cell_gnum, cells.n_elts, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < cells.n_elts; i++)
+    cell_gnum[i] = c_shift + i + 1;
+
+  /* Groups and families */
+
+  cs_lnum_t n_keys = 0;
+  cs_gnum_t *keys = NULL;
+
+  {
+    cs_gnum_t *l_keys;
+    BFT_MALLOC(l_keys, cells.n_elts + faces.n_elts, cs_gnum_t);
+    cs_lnum_t n_l_keys = 0;
+    for (cs_lnum_t i = 0; i < cells.n_elts; i++) {
+      if (cells.tag[i] > 0)
+        l_keys[n_l_keys++] = ((cs_gnum_t)cells.tag[i] << 2) | 3;
+    }
+    for (cs_lnum_t i = 0; i < faces.n_elts; i++) {
+      if (faces.tag[i] > 0)
+        l_keys[n_l_keys++] = ((cs_gnum_t)faces.tag[i] << 2) | 2;
+    }
+    n_l_keys = _sort_unique(n_l_keys, l_keys);
+    keys = _allgather(n_l_keys, CS_GNUM_TYPE, l_keys, &n_keys);
+    n_keys = _sort_unique(n_keys, keys);
+    BFT_FREE(l_keys);
+
+    cs_lnum_t g_names_size = 0;
+    char *g_names = _allgather(names_size, CS_CHAR, names, &g_names_size);
+    _define_groups(mesh, n_keys, keys, g_names_size, g_names);
+    BFT_FREE(g_names);
+    BFT_FREE(names);
+  }
+
+  /* Build faces */
+
+  mesh->n_g_cells = n_g_cells;
+  mesh->n_g_vertices = n_g_vertices;
+
+  int *b_elt_gc_id;
+  BFT_MALLOC(b_elt_gc_id, faces.n_elts, int);
+  for (cs_lnum_t i = 0; i < faces.n_elts; i++)
+    b_elt_gc_id[i] = _gc_id(n_keys, keys, 2, faces.tag[i]);
+
+  cs_mesh_from_cells(mb,
+                     n_g_cells,
+                     n_g_vertices,
+                     cells.n_elts,
+                     cell_gnum,
+                     cells.type,
+                     cells.vtx_idx,
+                     cells.vtx,
+                     faces.n_elts,
+                     faces.vtx_idx,
+                     faces.vtx,
+                     b_elt_gc_id,
+                     n_keys + 1);
+
+  BFT_FREE(b_elt_gc_id);
+  _free_elts(&faces);
+
+  /* Cell group classes */
+
+  {
+    int *cell_gc_id;
+    BFT_MALLOC(cell_gc_id, cells.n_elts, int);
+    for (cs_lnum_t i = 0; i < cells.n_elts; i++)
+      cell_gc_id[i] = _gc_id(n_keys, keys, 3, cells.tag[i]);
+
+    cs_mesh_from_cells_set_cell_gc_id(mb, cells.n_elts, cell_gnum, cell_gc_id);
+
+    BFT_FREE(cell_gc_id);
+  }
+
+  BFT_FREE(cell_gnum);
+  BFT_FREE(keys);
+  _free_elts(&cells);
+
+  /* Vertex coordinates */
+
+  cs_mesh_from_cells_set_vertex_coords(mb, n_nodes, node_gnum, node_coords);
+
+  BFT_FREE(node_coords);
+  BFT_FREE(node_gnum);
+
+  bft_printf(_("   %llu cells, %llu faces, %llu vertices, %d groups\n"),
+             (unsigned long long)(mesh->n_g_cells),
+             (unsigned long long)(mb->n_g_faces),
+             (unsigned long long)(mesh->n_g_vertices),
+             mesh->n_groups);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
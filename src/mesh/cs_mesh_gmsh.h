@@ -0,0 +1,90 @@
+#ifndef __CS_MESH_GMSH_H__
+#define __CS_MESH_GMSH_H__
+
+/*============================================================================
+ * Direct parallel import of Gmsh mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be read directly as a Gmsh file.
+ *
+ * \param[in]  path  path to mesh file
+ *
+ * \return  true if the file name has a ".msh" extension, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_gmsh_is_gmsh_file(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read a Gmsh (version 2 ASCII) mesh file in parallel.
+ *
+ * Each rank reads and parses a contiguous portion of the file, and
+ * data is then sent to the mesh builder's block distribution. Faces
+ * are built from cells using \ref cs_mesh_from_cells, so the resulting
+ * builder may be directly partitioned.
+ *
+ * Linear tetrahedra, pyramids, prisms and hexahedra are handled, and
+ * triangle and quadrangle elements are used to assign groups to the
+ * matching boundary faces. Physical entities are converted to groups.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       path  path to mesh file
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_read(const char         *path,
+                  cs_mesh_t          *mesh,
+                  cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_GMSH_H__ */
@@ -0,0 +1,745 @@
+/*============================================================================
+ * Direct parallel import of MED mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MED)
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * MED library headers
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include <med.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+
+#include "cs_file.h"
+#include "cs_parall.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_cells.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_med.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Elements read by the local rank */
+
+typedef struct {
+
+  cs_lnum_t       n_elts;     /* Number of elements */
+  cs_lnum_t       n_max;      /* Allocated number of elements */
+  cs_lnum_t       vtx_max;    /* Allocated size of vertex connectivity */
+  fvm_element_t  *type;       /* Element types */
+  med_int        *family;     /* MED family numbers */
+  cs_lnum_t      *vtx_idx;    /* Element -> vertices index */
+  cs_gnum_t      *vtx;        /* Element -> vertices global numbers */
+
+} _elts_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Handled MED element types, with matching element type and
+   vertex permutation (1 to n) to the local numbering of \ref fvm_nodal;
+   higher order elements are reduced to their corner vertices, which
+   come first in the MED numbering */
+
+static const int _n_med_types = 14;
+
+static const med_geometry_type _med_type[] = {MED_TRIA3,
+                                              MED_TRIA6,
+                                              MED_QUAD4,
+                                              MED_QUAD8,
+                                              MED_QUAD9,
+                                              MED_TETRA4,
+                                              MED_TETRA10,
+                                              MED_PYRA5,
+                                              MED_PYRA13,
+                                              MED_PENTA6,
+                                              MED_PENTA15,
+                                              MED_HEXA8,
+                                              MED_HEXA20,
+                                              MED_HEXA27};
+
+static const fvm_element_t _fvm_type[] = {FVM_FACE_TRIA,
+                                          FVM_FACE_TRIA,
+                                          FVM_FACE_QUAD,
+                                          FVM_FACE_QUAD,
+                                          FVM_FACE_QUAD,
+                                          FVM_CELL_TETRA,
+                                          FVM_CELL_TETRA,
+                                          FVM_CELL_PYRAM,
+                                          FVM_CELL_PYRAM,
+                                          FVM_CELL_PRISM,
+                                          FVM_CELL_PRISM,
+                                          FVM_CELL_HEXA,
+                                          FVM_CELL_HEXA,
+                                          FVM_CELL_HEXA};
+
+static const int _tria_vtx[] = {1, 2, 3};
+static const int _quad_vtx[] = {1, 2, 3, 4};
+static const int _tetra_vtx[] = {1, 3, 2, 4};
+static const int _pyram_vtx[] = {1, 4, 3, 2, 5};
+static const int _prism_vtx[] = {1, 3, 2, 4, 6, 5};
+static const int _hexa_vtx[] = {1, 4, 3, 2, 5, 8, 7, 6};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the portion of a set of entities read by the local rank.
+ *
+ * parameters:
+ *   n     <-- global number of entities
+ *   start --> first entity read (0 to n-1)
+ *   end   --> past-the-end entity read
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_range(cs_gnum_t   n,
+             cs_gnum_t  *start,
+             cs_gnum_t  *end)
+{
+  cs_gnum_t n_ranks = cs_glob_n_ranks;
+  cs_gnum_t rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_gnum_t q = n / n_ranks, r = n % n_ranks;
+
+  *start = q*rank_id + CS_MIN(rank_id, r);
+  *end = *start + q + ((rank_id < r) ? 1 : 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the vertex permutation associated with an element type.
+ *
+ * parameters:
+ *   type <-- element type
+ *
+ * returns:
+ *   MED vertex (1 to n) for each local vertex
+ *----------------------------------------------------------------------------*/
+
+static const int *
+_vertex_permutation(fvm_element_t  type)
+{
+  switch(type) {
+  case FVM_FACE_TRIA:
+    return _tria_vtx;
+  case FVM_FACE_QUAD:
+    return _quad_vtx;
+  case FVM_CELL_TETRA:
+    return _tetra_vtx;
+  case FVM_CELL_PYRAM:
+    return _pyram_vtx;
+  case FVM_CELL_PRISM:
+    return _prism_vtx;
+  default:
+    return _hexa_vtx;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create a block filter for the local portion of a set of entities.
+ *
+ * parameters:
+ *   path           <-- path to mesh file
+ *   fid            <-- MED file id
+ *   n              <-- global number of entities
+ *   n_constituents <-- number of values per entity
+ *   start          <-- first entity read (0 to n-1), ignored if
+ *                      n_block = 0
+ *   n_block        <-- number of entities read by the local rank
+ *   filter         <-> filter
+ *----------------------------------------------------------------------------*/
+
+static void
+_filter_create(const char  *path,
+               med_idt      fid,
+               cs_gnum_t    n,
+               int          n_constituents,
+               cs_gnum_t    start,
+               cs_gnum_t    n_block,
+               med_filter  *filter)
+{
+  med_int count = (n_block > 0) ? 1 : 0;
+  cs_gnum_t _start = (n_block > 0) ? start + 1 : 1;
+
+  med_err retval = MEDfilterBlockOfEntityCr(fid,
+                                            n,
+                                            1,
+                                            n_constituents,
+                                            MED_ALL_CONSTITUENT,
+                                            MED_FULL_INTERLACE,
+                                            MED_COMPACT_STMODE,
+                                            MED_NO_PROFILE,
+                                            _start,    /* start */
+                                            n_block,   /* stride */
+                                            count,
+                                            n_block,   /* blocksize */
+                                            0,         /* lastblocksize */
+                                            filter);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": MEDfilterBlockOfEntityCr() failed."), path);
+}
+
+/*----------------------------------------------------------------------------
+ * Read the local block of elements of a given type.
+ *
+ * parameters:
+ *   path      <-- path to mesh file
+ *   fid       <-- MED file id
+ *   mesh_name <-- MED mesh name
+ *   type_id   <-- id of element type in handled types
+ *   cells     <-> cells set
+ *   faces     <-> boundary elements set
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_elements(const char  *path,
+               med_idt      fid,
+               const char  *mesh_name,
+               int          type_id,
+               _elts_t     *cells,
+               _elts_t     *faces)
+{
+  med_bool changement, transformation;
+
+  const med_geometry_type med_type = _med_type[type_id];
+  const fvm_element_t type = _fvm_type[type_id];
+
+  med_int n = MEDmeshnEntity(fid, mesh_name, MED_NO_DT, MED_NO_IT,
+                             MED_CELL, med_type, MED_CONNECTIVITY, MED_NODAL,
+                             &changement, &transformation);
+  if (n <= 0)
+    return;
+
+  med_int n_fam = MEDmeshnEntity(fid, mesh_name, MED_NO_DT, MED_NO_IT,
+                                 MED_CELL, med_type, MED_FAMILY_NUMBER,
+                                 MED_NODAL, &changement, &transformation);
+
+  const int n_nodes = med_type % 100;
+  const int n_vtx = fvm_nodal_n_vertices_element[type];
+  const int *perm = _vertex_permutation(type);
+
+  cs_gnum_t s0, s1;
+  _block_range(n, &s0, &s1);
+  const cs_lnum_t n_elts = s1 - s0;
+
+  /* Connectivity */
+
+  med_int *conn;
+  BFT_MALLOC(conn, (size_t)n_elts*n_nodes + 1, med_int);
+
+  med_filter filter = MED_FILTER_INIT;
+  _filter_create(path, fid, n, n_nodes, s0, n_elts, &filter);
+
+  if (MEDmeshElementConnectivityAdvancedRd(fid, mesh_name,
+                                           MED_NO_DT, MED_NO_IT,
+                                           MED_CELL, med_type, MED_NODAL,
+                                           &filter, conn) < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": failed to read connectivity\n"
+                "for MED element type %d."), path, (int)med_type);
+
+  MEDfilterClose(&filter);
+
+  /* Family numbers */
+
+  med_int *family;
+  BFT_MALLOC(family, n_elts + 1, med_int);
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    family[i] = 0;
+
+  if (n_fam > 0) {
+
+    _filter_create(path, fid, n, 1, s0, n_elts, &filter);
+
+    if (MEDmeshEntityAttributeAdvancedRd(fid, mesh_name, MED_FAMILY_NUMBER,
+                                         MED_NO_DT, MED_NO_IT,
+                                         MED_CELL, med_type,
+                                         &filter, family) < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("File \"%s\": failed to read family numbers\n"
+                  "for MED element type %d."), path, (int)med_type);
+
+    MEDfilterClose(&filter);
+
+  }
+
+  /* Append to element set */
+
+  _elts_t *e = (type == FVM_FACE_TRIA || type == FVM_FACE_QUAD) ?
+    faces : cells;
+
+  if (e->n_elts + n_elts > e->n_max) {
+    e->n_max = e->n_elts + n_elts;
+    BFT_REALLOC(e->type, e->n_max, fvm_element_t);
+    BFT_REALLOC(e->family, e->n_max, med_int);
+    BFT_REALLOC(e->vtx_idx, e->n_max + 1, cs_lnum_t);
+    if (e->n_elts == 0)
+      e->vtx_idx[0] = 0;
+  }
+
+  cs_lnum_t s_id = e->vtx_idx[e->n_elts];
+  if (s_id + n_elts*n_vtx > e->vtx_max) {
+    e->vtx_max = s_id + n_elts*n_vtx;
+    BFT_REALLOC(e->vtx, e->vtx_max, cs_gnum_t);
+  }
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    cs_lnum_t j = e->n_elts + i;
+    e->type[j] = type;
+    e->family[j] = family[i];
+    for (int k = 0; k < n_vtx; k++)
+      e->vtx[s_id + i*n_vtx + k] = conn[(size_t)i*n_nodes + perm[k] - 1];
+    e->vtx_idx[j+1] = s_id + (i+1)*n_vtx;
+  }
+
+  e->n_elts += n_elts;
+
+  BFT_FREE(family);
+  BFT_FREE(conn);
+}
+
+/*----------------------------------------------------------------------------
+ * Free an element set.
+ *
+ * parameters:
+ *   e <-> element set
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_elts(_elts_t  *e)
+{
+  BFT_FREE(e->type);
+  BFT_FREE(e->family);
+  BFT_FREE(e->vtx_idx);
+  BFT_FREE(e->vtx);
+}
+
+/*----------------------------------------------------------------------------
+ * Define mesh groups and families from MED element families.
+ *
+ * Each MED element family (with number < 0) defines a family and group
+ * class; an additional family is associated with no group.
+ *
+ * parameters:
+ *   path       <-- path to mesh file
+ *   fid        <-- MED file id
+ *   mesh_name  <-- MED mesh name
+ *   mesh       <-> mesh
+ *   family_min --> lowest MED family number
+ *   family_gc  --> group class id for each MED family number
+ *                  (indexed by family_min - number)
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_groups(const char   *path,
+               med_idt       fid,
+               const char   *mesh_name,
+               cs_mesh_t    *mesh,
+               med_int      *family_min,
+               int         **family_gc)
+{
+  char family_name[MED_NAME_SIZE + 1];
+
+  med_int n_med_families = MEDnFamily(fid, mesh_name);
+
+  int n_families = 0, n_max_items = 1;
+  med_int *f_num, *f_n_groups;
+  char **f_groups;
+  BFT_MALLOC(f_num, n_med_families + 1, med_int);
+  BFT_MALLOC(f_n_groups, n_med_families + 1, med_int);
+  BFT_MALLOC(f_groups, n_med_families + 1, char *);
+
+  *family_min = 0;
+
+  for (int i = 0; i < n_med_families; i++) {
+
+    med_int n_groups = MEDnFamilyGroup(fid, mesh_name, i+1);
+    if (n_groups < 0)
+      n_groups = 0;
+
+    char *groups;
+    BFT_MALLOC(groups, MED_LNAME_SIZE*n_groups + 1, char);
+
+    if (MEDfamilyInfo(fid, mesh_name, i+1, family_name,
+                      f_num + n_families, groups) < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("File \"%s\": MEDfamilyInfo() failed."), path);
+
+    /* Vertex families (> 0) are ignored */
+
+    if (f_num[n_families] < 0) {
+      f_n_groups[n_families] = n_groups;
+      f_groups[n_families] = groups;
+      *family_min = CS_MIN(*family_min, f_num[n_families]);
+      n_max_items = CS_MAX(n_max_items, n_groups);
+      n_families++;
+    }
+    else
+      BFT_FREE(groups);
+
+  }
+
+  /* Groups (unique names) */
+
+  mesh->n_groups = 0;
+  BFT_REALLOC(mesh->group_idx, 1, int);
+  mesh->group_idx[0] = 0;
+
+  mesh->n_families = n_families + 1;
+  mesh->n_max_family_items = n_max_items;
+  BFT_REALLOC(mesh->family_item, mesh->n_families*n_max_items, int);
+  for (int i = 0; i < mesh->n_families*n_max_items; i++)
+    mesh->family_item[i] = 0;
+
+  for (int i = 0; i < n_families; i++) {
+
+    for (int j = 0; j < f_n_groups[i]; j++) {
+
+      char name[MED_LNAME_SIZE + 1];
+      strncpy(name, f_groups[i] + MED_LNAME_SIZE*j, MED_LNAME_SIZE);
+      name[MED_LNAME_SIZE] = '\0';
+      for (int k = strlen(name) - 1; k > -1 && name[k] == ' '; k--)
+        name[k] = '\0';
+
+      int g_id = 0;
+      while (   g_id < mesh->n_groups
+             && strcmp(name, mesh->group + mesh->group_idx[g_id]) != 0)
+        g_id++;
+
+      if (g_id == mesh->n_groups) {
+        int l = strlen(name) + 1;
+        mesh->n_groups += 1;
+        BFT_REALLOC(mesh->group_idx, mesh->n_groups + 1, int);
+        BFT_REALLOC(mesh->group, mesh->group_idx[g_id] + l, char);
+        strcpy(mesh->group + mesh->group_idx[g_id], name);
+        mesh->group_idx[g_id + 1] = mesh->group_idx[g_id] + l;
+      }
+
+      mesh->family_item[j*mesh->n_families + i] = -(g_id + 1);
+
+    }
+
+    BFT_FREE(f_groups[i]);
+  }
+
+  /* Map MED family numbers to group class ids */
+
+  BFT_MALLOC(*family_gc, 1 - *family_min, int);
+  for (int i = 0; i < 1 - *family_min; i++)
+    (*family_gc)[i] = n_families + 1;
+  for (int i = 0; i < n_families; i++)
+    (*family_gc)[f_num[i] - *family_min] = i + 1;
+
+  BFT_FREE(f_groups);
+  BFT_FREE(f_n_groups);
+  BFT_FREE(f_num);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be read directly as a MED file.
+ *
+ * \param[in]  path  path to mesh file
+ *
+ * \return  true if the file name has a ".med" extension, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_med_is_med_file(const char  *path)
+{
+  bool retval = false;
+
+  if (path != NULL) {
+    size_t l = strlen(path);
+    if (l > 4 && strcmp(path + l - 4, ".med") == 0)
+      retval = true;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read a MED mesh file in parallel.
+ *
+ * Each rank reads a block of the vertices and of each element type,
+ * using MED filters (with MPI-IO when MED is built with parallel
+ * support). Faces are built from cells using \ref cs_mesh_from_cells,
+ * so the resulting builder may be directly partitioned.
+ *
+ * Only the first unstructured mesh of the file is read. Tetrahedra,
+ * pyramids, prisms and hexahedra (higher order elements are reduced
+ * to their corner vertices) define cells, and triangles and quadrangles
+ * are used to assign groups to the matching boundary faces. Groups are
+ * defined by element families.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       path  path to mesh file
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_med_read(const char         *path,
+                 cs_mesh_t          *mesh,
+                 cs_mesh_builder_t  *mb)
+{
+  bft_printf(_("\n Reading mesh from file \"%s\" (MED format):\n"), path);
+
+  med_idt fid = -1;
+
+#if defined(HAVE_MED_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Info hints;
+    cs_file_get_default_access(CS_FILE_MODE_READ, NULL, &hints);
+    fid = MEDparFileOpen(path, MED_ACC_RDONLY, cs_glob_mpi_comm, hints);
+  }
+  else
+#endif
+    fid = MEDfileOpen(path, MED_ACC_RDONLY);
+
+  if (fid < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Failed to open MED file \"%s\"."), path);
+
+  /* Mesh info */
+
+  char mesh_name[MED_NAME_SIZE + 1];
+  char description[MED_COMMENT_SIZE + 1];
+  char dt_unit[MED_SNAME_SIZE + 1];
+  med_int space_dim = 0, mesh_dim = 0, n_steps = 0;
+  med_mesh_type mesh_type = MED_UNDEF_MESH_TYPE;
+  med_sorting_type sorting_type;
+  med_axis_type axis_type;
+
+  med_int n_axes = (MEDnMesh(fid) > 0) ? MEDmeshnAxis(fid, 1) : 0;
+
+  if (n_axes > 0) {
+    char *axis_name, *axis_unit;
+    BFT_MALLOC(axis_name, MED_SNAME_SIZE*n_axes + 1, char);
+    BFT_MALLOC(axis_unit, MED_SNAME_SIZE*n_axes + 1, char);
+    if (MEDmeshInfo(fid, 1, mesh_name, &space_dim, &mesh_dim, &mesh_type,
+                    description, dt_unit, &sorting_type, &n_steps,
+                    &axis_type, axis_name, axis_unit) < 0)
+      mesh_type = MED_UNDEF_MESH_TYPE;
+    BFT_FREE(axis_unit);
+    BFT_FREE(axis_name);
+  }
+
+  if (   mesh_type != MED_UNSTRUCTURED_MESH || mesh_dim != 3
+      || space_dim < 1 || space_dim > 3)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": only unstructured volume meshes\n"
+                "are handled by direct import;\n"
+                "use the Preprocessor for this mesh."), path);
+
+  med_bool changement, transformation;
+  med_int n_nodes = MEDmeshnEntity(fid, mesh_name, MED_NO_DT, MED_NO_IT,
+                                   MED_NODE, MED_NONE, MED_COORDINATE,
+                                   MED_NO_CMODE, &changement, &transformation);
+
+  const cs_gnum_t n_g_vertices = n_nodes;
+
+  /* Groups and families */
+
+  med_int family_min = 0;
+  int *family_gc = NULL;
+
+  _define_groups(path, fid, mesh_name, mesh, &family_min, &family_gc);
+
+  /* Elements */
+
+  _elts_t cells = {0, 0, 0, NULL, NULL, NULL, NULL};
+  _elts_t faces = {0, 0, 0, NULL, NULL, NULL, NULL};
+
+  for (int i = 0; i < _n_med_types; i++)
+    _read_elements(path, fid, mesh_name, i, &cells, &faces);
+
+  int *cell_gc_id, *b_elt_gc_id;
+  BFT_MALLOC(cell_gc_id, cells.n_elts, int);
+  BFT_MALLOC(b_elt_gc_id, faces.n_elts, int);
+
+  const int default_gc_id = mesh->n_families;
+
+  for (cs_lnum_t i = 0; i < cells.n_elts; i++)
+    cell_gc_id[i] = (cells.family[i] < 0 && cells.family[i] >= family_min) ?
+      family_gc[cells.family[i] - family_min] : default_gc_id;
+  for (cs_lnum_t i = 0; i < faces.n_elts; i++)
+    b_elt_gc_id[i] = (faces.family[i] < 0 && faces.family[i] >= family_min) ?
+      family_gc[faces.family[i] - family_min] : default_gc_id;
+
+  BFT_FREE(family_gc);
+
+  /* Global cell numbering (in rank order) */
+
+  cs_gnum_t n_g_cells = cells.n_elts;
+  cs_gnum_t c_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_cells = cells.n_elts;
+    MPI_Exscan(&_n_cells, &c_shift, 1, CS_MPI_GNUM, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      c_shift = 0;
+  }
+#endif
+
+  cs_parall_counter(&n_g_cells, 1);
+
+  if (n_g_cells == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": no volume elements found."), path);
+
+  cs_gnum_t *cell_gnum;
+  BFT_MALLOC(cell_gnum, cells.n_elts, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < cells.n_elts; i++)
+    cell_gnum[i] = c_shift + i + 1;
+
+  /* Build faces */
+
+  mesh->n_g_cells = n_g_cells;
+  mesh->n_g_vertices = n_g_vertices;
+
+  cs_mesh_from_cells(mb,
+                     n_g_cells,
+                     n_g_vertices,
+                     cells.n_elts,
+                     cell_gnum,
+                     cells.type,
+                     cells.vtx_idx,
+                     cells.vtx,
+                     faces.n_elts,
+                     faces.vtx_idx,
+                     faces.vtx,
+                     b_elt_gc_id,
+                     default_gc_id);
+
+  BFT_FREE(b_elt_gc_id);
+  _free_elts(&faces);
+
+  cs_mesh_from_cells_set_cell_gc_id(mb, cells.n_elts, cell_gnum, cell_gc_id);
+
+  BFT_FREE(cell_gc_id);
+  BFT_FREE(cell_gnum);
+  _free_elts(&cells);
+
+  /* Vertex coordinates, read directly on the vertex block distribution */
+
+  const cs_gnum_t v0 = mb->vertex_bi.gnum_range[0];
+  const cs_lnum_t n_vertices = mb->vertex_bi.gnum_range[1] - v0;
+
+  med_float *coords;
+  BFT_MALLOC(coords, (size_t)n_vertices*space_dim + 1, med_float);
+
+  med_filter filter = MED_FILTER_INIT;
+  _filter_create(path, fid, n_g_vertices, space_dim,
+                 (n_vertices > 0) ? v0 - 1 : 0, n_vertices, &filter);
+
+  if (MEDmeshNodeCoordinateAdvancedRd(fid, mesh_name, MED_NO_DT, MED_NO_IT,
+                                      &filter, coords) < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\": failed to read vertex coordinates."), path);
+
+  MEDfilterClose(&filter);
+
+  BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    for (int j = 0; j < 3; j++)
+      mb->vertex_coords[i*3 + j] = (j < space_dim) ? coords[i*space_dim + j]
+                                                   : 0.;
+  }
+
+  BFT_FREE(coords);
+
+  MEDfileClose(fid);
+
+  bft_printf(_("   %llu cells, %llu faces, %llu vertices, %d groups\n"),
+             (unsigned long long)(mesh->n_g_cells),
+             (unsigned long long)(mb->n_g_faces),
+             (unsigned long long)(mesh->n_g_vertices),
+             mesh->n_groups);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* HAVE_MED */
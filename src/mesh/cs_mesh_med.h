@@ -0,0 +1,92 @@
+#ifndef __CS_MESH_MED_H__
+#define __CS_MESH_MED_H__
+
+/*============================================================================
+ * Direct parallel import of MED mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be read directly as a MED file.
+ *
+ * \param[in]  path  path to mesh file
+ *
+ * \return  true if the file name has a ".med" extension, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_med_is_med_file(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read a MED mesh file in parallel.
+ *
+ * Each rank reads a block of the vertices and of each element type,
+ * using MED filters (with MPI-IO when MED is built with parallel
+ * support). Faces are built from cells using \ref cs_mesh_from_cells,
+ * so the resulting builder may be directly partitioned.
+ *
+ * Only the first unstructured mesh of the file is read. Tetrahedra,
+ * pyramids, prisms and hexahedra (higher order elements are reduced
+ * to their corner vertices) define cells, and triangles and quadrangles
+ * are used to assign groups to the matching boundary faces. Groups are
+ * defined by element families.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       path  path to mesh file
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_med_read(const char         *path,
+                 cs_mesh_t          *mesh,
+                 cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_MED_H__ */
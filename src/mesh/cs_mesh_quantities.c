@@ -126,12 +126,14 @@ cs_f_mesh_quantities_fluid_vol_reductions(void);
  * Build the geometrical matrix linear gradient correction
  *
  * parameters:
- *   m    <--  mesh
- *   fvq  <->  mesh quantities
+ *   m          <--  mesh
+ *   cell_flag  <--  if non-NULL, update only cells with nonzero flag
+ *   fvq        <->  mesh quantities
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_corr_grad_lin(const cs_mesh_t       *m,
+                       const int              cell_flag[],
                        cs_mesh_quantities_t  *fvq)
 {
   /* Local variables */
@@ -165,6 +167,8 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
 
   /* Initialization */
   for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
+    if (cell_flag != NULL && cell_flag[cell_id] == 0)
+      continue;
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++)
         corr_grad_lin[cell_id][i][j] = 0.;
@@ -176,11 +180,16 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
+    bool upd1 = (cell_flag == NULL || cell_flag[cell_id1] != 0);
+    bool upd2 = (cell_flag == NULL || cell_flag[cell_id2] != 0);
+
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++) {
         cs_real_t flux = i_face_cog[face_id][i] * i_face_normal[face_id][j];
-        corr_grad_lin[cell_id1][i][j] += flux;
-        corr_grad_lin[cell_id2][i][j] -= flux;
+        if (upd1)
+          corr_grad_lin[cell_id1][i][j] += flux;
+        if (upd2)
+          corr_grad_lin[cell_id2][i][j] -= flux;
       }
     }
   }
@@ -188,6 +197,8 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
   /* Boundary faces contribution */
   for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
     cs_lnum_t cell_id = b_face_cells[face_id];
+    if (cell_flag != NULL && cell_flag[cell_id] == 0)
+      continue;
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++) {
         cs_real_t flux = b_face_cog[face_id][i] * b_face_normal[face_id][j];
@@ -198,6 +209,8 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
 
   /* Matrix inversion */
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    if (cell_flag != NULL && cell_flag[cell_id] == 0)
+      continue;
     double cocg11 = corr_grad_lin[cell_id][0][0] / cell_vol[cell_id];
     double cocg12 = corr_grad_lin[cell_id][1][0] / cell_vol[cell_id];
     double cocg13 = corr_grad_lin[cell_id][2][0] / cell_vol[cell_id];
@@ -1498,6 +1511,142 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
   BFT_FREE(pb1);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell centers as the surface-weighted average of face centers
+ * of gravity.
+ *
+ * parameters:
+ *   mesh         <--  pointer to mesh structure
+ *   cell_flag    <--  if non-NULL, update only cells with nonzero flag
+ *   i_face_norm  <--  surface normal of internal faces
+ *   i_face_cog   <--  center of gravity of internal faces
+ *   b_face_norm  <--  surface normal of border faces
+ *   b_face_cog   <--  center of gravity of border faces
+ *   cell_cen     -->  cell centers
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_faces_cog(const cs_mesh_t  *mesh,
+                const int         cell_flag[],
+                const cs_real_t   i_face_norm[],
+                const cs_real_t   i_face_cog[],
+                const cs_real_t   b_face_norm[],
+                const cs_real_t   b_face_cog[],
+                cs_real_t         cell_cen[])
+{
+  cs_real_t  *cell_area = NULL;
+
+  /* Mesh connectivity */
+
+  const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const  cs_lnum_t  n_b_faces = mesh->n_b_faces;
+  const  cs_lnum_t  n_cells = mesh->n_cells;
+  const  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
+  const  cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
+
+  /* Return if ther is not enough data (Solcom case except rediative module
+     or Pre-processor 1.2.d without option "-n") */
+
+  if (mesh->i_face_vtx_lst == NULL && mesh->b_face_vtx_lst == NULL)
+    return;
+
+  /* Checking */
+
+  assert(cell_cen != NULL);
+
+  /* Initialization */
+
+  BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
+
+  for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
+
+    if (cell_flag != NULL && cell_flag[j] == 0)
+      continue;
+
+    cell_area[j] = 0.;
+
+    for (cs_lnum_t i = 0; i < 3; i++)
+      cell_cen[3*j + i] = 0.;
+
+  }
+
+  /* Loop on interior faces
+     ---------------------- */
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    /* For each cell sharing the internal face, we update
+     * cell_cen and cell_area */
+
+    cs_lnum_t c_id1 = i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+    /* Computation of the area of the face */
+
+    cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+
+    if (c_id1 > -1 && (cell_flag == NULL || cell_flag[c_id1] != 0)) {
+      cell_area[c_id1] += area;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
+    }
+    if (c_id2 > -1 && (cell_flag == NULL || cell_flag[c_id2] != 0)) {
+      cell_area[c_id2] += area;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
+    }
+
+  } /* End of loop on interior faces */
+
+  /* Loop on boundary faces
+     --------------------- */
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+
+    /* For each cell sharing a border face, we update the numerator
+     * of cell_cen and cell_area */
+
+    cs_lnum_t c_id1 = b_face_cells[f_id];
+
+    /* Computation of the area of the face
+       (note that c_id1 == -1 may happen for isolated faces,
+       which are cleaned afterwards) */
+
+    if (c_id1 > -1 && (cell_flag == NULL || cell_flag[c_id1] != 0)) {
+
+      cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
+
+      cell_area[c_id1] += area;
+
+      /* Computation of the numerator */
+
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
+
+    }
+
+  } /* End of loop on boundary faces */
+
+  /* Loop on cells to finalize the computation of center of gravity
+     -------------------------------------------------------------- */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    if (cell_flag != NULL && cell_flag[c_id] == 0)
+      continue;
+
+    for (cs_lnum_t i = 0; i < 3; i++)
+      cell_cen[c_id*3 + i] /= cell_area[c_id];
+
+  }
+
+  /* Free memory */
+
+  BFT_FREE(cell_area);
+}
+
 /*----------------------------------------------------------------------------
  * Compute the volume of cells C from their n faces F(i) and their center of
  * gravity G(Fi) where i=0, n-1
@@ -1513,11 +1662,13 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
  *   b_face_norm    <--  surface normal of border faces
  *   b_face_cog     <--  center of gravity of border faces
  *   cell_cen       <--  center of gravity of cells
+ *   cell_flag      <--  if non-NULL, update only cells with nonzero flag
  *   cell_vol       -->  cells volume
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_cell_volume(const cs_mesh_t   *mesh,
+                     const int          cell_flag[],
                      const cs_real_3_t  i_face_norm[],
                      const cs_real_3_t  i_face_cog[],
                      const cs_real_3_t  b_face_norm[],
@@ -1530,8 +1681,10 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
 
   /* Initialization */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
-    cell_vol[cell_id] = 0;
+  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++) {
+    if (cell_flag == NULL || cell_flag[cell_id] != 0)
+      cell_vol[cell_id] = 0;
+  }
 
   /* Loop on internal faces */
 
@@ -1540,12 +1693,16 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
     cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
     cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
-    cell_vol[cell_id2] -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
+    if (cell_flag == NULL || cell_flag[cell_id1] != 0)
+      cell_vol[cell_id1]
+        += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                          i_face_cog[fac_id],
+                                          i_face_norm[fac_id]);
+    if (cell_flag == NULL || cell_flag[cell_id2] != 0)
+      cell_vol[cell_id2]
+        -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
+                                          i_face_cog[fac_id],
+                                          i_face_norm[fac_id]);
 
   }
 
@@ -1555,15 +1712,19 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
 
     cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         b_face_cog[fac_id],
-                                                         b_face_norm[fac_id]);
+    if (cell_flag == NULL || cell_flag[cell_id1] != 0)
+      cell_vol[cell_id1]
+        += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                          b_face_cog[fac_id],
+                                          b_face_norm[fac_id]);
   }
 
   /* First computation of the volume */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
-    cell_vol[cell_id] *= a_third;
+  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++) {
+    if (cell_flag == NULL || cell_flag[cell_id] != 0)
+      cell_vol[cell_id] *= a_third;
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1661,6 +1822,8 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
  *   b_face_cog     <--  center of gravity of border faces
  *   cell_cen       <--  cell center
  *   cell_vol       <--  cell volume
+ *   cell_flag      <--  if non-NULL, update only faces adjacent to
+ *                       cells with nonzero flag
  *   i_dist         -->  distance IJ.Nij for interior faces
  *   b_dist         -->  likewise for border faces
  *   weight         -->  weighting factor (Aij=pond Ai+(1-pond)Aj)
@@ -1671,6 +1834,7 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
                         cs_lnum_t          n_b_faces,
                         const cs_lnum_2_t  i_face_cells[],
                         const cs_lnum_t    b_face_cells[],
+                        const int          cell_flag[],
                         const cs_real_t    i_face_normal[][3],
                         const cs_real_t    b_face_normal[][3],
                         const cs_real_t    i_face_cog[][3],
@@ -1687,13 +1851,17 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
+    cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+    cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+    if (   cell_flag != NULL
+        && cell_flag[cell_id1] == 0 && cell_flag[cell_id2] == 0)
+      continue;
+
     const cs_real_t *face_nomal = i_face_normal[face_id];
     cs_real_t normal[3];
     cs_math_3_normalise(face_nomal, normal);
 
-    cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-    cs_lnum_t cell_id2 = i_face_cells[face_id][1];
-
     /* Distance between the neighbor cell centers
      * and dot-product with the normal */
     i_dist[face_id] = cs_math_3_distance_dot_product(cell_cen[cell_id1],
@@ -1752,12 +1920,15 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
+    cs_lnum_t cell_id = b_face_cells[face_id];
+
+    if (cell_flag != NULL && cell_flag[cell_id] == 0)
+      continue;
+
     const cs_real_t *face_nomal = b_face_normal[face_id];
     cs_real_t normal[3];
     cs_math_3_normalise(face_nomal, normal);
 
-    cs_lnum_t cell_id = b_face_cells[face_id];
-
     /* Distance between the face center of gravity
        and the neighbor cell center */
     b_dist[face_id] = cs_math_3_distance_dot_product(cell_cen[cell_id],
@@ -1819,6 +1990,8 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
  *   n_b_faces      <--  number of border  faces
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
+ *   cell_flag      <--  if non-NULL, update only faces adjacent to
+ *                       cells with nonzero flag
  *   i_face_norm    <--  surface normal of interior faces
  *   b_face_norm    <--  surface normal of border faces
  *   i_face_cog     <--  center of gravity of interior faces
@@ -1837,6 +2010,7 @@ _compute_face_vectors(int                dim,
                       const cs_lnum_t    n_b_faces,
                       const cs_lnum_2_t  i_face_cells[],
                       const cs_lnum_t    b_face_cells[],
+                      const int          cell_flag[],
                       const cs_real_t    i_face_normal[],
                       const cs_real_t    b_face_normal[],
                       const cs_real_t    i_face_cog[],
@@ -1863,6 +2037,10 @@ _compute_face_vectors(int                dim,
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
+    if (   cell_flag != NULL
+        && cell_flag[cell_id1] == 0 && cell_flag[cell_id2] == 0)
+      continue;
+
     /* Normalized normal */
     surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
     surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
@@ -1904,6 +2082,9 @@ _compute_face_vectors(int                dim,
 
     cell_id = b_face_cells[face_id];
 
+    if (cell_flag != NULL && cell_flag[cell_id] == 0)
+      continue;
+
     cs_real_3_t normal;
     /* Normal is vector 0 if the b_face_normal norm is too small */
     cs_math_3_normalise(&b_face_normal[face_id*dim], normal);
@@ -1974,6 +2155,8 @@ _compute_face_vectors(int                dim,
  *   n_cells        <--  number of cells
  *   n_i_faces      <--  number of interior faces
  *   i_face_cells   <--  interior "faces -> cells" connectivity
+ *   cell_flag      <--  if non-NULL, update only faces adjacent to
+ *                       cells with nonzero flag
  *   i_face_norm    <--  surface normal of interior faces
  *   i_face_cog     <--  center of gravity of interior faces
  *   i_face_surf    <--  interior faces surface
@@ -1988,6 +2171,7 @@ static void
 _compute_face_sup_vectors(const cs_lnum_t    n_cells,
                           const cs_lnum_t    n_i_faces,
                           const cs_lnum_2_t  i_face_cells[],
+                          const int          cell_flag[],
                           const cs_real_t    i_face_normal[][3],
                           const cs_real_t    i_face_cog[][3],
                           const cs_real_t    cell_cen[][3],
@@ -2005,6 +2189,10 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
+    if (   cell_flag != NULL
+        && cell_flag[cell_id1] == 0 && cell_flag[cell_id2] == 0)
+      continue;
+
     /* Normalized normal */
     cs_real_3_t normal;
     cs_math_3_normalise(i_face_normal[face_id], normal);
@@ -2099,6 +2287,110 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Recompute geometric quantities of flagged faces.
+ *
+ * Consecutive flagged faces are handled as a single range, so the
+ * per-face computations are the same as for a full update.
+ *
+ * parameters:
+ *   n_faces       <--  number of faces
+ *   vtx_coord     <--  vertex coordinates
+ *   face_vtx_idx  <--  "face -> vertices" connectivity index
+ *   face_vtx      <--  "face -> vertices" connectivity list
+ *   face_flag     <--  face update flag (1 to update, 0 otherwise)
+ *   face_cog      <->  coordinates of the center of gravity of the faces
+ *   face_normal   <->  face surface normals
+ *   face_surf     <->  face surfaces
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_flagged_faces(cs_lnum_t          n_faces,
+                      const cs_real_3_t  vtx_coord[],
+                      const cs_lnum_t    face_vtx_idx[],
+                      const cs_lnum_t    face_vtx[],
+                      const char         face_flag[],
+                      cs_real_3_t        face_cog[],
+                      cs_real_3_t        face_normal[],
+                      cs_real_t          face_surf[])
+{
+  cs_lnum_t s_id = 0;
+
+  while (s_id < n_faces) {
+
+    if (face_flag[s_id] == 0) {
+      s_id++;
+      continue;
+    }
+
+    cs_lnum_t e_id = s_id + 1;
+    while (e_id < n_faces && face_flag[e_id] != 0)
+      e_id++;
+
+    cs_lnum_t n_r_faces = e_id - s_id;
+
+    _compute_face_quantities(n_r_faces,
+                             vtx_coord,
+                             face_vtx_idx + s_id,
+                             face_vtx,
+                             face_cog + s_id,
+                             face_normal + s_id);
+
+    _compute_face_surface(n_r_faces,
+                          (const cs_real_t *)(face_normal + s_id),
+                          face_surf + s_id);
+
+    if (cs_glob_mesh_quantities_flag & CS_FACE_CENTER_REFINE)
+      _refine_warped_face_centers(n_r_faces,
+                                  vtx_coord,
+                                  face_vtx_idx + s_id,
+                                  face_vtx,
+                                  face_cog + s_id,
+                                  (const cs_real_3_t *)(face_normal + s_id));
+
+    if (_ajust_face_cog_compat_v11_v52)
+      _adjust_face_cog_v11_v52(n_r_faces,
+                               vtx_coord,
+                               face_vtx_idx + s_id,
+                               face_vtx,
+                               face_cog + s_id,
+                               (const cs_real_3_t *)(face_normal + s_id));
+
+    s_id = e_id;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Print some information on the control volumes, and check min volume.
+ *
+ * parameters:
+ *   mq  <-- pointer to mesh quantities structures.
+ *----------------------------------------------------------------------------*/
+
+static void
+_volume_info(const cs_mesh_quantities_t  *mq)
+{
+  if (_n_computations == 1)
+    bft_printf(_(" --- Information on the volumes\n"
+                 "       Minimum control volume      = %14.7e\n"
+                 "       Maximum control volume      = %14.7e\n"
+                 "       Total volume for the domain = %14.7e\n"),
+               mq->min_vol, mq->max_vol,
+               mq->tot_vol);
+  else {
+    if (mq->min_vol <= 0.) {
+      bft_printf(_(" --- Information on the volumes\n"
+                   "       Minimum control volume      = %14.7e\n"
+                   "       Maximum control volume      = %14.7e\n"
+                   "       Total volume for the domain = %14.7e\n"),
+                 mq->min_vol, mq->max_vol,
+                 mq->tot_vol);
+      bft_printf(_("\nAbort due to the detection of a negative control "
+                   "volume.\n"));
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Evaluate boundary thickness.
  *
@@ -2481,6 +2773,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
 
   if (volume_computed == false)
     _compute_cell_volume(m,
+                         NULL,
                          (const cs_real_3_t *)(mq->i_face_normal),
                          (const cs_real_3_t *)(mq->i_face_cog),
                          (const cs_real_3_t *)(mq->b_face_normal),
@@ -2624,6 +2917,7 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
                           m->n_b_faces,
                           (const cs_lnum_2_t *)(m->i_face_cells),
                           m->b_face_cells,
+                          NULL,
                           (const cs_real_3_t *)(mq->i_face_normal),
                           (const cs_real_3_t *)(mq->b_face_normal),
                           (const cs_real_3_t *)(mq->i_face_cog),
@@ -2641,6 +2935,7 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
                         m->n_b_faces,
                         (const cs_lnum_2_t *)(m->i_face_cells),
                         m->b_face_cells,
+                        NULL,
                         mq->i_face_normal,
                         mq->b_face_normal,
                         mq->i_face_cog,
@@ -2659,6 +2954,7 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
     (m->n_cells,
      m->n_i_faces,
      (const cs_lnum_2_t *)(m->i_face_cells),
+     NULL,
      (const cs_real_3_t *)(mq->i_face_normal),
      (const cs_real_3_t *)(mq->i_face_cog),
      (const cs_real_3_t *)(mq->cell_cen),
@@ -2669,29 +2965,264 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
 
   /* Build the geometrical matrix linear gradient correction */
   if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
-    _compute_corr_grad_lin(m, mq);
+    _compute_corr_grad_lin(m, NULL, mq);
 
   /* Print some information on the control volumes, and check min volume */
 
-  if (_n_computations == 1)
-    bft_printf(_(" --- Information on the volumes\n"
-                 "       Minimum control volume      = %14.7e\n"
-                 "       Maximum control volume      = %14.7e\n"
-                 "       Total volume for the domain = %14.7e\n"),
-               mq->min_vol, mq->max_vol,
-               mq->tot_vol);
-  else {
-    if (mq->min_vol <= 0.) {
-      bft_printf(_(" --- Information on the volumes\n"
-                   "       Minimum control volume      = %14.7e\n"
-                   "       Maximum control volume      = %14.7e\n"
-                   "       Total volume for the domain = %14.7e\n"),
-                 mq->min_vol, mq->max_vol,
-                 mq->tot_vol);
-      bft_printf(_("\nAbort due to the detection of a negative control "
-                   "volume.\n"));
+  _volume_info(mq);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after displacement of some vertices.
+ *
+ * Only quantities of faces sharing a moved vertex, of cells adjacent to
+ * those faces, and of faces adjacent to those cells are recomputed, in
+ * the same order of operations as in \ref cs_mesh_quantities_compute,
+ * so results are identical to those of a full computation.
+ *
+ * When options requiring a global update are active (cell center or
+ * volume corrections, cell center algorithm other than the default,
+ * porosity), or when a large portion of the vertices have moved, or
+ * quantities have not been computed yet, a full computation is done.
+ *
+ * \param[in]       m         pointer to mesh structure
+ * \param[in, out]  mq        pointer to mesh quantities structures.
+ * \param[in]       vtx_flag  flag for moved vertices (1 if moved,
+ *                            0 otherwise)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *m,
+                                cs_mesh_quantities_t  *mq,
+                                const char             vtx_flag[])
+{
+  const cs_lnum_t  n_i_faces = m->n_i_faces;
+  const cs_lnum_t  n_b_faces = CS_MAX(m->n_b_faces, m->n_b_faces_all);
+  const cs_lnum_t  n_cells = m->n_cells;
+  const cs_lnum_t  n_cells_ext = m->n_cells_with_ghosts;
+
+  const cs_lnum_2_t  *i_face_cells = (const cs_lnum_2_t *)(m->i_face_cells);
+  const cs_lnum_t  *b_face_cells = m->b_face_cells;
+
+  /* Check whether an incremental update is possible
+     (the decision must be the same on all ranks) */
+
+  const unsigned global_opts =   CS_CELL_CENTER_CORRECTION
+                               | CS_CELL_FACE_CENTER_CORRECTION
+                               | CS_CELL_VOLUME_RATIO_CORRECTION;
+
+  int full_update = 0;
+
+  if (   _cell_cen_algorithm != 0
+      || (cs_glob_mesh_quantities_flag & global_opts)
+      || mq->i_dist == NULL
+      || mq->cell_f_vol != mq->cell_vol
+      || mq->i_f_face_normal != mq->i_face_normal
+      || mq->b_f_face_normal != mq->b_face_normal)
+    full_update = 1;
+
+  cs_parall_max(1, CS_INT_TYPE, &full_update);
+
+  cs_gnum_t n_g_moved = 0;
+
+  if (full_update == 0) {
+    for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
+      if (vtx_flag[i] != 0)
+        n_g_moved++;
     }
+    cs_parall_counter(&n_g_moved, 1);
+
+    if (n_g_moved > m->n_g_vertices / 2)
+      full_update = 1;
+  }
+
+  if (full_update) {
+    cs_mesh_quantities_compute(m, mq);
+    return;
+  }
+
+  _n_computations++;
+
+  if (n_g_moved == 0)
+    return;
+
+  /* Flag faces with moved vertices, and update their quantities */
+
+  char *i_face_flag, *b_face_flag;
+  BFT_MALLOC(i_face_flag, n_i_faces, char);
+  BFT_MALLOC(b_face_flag, n_b_faces, char);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    i_face_flag[f_id] = 0;
+    for (cs_lnum_t j = m->i_face_vtx_idx[f_id];
+         j < m->i_face_vtx_idx[f_id+1];
+         j++) {
+      if (vtx_flag[m->i_face_vtx_lst[j]] != 0) {
+        i_face_flag[f_id] = 1;
+        break;
+      }
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    b_face_flag[f_id] = 0;
+    for (cs_lnum_t j = m->b_face_vtx_idx[f_id];
+         j < m->b_face_vtx_idx[f_id+1];
+         j++) {
+      if (vtx_flag[m->b_face_vtx_lst[j]] != 0) {
+        b_face_flag[f_id] = 1;
+        break;
+      }
+    }
+  }
+
+  _update_flagged_faces(n_i_faces,
+                        (const cs_real_3_t *)m->vtx_coord,
+                        m->i_face_vtx_idx,
+                        m->i_face_vtx_lst,
+                        i_face_flag,
+                        (cs_real_3_t *)mq->i_face_cog,
+                        (cs_real_3_t *)mq->i_face_normal,
+                        mq->i_face_surf);
+
+  _update_flagged_faces(n_b_faces,
+                        (const cs_real_3_t *)m->vtx_coord,
+                        m->b_face_vtx_idx,
+                        m->b_face_vtx_lst,
+                        b_face_flag,
+                        (cs_real_3_t *)mq->b_face_cog,
+                        (cs_real_3_t *)mq->b_face_normal,
+                        mq->b_face_surf);
+
+  /* Flag cells adjacent to updated faces */
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, n_cells_ext, int);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    cell_flag[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (i_face_flag[f_id] != 0) {
+      cell_flag[i_face_cells[f_id][0]] = 1;
+      cell_flag[i_face_cells[f_id][1]] = 1;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (b_face_flag[f_id] != 0 && b_face_cells[f_id] > -1)
+      cell_flag[b_face_cells[f_id]] = 1;
+  }
+
+  BFT_FREE(b_face_flag);
+  BFT_FREE(i_face_flag);
+
+  for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++)
+    cell_flag[c_id] = 0;
+
+  if (m->halo != NULL)
+    cs_halo_sync_untyped(m->halo, CS_HALO_EXTENDED, sizeof(int), cell_flag);
+
+  /* Update cell centers and volumes */
+
+  _cell_faces_cog(m,
+                  cell_flag,
+                  mq->i_face_normal,
+                  mq->i_face_cog,
+                  mq->b_face_normal,
+                  mq->b_face_cog,
+                  mq->cell_cen);
+
+  _compute_cell_volume(m,
+                       cell_flag,
+                       (const cs_real_3_t *)(mq->i_face_normal),
+                       (const cs_real_3_t *)(mq->i_face_cog),
+                       (const cs_real_3_t *)(mq->b_face_normal),
+                       (const cs_real_3_t *)(mq->b_face_cog),
+                       (const cs_real_3_t *)(mq->cell_cen),
+                       mq->cell_vol);
+
+  if (m->halo != NULL) {
+
+    cs_halo_sync_var_strided(m->halo, CS_HALO_EXTENDED,
+                             mq->cell_cen, 3);
+    if (m->n_init_perio > 0)
+      cs_halo_perio_sync_coords(m->halo, CS_HALO_EXTENDED,
+                                mq->cell_cen);
+
+    cs_halo_sync_var(m->halo, CS_HALO_EXTENDED, mq->cell_vol);
+
   }
+
+  _cell_volume_reductions(m,
+                          mq->cell_vol,
+                          &(mq->min_vol),
+                          &(mq->max_vol),
+                          &(mq->tot_vol));
+
+  cs_parall_min(1, CS_REAL_TYPE, &(mq->min_vol));
+  cs_parall_max(1, CS_REAL_TYPE, &(mq->max_vol));
+  cs_parall_sum(1, CS_REAL_TYPE, &(mq->tot_vol));
+
+  mq->min_f_vol = mq->min_vol;
+  mq->max_f_vol = mq->max_vol;
+  mq->tot_f_vol = mq->tot_vol;
+
+  /* Update quantities of faces adjacent to updated cells */
+
+  _compute_face_distances(m->n_i_faces,
+                          m->n_b_faces,
+                          i_face_cells,
+                          b_face_cells,
+                          cell_flag,
+                          (const cs_real_3_t *)(mq->i_face_normal),
+                          (const cs_real_3_t *)(mq->b_face_normal),
+                          (const cs_real_3_t *)(mq->i_face_cog),
+                          (const cs_real_3_t *)(mq->b_face_cog),
+                          (const cs_real_3_t *)(mq->cell_cen),
+                          (const cs_real_t *)(mq->cell_vol),
+                          mq->i_dist,
+                          mq->b_dist,
+                          mq->weight);
+
+  _compute_face_vectors(m->dim,
+                        m->n_i_faces,
+                        m->n_b_faces,
+                        i_face_cells,
+                        b_face_cells,
+                        cell_flag,
+                        mq->i_face_normal,
+                        mq->b_face_normal,
+                        mq->i_face_cog,
+                        mq->b_face_cog,
+                        mq->i_face_surf,
+                        mq->cell_cen,
+                        mq->weight,
+                        mq->b_dist,
+                        mq->dijpf,
+                        mq->diipb,
+                        mq->dofij);
+
+  _compute_face_sup_vectors(m->n_cells,
+                            m->n_i_faces,
+                            i_face_cells,
+                            cell_flag,
+                            (const cs_real_3_t *)(mq->i_face_normal),
+                            (const cs_real_3_t *)(mq->i_face_cog),
+                            (const cs_real_3_t *)(mq->cell_cen),
+                            mq->cell_vol,
+                            mq->i_dist,
+                            (cs_real_3_t *)(mq->diipf),
+                            (cs_real_3_t *)(mq->djjpf));
+
+  if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
+    _compute_corr_grad_lin(m, cell_flag, mq);
+
+  BFT_FREE(cell_flag);
+
+  _volume_info(mq);
 }
 
 /*----------------------------------------------------------------------------
@@ -2821,6 +3352,7 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
     (mesh->n_cells,
      mesh->n_i_faces,
      (const cs_lnum_2_t *)(mesh->i_face_cells),
+     NULL,
      (const cs_real_3_t *)(mesh_quantities->i_face_normal),
      (const cs_real_3_t *)(mesh_quantities->i_face_cog),
      (const cs_real_3_t *)(mesh_quantities->cell_cen),
@@ -2970,111 +3502,13 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
                                   const cs_real_t   b_face_cog[],
                                   cs_real_t         cell_cen[])
 {
-  cs_real_t  *cell_area = NULL;
-
-  /* Mesh connectivity */
-
-  const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
-  const  cs_lnum_t  n_b_faces = mesh->n_b_faces;
-  const  cs_lnum_t  n_cells = mesh->n_cells;
-  const  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
-  const  cs_lnum_2_t  *i_face_cells
-    = (const cs_lnum_2_t *)(mesh->i_face_cells);
-  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
-
-  /* Return if ther is not enough data (Solcom case except rediative module
-     or Pre-processor 1.2.d without option "-n") */
-
-  if (mesh->i_face_vtx_lst == NULL && mesh->b_face_vtx_lst == NULL)
-    return;
-
-  /* Checking */
-
-  assert(cell_cen != NULL);
-
-  /* Initialization */
-
-  BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
-
-  for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
-
-    cell_area[j] = 0.;
-
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[3*j + i] = 0.;
-
-  }
-
-  /* Loop on interior faces
-     ---------------------- */
-
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
-
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-    /* Computation of the area of the face */
-
-    cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
-
-    if (c_id1 > -1) {
-      cell_area[c_id1] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
-    }
-    if (c_id2 > -1) {
-      cell_area[c_id2] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
-    }
-
-  } /* End of loop on interior faces */
-
-  /* Loop on boundary faces
-     --------------------- */
-
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
-
-    cs_lnum_t c_id1 = b_face_cells[f_id];
-
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
-
-    if (c_id1 > -1) {
-
-      cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
-
-      cell_area[c_id1] += area;
-
-      /* Computation of the numerator */
-
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
-
-    }
-
-  } /* End of loop on boundary faces */
-
-  /* Loop on cells to finalize the computation of center of gravity
-     -------------------------------------------------------------- */
-
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[c_id*3 + i] /= cell_area[c_id];
-
-  }
-
-  /* Free memory */
-
-  BFT_FREE(cell_area);
+  _cell_faces_cog(mesh,
+                  NULL,
+                  i_face_norm,
+                  i_face_cog,
+                  b_face_norm,
+                  b_face_cog,
+                  cell_cen);
 }
 
 /*----------------------------------------------------------------------------
@@ -255,6 +255,26 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *m,
                            cs_mesh_quantities_t  *mq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after displacement of some vertices.
+ *
+ * Only quantities of faces sharing a moved vertex, of cells adjacent to
+ * those faces, and of faces adjacent to those cells are recomputed.
+ * A full computation is done when options requiring it are active.
+ *
+ * \param[in]       m         pointer to mesh structure
+ * \param[in, out]  mq        pointer to mesh quantities structures.
+ * \param[in]       vtx_flag  flag for moved vertices (1 if moved,
+ *                            0 otherwise)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *m,
+                                cs_mesh_quantities_t  *mq,
+                                const char             vtx_flag[]);
+
 /*----------------------------------------------------------------------------
  * Compute fluid mesh quantities
  *
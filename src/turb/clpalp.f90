@@ -124,6 +124,9 @@ do iel = 1, ncel
   endif
 enddo
 
+! Values may have been clipped
+call field_increment_version(f_id)
+
 call log_iteration_clipping_field(f_id, iclpmn(1), iclpmx(1), vmin, vmax,iclpmn(1), iclpmx(1))
 
 return
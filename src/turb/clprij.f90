@@ -191,6 +191,11 @@ do isou = 1, 6
   icltot = icltot + iclrij(isou)
 enddo
 
+! Values may have been clipped
+
+call field_increment_version(ivarfl(irij))
+call field_increment_version(ivarfl(iep))
+
 ! ---> Stockage nb de clippings pour log
 
 call log_iteration_clipping_field(ivarfl(irij), icltot, 0,  &
@@ -445,6 +450,11 @@ do iel = 1, ncel
   icltot = icltot + is_clipped
 enddo
 
+! Values may have been clipped
+
+call field_increment_version(ivarfl(irij))
+call field_increment_version(ivarfl(iep))
+
 call log_iteration_clipping_field(ivarfl(irij), icltot, 0,      &
                                   vmin, vmax,iclrij,iclrij_max)
 call log_iteration_clipping_field(ivarfl(iep), iclpep(1), 0,    &
@@ -150,6 +150,9 @@ do iel = 1, ncel
   endif
 enddo
 
+! Values may have been clipped
+call field_increment_version(ivarfl(iphi))
+
 call log_iteration_clipping_field(ivarfl(iphi), nclpmn(1), 0, vmin, vmax,nclpmn(1), nclpmx(1))
 
 !===============================================================================
@@ -194,6 +197,9 @@ if (iturb.eq.51) then
     endif
   enddo
 
+  ! Values may have been clipped
+  call field_increment_version(ivarfl(ial))
+
   call log_iteration_clipping_field(ivarfl(ial), nclpmn(1), nclpmx(1), vmin,vmax,nclpmn(1), nclpmx(1))
 
 endif
@@ -78,205 +78,316 @@ BEGIN_C_DECLS
  * Type definition
  *============================================================================*/
 
+/* Filter operator, stored as a compact CSR structure with normalized
+   weights, so that the filtered value of element i is
+   sum_{j=idx[i]}^{idx[i+1]-1} w[j].val[ids[j]] */
+
+typedef struct {
+
+  cs_lnum_t   n_rows;      /* number of rows (filtered elements) */
+
+  cs_lnum_t  *idx;         /* row index (size: n_rows + 1) */
+  cs_lnum_t  *ids;         /* column ids (size: idx[n_rows]) */
+  cs_real_t  *w;           /* normalized weights (size: idx[n_rows]) */
+
+  bool        owner;       /* true if idx and ids are owned */
+
+} _les_filter_op_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Cell-based filter operator for the extended neighborhood */
+
+static _les_filter_op_t  *_ext_filter = NULL;
+
+/* Vertex to cell averaging operator for the vertex-based filter */
+
+static _les_filter_op_t  *_v2c_filter = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute filters for dynamic models.
- *
- * This function deals with the standard or extended neighborhood.
+/*----------------------------------------------------------------------------
+ * Destroy a filter operator.
  *
- * \param[in]   stride   stride of array to filter
- * \param[in]   val      array of values to filter
- * \param[out]  f_val    array of filtered values
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   op <-> pointer to filter operator pointer
+ *----------------------------------------------------------------------------*/
 
 static void
-_les_filter_ext_neighborhood(int        stride,
-                             cs_real_t  val[],
-                             cs_real_t  f_val[])
+_destroy_filter_op(_les_filter_op_t  **op)
 {
-  cs_real_t *w1 = NULL, *w2 = NULL;
+  _les_filter_op_t  *_op = *op;
+
+  if (_op == NULL)
+    return;
+
+  if (_op->owner) {
+    BFT_FREE(_op->idx);
+    BFT_FREE(_op->ids);
+  }
+  BFT_FREE(_op->w);
+
+  BFT_FREE(*op);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the cell-based filter operator for the extended neighborhood.
+ *
+ * Each cell's stencil contains the cell itself, its face-adjacent cells,
+ * and its extended neighborhood, with weights proportional to cell volumes.
+ *
+ * returns:
+ *   pointer to filter operator
+ *----------------------------------------------------------------------------*/
 
+static _les_filter_op_t *
+_build_ext_filter_op(void)
+{
   const cs_mesh_t  *mesh = cs_glob_mesh;
-  const cs_lnum_t  _stride = stride;
   const cs_lnum_t  n_cells = mesh->n_cells;
-  const cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
-  const cs_lnum_t  n_elts_l = n_cells * _stride;
-  const cs_lnum_t  n_elts = n_cells_ext * _stride;
-  const int n_i_groups = mesh->i_face_numbering->n_groups;
-  const int n_i_threads = mesh->i_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = mesh->i_face_numbering->group_index;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)mesh->i_face_cells;
   const cs_lnum_t  *cell_cells_idx = mesh->cell_cells_idx;
   const cs_lnum_t  *cell_cells_lst = mesh->cell_cells_lst;
   const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
 
   assert(cell_cells_idx != NULL);
 
-  /* Allocate and initialize working buffers */
+  _les_filter_op_t  *op = NULL;
 
-  BFT_MALLOC(w1, n_elts, cs_real_t);
-  BFT_MALLOC(w2, n_elts, cs_real_t);
+  BFT_MALLOC(op, 1, _les_filter_op_t);
 
-  /* Case for scalar variable */
-  /*--------------------------*/
+  op->n_rows = n_cells;
+  op->owner = true;
 
-  if (stride == 1) {
+  BFT_MALLOC(op->idx, n_cells + 1, cs_lnum_t);
 
-    /* Synchronize variable */
+  cs_lnum_t  *idx = op->idx;
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, val);
+  /* Count stencil size per cell */
 
-    /* Define filtered variable array */
+  idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    idx[i+1] = 1 + cell_cells_idx[i+1] - cell_cells_idx[i];
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (cs_lnum_t k = 0; k < 2; k++) {
+      cs_lnum_t i = i_face_cells[f_id][k];
+      if (i < n_cells)
+        idx[i+1] += 1;
+    }
+  }
 
-      w1[i] = val[i] * cell_vol[i];
-      w2[i] = cell_vol[i];
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    idx[i+1] += idx[i];
 
-      /* Loop on connected cells (without cells sharing a face) */
+  BFT_MALLOC(op->ids, idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(op->w, idx[n_cells], cs_real_t);
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        w1[i] += val[k] * cell_vol[k];
-        w2[i] += cell_vol[k];
-      }
+  cs_lnum_t  *ids = op->ids;
+  cs_real_t  *w = op->w;
 
-    } /* End of loop on cells */
+  cs_lnum_t  *count;
+  BFT_MALLOC(count, n_cells, cs_lnum_t);
 
-#   pragma omp parallel for if (mesh->n_ghost_cells > CS_THR_MIN)
-    for (cs_lnum_t i = n_cells; i < n_cells_ext; i++) {
-      w1[i] = 0;
-      w2[i] = 0;
-    }
+  /* Cell itself and extended neighborhood */
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_lnum_t s_id = idx[i];
+    ids[s_id] = i;
+    cs_lnum_t n = 1;
+    for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++)
+      ids[s_id + n++] = cell_cells_lst[j];
+    count[i] = n;
+  }
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  /* Face-adjacent cells */
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t i = i_face_cells[f_id][0];
+    cs_lnum_t j = i_face_cells[f_id][1];
+    if (i < n_cells) {
+      ids[idx[i] + count[i]] = j;
+      count[i] += 1;
+    }
+    if (j < n_cells) {
+      ids[idx[j] + count[j]] = i;
+      count[j] += 1;
+    }
+  }
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+  BFT_FREE(count);
 
-          w1[i] += val[j] * cell_vol[j];
-          w2[i] += cell_vol[j];
+  /* Normalized weights */
 
-          w1[j] += val[i] * cell_vol[i];
-          w2[j] += cell_vol[i];
-        }
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_real_t  w_sum = 0;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++)
+      w_sum += cell_vol[ids[j]];
+    cs_real_t  inv_w_sum = 1. / w_sum;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++)
+      w[j] = cell_vol[ids[j]] * inv_w_sum;
+  }
 
-      }
+  return op;
+}
 
-    }
+/*----------------------------------------------------------------------------
+ * Build the vertex to cell averaging operator for the vertex-based filter.
+ *
+ * Vertex weights are based on the interpolation of cell volumes
+ * to vertices, so the operator shares the cell->vertices adjacency.
+ *
+ * returns:
+ *   pointer to filter operator
+ *----------------------------------------------------------------------------*/
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++)
-      f_val[i] = w1[i]/w2[i];
+static _les_filter_op_t *
+_build_v2c_filter_op(void)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
 
-    /* Synchronize variable */
+  const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val);
-  }
+  cs_real_t  *v_weight = NULL;
+  BFT_MALLOC(v_weight, mesh->n_vertices, cs_real_t);
 
-  /* Case for vector or tensor variable */
-  /*------------------------------------*/
+  cs_cell_to_vertex(CS_CELL_TO_VERTEX_LR,
+                    0,
+                    1,
+                    true, /* ignore periodicity of rotation */
+                    NULL,
+                    cell_vol,
+                    NULL,
+                    v_weight);
 
-  else {
+  _les_filter_op_t  *op = NULL;
 
-    /* Synchronize variable */
+  BFT_MALLOC(op, 1, _les_filter_op_t);
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, val, stride);
+  op->n_rows = n_cells;
+  op->owner = false;
+  op->idx = c2v->idx;
+  op->ids = c2v->ids;
 
-    /* Define filtered variable array */
+  BFT_MALLOC(op->w, c2v->idx[n_cells], cs_real_t);
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+  const cs_lnum_t  *idx = op->idx;
+  const cs_lnum_t  *ids = op->ids;
+  cs_real_t  *w = op->w;
 
-      for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-        const cs_lnum_t ic = i *_stride + c_id;
-        w1[ic] = val[ic] * cell_vol[i];
-        w2[ic] = cell_vol[i];
-      }
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_real_t  w_sum = 0;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++)
+      w_sum += v_weight[ids[j]];
+    cs_real_t  inv_w_sum = 1. / w_sum;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++)
+      w[j] = v_weight[ids[j]] * inv_w_sum;
+  }
 
-      /* Loop on connected cells (without cells sharing a face) */
+  BFT_FREE(v_weight);
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-          const cs_lnum_t ic = i *_stride + c_id;
-          const cs_lnum_t kc = k *_stride + c_id;
-          w1[ic] += val[kc] * cell_vol[k];
-          w2[ic] += cell_vol[k];
-        }
-      }
+  return op;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply a filter operator to an interleaved array.
+ *
+ * parameters:
+ *   op     <-- pointer to filter operator
+ *   stride <-- stride of array to filter
+ *   val    <-- array of values to filter
+ *   f_val  --> array of filtered values
+ *----------------------------------------------------------------------------*/
 
-    } /* End of loop on cells */
+static void
+_apply_filter_op(const _les_filter_op_t  *op,
+                 cs_lnum_t                stride,
+                 const cs_real_t          val[restrict],
+                 cs_real_t                f_val[restrict])
+{
+  const cs_lnum_t  n_rows = op->n_rows;
+  const cs_lnum_t  *restrict idx = op->idx;
+  const cs_lnum_t  *restrict ids = op->ids;
+  const cs_real_t  *restrict w = op->w;
 
-#   pragma omp parallel for if (mesh->n_ghost_cells > CS_THR_MIN)
-    for (cs_lnum_t i = n_cells; i < n_cells_ext; i++) {
-      for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-        const cs_lnum_t ic = i *_stride + c_id;
-        w1[ic] = 0;
-        w2[ic] = 0;
-      }
-    }
+  if (stride == 1) {
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for if (n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      cs_real_t  _f_val = 0;
+      for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++)
+        _f_val += w[j] * val[ids[j]];
+      f_val[i] = _f_val;
+    }
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  }
+  else {
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+#   pragma omp parallel for if (n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      cs_real_t  *restrict _f_val = f_val + i*stride;
+      for (cs_lnum_t k = 0; k < stride; k++)
+        _f_val[k] = 0;
+      for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++) {
+        const cs_real_t  _w = w[j];
+        const cs_real_t  *restrict _val = val + ids[j]*stride;
+        for (cs_lnum_t k = 0; k < stride; k++)
+          _f_val[k] += _w * _val[k];
+      }
+    }
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+  }
+}
 
-          for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-            const cs_lnum_t ic = i *_stride + c_id;
-            const cs_lnum_t jc = j *_stride + c_id;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models.
+ *
+ * This function deals with the standard or extended neighborhood.
+ *
+ * \param[in]   stride   stride of array to filter
+ * \param[in]   val      array of values to filter
+ * \param[out]  f_val    array of filtered values
+ */
+/*----------------------------------------------------------------------------*/
 
-            w1[ic] += val[jc] * cell_vol[j];
-            w2[ic] += cell_vol[j];
+static void
+_les_filter_ext_neighborhood(int        stride,
+                             cs_real_t  val[],
+                             cs_real_t  f_val[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
 
-            w1[jc] += val[ic] * cell_vol[i];
-            w2[jc] += cell_vol[i];
-          }
+  if (_ext_filter == NULL)
+    _ext_filter = _build_ext_filter_op();
 
-        }
+  /* Synchronize variable */
 
-      }
+  if (mesh->halo != NULL)
+    cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, val, stride);
 
-    }
+  /* Define filtered variable array */
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_elts_l; i++)
-      f_val[i] = w1[i]/w2[i];
+  _apply_filter_op(_ext_filter, stride, val, f_val);
 
-    /* Synchronize variable */
+  /* Synchronize variable */
 
-    if (mesh->halo != NULL)
+  if (mesh->halo != NULL) {
+    if (stride == 1)
+      cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val);
+    else
       cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, f_val, stride);
   }
-
-  BFT_FREE(w2);
-  BFT_FREE(w1);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -291,6 +402,11 @@ _les_filter_ext_neighborhood(int        stride,
  *
  * This function deals with the standard or extended neighborhood.
  *
+ * Filter weights are computed on first use and kept until
+ * \ref cs_les_filter_free is called, and interleaved arrays are filtered
+ * in a single pass, so filtering several fields at once using a stride
+ * larger than 1 is more efficient than filtering them separately.
+ *
  * \param[in]   stride   stride of array to filter
  * \param[in]   val      array of values to filter
  * \param[out]  f_val    array of filtered values
@@ -307,17 +423,18 @@ cs_les_filter(int        stride,
     return;
   }
 
-  cs_real_t *v_val = NULL, *v_weight = NULL;
+  cs_real_t *v_val = NULL;
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_lnum_t  _stride = stride;
-  const cs_lnum_t  n_cells = mesh->n_cells;
   const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
 
+  if (_v2c_filter == NULL)
+    _v2c_filter = _build_v2c_filter_op();
+
   /* Allocate and initialize working buffer */
 
   BFT_MALLOC(v_val, mesh->n_vertices*_stride, cs_real_t);
-  BFT_MALLOC(v_weight, mesh->n_vertices, cs_real_t);
 
   /* Define filtered variable array */
 
@@ -330,64 +447,10 @@ cs_les_filter(int        stride,
                     NULL,
                     v_val);
 
-  cs_cell_to_vertex(CS_CELL_TO_VERTEX_LR,
-                    0,
-                    1,
-                    true, /* ignore periodicity of rotation */
-                    NULL,
-                    cell_vol,
-                    NULL,
-                    v_weight);
-
   /* Build cell average */
 
-  const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
-  const cs_lnum_t *c2v_idx = c2v->idx;
-  const cs_lnum_t *c2v_ids = c2v->ids;
-
-  if (_stride == 1) {
-
-#   pragma omp parallel for if (n_cells > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cs_lnum_t s_id = c2v_idx[c_id];
-      cs_lnum_t e_id = c2v_idx[c_id+1];
-      cs_real_t _f_val = 0, _f_weight = 0;
-      for (cs_lnum_t j = s_id; j < e_id; j++) {
-        cs_lnum_t v_id = c2v_ids[j];
-        _f_val += v_val[v_id] * v_weight[v_id];
-        _f_weight += v_weight[v_id];
-      }
-      f_val[c_id] = _f_val / _f_weight;
-    }
-
-  }
-  else {
-
-    assert(_stride <= 9);
+  _apply_filter_op(_v2c_filter, _stride, v_val, f_val);
 
-#   pragma omp parallel for if (n_cells > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cs_lnum_t s_id = c2v_idx[c_id];
-      cs_lnum_t e_id = c2v_idx[c_id+1];
-      cs_real_t _f_val[9], _f_weight = 0;
-      for (cs_lnum_t k = 0; k < _stride; k++)
-        _f_val[k] = 0;
-      for (cs_lnum_t j = s_id; j < e_id; j++) {
-        cs_lnum_t v_id = c2v_ids[j];
-        for (cs_lnum_t k = 0; k < _stride; k++) {
-          _f_val[k] += v_val[v_id*_stride + k] * v_weight[v_id];
-        }
-        _f_weight += v_weight[v_id];
-      }
-      for (cs_lnum_t k = 0; k < _stride; k++) {
-        f_val[c_id*_stride + k] = _f_val[k] / _f_weight;
-      }
-
-    }
-
-  }
-
-  BFT_FREE(v_weight);
   BFT_FREE(v_val);
 
   /* Synchronize variable */
@@ -396,6 +459,22 @@ cs_les_filter(int        stride,
     cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD, f_val, _stride);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free filter operators.
+ *
+ * This function should be called when the mesh or its quantities
+ * are modified.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_free(void)
+{
+  _destroy_filter_op(&_ext_filter);
+  _destroy_filter_op(&_v2c_filter);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
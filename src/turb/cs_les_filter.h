@@ -54,6 +54,11 @@ BEGIN_C_DECLS
  *
  * This function deals with the standard or extended neighborhood.
  *
+ * Filter weights are computed on first use and kept until
+ * cs_les_filter_free is called; filtering several fields at once
+ * using an interleaved array is more efficient than filtering them
+ * separately.
+ *
  * parameters:
  *   stride  <--  stride of array to filter
  *   val     <->  array of values to filter
@@ -65,6 +70,16 @@ cs_les_filter(int        stride,
               cs_real_t  val[],
               cs_real_t  f_val[]);
 
+/*----------------------------------------------------------------------------
+ * Free filter operators.
+ *
+ * This function should be called when the mesh or its quantities
+ * are modified.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_free(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
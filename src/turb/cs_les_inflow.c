@@ -58,6 +58,7 @@
 #include "cs_parall.h"
 #include "cs_random.h"
 #include "cs_timer.h"
+#include "cs_time_step.h"
 #include "cs_mesh_location.h"
 #include "cs_restart.h"
 #include "cs_restart_default.h"
@@ -145,6 +146,21 @@ typedef struct {
   int     rank;
 } _mpi_double_int_t;
 
+/* Spatial bins of synthetic eddies (cell list) */
+
+typedef struct {
+
+  int         n_bins[3];           /* Number of bins in each direction */
+  cs_real_t   min_coord[3];        /* Minimum coordinates of binned box */
+  cs_real_t   inv_width[3];        /* Inverse of bin width */
+
+  cs_lnum_t  *idx;                 /* Index of structures in each bin
+                                      (size: n_bins[0]*n_bins[1]*n_bins[2]
+                                      + 1) */
+  int        *struct_ids;          /* Ids of structures in each bin */
+
+} _sem_bins_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -169,6 +185,10 @@ static bool  _allow_restart_write = true;
 
 static int   _n_sem_vol_restart_structures = 50;
 
+/* SEM rank-local generation of eddies */
+
+static bool  _sem_local_generation = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -370,6 +390,201 @@ _batten_method(cs_lnum_t            n_points,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return a uniform random value in [0, 1[ for the SEM.
+ *
+ * With rank-local generation, a counter-based generator (hash of the
+ * inlet, structure, time step and draw ids) is used, so that all ranks
+ * obtain the same values independently. Otherwise, the global random
+ * number generator is used.
+ *
+ * parameters:
+ *   local_gen  <-- use counter-based (rank-local) generation ?
+ *   inlet_id   <-- associated inlet id
+ *   struct_id  <-- structure id
+ *   step       <-- time step number
+ *   draw_id    <-- draw id for this structure and time step
+ *
+ * returns:
+ *   random value
+ *----------------------------------------------------------------------------*/
+
+static double
+_sem_random(bool  local_gen,
+            int   inlet_id,
+            int   struct_id,
+            int   step,
+            int   draw_id)
+{
+  double r = 0.;
+
+  if (local_gen) {
+
+    /* splitmix64 finalizer applied to successive keys */
+
+    uint64_t key[4] = {(uint64_t)inlet_id, (uint64_t)step,
+                       (uint64_t)struct_id, (uint64_t)draw_id};
+    uint64_t z = 0;
+
+    for (int i = 0; i < 4; i++) {
+      z ^= key[i];
+      z += 0x9e3779b97f4a7c15ULL;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      z = z ^ (z >> 31);
+    }
+
+    r = (double)(z >> 11) * (1.0/9007199254740992.0);
+
+  }
+  else
+    cs_random_uniform(1, &r);
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------
+ * Return bin coordinate associated with a given coordinate for SEM bins.
+ *
+ * parameters:
+ *   bins     <-- pointer to SEM bins structure
+ *   coo_id   <-- coordinate id
+ *   x        <-- coordinate value
+ *
+ * returns:
+ *   bin coordinate, clipped to the binned box
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_sem_bin_coord(const _sem_bins_t  *bins,
+               int                 coo_id,
+               cs_real_t           x)
+{
+  cs_real_t c = (x - bins->min_coord[coo_id]) * bins->inv_width[coo_id];
+
+  if (c < 0.)
+    return 0;
+  else if (c < bins->n_bins[coo_id])
+    return (int)c;
+  else
+    return bins->n_bins[coo_id] - 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Build spatial bins for structures which may reach local points.
+ *
+ * Only structures inside the local box (points extents enlarged by their
+ * length scale) are binned; bin widths are based on the maximum local
+ * length scale, and the total number of bins is limited to the number
+ * of binned structures.
+ *
+ * parameters:
+ *   inflow     <-- pointer to SEM structure
+ *   box_min    <-- local box minimum coordinates
+ *   box_max    <-- local box maximum coordinates
+ *   ls_max     <-- local maximum length scale in each direction
+ *   bins       --> SEM bins structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bins_build(const cs_inflow_sem_t  *inflow,
+                const cs_real_t         box_min[3],
+                const cs_real_t         box_max[3],
+                const cs_real_t         ls_max[3],
+                _sem_bins_t            *bins)
+{
+  const cs_real_3_t *position = (const cs_real_3_t *)inflow->position;
+
+  /* Structures inside local box */
+
+  int *bin_id;
+  BFT_MALLOC(bin_id, inflow->n_structures, int);
+
+  cs_lnum_t n_local = 0;
+
+  for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    bin_id[struct_id] = -1;
+    if (   position[struct_id][0] >= box_min[0]
+        && position[struct_id][0] <= box_max[0]
+        && position[struct_id][1] >= box_min[1]
+        && position[struct_id][1] <= box_max[1]
+        && position[struct_id][2] >= box_min[2]
+        && position[struct_id][2] <= box_max[2]) {
+      bin_id[struct_id] = 0;
+      n_local++;
+    }
+  }
+
+  /* Bin dimensions */
+
+  const cs_lnum_t n_bins_max = CS_MAX(n_local, 1);
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    cs_real_t l = box_max[coo_id] - box_min[coo_id];
+    cs_real_t nb = 1.;
+    if (ls_max[coo_id] > 0. && l > 0.)
+      nb = CS_MIN(l / ls_max[coo_id], (cs_real_t)n_bins_max);
+    bins->n_bins[coo_id] = CS_MAX((int)nb, 1);
+  }
+
+  while (  (cs_gnum_t)bins->n_bins[0]
+         * (cs_gnum_t)bins->n_bins[1]
+         * (cs_gnum_t)bins->n_bins[2] > (cs_gnum_t)n_bins_max) {
+    int coo_id = 0;
+    for (int j = 1; j < 3; j++) {
+      if (bins->n_bins[j] > bins->n_bins[coo_id])
+        coo_id = j;
+    }
+    bins->n_bins[coo_id] = (bins->n_bins[coo_id] + 1) / 2;
+  }
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    cs_real_t l = box_max[coo_id] - box_min[coo_id];
+    bins->min_coord[coo_id] = box_min[coo_id];
+    bins->inv_width[coo_id] = (l > 0.) ? bins->n_bins[coo_id] / l : 0.;
+  }
+
+  /* Fill bins (by increasing structure id in each bin) */
+
+  const cs_lnum_t n_bins_tot
+    = bins->n_bins[0]*bins->n_bins[1]*bins->n_bins[2];
+
+  BFT_MALLOC(bins->idx, n_bins_tot + 1, cs_lnum_t);
+  BFT_MALLOC(bins->struct_ids, n_local, int);
+
+  for (cs_lnum_t i = 0; i < n_bins_tot + 1; i++)
+    bins->idx[i] = 0;
+
+  for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    if (bin_id[struct_id] > -1) {
+      int b[3];
+      for (int coo_id = 0; coo_id < 3; coo_id++)
+        b[coo_id] = _sem_bin_coord(bins, coo_id, position[struct_id][coo_id]);
+      bin_id[struct_id] = (b[2]*bins->n_bins[1] + b[1])*bins->n_bins[0] + b[0];
+      bins->idx[bin_id[struct_id] + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_bins_tot; i++)
+    bins->idx[i+1] += bins->idx[i];
+
+  cs_lnum_t *count;
+  BFT_MALLOC(count, n_bins_tot, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_bins_tot; i++)
+    count[i] = 0;
+
+  for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    int b_id = bin_id[struct_id];
+    if (b_id > -1) {
+      bins->struct_ids[bins->idx[b_id] + count[b_id]] = struct_id;
+      count[b_id] += 1;
+    }
+  }
+
+  BFT_FREE(count);
+  BFT_FREE(bin_id);
+}
+
 /*----------------------------------------------------------------------------
  * Modify the normal component of the fluctuations such that the mass flowrate
  * of the fluctuating field is zero.
@@ -1023,6 +1238,7 @@ cs_les_inflow_add_inlet(cs_les_inflow_type_t   type,
       cs_inflow_sem_t *inflow;
       BFT_MALLOC(inflow, 1, cs_inflow_sem_t);
       inflow->volume_mode = (volume_mode == true) ? 1 : 0;
+      inflow->inlet_id = cs_glob_inflow_n_inlets;
       inflow->n_structures = n_entities;
 
       BFT_MALLOC(inflow->position, inflow->n_structures, cs_real_3_t);
@@ -1644,8 +1860,19 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
   cs_real_t  box_min_coord[3];
   cs_real_t  box_max_coord[3];
 
+  cs_real_t  l_box_min_coord[3];
+  cs_real_t  l_box_max_coord[3];
+  cs_real_t  l_length_scale_max[3];
+
   cs_gnum_t  count[3] = {0, 0, 0};
 
+  /* With rank-local generation, all ranks update the structures
+     identically, so no broadcast is needed */
+
+  const bool local_gen = _sem_local_generation;
+  const bool gen_rank = (local_gen || cs_glob_rank_id <= 0);
+  const int  step = cs_glob_time_step->nt_cur;
+
   /* Computation of the characteristic scale of the synthetic eddies */
   /*-----------------------------------------------------------------*/
 
@@ -1786,6 +2013,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
   for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
     box_min_coord[coo_id] =  HUGE_VAL;
     box_max_coord[coo_id] = -HUGE_VAL;
+    l_length_scale_max[coo_id] = 0.;
   }
 
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++)
@@ -1802,8 +2030,18 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
                  point_coordinates[point_id][coo_id]
                  + length_scale[point_id][coo_id]);
 
+      l_length_scale_max[coo_id]
+        = CS_MAX(l_length_scale_max[coo_id], length_scale[point_id][coo_id]);
+
     }
 
+  /* Keep local box: only structures inside it may reach local points */
+
+  for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+    l_box_min_coord[coo_id] = box_min_coord[coo_id];
+    l_box_max_coord[coo_id] = box_max_coord[coo_id];
+  }
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_rank_id >= 0) {
@@ -1850,7 +2088,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   if (initialize == 1) {
 
-    if (cs_glob_rank_id <= 0) {
+    if (gen_rank) {
 
       for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
 
@@ -1858,7 +2096,8 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
         for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
 
-          cs_random_uniform(1, &random);
+          random = _sem_random(local_gen, inflow->inlet_id,
+                               struct_id, step, coo_id);
           inflow->energy[struct_id][coo_id] = (random < 0.5) ? -1. : 1.;
 
         }
@@ -1867,7 +2106,8 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
         for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
 
-          cs_random_uniform(1, &random);
+          random = _sem_random(local_gen, inflow->inlet_id,
+                               struct_id, step, 3 + coo_id);
           inflow->position[struct_id][coo_id]
             = box_min_coord[coo_id] + random*box_length[coo_id];
 
@@ -1879,7 +2119,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
 #if defined(HAVE_MPI)
 
-    if (cs_glob_rank_id >= 0) {
+    if (cs_glob_rank_id >= 0 && local_gen == false) {
 
       MPI_Bcast(inflow->energy, 3*inflow->n_structures,
                 CS_MPI_REAL, 0, cs_glob_mpi_comm);
@@ -1946,7 +2186,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
   /* Time evolution of the eddies */
   /*------------------------------*/
 
-  if (cs_glob_rank_id <= 0) {
+  if (gen_rank) {
 
     /* Time advancement of the eddies */
 
@@ -1990,7 +2230,8 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
         for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
 
           if (randomize[coo_id] == 1) {
-            cs_random_uniform(1, &random);
+            random = _sem_random(local_gen, inflow->inlet_id,
+                                 struct_id, step, 6 + coo_id);
             inflow->position[struct_id][coo_id]
               = box_min_coord[coo_id] + random*box_length[coo_id];
           }
@@ -2001,7 +2242,8 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
         for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
 
-          cs_random_uniform(1, &random);
+          random = _sem_random(local_gen, inflow->inlet_id,
+                               struct_id, step, 9 + coo_id);
           inflow->energy[struct_id][coo_id] = (random < 0.5) ? -1. : 1.;
         }
 
@@ -2019,7 +2261,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_rank_id >= 0) {
+  if (cs_glob_rank_id >= 0 && local_gen == false) {
 
     MPI_Bcast(inflow->energy,   3*inflow->n_structures,
               CS_MPI_REAL, 0, cs_glob_mpi_comm);
@@ -2030,38 +2272,78 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
 #endif
 
+  if (n_points == 0) {
+    BFT_FREE(length_scale);
+    return;
+  }
+
   /* Computation of the eddy signal */
   /*--------------------------------*/
 
+  /* Structures reaching a given point lie within its length scale
+     in each direction, so only neighboring bins need to be scanned */
+
+  _sem_bins_t bins;
+
+  _sem_bins_build(inflow,
+                  l_box_min_coord,
+                  l_box_max_coord,
+                  l_length_scale_max,
+                  &bins);
+
   alpha = sqrt(box_volume / (double)inflow->n_structures);
 
+  const cs_real_3_t *position = (const cs_real_3_t *)inflow->position;
+  const cs_real_3_t *energy = (const cs_real_3_t *)inflow->energy;
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
+    const cs_real_t *x = point_coordinates[point_id];
+    const cs_real_t *ls = length_scale[point_id];
+
     cs_real_t distance[3];
+    int b_s[3], b_e[3];
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      b_s[coo_id] = _sem_bin_coord(&bins, coo_id, x[coo_id] - ls[coo_id]);
+      b_e[coo_id] = _sem_bin_coord(&bins, coo_id, x[coo_id] + ls[coo_id]);
+    }
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id][coo_id]
-                 - inflow->position[struct_id][coo_id]);
+    for (int k = b_s[2]; k <= b_e[2]; k++) {
+      for (int j = b_s[1]; j <= b_e[1]; j++) {
+        for (int i = b_s[0]; i <= b_e[0]; i++) {
 
-      if (   distance[0] < length_scale[point_id][0]
-          && distance[1] < length_scale[point_id][1]
-          && distance[2] < length_scale[point_id][2]) {
+          cs_lnum_t bin_id = (k*bins.n_bins[1] + j)*bins.n_bins[0] + i;
 
-        cs_real_t form_function = 1.;
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id][coo_id])
-            /sqrt(2./3.*length_scale[point_id][coo_id]);
+          for (cs_lnum_t l = bins.idx[bin_id]; l < bins.idx[bin_id+1]; l++) {
 
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id][coo_id]
-            += inflow->energy[struct_id][coo_id]*form_function;
+            int struct_id = bins.struct_ids[l];
 
-      }
+            for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+              distance[coo_id]
+                = CS_ABS(x[coo_id] - position[struct_id][coo_id]);
+
+            if (   distance[0] < ls[0]
+                && distance[1] < ls[1]
+                && distance[2] < ls[2]) {
+
+              cs_real_t form_function = 1.;
+              for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+                form_function *=
+                  (1.-distance[coo_id]/ls[coo_id])
+                  /sqrt(2./3.*ls[coo_id]);
+
+              for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+                fluctuations[point_id][coo_id]
+                  += energy[struct_id][coo_id]*form_function;
+
+            }
+
+          }
 
+        }
+      }
     }
 
     for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
@@ -2069,6 +2351,9 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
 
+  BFT_FREE(bins.struct_ids);
+  BFT_FREE(bins.idx);
+
   BFT_FREE(length_scale);
 }
 
@@ -2159,6 +2444,42 @@ cs_les_synthetic_eddy_get_n_restart_structures(void)
   return _n_sem_vol_restart_structures;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether synthetic eddies are generated locally on each rank.
+ *
+ * By default, synthetic eddies are generated and convected on rank 0,
+ * then broadcast to all ranks at each time step.
+ *
+ * When local generation is activated, all ranks update the eddies
+ * redundantly using a counter-based random sequence (so that the eddy
+ * field is identical on all ranks without communication), and each rank
+ * only evaluates the eddies which may reach its own points.
+ *
+ * \param[in]  local_generation  true to activate rank-local generation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_synthetic_eddy_set_local_generation(bool  local_generation)
+{
+  _sem_local_generation = local_generation;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether synthetic eddies are generated locally on each rank.
+ *
+ * \return   true if rank-local generation is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_les_synthetic_eddy_get_local_generation(void)
+{
+  return _sem_local_generation;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Query behavior of the LES inflow module in case of restart.
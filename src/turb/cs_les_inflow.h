@@ -77,6 +77,8 @@ typedef struct {
   int           n_structures;  /*!< Number of coherent structures */
   int           volume_mode;   /*!< Indicator to use classic inlet SEM (0)
                                     or volumic SEM over the domain */
+  int           inlet_id;      /*!< Associated inlet id (used to define
+                                    independent rank-local random streams) */
   cs_real_3_t  *position;      /*!< Position of the structures */
   cs_real_3_t  *energy;        /*!w Anisotropic energy of the structures */
 
@@ -244,6 +246,36 @@ cs_les_synthetic_eddy_set_n_restart_structures(int  n_structures);
 int
 cs_les_synthetic_eddy_get_n_restart_structures(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether synthetic eddies are generated locally on each rank.
+ *
+ * By default, synthetic eddies are generated and convected on rank 0,
+ * then broadcast to all ranks at each time step.
+ *
+ * When local generation is activated, all ranks update the eddies
+ * redundantly using a counter-based random sequence (so that the eddy
+ * field is identical on all ranks without communication), and each rank
+ * only evaluates the eddies which may reach its own points.
+ *
+ * \param[in]  local_generation  true to activate rank-local generation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_synthetic_eddy_set_local_generation(bool  local_generation);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether synthetic eddies are generated locally on each rank.
+ *
+ * \return   true if rank-local generation is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_les_synthetic_eddy_get_local_generation(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Query behavior of the LES inflow module in case of restart.
@@ -1108,8 +1108,9 @@ cs_turbulence_ke(cs_lnum_t        ncesmp,
 
   if (cs_glob_turb_model->iturb == CS_TURB_K_EPSILON_LS) {
 
-    /* Gradient of square root of k
-     * -----------------------------*/
+    /* Gradients of square root of k and of the strain rate
+     * (grad S), computed together
+     * ------------------------------------------------------*/
 
     coefap = (cs_real_t *)f_k->bc_coeffs->a;
     coefbp = (cs_real_t *)f_k->bc_coeffs->b;
@@ -1125,66 +1126,41 @@ cs_turbulence_ke(cs_lnum_t        ncesmp,
       coefb_sqk[face_id] = coefbp[face_id];
     }
 
-    cs_halo_type_t halo_type = CS_HALO_STANDARD;
-    cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
-
-    cs_gradient_type_by_imrgra(vcopt_k->imrgra,
-                               &gradient_type,
-                               &halo_type);
-
-    cs_gradient_scalar("grad_sqk",
-                       gradient_type,
-                       halo_type,
-                       1,     /* inc */
-                       true,  /* iccocg */
-                       vcopt_k->nswrgr,
-                       0,
-                       0,
-                       1,     /* w_stride */
-                       vcopt_k->verbosity,
-                       vcopt_k->imligr,
-                       vcopt_k->epsrgr,
-                       vcopt_k->climgr,
-                       NULL,
-                       coefa_sqk,
-                       coefb_sqk,
-                       sqrt_k,
-                       NULL,
-                       NULL,  /* internal coupling */
-                       grad_sqk);
-
-    /* Gradient of the Strain gradient (grad S)
-       --------------------------------------- */
-
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
       coefa_sqs[face_id] = 0.;
       coefb_sqs[face_id] = 1.;
     }
 
+    cs_halo_type_t halo_type = CS_HALO_STANDARD;
+    cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
     cs_gradient_type_by_imrgra(vcopt_k->imrgra,
                                &gradient_type,
                                &halo_type);
 
-    cs_gradient_scalar("grad_sqs",
-                       gradient_type,
-                       halo_type,
-                       1,     /* inc */
-                       true,  /* iccocg */
-                       vcopt_k->nswrgr,
-                       0,
-                       0,
-                       1,     /* w_stride */
-                       vcopt_k->verbosity,
-                       vcopt_k->imligr,
-                       vcopt_k->epsrgr,
-                       vcopt_k->climgr,
-                       NULL,
-                       coefa_sqs,
-                       coefb_sqs,
-                       sqrt_strain,
-                       NULL,
-                       NULL, /* internal coupling */
-                       grad_sqs);
+    const char *var_name[2] = {"grad_sqk", "grad_sqs"};
+    const cs_real_t *coefa_ls[2] = {coefa_sqk, coefa_sqs};
+    const cs_real_t *coefb_ls[2] = {coefb_sqk, coefb_sqs};
+    cs_real_t *var_ls[2] = {sqrt_k, sqrt_strain};
+    cs_real_3_t *grad_ls[2] = {grad_sqk, grad_sqs};
+
+    cs_gradient_scalar_multi(2,
+                             var_name,
+                             gradient_type,
+                             halo_type,
+                             1,     /* inc */
+                             true,  /* iccocg */
+                             vcopt_k->nswrgr,
+                             vcopt_k->verbosity,
+                             vcopt_k->imligr,
+                             vcopt_k->epsrgr,
+                             vcopt_k->climgr,
+                             coefa_ls,
+                             coefb_ls,
+                             var_ls,
+                             NULL,
+                             NULL,  /* internal coupling */
+                             grad_ls);
 
   }
 
@@ -391,17 +391,17 @@ cs_turbulence_kw(cs_lnum_t        ncesmp,
 
   bool use_previous_t = true;
 
-  cs_field_gradient_scalar(f_k,
-                           use_previous_t,
-                           1,     /* inc */
-                           true,  /* iccocg */
-                           gradk);
-
-  cs_field_gradient_scalar(f_omg,
-                           use_previous_t,
-                           1,     /* inc */
-                           true,  /* iccocg */
-                           grado);
+  {
+    const cs_field_t *f_kw[2] = {f_k, f_omg};
+    cs_real_3_t *grad_kw[2] = {gradk, grado};
+
+    cs_field_gradient_scalar_multi(2,
+                                   f_kw,
+                                   use_previous_t,
+                                   1,     /* inc */
+                                   true,  /* iccocg */
+                                   grad_kw);
+  }
 
   /* Initialization of work arrays in case of Hybrid turbulence modelling */
 
@@ -689,6 +689,8 @@ do iel = 1, ncel
   cvar_rij(isou,iel) = cvar_var(iel)
 enddo
 
+call field_increment_version(ivarfl(irij))
+
 ! Free memory
 
 deallocate(cvar_var, cvara_var)
@@ -322,6 +322,8 @@ if (ntcabs.eq.1.and.reinit_turb.eq.1.and.iturb.eq.32) then
 
   call field_current_to_previous(ivarfl(iu))
   call field_current_to_previous(ivarfl(irij))
+  call field_increment_version(ivarfl(ial))
+  call field_increment_version(ivarfl(iep))
 
   deallocate(grad)
 endif
@@ -131,6 +131,7 @@ double precision, allocatable, dimension(:) :: s_n, sf_n
 double precision, allocatable, dimension(:) :: w0, xrof, xro
 double precision, allocatable, dimension(:,:) :: grads, scami, scamif
 double precision, allocatable, dimension(:,:) :: xmij, w61, w62, gradsf
+double precision, allocatable, dimension(:,:) :: w21, w22, w91, w92
 double precision, dimension(:,:), pointer :: coefau
 double precision, dimension(:,:,:), pointer :: coefbu
 double precision, dimension(:), pointer :: crom, coefas, coefbs, cvar_sca
@@ -289,70 +290,38 @@ allocate(w5(ncelet), w6(ncelet), w7(ncelet))
 allocate(w8(ncelet), w9(ncelet))
 
 ! Filtering the velocity and its square
+! (all products are filtered in a single pass)
 
-! U**2
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(1,iel)*vel(1,iel)
-enddo
-call les_filter(1, w0, w1)
-
-! V**2
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(2,iel)*vel(2,iel)
-enddo
-call les_filter(1, w0, w2)
-
-! W**2
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(3,iel)*vel(3,iel)
-enddo
-call les_filter(1, w0, w3)
-
-! UV
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(1,iel)*vel(2,iel)
-enddo
-call les_filter(1, w0, w4)
-
-! UW
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(1,iel)*vel(3,iel)
-enddo
-call les_filter(1, w0, w5)
-
-! VW
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(2,iel)*vel(3,iel)
-enddo
-call les_filter(1, w0, w6)
+allocate(w91(9,ncelet), w92(9,ncelet))
 
-! U
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(1,iel)
-enddo
-call les_filter(1, w0, w7)
 do iel = 1, ncel
-  w7(iel) = w7(iel)/xrof(iel)
+  w91(1,iel) = xro(iel)*vel(1,iel)*vel(1,iel)  ! U**2
+  w91(2,iel) = xro(iel)*vel(2,iel)*vel(2,iel)  ! V**2
+  w91(3,iel) = xro(iel)*vel(3,iel)*vel(3,iel)  ! W**2
+  w91(4,iel) = xro(iel)*vel(1,iel)*vel(2,iel)  ! UV
+  w91(5,iel) = xro(iel)*vel(1,iel)*vel(3,iel)  ! UW
+  w91(6,iel) = xro(iel)*vel(2,iel)*vel(3,iel)  ! VW
+  w91(7,iel) = xro(iel)*vel(1,iel)             ! U
+  w91(8,iel) = xro(iel)*vel(2,iel)             ! V
+  w91(9,iel) = xro(iel)*vel(3,iel)             ! W
 enddo
 
-! V
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(2,iel)
-enddo
-call les_filter(1, w0, w8)
-do iel = 1, ncel
-  w8(iel) = w8(iel)/xrof(iel)
-enddo
+call les_filter(9, w91, w92)
 
-! W
-do iel = 1,ncel
-  w0(iel) = xro(iel)*vel(3,iel)
-enddo
-call les_filter(1, w0, w9)
 do iel = 1, ncel
-  w9(iel) = w9(iel)/xrof(iel)
+  w1(iel) = w92(1,iel)
+  w2(iel) = w92(2,iel)
+  w3(iel) = w92(3,iel)
+  w4(iel) = w92(4,iel)
+  w5(iel) = w92(5,iel)
+  w6(iel) = w92(6,iel)
+  w7(iel) = w92(7,iel)/xrof(iel)
+  w8(iel) = w92(8,iel)/xrof(iel)
+  w9(iel) = w92(9,iel)/xrof(iel)
 enddo
 
+deallocate(w91, w92)
+
 do iel = 1, ncel
 
   ! Calculation of Lij
@@ -391,9 +360,19 @@ endif
 ! denominator, then only we make the quotient.
 ! The user can do otherwise in ussmag.
 
-call les_filter(1, w1, w3)
+allocate(w21(2,ncelet), w22(2,ncelet))
+
+do iel = 1, ncel
+  w21(1,iel) = w1(iel)
+  w21(2,iel) = w2(iel)
+enddo
+
+call les_filter(2, w21, w22)
 
-call les_filter(1, w2, w4)
+do iel = 1, ncel
+  w3(iel) = w22(1,iel)
+  w4(iel) = w22(2,iel)
+enddo
 
 do iel = 1, ncel
   if(abs(w4(iel)).le.epzero) then
@@ -570,23 +549,19 @@ do jj = 1, nscal
     !================================================================
     ! 7.2.  Compute the Li for scalar
     !================================================================
-    ! rho*U*Y
+    ! rho*U*Y, rho*V*Y, rho*W*Y
+    ! (reuse grads and gradsf as temporary arrays)
     do iel = 1, ncel
-      w0(iel) = xro(iel)*vel(1,iel)*cvar_sca(iel)
+      grads(1,iel) = xro(iel)*vel(1,iel)*cvar_sca(iel)
+      grads(2,iel) = xro(iel)*vel(2,iel)*cvar_sca(iel)
+      grads(3,iel) = xro(iel)*vel(3,iel)*cvar_sca(iel)
     enddo
-    call les_filter(1, w0, w1)
-
-    ! rho*V*Y
+    call les_filter(3, grads, gradsf)
     do iel = 1, ncel
-      w0(iel) = xro(iel)*vel(2,iel)*cvar_sca(iel)
+      w1(iel) = gradsf(1,iel)
+      w2(iel) = gradsf(2,iel)
+      w3(iel) = gradsf(3,iel)
     enddo
-    call les_filter(1, w0, w2)
-
-    ! rho*W*Y
-    do iel = 1, ncel
-      w0(iel) = xro(iel)*vel(3,iel)*cvar_sca(iel)
-    enddo
-    call les_filter(1, w0, w3)
 
     do iel = 1, ncel
       scal1 = w1(iel) - xrof(iel)*w7(iel)*w4(iel)
@@ -602,8 +577,15 @@ do jj = 1, nscal
       call synsca(w2)
     endif
 
-    call les_filter(1, w1, w3)
-    call les_filter(1, w2, w4)
+    do iel = 1, ncel
+      w21(1,iel) = w1(iel)
+      w21(2,iel) = w2(iel)
+    enddo
+    call les_filter(2, w21, w22)
+    do iel = 1, ncel
+      w3(iel) = w22(1,iel)
+      w4(iel) = w22(2,iel)
+    enddo
 
     !================================================================
     ! 7.3.  Compute the SGS flux coefficient and SGS diffusivity
@@ -629,6 +611,7 @@ enddo
 
 
 ! Free memory
+deallocate(w21, w22)
 deallocate(s_n, sf_n)
 deallocate(w9, w8)
 deallocate(w7, w6, w5)
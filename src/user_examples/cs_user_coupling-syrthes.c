@@ -163,6 +163,16 @@ cs_user_syrthes_coupling(void)
      cs_syr_coupling_set_explicit_treatment();
   */
 
+  /* Only for a surface coupling:
+      By default, both codes wait for each other at each exchange.
+      Lagged exchange allows the fluid and solid solves to run concurrently,
+      using a solid temperature lagged by one time step; relaxing the
+      received wall temperature (factor in ]0, 1]) may help stability:
+
+     cs_syr_coupling_set_lagged_exchange(1);
+     cs_syr_coupling_set_relaxation(0.7);
+  */
+
 }
 
 /*----------------------------------------------------------------------------*/
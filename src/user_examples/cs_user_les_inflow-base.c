@@ -79,6 +79,13 @@ cs_user_les_inflow_define(void)
                             false);  /* allow_write */
   /*! [set_restart] */
 
+  /* For large SEM inlets in parallel, eddies may be generated on each
+     rank rather than broadcast from rank 0 at each time step */
+
+  /*! [set_local_generation] */
+  cs_les_synthetic_eddy_set_local_generation(true);
+  /*! [set_local_generation] */
+
   /* First synthetic turbulence inlet: the Batten Method is used
      for boundary faces of zone "INLET_1" */
 
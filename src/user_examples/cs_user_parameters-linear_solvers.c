@@ -406,6 +406,19 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_viz_1] */
 
+  /* Example: automatic selection of default solver settings */
+  /*---------------------------------------------------------*/
+
+  /*! [sles_tuning_1] */
+  {
+    /* Try each candidate configuration for 3 resolutions of
+       systems using default settings, keep the fastest one, and
+       save the result for future runs of this case */
+
+    cs_sles_tuning_set_options(3, "../../DATA/sles_tuning.txt");
+  }
+  /*! [sles_tuning_1] */
+
   /* Example: change multigrid parameters for pressure */
   /*---------------------------------------------------*/
 
@@ -648,6 +648,12 @@ isepchemistry = 1
 ! dtchemmax: maximal time step (s) for chemistry resolution
 dtchemmax = 10.0d0
 
+! rtolchem, atolchem: relative and absolute tolerances for adaptive
+! chemistry sub-steps (of at most dtchemmax) in each cell.
+! If rtolchem is not positive (default), sub-steps of dtchemmax are used.
+rtolchem = 1.0d-3
+atolchem = 1.0d-6
+
 ! computation / storage of downward and upward infrared radiative fluxes
 irdu = 1
 
@@ -0,0 +1,148 @@
+/*============================================================================
+ * Unit test for cs_compress.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_compress.h"
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  const size_t n = 100000;
+  const double eps = 1e-6;
+
+  int retval = EXIT_SUCCESS;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  double *d, *d_r;
+  cs_gnum_t *g, *g_r;
+  unsigned char *buf;
+
+  BFT_MALLOC(d, n, double);
+  BFT_MALLOC(d_r, n, double);
+  BFT_MALLOC(g, n, cs_gnum_t);
+  BFT_MALLOC(g_r, n, cs_gnum_t);
+  BFT_MALLOC(buf, cs_compress_bound(CS_DOUBLE, n), unsigned char);
+
+  for (size_t i = 0; i < n; i++) {
+    d[i] = sin(i*1e-3) + 0.5*cos(i*3e-4);
+    g[i] = i*3 + 1;
+  }
+
+  /* Lossless compression of integer values */
+
+  size_t c_size = cs_compress_encode(CS_COMPRESS_LOSSLESS, 0., CS_GNUM_TYPE,
+                                     n, g, buf);
+  cs_compress_decode(CS_GNUM_TYPE, n, c_size, buf, g_r);
+
+  bft_printf("lossless (cs_gnum_t): %lu -> %lu bytes\n",
+             (unsigned long)(n*sizeof(cs_gnum_t)), (unsigned long)c_size);
+
+  if (memcmp(g, g_r, n*sizeof(cs_gnum_t)) != 0) {
+    bft_printf("  error: decoded values differ\n");
+    retval = EXIT_FAILURE;
+  }
+
+  /* Lossless compression of floating-point values */
+
+  c_size = cs_compress_encode(CS_COMPRESS_LOSSLESS, 0., CS_DOUBLE,
+                              n, d, buf);
+  cs_compress_decode(CS_DOUBLE, n, c_size, buf, d_r);
+
+  bft_printf("lossless (double): %lu -> %lu bytes\n",
+             (unsigned long)(n*sizeof(double)), (unsigned long)c_size);
+
+  if (memcmp(d, d_r, n*sizeof(double)) != 0) {
+    bft_printf("  error: decoded values differ\n");
+    retval = EXIT_FAILURE;
+  }
+
+  /* Error-bounded compression of floating-point values */
+
+  c_size = cs_compress_encode(CS_COMPRESS_QUANTIZE, eps, CS_DOUBLE,
+                              n, d, buf);
+  cs_compress_decode(CS_DOUBLE, n, c_size, buf, d_r);
+
+  double d_max = 0;
+  for (size_t i = 0; i < n; i++) {
+    double d_i = fabs(d[i] - d_r[i]);
+    if (d_i > d_max)
+      d_max = d_i;
+  }
+
+  bft_printf("quantized (double, eps = %g): %lu -> %lu bytes, "
+             "max. error %g\n",
+             eps, (unsigned long)(n*sizeof(double)), (unsigned long)c_size,
+             d_max);
+
+  if (d_max > eps) {
+    bft_printf("  error: error bound exceeded\n");
+    retval = EXIT_FAILURE;
+  }
+
+  /* In-place quantization */
+
+  memcpy(d_r, d, n*sizeof(double));
+  cs_compress_quantize(eps, CS_DOUBLE, n, d_r);
+
+  d_max = 0;
+  for (size_t i = 0; i < n; i++) {
+    double d_i = fabs(d[i] - d_r[i]);
+    if (d_i > d_max)
+      d_max = d_i;
+  }
+
+  bft_printf("in-place quantization (eps = %g): max. error %g\n", eps, d_max);
+
+  if (d_max > eps) {
+    bft_printf("  error: error bound exceeded\n");
+    retval = EXIT_FAILURE;
+  }
+
+  BFT_FREE(buf);
+  BFT_FREE(g_r);
+  BFT_FREE(g);
+  BFT_FREE(d_r);
+  BFT_FREE(d);
+
+  bft_mem_end();
+
+  return retval;
+}
@@ -0,0 +1,551 @@
+/*============================================================================
+ * Unit test for direct mesh import (cs_mesh_gmsh.c, cs_mesh_cgns.c,
+ * cs_mesh_med.c);
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_CGNS)
+#include <cgnslib.h>
+#endif
+
+#if defined(HAVE_MED)
+#include <med.h>
+#endif
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_parall.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_cgns.h"
+#include "cs_mesh_gmsh.h"
+#include "cs_mesh_med.h"
+
+/*---------------------------------------------------------------------------*/
+
+#if defined(HAVE_CGNS)
+#if !defined(CGNS_ENUMV)
+#define CGNS_ENUMV(e) e
+#endif
+#if CGNS_VERSION < 3100
+#define cgsize_t int
+#endif
+#endif
+
+/*---------------------------------------------------------------------------*/
+
+/* Test mesh: 2 hexahedra along x, with vertex (i, j, k) numbered
+   1 + i + 3*j + 6*k; cells belong to group "fluid", and boundary
+   faces at x = 0, x = 2, and z = 0 to groups "inlet", "outlet",
+   and "wall" respectively. */
+
+static const int _cell_vtx[2][8] = {{1, 2, 5, 4, 7, 8, 11, 10},
+                                    {2, 3, 6, 5, 8, 9, 12, 11}};
+
+static const int _face_vtx[4][4] = {{1, 4, 10, 7},
+                                    {3, 6, 12, 9},
+                                    {1, 2, 5, 4},
+                                    {2, 3, 6, 5}};
+
+static const char *_group_name[] = {"fluid", "inlet", "outlet", "wall"};
+
+/* Face group ids (in _group_name) */
+
+static const int _face_group[4] = {1, 2, 3, 3};
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_mesh_import_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+static int
+_bft_printf_flush_proxy(void)
+{
+  return fflush(NULL);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_num,
+                   int          sys_err_code,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  bft_printf_flush();
+
+  fprintf(stderr, "\n%s:%d: ", filename, line_num);
+
+  if (sys_err_code != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(sys_err_code));
+
+  vfprintf(stderr, format, arg_ptr);
+  fprintf(stderr, "\n");
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Abort(cs_glob_mpi_comm, EXIT_FAILURE);
+#endif
+
+  exit(EXIT_FAILURE);
+}
+
+/*----------------------------------------------------------------------------
+ * Write the test mesh to a Gmsh file.
+ *
+ * parameters:
+ *   path <-- file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_gmsh(const char  *path)
+{
+  FILE *f = fopen(path, "w");
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, 0, "Error opening file \"%s\"", path);
+
+  fprintf(f, "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n");
+
+  fprintf(f, "$PhysicalNames\n4\n");
+  fprintf(f, "3 1 \"%s\"\n", _group_name[0]);
+  for (int i = 1; i < 4; i++)
+    fprintf(f, "2 %d \"%s\"\n", i+1, _group_name[i]);
+  fprintf(f, "$EndPhysicalNames\n");
+
+  fprintf(f, "$Nodes\n12\n");
+  for (int v = 0; v < 12; v++)
+    fprintf(f, "%d %d %d %d\n", v+1, v%3, (v/3)%2, v/6);
+  fprintf(f, "$EndNodes\n");
+
+  fprintf(f, "$Elements\n6\n");
+  for (int i = 0; i < 4; i++)
+    fprintf(f, "%d 3 2 %d %d %d %d %d %d\n", i+1,
+            _face_group[i] + 1, i+1,
+            _face_vtx[i][0], _face_vtx[i][1],
+            _face_vtx[i][2], _face_vtx[i][3]);
+  for (int i = 0; i < 2; i++) {
+    fprintf(f, "%d 5 2 1 1", i+5);
+    for (int j = 0; j < 8; j++)
+      fprintf(f, " %d", _cell_vtx[i][j]);
+    fprintf(f, "\n");
+  }
+  fprintf(f, "$EndElements\n");
+
+  fclose(f);
+}
+
+#if defined(HAVE_CGNS)
+
+/*----------------------------------------------------------------------------
+ * Write the test mesh to a CGNS file.
+ *
+ * Boundary faces are defined in a single section, with groups
+ * defined by boundary conditions.
+ *
+ * parameters:
+ *   path <-- file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_cgns(const char  *path)
+{
+  int fn, B, Z, S, BC, C;
+  cgsize_t size[3] = {12, 2, 0};
+  double coords[3][12];
+  cgsize_t cell_vtx[16], face_vtx[16];
+
+  for (int v = 0; v < 12; v++) {
+    coords[0][v] = v%3;
+    coords[1][v] = (v/3)%2;
+    coords[2][v] = v/6;
+  }
+  for (int i = 0; i < 16; i++) {
+    cell_vtx[i] = _cell_vtx[i/8][i%8];
+    face_vtx[i] = _face_vtx[i/4][i%4];
+  }
+
+  if (cg_open(path, CG_MODE_WRITE, &fn) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0, "%s", cg_get_error());
+
+  cg_base_write(fn, "Base", 3, 3, &B);
+  cg_zone_write(fn, B, "Zone", size, CGNS_ENUMV(Unstructured), &Z);
+
+  cg_coord_write(fn, B, Z, CGNS_ENUMV(RealDouble), "CoordinateX",
+                 coords[0], &C);
+  cg_coord_write(fn, B, Z, CGNS_ENUMV(RealDouble), "CoordinateY",
+                 coords[1], &C);
+  cg_coord_write(fn, B, Z, CGNS_ENUMV(RealDouble), "CoordinateZ",
+                 coords[2], &C);
+
+  cg_section_write(fn, B, Z, _group_name[0], CGNS_ENUMV(HEXA_8),
+                   1, 2, 0, cell_vtx, &S);
+  cg_section_write(fn, B, Z, "boundary", CGNS_ENUMV(QUAD_4),
+                   3, 6, 0, face_vtx, &S);
+
+  cgsize_t inlet[2] = {3, 3}, outlet[1] = {4}, wall[2] = {5, 6};
+
+  cg_boco_write(fn, B, Z, _group_name[1], CGNS_ENUMV(BCInflow),
+                CGNS_ENUMV(ElementRange), 2, inlet, &BC);
+  cg_boco_write(fn, B, Z, _group_name[2], CGNS_ENUMV(BCOutflow),
+                CGNS_ENUMV(ElementList), 1, outlet, &BC);
+  cg_boco_write(fn, B, Z, _group_name[3], CGNS_ENUMV(BCWall),
+                CGNS_ENUMV(ElementRange), 2, wall, &BC);
+
+  if (cg_close(fn) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0, "%s", cg_get_error());
+}
+
+#endif /* defined(HAVE_CGNS) */
+
+#if defined(HAVE_MED)
+
+/*----------------------------------------------------------------------------
+ * Write the test mesh to a MED file.
+ *
+ * parameters:
+ *   path <-- file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_med(const char  *path)
+{
+  /* MED hexahedron vertex numbering, from local numbering */
+  const int hexa_perm[8] = {0, 3, 2, 1, 4, 7, 6, 5};
+
+  char axis_name[3*MED_SNAME_SIZE + 1], axis_unit[3*MED_SNAME_SIZE + 1];
+  char group[MED_LNAME_SIZE + 1];
+  med_float coords[36];
+  med_int cell_vtx[16], face_vtx[16];
+  med_int cell_family[2] = {-1, -1}, face_family[4];
+
+  memset(axis_name, ' ', 3*MED_SNAME_SIZE);
+  memset(axis_unit, ' ', 3*MED_SNAME_SIZE);
+  axis_name[0] = 'x'; axis_name[MED_SNAME_SIZE] = 'y';
+  axis_name[2*MED_SNAME_SIZE] = 'z';
+  axis_name[3*MED_SNAME_SIZE] = '\0';
+  axis_unit[3*MED_SNAME_SIZE] = '\0';
+
+  for (int v = 0; v < 12; v++) {
+    coords[v*3] = v%3;
+    coords[v*3 + 1] = (v/3)%2;
+    coords[v*3 + 2] = v/6;
+  }
+  for (int i = 0; i < 16; i++) {
+    cell_vtx[i] = _cell_vtx[i/8][hexa_perm[i%8]];
+    face_vtx[i] = _face_vtx[i/4][i%4];
+  }
+  for (int i = 0; i < 4; i++)
+    face_family[i] = -(_face_group[i] + 1);
+
+  med_idt fid = MEDfileOpen(path, MED_ACC_CREAT);
+  if (fid < 0)
+    bft_error(__FILE__, __LINE__, 0, "Error opening file \"%s\"", path);
+
+  MEDmeshCr(fid, "mesh", 3, 3, MED_UNSTRUCTURED_MESH, "test mesh", "s",
+            MED_SORT_DTIT, MED_CARTESIAN, axis_name, axis_unit);
+
+  MEDmeshNodeCoordinateWr(fid, "mesh", MED_NO_DT, MED_NO_IT, 0.,
+                          MED_FULL_INTERLACE, 12, coords);
+
+  MEDmeshElementConnectivityWr(fid, "mesh", MED_NO_DT, MED_NO_IT, 0.,
+                               MED_CELL, MED_HEXA8, MED_NODAL,
+                               MED_FULL_INTERLACE, 2, cell_vtx);
+  MEDmeshElementConnectivityWr(fid, "mesh", MED_NO_DT, MED_NO_IT, 0.,
+                               MED_CELL, MED_QUAD4, MED_NODAL,
+                               MED_FULL_INTERLACE, 4, face_vtx);
+
+  MEDfamilyCr(fid, "mesh", "FAMILY_0", 0, 0, "");
+  for (int i = 0; i < 4; i++) {
+    char family_name[MED_NAME_SIZE + 1];
+    snprintf(family_name, MED_NAME_SIZE, "FAMILY_%d", -(i+1));
+    memset(group, 0, MED_LNAME_SIZE + 1);
+    strncpy(group, _group_name[i], MED_LNAME_SIZE);
+    MEDfamilyCr(fid, "mesh", family_name, -(i+1), 1, group);
+  }
+
+  MEDmeshEntityFamilyNumberWr(fid, "mesh", MED_NO_DT, MED_NO_IT,
+                              MED_CELL, MED_HEXA8, 2, cell_family);
+  MEDmeshEntityFamilyNumberWr(fid, "mesh", MED_NO_DT, MED_NO_IT,
+                              MED_CELL, MED_QUAD4, 4, face_family);
+
+  MEDfileClose(fid);
+}
+
+#endif /* defined(HAVE_MED) */
+
+/*----------------------------------------------------------------------------
+ * Count elements belonging to a given group.
+ *
+ * parameters:
+ *   mesh     <-- mesh (for groups and families)
+ *   n_elts   <-- local number of elements
+ *   gc_id    <-- element group class ids (1 to n)
+ *   name     <-- group name
+ *
+ * returns:
+ *   global number of elements in group
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_n_group_elts(const cs_mesh_t  *mesh,
+              cs_lnum_t         n_elts,
+              const int         gc_id[],
+              const char       *name)
+{
+  cs_gnum_t count = 0;
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    int f_id = gc_id[i] - 1;
+    if (f_id < 0 || f_id >= mesh->n_families)
+      continue;
+    for (int j = 0; j < mesh->n_max_family_items; j++) {
+      int g_id = -mesh->family_item[j*mesh->n_families + f_id] - 1;
+      if (   g_id >= 0
+          && strcmp(mesh->group + mesh->group_idx[g_id], name) == 0)
+        count++;
+    }
+  }
+
+  cs_parall_counter(&count, 1);
+
+  return count;
+}
+
+/*----------------------------------------------------------------------------
+ * Read and check the test mesh.
+ *
+ * parameters:
+ *   path   <-- file name
+ *   reader <-- read function
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_and_check(const char  *path,
+                void        (*reader)(const char *,
+                                      cs_mesh_t *,
+                                      cs_mesh_builder_t *))
+{
+  cs_mesh_t *mesh;
+  BFT_MALLOC(mesh, 1, cs_mesh_t);
+  memset(mesh, 0, sizeof(cs_mesh_t));
+
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  reader(path, mesh, mb);
+
+  const cs_lnum_t n_cells
+    = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+  const cs_lnum_t n_faces
+    = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+  const cs_lnum_t n_vertices
+    = mb->vertex_bi.gnum_range[1] - mb->vertex_bi.gnum_range[0];
+
+  if (mesh->n_g_cells != 2 || mb->n_g_faces != 11 || mesh->n_g_vertices != 12)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: %llu cells, %llu faces, %llu vertices read\n"
+              "(2, 11, 12 expected)", path,
+              (unsigned long long)mesh->n_g_cells,
+              (unsigned long long)mb->n_g_faces,
+              (unsigned long long)mesh->n_g_vertices);
+
+  /* Coordinates */
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_gnum_t v = mb->vertex_bi.gnum_range[0] + i - 1;
+    double d = 0;
+    d += CS_ABS(mb->vertex_coords[i*3]     - (double)(v%3));
+    d += CS_ABS(mb->vertex_coords[i*3 + 1] - (double)((v/3)%2));
+    d += CS_ABS(mb->vertex_coords[i*3 + 2] - (double)(v/6));
+    if (d > 1e-12)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: wrong coordinates for vertex %llu", path,
+                (unsigned long long)(v+1));
+  }
+
+  /* Boundary faces (with a single adjacent cell) */
+
+  cs_gnum_t n_b_faces = 0;
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    if (mb->face_cells[i*2] == 0 || mb->face_cells[i*2 + 1] == 0)
+      n_b_faces++;
+  }
+  cs_parall_counter(&n_b_faces, 1);
+
+  /* Groups */
+
+  cs_gnum_t n_group_elts[4], n_ref[4] = {2, 1, 1, 2};
+
+  n_group_elts[0] = _n_group_elts(mesh, n_cells, mb->cell_gc_id,
+                                  _group_name[0]);
+  for (int i = 1; i < 4; i++)
+    n_group_elts[i] = _n_group_elts(mesh, n_faces, mb->face_gc_id,
+                                    _group_name[i]);
+
+  for (int i = 0; i < 4; i++) {
+    if (n_group_elts[i] != n_ref[i])
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: %llu elements in group \"%s\" (%llu expected)",
+                path, (unsigned long long)n_group_elts[i], _group_name[i],
+                (unsigned long long)n_ref[i]);
+  }
+
+  if (n_b_faces != 10)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: %llu boundary faces (10 expected)",
+              path, (unsigned long long)n_b_faces);
+
+  bft_printf("%s: %llu cells, %llu faces, %llu vertices, %d groups: OK\n",
+             path,
+             (unsigned long long)mesh->n_g_cells,
+             (unsigned long long)mb->n_g_faces,
+             (unsigned long long)mesh->n_g_vertices,
+             mesh->n_groups);
+
+  cs_mesh_builder_destroy(&mb);
+
+  BFT_FREE(mesh->group_idx);
+  BFT_FREE(mesh->group);
+  BFT_FREE(mesh->family_item);
+  BFT_FREE(mesh);
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int rank = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+#else
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#endif /* (HAVE_MPI) */
+
+  bft_error_handler_set(_bft_error_handler);
+  bft_printf_proxy_set(_bft_printf_proxy);
+  bft_printf_flush_proxy_set(_bft_printf_flush_proxy);
+
+  sprintf(mem_trace_name, "cs_mesh_import_test_mem.%d", rank);
+  bft_mem_init(mem_trace_name);
+
+  /* Gmsh */
+
+  if (rank == 0)
+    _write_gmsh("cs_mesh_import_test.msh");
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+  _read_and_check("cs_mesh_import_test.msh", cs_mesh_gmsh_read);
+  if (rank == 0)
+    remove("cs_mesh_import_test.msh");
+
+  /* CGNS and MED: round trip through the matching writer API */
+
+#if defined(HAVE_CGNS)
+  if (rank == 0)
+    _write_cgns("cs_mesh_import_test.cgns");
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+  _read_and_check("cs_mesh_import_test.cgns", cs_mesh_cgns_read);
+  if (rank == 0)
+    remove("cs_mesh_import_test.cgns");
+#endif
+
+#if defined(HAVE_MED)
+  if (rank == 0)
+    _write_med("cs_mesh_import_test.med");
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+  _read_and_check("cs_mesh_import_test.med", cs_mesh_med_read);
+  if (rank == 0)
+    remove("cs_mesh_import_test.med");
+#endif
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  exit (EXIT_SUCCESS);
+}
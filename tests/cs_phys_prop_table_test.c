@@ -0,0 +1,376 @@
+/*============================================================================
+ * Unit test for adaptive property tables (cs_phys_prop_table.c)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+
+#include "cs_phys_prop_table.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Number of evaluations of the test function on this rank */
+
+static unsigned long long _n_evals = 0;
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_phys_prop_table_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+static int
+_bft_printf_flush_proxy(void)
+{
+  return fflush(NULL);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_num,
+                   int          sys_err_code,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  bft_printf_flush();
+
+  fprintf(stderr, "\n%s:%d: ", filename, line_num);
+
+  if (sys_err_code != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(sys_err_code));
+
+  vfprintf(stderr, format, arg_ptr);
+  fprintf(stderr, "\n");
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Abort(cs_glob_mpi_comm, EXIT_FAILURE);
+#endif
+
+  exit(EXIT_FAILURE);
+}
+
+/*----------------------------------------------------------------------------
+ * Test property, mimicking a saturation line: smooth on each side of
+ * the curve y = 0.3 + 0.4 x^2, with a jump across it, and undefined
+ * (NaN) for x > 0.9 and y > 0.9.
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_f(cs_real_t  x,
+   cs_real_t  y)
+{
+  if (x > 0.9 && y > 0.9)
+    return NAN;
+  else if (y < 0.3 + 0.4*x*x)
+    return 1 + x + 2*y*y;
+  else
+    return 0.1*(1 + x*y) + exp(y);
+}
+
+static void
+_eval(void             *input,
+      cs_lnum_t         n_vals,
+      const cs_real_t   x[],
+      const cs_real_t   y[],
+      cs_real_t         val[])
+{
+  CS_UNUSED(input);
+
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    val[i] = _f(x[i], y[i]);
+
+  _n_evals += n_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Return total number of evaluations on all ranks since last call.
+ *----------------------------------------------------------------------------*/
+
+static unsigned long long
+_count_evals(void)
+{
+  unsigned long long n = _n_evals;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(&_n_evals, &n, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                  cs_glob_mpi_comm);
+#endif
+
+  _n_evals = 0;
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Check table values against the test property at a set of points.
+ *
+ * parameters:
+ *   t    <-- pointer to table structure
+ *   rtol <-- tolerance used to build table
+ *
+ * returns:
+ *   checksum of computed values
+ *----------------------------------------------------------------------------*/
+
+static double
+_check_table(const cs_phys_prop_table_t  *t,
+             cs_real_t                    rtol)
+{
+  const cs_lnum_t n = 40000;
+
+  cs_real_t *x, *y, *val;
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(y, n, cs_real_t);
+  BFT_MALLOC(val, n, cs_real_t);
+
+  /* Quasi-random points, including some outside the table bounds */
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    x[i] = fmod(i*0.7548776662466927, 1.) * 1.1 - 0.05;
+    y[i] = fmod(i*0.5698402909980532, 1.) * 1.1 - 0.05;
+  }
+
+  cs_phys_prop_table_compute(t, n, 1, 1, x, y, _eval, NULL, val);
+
+  cs_lnum_t n_nan = 0;
+  cs_real_t err_max = 0;
+  double checksum = 0;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_real_t v_e = _f(x[i], y[i]);
+    if (isnan(v_e)) {
+      if (! isnan(val[i]))
+        bft_error(__FILE__, __LINE__, 0,
+                  "Value at (%g, %g) should be undefined, not %g.",
+                  x[i], y[i], val[i]);
+      n_nan++;
+      continue;
+    }
+    cs_real_t err = CS_ABS(val[i] - v_e) / CS_ABS(v_e);
+    err_max = CS_MAX(err_max, err);
+    checksum += val[i];
+  }
+
+  bft_printf("  %d points (%d undefined), max. relative error: %8.2e\n",
+             (int)n, (int)n_nan, err_max);
+
+  /* The error estimate is based on grid midpoints, so allow for a
+     moderate margin */
+
+  if (err_max > 10*rtol)
+    bft_error(__FILE__, __LINE__, 0,
+              "Max. relative error %g exceeds 10 x tolerance (%g).",
+              err_max, rtol);
+
+  BFT_FREE(val);
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  return checksum;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int rank = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+#else
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#endif /* (HAVE_MPI) */
+
+  bft_error_handler_set(_bft_error_handler);
+  bft_printf_proxy_set(_bft_printf_proxy);
+  bft_printf_flush_proxy_set(_bft_printf_flush_proxy);
+
+  sprintf(mem_trace_name, "cs_phys_prop_table_test_mem.%d", rank);
+  bft_mem_init(mem_trace_name);
+
+  const cs_real_t bounds[4] = {0, 1, 0, 1};
+  const cs_real_t rtol = 1e-5;
+  const int n_max = 1025;
+  const char path[] = "cs_phys_prop_table_test.tab";
+  const char key[] = "test 1e-5 1025";
+
+  if (rank == 0)
+    remove(path);
+
+  /* Build table; refinement must remain local to the saturation line
+     and the boundary of the undefined region */
+
+  cs_phys_prop_table_t *t
+    = cs_phys_prop_table_build("test", bounds, rtol, n_max,
+                               path, key, _eval, NULL);
+
+  unsigned long long n_evals = _count_evals();
+  cs_lnum_t n_tiles = 0, n_exact = 0;
+  cs_real_t err = -1;
+  cs_phys_prop_table_get_info(t, &n_tiles, &n_exact, &err);
+
+  bft_printf("\nTable built with %llu evaluations:\n"
+             "  %d tiles (%d not interpolated), estimated error: %8.2e\n",
+             n_evals, (int)n_tiles, (int)n_exact, err);
+
+  if (n_evals > (unsigned long long)(n_max*n_max) / 2)
+    bft_error(__FILE__, __LINE__, 0,
+              "Too many evaluations (%llu) for local refinement.", n_evals);
+
+  if (n_exact < 1 || err > rtol)
+    bft_error(__FILE__, __LINE__, 0,
+              "Tiles across the saturation line should not be interpolated\n"
+              "(%d exact tiles, estimated error %g).",
+              (int)n_exact, err);
+
+  double checksum = _check_table(t, rtol);
+
+  /* All ranks must have identical tables */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double c[2] = {-checksum, checksum};
+    MPI_Allreduce(MPI_IN_PLACE, c, 2, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+    if (-c[0] < c[1])
+      bft_error(__FILE__, __LINE__, 0,
+                "Tables differ between ranks (checksums %.17g to %.17g).",
+                -c[0], c[1]);
+  }
+#endif
+
+  _count_evals();
+
+  cs_phys_prop_table_destroy(&t);
+
+  /* Read table from cache */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  t = cs_phys_prop_table_build("test", bounds, rtol, n_max,
+                               path, key, _eval, NULL);
+
+  n_evals = _count_evals();
+  bft_printf("\nTable read from cache with %llu evaluations.\n", n_evals);
+
+  if (n_evals > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Table was not read from cache.");
+
+  double checksum_c = _check_table(t, rtol);
+
+  if (checksum_c < checksum || checksum_c > checksum)
+    bft_error(__FILE__, __LINE__, 0,
+              "Table read from cache differs (checksums %.17g and %.17g).",
+              checksum, checksum_c);
+
+  cs_phys_prop_table_destroy(&t);
+
+  /* A different key must lead to a rebuild */
+
+  t = cs_phys_prop_table_build("test", bounds, rtol, n_max,
+                               path, "other key", _eval, NULL);
+
+  n_evals = _count_evals();
+  if (n_evals < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              "Table with different key was read from cache.");
+
+  cs_phys_prop_table_destroy(&t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  if (rank == 0)
+    remove(path);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  exit (EXIT_SUCCESS);
+}